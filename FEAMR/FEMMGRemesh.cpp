@@ -361,19 +361,21 @@ bool FEMMGRemesh::MMG::build_mmg_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMe
 		}
 	}
 
+	// apply the sizing function to all element values at once
+	int nsel = (int)elemList.size();
+	vector<double> elemValue(nsel), elemScale(nsel);
+	for (int i = 0; i < nsel; ++i) elemValue[i] = elemScale[i] = elemList[i].m_elemValue;
+	FEFunction1D* fs = m_mmgRemesh->m_sfunc;
+	if (fs && (nsel > 0)) fs->values(nsel, &elemValue[0], &elemScale[0]);
+
 	// map to nodal data
 	vector<int> tag(NN, 0);
-	for (int i = 0; i < (int)elemList.size(); ++i)
+	for (int i = 0; i < nsel; ++i)
 	{
 		FEElement& el = *mesh.FindElementFromID(elemList[i].m_elementId);
 		for (int j = 0; j < el.Nodes(); ++j)
 		{
-			double s = elemList[i].m_elemValue;
-			FEFunction1D* fs = m_mmgRemesh->m_sfunc;
-			if (fs)
-			{
-				s = fs->value(s);
-			}
+			double s = elemScale[i];
 			assert(s > 0.0);
 			if (s <= 0.0) return false;
 			nodeScale[el.m_node[j]] += s;
@@ -500,7 +502,7 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 		node.m_r0 = nodePos0[i];
 		node.m_rt = nodePos[i];
 		if (m_mmgRemesh->m_nsdim == 2) node.m_rt.z = node.m_r0.z;
-		for (int j = 0; j < node.m_ID.size(); ++j) {
+		for (int j = 0; j < node.dofs(); ++j) {
 			node.set(j, nodeVal[i][j]);
 		}
 		node.UpdateValues();
@@ -50,7 +50,7 @@ FEBinghamFluid::FEBinghamFluid(FEModel* pfem) : FEViscousFluid(pfem)
 //! viscous stress
 mat3ds FEBinghamFluid::Stress(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double mu = ShearViscosity(pt);
     
@@ -70,7 +70,7 @@ mat3ds FEBinghamFluid::Tangent_Strain(FEMaterialPoint& mp)
 //! tangent of stress with respect to rate of deformation tensor D
 tens4ds FEBinghamFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     tens4ds c;
@@ -92,7 +92,7 @@ tens4ds FEBinghamFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 //! dynamic viscosity
 double FEBinghamFluid::ShearViscosity(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double mu = (gdot > 0) ? m_mu + m_tauy/gdot*(1-exp(-m_n*gdot)) : m_mu + m_tauy*m_n;
@@ -66,8 +66,8 @@ double FELogElemFluidPosX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* pt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
-        FEElasticMaterialPoint* ept = el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEFluidMaterialPoint* pt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
+        FEElasticMaterialPoint* ept = el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         if (pt) val += pt->m_r0.x;
         else if (ept) val += ept->m_rt.x;
     }
@@ -81,8 +81,8 @@ double FELogElemFluidPosY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* pt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
-        FEElasticMaterialPoint* ept = el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEFluidMaterialPoint* pt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
+        FEElasticMaterialPoint* ept = el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         if (pt) val += pt->m_r0.y;
         else if (ept) val += ept->m_rt.y;
     }
@@ -96,8 +96,8 @@ double FELogElemFluidPosZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* pt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
-        FEElasticMaterialPoint* ept = el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEFluidMaterialPoint* pt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
+        FEElasticMaterialPoint* ept = el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         if (pt) val += pt->m_r0.z;
         else if (ept) val += ept->m_rt.z;
     }
@@ -111,7 +111,7 @@ double FELogElasticFluidPressure::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+		FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
 		if (ppt) val += ppt->m_pf;
 	}
 	return val / (double) nint;
@@ -124,7 +124,7 @@ double FELogFluidVolumeRatio::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_ef + 1;
     }
     return val / (double) nint;
@@ -156,7 +156,7 @@ double FELogFluidStressPower::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += (ppt->m_sf*ppt->m_Lf).trace();
     }
     return val / (double) nint;
@@ -169,7 +169,7 @@ double FELogFluidVelocityX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_vft.x;
     }
     return val / (double) nint;
@@ -182,7 +182,7 @@ double FELogFluidVelocityY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_vft.y;
     }
     return val / (double) nint;
@@ -195,7 +195,7 @@ double FELogFluidVelocityZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_vft.z;
     }
     return val / (double) nint;
@@ -208,7 +208,7 @@ double FELogFluidAccelerationX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_aft.x;
     }
     return val / (double) nint;
@@ -221,7 +221,7 @@ double FELogFluidAccelerationY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_aft.y;
     }
     return val / (double) nint;
@@ -234,7 +234,7 @@ double FELogFluidAccelerationZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_aft.z;
     }
     return val / (double) nint;
@@ -247,7 +247,7 @@ double FELogFluidVorticityX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->Vorticity().x;
     }
     return val / (double) nint;
@@ -260,7 +260,7 @@ double FELogFluidVorticityY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->Vorticity().y;
     }
     return val / (double) nint;
@@ -273,7 +273,7 @@ double FELogFluidVorticityZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->Vorticity().z;
     }
     return val / (double) nint;
@@ -286,7 +286,7 @@ double FELogFluidStressXX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_sf.xx();
     }
     return val / (double) nint;
@@ -299,7 +299,7 @@ double FELogFluidStressYY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_sf.yy();
     }
     return val / (double) nint;
@@ -312,7 +312,7 @@ double FELogFluidStressZZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_sf.zz();
     }
     return val / (double) nint;
@@ -325,7 +325,7 @@ double FELogFluidStressXY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_sf.xy();
     }
     return val / (double) nint;
@@ -338,7 +338,7 @@ double FELogFluidStressYZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_sf.yz();
     }
     return val / (double) nint;
@@ -351,7 +351,7 @@ double FELogFluidStressXZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) val += ppt->m_sf.xz();
     }
     return val / (double) nint;
@@ -364,7 +364,7 @@ double FELogFluidRateOfDefXX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) {
             mat3ds D = ppt->RateOfDeformation();
             val += D.xx();
@@ -380,7 +380,7 @@ double FELogFluidRateOfDefYY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) {
             mat3ds D = ppt->RateOfDeformation();
             val += D.yy();
@@ -396,7 +396,7 @@ double FELogFluidRateOfDefZZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) {
             mat3ds D = ppt->RateOfDeformation();
             val += D.zz();
@@ -412,7 +412,7 @@ double FELogFluidRateOfDefXY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) {
             mat3ds D = ppt->RateOfDeformation();
             val += D.xy();
@@ -428,7 +428,7 @@ double FELogFluidRateOfDefYZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) {
             mat3ds D = ppt->RateOfDeformation();
             val += D.yz();
@@ -444,7 +444,7 @@ double FELogFluidRateOfDefXZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEFluidMaterialPoint>();
         if (ppt) {
             mat3ds D = ppt->RateOfDeformation();
             val += D.xz();
@@ -196,7 +196,7 @@ bool FEPlotFluidSurfaceForce::Save(FESurface &surf, FEDataStream &a)
                 for (int n=0; n<nint; ++n)
                 {
                     FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-                    FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+                    FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
                     s += pt.m_sf;
                 }
                 s /= nint;
@@ -291,7 +291,7 @@ bool FEPlotFluidSurfaceTractionPower::Save(FESurface &surf, FEDataStream &a)
                 for (int n=0; n<nint; ++n)
                 {
                     FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-                    FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+                    FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
                     s += pt.m_vft*(pt.m_sf*m_area[j]);
                 }
                 s /= nint;
@@ -352,7 +352,7 @@ bool FEPlotFluidSurfaceEnergyFlux::Save(FESurface &surf, FEDataStream &a)
                 for (int n=0; n<nint; ++n)
                 {
                     FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-                    FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+                    FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
                     s += pfluid->EnergyDensity(mp)*(pt.m_vft*m_area[j]);
                 }
                 s /= nint;
@@ -474,7 +474,7 @@ bool FEPlotFluidFlowRate::Save(FESurface &surf, FEDataStream &a)
 			for (int n = 0; n<nint; ++n)
 			{
 				FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-				FEFluidMaterialPoint* ptf = mp.ExtractData<FEFluidMaterialPoint>();
+				FEFluidMaterialPoint* ptf = mp.GetData<FEFluidMaterialPoint>();
 				if (ptf) w += ptf->m_vft / (ptf->m_ef + 1);
 			}
 			w /= nint;
@@ -501,7 +501,7 @@ bool FEPlotFluidPressure::Save(FEDomain &dom, FEDataStream& a)
 	if (pfluid == 0) return false;
 
 	writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* pt = (mp.ExtractData<FEFluidMaterialPoint>());
+		const FEFluidMaterialPoint* pt = (mp.GetData<FEFluidMaterialPoint>());
 		return (pt ? pt->m_pf : 0.0);
 	});
 	return true;
@@ -515,7 +515,7 @@ bool FEPlotElasticFluidPressure::Save(FEDomain &dom, FEDataStream& a)
     if (pfluid == 0) return false;
     
 	writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* pt = (mp.ExtractData<FEFluidMaterialPoint>());
+		const FEFluidMaterialPoint* pt = (mp.GetData<FEFluidMaterialPoint>());
 		return (pt ? pt->m_pf : 0.0);
 	});
     return true;
@@ -706,7 +706,7 @@ bool FEPlotFluidVelocity::Save(FEDomain &dom, FEDataStream& a)
 
     // write solid element data
 	writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* ppt = mp.ExtractData<FEFluidMaterialPoint>();
+		const FEFluidMaterialPoint* ppt = mp.GetData<FEFluidMaterialPoint>();
 		return (ppt ? ppt->m_vft : vec3d(0.));
 	});
 
@@ -720,8 +720,8 @@ bool FEPlotRelativeFluidVelocity::Save(FEDomain &dom, FEDataStream& a)
     if (pfluid == 0) return false;
     
     writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-        const FEFluidMaterialPoint* fpt = mp.ExtractData<FEFluidMaterialPoint>();
-        const FEElasticMaterialPoint* ept = mp.ExtractData<FEElasticMaterialPoint>();
+        const FEFluidMaterialPoint* fpt = mp.GetData<FEFluidMaterialPoint>();
+        const FEElasticMaterialPoint* ept = mp.GetData<FEElasticMaterialPoint>();
         return (fpt ? fpt->m_vft - ept->m_v : vec3d(0.0));
     });
     
@@ -763,7 +763,7 @@ bool FEPlotFSIFluidFlux::Save(FEDomain &dom, FEDataStream& a)
 	if (pfluid == 0) return false;
 
 	writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFSIMaterialPoint* ppt = mp.ExtractData<FEFSIMaterialPoint>();
+		const FEFSIMaterialPoint* ppt = mp.GetData<FEFSIMaterialPoint>();
         return (ppt ? ppt->m_w : vec3d(0.0));
 	});
     
@@ -789,7 +789,7 @@ bool FEPlotGradJ::Save(FEDomain &dom, FEDataStream& a)
     if (pbfsi == 0) return false;
     
     writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-        const FEBiphasicFSIMaterialPoint* bpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+        const FEBiphasicFSIMaterialPoint* bpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
         return (bpt ? bpt->m_gradJ : vec3d(0.0));
     });
     
@@ -818,7 +818,7 @@ bool FEPlotFluidAcceleration::Save(FEDomain &dom, FEDataStream& a)
 
     // write solid element data
 	writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* ppt = mp.ExtractData<FEFluidMaterialPoint>();
+		const FEFluidMaterialPoint* ppt = mp.GetData<FEFluidMaterialPoint>();
 		return (ppt ? ppt->m_aft : vec3d(0.));
 	});
     
@@ -833,7 +833,7 @@ bool FEPlotFluidVorticity::Save(FEDomain &dom, FEDataStream& a)
 
     // write solid element data
 	writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* ppt = mp.ExtractData<FEFluidMaterialPoint>();
+		const FEFluidMaterialPoint* ppt = mp.GetData<FEFluidMaterialPoint>();
 		return (ppt ? ppt->Vorticity() : vec3d(0.));
 	});
     
@@ -848,7 +848,7 @@ bool FEPlotFluidHeatFlux::Save(FEDomain &dom, FEDataStream& a)
 
     // write solid element data
     writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-        const FEThermoFluidMaterialPoint* ppt = mp.ExtractData<FEThermoFluidMaterialPoint>();
+        const FEThermoFluidMaterialPoint* ppt = mp.GetData<FEThermoFluidMaterialPoint>();
         return (ppt ? ppt->m_q : vec3d(0.));
     });
     
@@ -864,7 +864,7 @@ bool FEPlotFluidStress::Save(FEDomain& dom, FEDataStream& a)
 
     // write solid element data
 	writeAverageElementValue<mat3ds>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* ppt = mp.ExtractData<FEFluidMaterialPoint>();
+		const FEFluidMaterialPoint* ppt = mp.GetData<FEFluidMaterialPoint>();
 		return (ppt ? ppt->m_sf : mat3ds(0.));
 	});
     
@@ -880,7 +880,7 @@ bool FEPlotElementFluidRateOfDef::Save(FEDomain& dom, FEDataStream& a)
 
     // write solid element data
 	writeAverageElementValue<mat3ds>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* ppt = mp.ExtractData<FEFluidMaterialPoint>();
+		const FEFluidMaterialPoint* ppt = mp.GetData<FEFluidMaterialPoint>();
 		return (ppt ? ppt->RateOfDeformation() : mat3ds(0.));
 	});
     
@@ -895,7 +895,7 @@ bool FEPlotFluidStressPowerDensity::Save(FEDomain &dom, FEDataStream& a)
 
     // write solid element data
 	writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEFluidMaterialPoint* ppt = mp.ExtractData<FEFluidMaterialPoint>();
+		const FEFluidMaterialPoint* ppt = mp.GetData<FEFluidMaterialPoint>();
 		return (ppt ? (ppt->m_sf*ppt->m_Lf).trace() : 0.0);
 	});
 
@@ -911,7 +911,7 @@ bool FEPlotFluidHeatSupplyDensity::Save(FEDomain &dom, FEDataStream& a)
     // write solid element data
 	writeAverageElementValue<double>(dom, a, [=](const FEMaterialPoint& mp) {
 		FEMaterialPoint& mp_noconst = const_cast<FEMaterialPoint&>(mp);
-		FEFluidMaterialPoint* ppt = (mp_noconst.ExtractData<FEFluidMaterialPoint>());
+		FEFluidMaterialPoint* ppt = (mp_noconst.GetData<FEFluidMaterialPoint>());
 		return (ppt ? -(pfluid->GetViscous()->Stress(mp_noconst)*ppt->m_Lf).trace() : 0.0);
 	});
     
@@ -1036,7 +1036,7 @@ bool FEPlotFluidElementCenterOfMass::Save(FEDomain &dom, FEDataStream& a)
 			double m = 0;
 			for (int j=0; j<el.GaussPoints(); ++j)
 			{
-				FEFluidMaterialPoint& pt = *(el.GetMaterialPoint(j)->ExtractData<FEFluidMaterialPoint>());
+				FEFluidMaterialPoint& pt = *(el.GetMaterialPoint(j)->GetData<FEFluidMaterialPoint>());
 				double detJ = bd.detJ0(el, j)*gw[j];
 				ew += pt.m_r0*(dens*detJ);
 				m += dens*detJ;
@@ -1060,7 +1060,7 @@ bool FEPlotFluidElementLinearMomentum::Save(FEDomain &dom, FEDataStream& a)
         FESolidDomain& bd = static_cast<FESolidDomain&>(dom);
 		writeIntegratedElementValue<vec3d>(bd, a, [=](const FEMaterialPoint& mp) {
 			double dens = pfluid->m_rhor;
-			const FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+			const FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
 			return pt.m_vft*dens;
 		});
         return true;
@@ -1079,7 +1079,7 @@ bool FEPlotFluidElementAngularMomentum::Save(FEDomain &dom, FEDataStream& a)
 		FESolidDomain& bd = static_cast<FESolidDomain&>(dom);
 		writeIntegratedElementValue<vec3d>(bd, a, [=](const FEMaterialPoint& mp) {
 			double dens = pfluid->m_rhor;
-			const FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+			const FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
 			return pt.m_vft*dens;
 		});
 		return true;
@@ -1224,7 +1224,7 @@ bool FEPlotFSISolidStress::Save(FEDomain& dom, FEDataStream& a)
     {
         FESolidDomain& sd = static_cast<FESolidDomain&>(dom);
         writeAverageElementValue<mat3ds>(sd, a, [](const FEMaterialPoint& mp) {
-            const FEFSIMaterialPoint* pt = (mp.ExtractData<FEFSIMaterialPoint>());
+            const FEFSIMaterialPoint* pt = (mp.GetData<FEFSIMaterialPoint>());
             return (pt ? pt->m_ss : mat3ds(0.0));
         });
         return true;
@@ -1242,7 +1242,7 @@ bool FEPlotFluidShearStressError::Save(FEDomain& dom, FEDataStream& a)
 	if (dom.Class() == FE_DOMAIN_SOLID)
 	{
 		writeRelativeError(dom, a, [](FEMaterialPoint& mp) {
-			FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+			FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
 			mat3ds s = fp.m_sf;
 			double v = s.max_shear();
 			return v;
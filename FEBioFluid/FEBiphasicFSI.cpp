@@ -123,8 +123,8 @@ double FEBiphasicFSI::Porosity(FEMaterialPoint& pt)
 //! Solid Volume Frac (1 - porosity) in current configuration
 double FEBiphasicFSI::SolidVolumeFrac(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
     
     // relative volume
     double J = et.m_J;
@@ -141,8 +141,8 @@ double FEBiphasicFSI::SolidVolumeFrac(FEMaterialPoint& pt)
 //! porosity gradient
 vec3d FEBiphasicFSI::gradPorosity(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
 
     double J = et.m_J;
     double phis = SolidVolumeFrac(pt);
@@ -154,8 +154,8 @@ vec3d FEBiphasicFSI::gradPorosity(FEMaterialPoint& pt)
 //! porosity gradient
 vec3d FEBiphasicFSI::gradPhifPhis(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
     
     double phisr = SolidReferentialVolumeFraction(pt);
     
@@ -171,7 +171,7 @@ vec3d FEBiphasicFSI::gradPhifPhis(FEMaterialPoint& pt)
 //! Solid referential apparent density
 double FEBiphasicFSI::SolidReferentialApparentDensity(FEMaterialPoint& pt)
 {
-    FEBiphasicFSIMaterialPoint& pet = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& pet = *pt.GetData<FEBiphasicFSIMaterialPoint>();
     
     // evaluate referential apparent density of base solid
     double density = TrueSolidDensity(pt);
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEBioFSI.h"
 #include "FEFluidFSI.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -111,7 +112,7 @@ void FEBiphasicFSIDomain3D::Reset()
     
     // initialize all element data
     ForEachMaterialPoint([=](FEMaterialPoint& mp) {
-        FEBiphasicFSIMaterialPoint& pt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& pt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
         
         // initialize referential solid volume fraction
         pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -144,8 +145,8 @@ void FEBiphasicFSIDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
                 rt = el.Evaluate(xt, j);
                 
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-                FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+                FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+                FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
                 et.m_Wp = et.m_Wt;
                 
                 if ((pt.m_ef <= -1) || (et.m_J <= 0)) {
@@ -168,7 +169,7 @@ void FEBiphasicFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[7*i  ] = id[m_dofU[0]];
@@ -191,7 +192,7 @@ void FEBiphasicFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the displacement dofs
             lm[7*i  ] = id[m_dofSU[0]];
@@ -209,8 +210,9 @@ void FEBiphasicFSIDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo&
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -260,10 +262,10 @@ void FEBiphasicFSIDomain3D::ElementInternalForce(FESolidElement& el, vector<doub
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFSIMaterialPoint& ft = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFSIMaterialPoint& ft = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
         
         // calculate the jacobian
         detJ = invjact(el, Ji, n, tp.alphaf)*gw[n];
@@ -331,8 +333,9 @@ void FEBiphasicFSIDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp, F
         FESolidElement& el = m_Elem[i];
         
         if (el.isActive()) {
-            vector<double> fe;
-            vector<int> lm;
+            FEElementWorkspace& ws = ElementWorkspace();
+            vector<double>& fe = ws.ForceVector();
+            vector<int>& lm = ws.LM();
             
             // get the element force vector and initialize it to zero
             int ndof = 7*el.Nodes();
@@ -416,7 +419,7 @@ void FEBiphasicFSIDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidEl
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double Jf = 1 + pt.m_ef;
         
         // calculate the jacobian
@@ -531,10 +534,10 @@ void FEBiphasicFSIDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, con
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFSIMaterialPoint& fpt = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFSIMaterialPoint& fpt = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bpt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
 
         // get the tangents
@@ -646,7 +649,8 @@ void FEBiphasicFSIDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo
         
         if (el.isActive()) {
             // element stiffness matrix
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = 7*el.Nodes();
@@ -657,7 +661,7 @@ void FEBiphasicFSIDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo
             ElementStiffness(el, ke, tp);
             
             // get the element's LM vector
-            vector<int> lm;
+            vector<int>& lm = ws.LM();
             UnpackLM(el, lm);
             ke.SetIndices(lm);
             
@@ -679,7 +683,8 @@ void FEBiphasicFSIDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         
         if (el.isActive()) {
             
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = 7*el.Nodes();
@@ -690,7 +695,7 @@ void FEBiphasicFSIDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
             ElementMassMatrix(el, ke, tp);
             
             // get the element's LM vector
-            vector<int> lm;
+            vector<int>& lm = ws.LM();
             UnpackLM(el, lm);
             ke.SetIndices(lm);
             
@@ -714,7 +719,8 @@ void FEBiphasicFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeI
         if (el.isActive()) {
             
             // element stiffness matrix
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = 7*el.Nodes();
@@ -725,7 +731,7 @@ void FEBiphasicFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeI
             ElementBodyForceStiffness(bf, el, ke, tp);
             
             // get the element's LM vector
-            vector<int> lm;
+            vector<int>& lm = ws.LM();
             UnpackLM(el, lm);
             ke.SetIndices(lm);
             
@@ -793,10 +799,10 @@ void FEBiphasicFSIDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke, co
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFSIMaterialPoint& fpt = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFSIMaterialPoint& fpt = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bpt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
 
         double denss = m_pMat->SolidDensity(mp);
@@ -946,10 +952,10 @@ void FEBiphasicFSIDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFSIMaterialPoint& ft = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFSIMaterialPoint& ft = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
 
         // elastic material point data
         ept.m_r0 = el.Evaluate(r0, n);
@@ -1019,8 +1025,9 @@ void FEBiphasicFSIDomain3D::InertialForces(FEGlobalVector& R, const FETimeInfo&
         
         if (el.isActive()) {
             // element force vector
-            vector<double> fe;
-            vector<int> lm;
+            FEElementWorkspace& ws = ElementWorkspace();
+            vector<double>& fe = ws.ForceVector();
+            vector<int>& lm = ws.LM();
             
             // get the element force vector and initialize it to zero
             int ndof = 7*el.Nodes();
@@ -1057,8 +1064,8 @@ void FEBiphasicFSIDomain3D::ElementInertialForce(FESolidElement& el, vector<doub
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
         double densTf = m_pMat->TrueFluidDensity(mp);
         double densTs = m_pMat->TrueSolidDensity(mp);
         double phis = m_pMat->SolidVolumeFrac(mp);
@@ -225,8 +225,8 @@ void FEBiphasicFSITraction::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo
         for (int n = 0; n<pint; ++n)
         {
             FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-            FEElasticMaterialPoint& ep = *(mp.ExtractData<FEElasticMaterialPoint>());
-            FEBiphasicFSIMaterialPoint& ft = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+            FEElasticMaterialPoint& ep = *(mp.GetData<FEElasticMaterialPoint>());
+            FEBiphasicFSIMaterialPoint& ft = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
             sv += pfsi->Fluid()->GetViscous()->Stress(mp);
             svJ += pfsi->Fluid()->GetViscous()->Tangent_Strain(mp);
             cv += pfsi->Fluid()->Tangent_RateOfDeformation(mp);
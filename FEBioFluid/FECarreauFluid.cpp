@@ -52,7 +52,7 @@ FECarreauFluid::FECarreauFluid(FEModel* pfem) : FEViscousFluid(pfem)
 //! viscous stress
 mat3ds FECarreauFluid::Stress(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double mu = ShearViscosity(pt);
     
@@ -72,7 +72,7 @@ mat3ds FECarreauFluid::Tangent_Strain(FEMaterialPoint& mp)
 //! tangent of stress with respect to rate of deformation tensor D
 tens4ds FECarreauFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamg2 = m_lam*m_lam*gdot*gdot;
@@ -88,7 +88,7 @@ tens4ds FECarreauFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 //! dynamic viscosity
 double FECarreauFluid::ShearViscosity(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double mu = m_mui + (m_mu0 - m_mui)*pow(1+m_lam*m_lam*gdot*gdot, (m_n-1)*0.5);
@@ -54,7 +54,7 @@ FECarreauYasudaFluid::FECarreauYasudaFluid(FEModel* pfem) : FEViscousFluid(pfem)
 //! viscous stress
 mat3ds FECarreauYasudaFluid::Stress(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double mu = ShearViscosity(pt);
     
@@ -74,7 +74,7 @@ mat3ds FECarreauYasudaFluid::Tangent_Strain(FEMaterialPoint& mp)
 //! tangent of stress with respect to rate of deformation tensor D
 tens4ds FECarreauYasudaFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamga = pow(m_lam*gdot,m_a);
@@ -91,7 +91,7 @@ tens4ds FECarreauYasudaFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 //! dynamic viscosity
 double FECarreauYasudaFluid::ShearViscosity(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamga = pow(m_lam*gdot,m_a);
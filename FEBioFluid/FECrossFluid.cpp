@@ -52,7 +52,7 @@ FECrossFluid::FECrossFluid(FEModel* pfem) : FEViscousFluid(pfem)
 //! viscous stress
 mat3ds FECrossFluid::Stress(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double mu = ShearViscosity(pt);
     
@@ -72,7 +72,7 @@ mat3ds FECrossFluid::Tangent_Strain(FEMaterialPoint& mp)
 //! tangent of stress with respect to rate of deformation tensor D
 tens4ds FECrossFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamg = m_lam*gdot;
@@ -88,7 +88,7 @@ tens4ds FECrossFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 //! dynamic viscosity
 double FECrossFluid::ShearViscosity(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamg = m_lam*gdot;
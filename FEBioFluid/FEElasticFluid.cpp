@@ -37,7 +37,7 @@ double FEElasticFluid::SpecificInternalEnergy(FEMaterialPoint& mp)
 {
     double Tr =  GetFEModel()->GetGlobalConstant("T");
 
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = tf.m_T + Tr;
 
     double u = SpecificFreeEnergy(mp) + T*SpecificEntropy(mp);
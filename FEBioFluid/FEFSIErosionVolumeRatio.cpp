@@ -84,7 +84,7 @@ bool FEFSIErosionVolumeRatio::Apply(int iteration)
                     for (int n = 0; n < nint; ++n)
                     {
                         FEMaterialPoint* mp = el.GetMaterialPoint(n);
-                        FEElasticMaterialPoint* ep = mp->ExtractData<FEElasticMaterialPoint>();
+                        FEElasticMaterialPoint* ep = mp->GetData<FEElasticMaterialPoint>();
                         if (ep)
                         {
                             mat3ds C = ep->RightCauchyGreen();
@@ -132,7 +132,7 @@ bool FEFSIErosionVolumeRatio::Apply(int iteration)
                         for (int n = 0; n < nint; ++n)
                         {
                             FEMaterialPoint* mp = el.GetMaterialPoint(n);
-                            FEElasticMaterialPoint* ep = mp->ExtractData<FEElasticMaterialPoint>();
+                            FEElasticMaterialPoint* ep = mp->GetData<FEElasticMaterialPoint>();
                             
                             // get the deformation gradient and determinant at intermediate time
                             double Jt;
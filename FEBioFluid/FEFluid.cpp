@@ -87,7 +87,7 @@ FEMaterialPoint* FEFluid::CreateMaterialPointData()
 //! bulk modulus
 double FEFluid::BulkModulus(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& vt = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *mp.GetData<FEFluidMaterialPoint>();
     return -(vt.m_ef+1)*Tangent_Pressure_Strain(mp);
 }
 
@@ -152,7 +152,7 @@ mat3ds FEFluid::Tangent_Strain(FEMaterialPoint& mp)
 //! calculate strain energy density (per reference volume)
 double FEFluid::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double sed = m_k*(fp.m_ef-log(fp.m_ef+1));
     return sed;
 }
@@ -35,6 +35,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include <FECore/FELinearSystem.h>
 #include "FEBioFluid.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -145,7 +146,7 @@ void FEFluidDomain2D::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int j=0; j<n; ++j)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+            FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
             pt.m_r0 = el.Evaluate(x0, j);
             
             if (pt.m_ef <= -1) {
@@ -166,8 +167,9 @@ void FEFluidDomain2D::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEElement2D& el = m_Elem[i];
@@ -214,7 +216,7 @@ void FEFluidDomain2D::ElementInternalForce(FEElement2D& el, vector<double>& fe)
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // calculate the jacobian
         detJ = invjac0(el, Ji, n)*gw[n];
@@ -260,8 +262,9 @@ void FEFluidDomain2D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp, FEBodyF
 #pragma omp parallel for
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEElement2D& el = m_Elem[i];
@@ -305,7 +308,7 @@ void FEFluidDomain2D::ElementBodyForce(FEBodyForce& BF, FEElement2D& el, vector<
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double dens = m_pMat->Density(mp);
         
         pt.m_r0 = el.Evaluate(r0, n);
@@ -346,7 +349,7 @@ void FEFluidDomain2D::ElementBodyForceStiffness(FEBodyForce& BF, FEElement2D &el
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         
         // calculate the jacobian
         detJ = detJ0(el, n)*gw[n];
@@ -414,7 +417,7 @@ void FEFluidDomain2D::ElementMaterialStiffness(FEElement2D &el, matrix &ke)
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // get the tangents
         double dpdJ = m_pMat->Tangent_Pressure_Strain(mp);
@@ -463,7 +466,8 @@ void FEFluidDomain2D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FEElement2D& el = m_Elem[iel];
 
         // element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 
         // create the element's stiffness matrix
         int ndof = 3*el.Nodes();
@@ -474,7 +478,7 @@ void FEFluidDomain2D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementMaterialStiffness(el, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -495,7 +499,8 @@ void FEFluidDomain2D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FEElement2D& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 3*el.Nodes();
@@ -506,7 +511,7 @@ void FEFluidDomain2D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementMassMatrix(el, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -529,7 +534,8 @@ void FEFluidDomain2D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo& t
 		FEElement2D& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 3*el.Nodes();
@@ -540,7 +546,7 @@ void FEFluidDomain2D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo& t
         ElementBodyForceStiffness(bf, el, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -601,7 +607,7 @@ void FEFluidDomain2D::ElementMassMatrix(FEElement2D& el, matrix& ke)
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
 		double dt = GetFEModel()->GetTime().timeIncrement;
         double dens = m_pMat->Density(mp);
@@ -700,7 +706,7 @@ void FEFluidDomain2D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // material point data
         pt.m_vft = el.Evaluate(vt, n)*alphaf + el.Evaluate(vp, n)*(1-alphaf);
@@ -728,8 +734,9 @@ void FEFluidDomain2D::InertialForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEElement2D& el = m_Elem[i];
@@ -772,7 +779,7 @@ void FEFluidDomain2D::ElementInertialForce(FEElement2D& el, vector<double>& fe)
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double dens = m_pMat->Density(mp);
         
         // calculate the jacobian
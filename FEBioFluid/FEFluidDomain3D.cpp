@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioFluid.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -110,7 +111,7 @@ void FEFluidDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int j=0; j<n; ++j)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+            FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
             pt.m_r0 = el.Evaluate(x0, j);
             
             if (pt.m_ef <= -1) {
@@ -131,8 +132,9 @@ void FEFluidDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -179,7 +181,7 @@ void FEFluidDomain3D::ElementInternalForce(FESolidElement& el, vector<double>& f
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // calculate the jacobian
         detJ = invjac0(el, Ji, n)*gw[n];
@@ -229,8 +231,9 @@ void FEFluidDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp, FEBodyF
     int NE = (int)m_Elem.size();
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -274,7 +277,7 @@ void FEFluidDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement& el, vect
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double dens = m_pMat->Density(mp);
         
         pt.m_r0 = el.Evaluate(r0, n);
@@ -316,7 +319,7 @@ void FEFluidDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidElement
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
 
         // calculate the jacobian
         detJ = detJ0(el, n)*gw[n]*tp.alphaf;
@@ -385,7 +388,7 @@ void FEFluidDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, const FET
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         // get the tangents
@@ -446,7 +449,8 @@ void FEFluidDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
@@ -457,7 +461,7 @@ void FEFluidDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementStiffness(el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -477,7 +481,8 @@ void FEFluidDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
@@ -488,7 +493,7 @@ void FEFluidDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementMassMatrix(el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -508,7 +513,8 @@ void FEFluidDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo& t
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
@@ -519,7 +525,7 @@ void FEFluidDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo& t
         ElementBodyForceStiffness(bf, el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -572,7 +578,7 @@ void FEFluidDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke, const FE
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         double dens = m_pMat->Density(mp);
         
@@ -678,7 +684,7 @@ void FEFluidDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // material point data
         pt.m_vft = el.Evaluate(vt, n)*alphaf + el.Evaluate(vp, n)*(1-alphaf);
@@ -705,8 +711,9 @@ void FEFluidDomain3D::InertialForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -745,7 +752,7 @@ void FEFluidDomain3D::ElementInertialForce(FESolidElement& el, vector<double>& f
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double dens = m_pMat->Density(mp);
         
         // calculate the jacobian
@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include "FEBioFSI.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -133,9 +134,9 @@ void FEFluidFSIDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
                 rt = el.Evaluate(xt, j);
                 
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-                FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
-                FEFSIMaterialPoint& ft = *mp.ExtractData<FEFSIMaterialPoint>();
+                FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+                FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
+                FEFSIMaterialPoint& ft = *mp.GetData<FEFSIMaterialPoint>();
                 et.m_Wp = et.m_Wt;
                 
                 if ((pt.m_ef <= -1) || (et.m_J <= 0)) {
@@ -158,7 +159,7 @@ void FEFluidFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[7*i  ] = id[m_dofU[0]];
@@ -181,7 +182,7 @@ void FEFluidFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the displacement dofs
             lm[7*i  ] = id[m_dofSU[0]];
@@ -199,8 +200,9 @@ void FEFluidFSIDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -251,9 +253,9 @@ void FEFluidFSIDomain3D::ElementInternalForce(FESolidElement& el, vector<double>
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFSIMaterialPoint& ft = *(mp.ExtractData<FEFSIMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFSIMaterialPoint& ft = *(mp.GetData<FEFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         // calculate the jacobian
@@ -316,8 +318,9 @@ void FEFluidFSIDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp, FEBo
         FESolidElement& el = m_Elem[i];
         
         if (el.isActive()) {
-            vector<double> fe;
-            vector<int> lm;
+            FEElementWorkspace& ws = ElementWorkspace();
+            vector<double>& fe = ws.ForceVector();
+            vector<int>& lm = ws.LM();
             
             // get the element force vector and initialize it to zero
             int ndof = 7*el.Nodes();
@@ -395,7 +398,7 @@ void FEFluidFSIDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidEleme
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         
         // calculate the jacobian
         detJ = invjact(el, Ji, n, tp.alphaf)*gw[n]*tp.alphaf;
@@ -483,9 +486,9 @@ void FEFluidFSIDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, const
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFSIMaterialPoint& fpt = *(mp.ExtractData<FEFSIMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFSIMaterialPoint& fpt = *(mp.GetData<FEFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         // get the tangents
@@ -571,7 +574,8 @@ void FEFluidFSIDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
         
         if (el.isActive()) {
             // element stiffness matrix
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = 7*el.Nodes();
@@ -582,7 +586,7 @@ void FEFluidFSIDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
             ElementStiffness(el, ke, tp);
             
             // get the element's LM vector
-			vector<int> lm;
+			vector<int>& lm = ws.LM();
 			UnpackLM(el, lm);
 			ke.SetIndices(lm);
             
@@ -604,7 +608,8 @@ void FEFluidFSIDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         
         if (el.isActive()) {
 
-			FEElementMatrix ke(el);
+			FEElementWorkspace& ws = ElementWorkspace();
+			FEElementMatrix& ke = ws.ElementMatrix(el);
 
             // create the element's stiffness matrix
             int ndof = 7*el.Nodes();
@@ -615,7 +620,7 @@ void FEFluidFSIDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
             ElementMassMatrix(el, ke, tp);
             
             // get the element's LM vector
-			vector<int> lm;
+			vector<int>& lm = ws.LM();
 			UnpackLM(el, lm);
 			ke.SetIndices(lm);
             
@@ -639,7 +644,8 @@ void FEFluidFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo
         if (el.isActive()) {
 
 			// element stiffness matrix
-			FEElementMatrix ke(el);
+			FEElementWorkspace& ws = ElementWorkspace();
+			FEElementMatrix& ke = ws.ElementMatrix(el);
 
             // create the element's stiffness matrix
             int ndof = 7*el.Nodes();
@@ -650,7 +656,7 @@ void FEFluidFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo
             ElementBodyForceStiffness(bf, el, ke, tp);
             
             // get the element's LM vector
-			vector<int> lm;
+			vector<int>& lm = ws.LM();
 			UnpackLM(el, lm);
 			ke.SetIndices(lm);
             
@@ -708,8 +714,8 @@ void FEFluidFSIDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke, const
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFSIMaterialPoint& fpt = *(mp.ExtractData<FEFSIMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFSIMaterialPoint& fpt = *(mp.GetData<FEFSIMaterialPoint>());
         
         double dens = m_pMat->Fluid()->Density(mp);
         
@@ -826,9 +832,9 @@ void FEFluidFSIDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-		FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
-		FEFSIMaterialPoint& ft = *(mp.ExtractData<FEFSIMaterialPoint>());
+		FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+		FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
+		FEFSIMaterialPoint& ft = *(mp.GetData<FEFSIMaterialPoint>());
 
 		// elastic material point data
 		ept.m_r0 = el.Evaluate(r0, n);
@@ -886,8 +892,9 @@ void FEFluidFSIDomain3D::InertialForces(FEGlobalVector& R, const FETimeInfo& tp)
         
         if (el.isActive()) {
             // element force vector
-            vector<double> fe;
-            vector<int> lm;
+            FEElementWorkspace& ws = ElementWorkspace();
+            vector<double>& fe = ws.ForceVector();
+            vector<int>& lm = ws.LM();
             
             // get the element force vector and initialize it to zero
             int ndof = 7*el.Nodes();
@@ -924,7 +931,7 @@ void FEFluidFSIDomain3D::ElementInertialForce(FESolidElement& el, vector<double>
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double dens = m_pMat->Fluid()->Density(mp);
         
         // calculate the jacobian
@@ -224,7 +224,7 @@ void FEFluidFSITraction::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
 		for (int n = 0; n<pint; ++n)
 		{
 			FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-			FEElasticMaterialPoint& ep = *(mp.ExtractData<FEElasticMaterialPoint>());
+			FEElasticMaterialPoint& ep = *(mp.GetData<FEElasticMaterialPoint>());
 			sv += pfsi->Fluid()->GetViscous()->Stress(mp);
 			svJ += pfsi->Fluid()->GetViscous()->Tangent_Strain(mp);
 			cv += pfsi->Fluid()->Tangent_RateOfDeformation(mp);
@@ -59,7 +59,7 @@ FEFluidMaterial::FEFluidMaterial(FEModel* pfem) : FEMaterial(pfem)
 //! calculate current fluid density
 double FEFluidMaterial::Density(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     return m_rhor/(vt.m_ef+1);
 }
 
@@ -83,7 +83,7 @@ double FEFluidMaterial::AcousticSpeed(FEMaterialPoint& mp)
 //! calculate kinetic energy density (per reference volume)
 double FEFluidMaterial::KineticEnergyDensity(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double ked = m_rhor*(fp.m_vft*fp.m_vft)/2;
     return ked;
 }
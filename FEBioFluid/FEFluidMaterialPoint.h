@@ -34,6 +34,8 @@ SOFTWARE.*/
 //
 class FEBIOFLUID_API FEFluidMaterialPoint : public FEMaterialPoint
 {
+	FEMATERIALPOINT_FLAT_ARENA_ALLOCATION(FEFluidMaterialPoint)
+
 public:
     //! constructor
     FEFluidMaterialPoint(FEMaterialPoint* pt = 0);
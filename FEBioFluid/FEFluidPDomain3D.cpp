@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioFluid.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -109,7 +110,7 @@ void FEFluidPDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int j=0; j<n; ++j)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+            FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
             pt.m_r0 = el.Evaluate(x0, j);
             
             if (pt.m_ef <= -1) {
@@ -130,8 +131,9 @@ void FEFluidPDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -178,7 +180,7 @@ void FEFluidPDomain3D::ElementInternalForce(FESolidElement& el, vector<double>&
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // calculate the jacobian
         detJ = invjac0(el, Ji, n)*gw[n];
@@ -228,8 +230,9 @@ void FEFluidPDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp, FEBody
     int NE = (int)m_Elem.size();
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -273,7 +276,7 @@ void FEFluidPDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement& el, vec
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double dens = m_pMat->Fluid()->Density(mp);
         
         pt.m_r0 = el.Evaluate(r0, n);
@@ -315,7 +318,7 @@ void FEFluidPDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidElement
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         
         // calculate the jacobian
         detJ = detJ0(el, n)*gw[n]*tp.alphaf;
@@ -385,7 +388,7 @@ void FEFluidPDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, const FE
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         // get the tangents
@@ -446,7 +449,8 @@ void FEFluidPDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
@@ -457,7 +461,7 @@ void FEFluidPDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementStiffness(el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -477,7 +481,8 @@ void FEFluidPDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
@@ -488,7 +493,7 @@ void FEFluidPDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementMassMatrix(el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -512,7 +517,8 @@ void FEFluidPDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo&
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
@@ -523,7 +529,7 @@ void FEFluidPDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeInfo&
         ElementBodyForceStiffness(bf, el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -577,7 +583,7 @@ void FEFluidPDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke, const F
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         double dens = m_pMat->Fluid()->Density(mp);
         
@@ -684,7 +690,7 @@ void FEFluidPDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         // material point data
         pt.m_vft = el.Evaluate(vt, n)*alphaf + el.Evaluate(vp, n)*(1-alphaf);
@@ -711,8 +717,9 @@ void FEFluidPDomain3D::InertialForces(FEGlobalVector& R, const FETimeInfo& tp)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -751,7 +758,7 @@ void FEFluidPDomain3D::ElementInertialForce(FESolidElement& el, vector<double>&
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double dens = m_pMat->Fluid()->Density(mp);
         
         // calculate the jacobian
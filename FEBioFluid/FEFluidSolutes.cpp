@@ -406,7 +406,7 @@ double FEFluidSolutes::ElectricPotential(FEMaterialPoint& pt, const bool eform)
     int i, j;
     
     // if not neutral, solve electroneutrality polynomial for zeta
-    FEFluidSolutesMaterialPoint& set = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& set = *pt.GetData<FEFluidSolutesMaterialPoint>();
     const int nsol = (int)m_pSolute.size();
     double cF = 0.0;
     
@@ -480,8 +480,8 @@ void FEFluidSolutes::PartitionCoefficientFunctions(FEMaterialPoint& mp, vector<d
     
     int isol, jsol, ksol;
     
-    FEFluidMaterialPoint& fpt = *(mp.ExtractData<FEFluidMaterialPoint>());
-    FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+    FEFluidMaterialPoint& fpt = *(mp.GetData<FEFluidMaterialPoint>());
+    FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
     
     const int nsol = (int)m_pSolute.size();
     
@@ -610,7 +610,7 @@ vec3d FEFluidSolutes::CurrentDensity(FEMaterialPoint& pt)
 //! actual concentration
 double FEFluidSolutes::ConcentrationActual(FEMaterialPoint& pt, const int sol)
 {
-    FEFluidSolutesMaterialPoint& spt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& spt = *pt.GetData<FEFluidSolutesMaterialPoint>();
     
     // effective concentration
     double c = spt.m_c[sol];
@@ -629,8 +629,8 @@ double FEFluidSolutes::PressureActual(FEMaterialPoint& pt)
 {
     int i;
     
-    FEFluidMaterialPoint& fpt = *pt.ExtractData<FEFluidMaterialPoint>();
-    FEFluidSolutesMaterialPoint& spt = *(pt.ExtractData<FEFluidSolutesMaterialPoint>());
+    FEFluidMaterialPoint& fpt = *pt.GetData<FEFluidMaterialPoint>();
+    FEFluidSolutesMaterialPoint& spt = *(pt.GetData<FEFluidSolutesMaterialPoint>());
     const int nsol = (int)m_pSolute.size();
     
     // effective pressure
@@ -657,8 +657,8 @@ double FEFluidSolutes::PressureActual(FEMaterialPoint& pt)
 
 vec3d FEFluidSolutes::SoluteFlux(FEMaterialPoint& pt, const int sol)
 {
-    FEFluidSolutesMaterialPoint& spt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FEFluidMaterialPoint& fpt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidSolutesMaterialPoint& spt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FEFluidMaterialPoint& fpt = *pt.GetData<FEFluidMaterialPoint>();
     
     // concentration gradient
     vec3d gradc = spt.m_gradc[sol];
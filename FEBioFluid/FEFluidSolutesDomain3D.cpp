@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioFluidSolutes.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
@@ -135,7 +136,7 @@ void FEFluidSolutesDomain3D::Reset()
         for (int n=0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEFluidSolutesMaterialPoint& ps = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+            FEFluidSolutesMaterialPoint& ps = *(mp.GetData<FEFluidSolutesMaterialPoint>());
             
             // initialize solutes
             ps.m_nsol = nsol;
@@ -213,7 +214,7 @@ void FEFluidSolutesDomain3D::InitMaterialPoints()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEFluidSolutesMaterialPoint& ps = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+            FEFluidSolutesMaterialPoint& ps = *(mp.GetData<FEFluidSolutesMaterialPoint>());
             
             // initialize solutes
             ps.m_nsol = nsol;
@@ -254,7 +255,7 @@ void FEFluidSolutesDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int j=0; j<n; ++j)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+            FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
             pt.m_r0 = el.Evaluate(x0, j);
             
             if (pt.m_ef <= -1) {
@@ -283,8 +284,9 @@ void FEFluidSolutesDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo&
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -337,8 +339,8 @@ void FEFluidSolutesDomain3D::ElementInternalForce(FESolidElement& el, vector<dou
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
 
         // calculate the jacobian
         detJ = invjac0(el, Ji, n)*gw[n];
@@ -438,8 +440,9 @@ void FEFluidSolutesDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp,
     int ndpn = 4+nsol;
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -488,8 +491,8 @@ void FEFluidSolutesDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement& e
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
-        FEFluidSolutesMaterialPoint& spt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
+        FEFluidSolutesMaterialPoint& spt = *mp.GetData<FEFluidSolutesMaterialPoint>();
         double dens = m_pMat->Fluid()->Density(mp);
         
         pt.m_r0 = el.Evaluate(r0, n);
@@ -576,8 +579,8 @@ void FEFluidSolutesDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidE
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
-        FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
+        FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
         
         // calculate the jacobian
         detJ = invjac0(el, Ji, n)*gw[n]*tp.alphaf;
@@ -725,8 +728,8 @@ void FEFluidSolutesDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, co
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
         double Jf = 1 + pt.m_ef;
 
         // get the tangents
@@ -894,7 +897,8 @@ void FEFluidSolutesDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInf
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int nsol = m_pMat->Solutes();
@@ -907,7 +911,7 @@ void FEFluidSolutesDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInf
         ElementStiffness(el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
         
@@ -927,7 +931,8 @@ void FEFluidSolutesDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         const int nsol = m_pMat->Solutes();
@@ -940,7 +945,7 @@ void FEFluidSolutesDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp
         ElementMassMatrix(el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
         
@@ -960,7 +965,8 @@ void FEFluidSolutesDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETime
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         const int nsol = m_pMat->Solutes();
@@ -973,7 +979,7 @@ void FEFluidSolutesDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETime
         ElementBodyForceStiffness(bf, el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
         
@@ -1028,7 +1034,7 @@ void FEFluidSolutesDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke, c
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         double dens = m_pMat->Fluid()->Density(mp);
         
@@ -1149,8 +1155,8 @@ void FEFluidSolutesDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
 
         // material point data
         pt.m_vft = el.Evaluate(vt, n)*alphaf + el.Evaluate(vp, n)*(1-alphaf);
@@ -1201,8 +1207,9 @@ void FEFluidSolutesDomain3D::InertialForces(FEGlobalVector& R, const FETimeInfo&
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -1245,7 +1252,7 @@ void FEFluidSolutesDomain3D::ElementInertialForce(FESolidElement& el, vector<dou
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double dens = m_pMat->Fluid()->Density(mp);
         
         // calculate the jacobian
@@ -244,7 +244,7 @@ vec3d FEFluidSolutesNaturalFlux::EffectiveCGrad(FESurfaceMaterialPoint& pt)
     for (int n = 0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-        FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+        FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
         gradc += spt.m_gradc[m_isol-1];
     }
     gradc /= nint;
@@ -264,7 +264,7 @@ double FEFluidSolutesNaturalFlux::EffectiveConcentrationElm(FESurfaceMaterialPoi
     for (int n = 0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-        FEFluidSolutesMaterialPoint& spt = *(mp.ExtractData<FEFluidSolutesMaterialPoint>());
+        FEFluidSolutesMaterialPoint& spt = *(mp.GetData<FEFluidSolutesMaterialPoint>());
         c += spt.m_c[m_isol-1];
     }
     c /= nint;
@@ -284,7 +284,7 @@ vec3d FEFluidSolutesNaturalFlux::FluidVelocityElm(FESurfaceMaterialPoint& pt)
     for (int n = 0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-        FEFluidMaterialPoint& fpt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& fpt = *(mp.GetData<FEFluidMaterialPoint>());
         v += fpt.m_vft;
     }
     v /= nint;
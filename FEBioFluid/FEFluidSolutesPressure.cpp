@@ -112,7 +112,7 @@ void FEFluidSolutesPressure::Update()
             double cao[FEElement::MAX_NODES];
             for (int j=0; j<se->GaussPoints(); ++j) {
                 FEMaterialPoint* pt = se->GetMaterialPoint(j);
-                FEFluidSolutesMaterialPoint* fsp = pt->ExtractData<FEFluidSolutesMaterialPoint>();
+                FEFluidSolutesMaterialPoint* fsp = pt->GetData<FEFluidSolutesMaterialPoint>();
                 if (fsp)
                 {
                     if (m_pfs)
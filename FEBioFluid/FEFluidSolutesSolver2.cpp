@@ -225,8 +225,8 @@ void FEFluidSolutesSolver2::MapVelocitySolution()
 			for (int n = 0; n < nint; ++n)
 			{
 				FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-				FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-				FESolutesMaterial::Point& sp = *mp.ExtractData<FESolutesMaterial::Point>();
+				FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+				FESolutesMaterial::Point& sp = *mp.GetData<FESolutesMaterial::Point>();
 
 				sp.m_vft = fp.m_vft;
 				sp.m_JfdotoJf = fp.m_efdot / (fp.m_ef+1);
@@ -254,8 +254,8 @@ void FEFluidSolutesSolver2::CorrectActualPressure()
             for (int n = 0; n < nint; ++n)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-                FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-                FESolutesMaterial::Point& sp = *mp.ExtractData<FESolutesMaterial::Point>();
+                FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+                FESolutesMaterial::Point& sp = *mp.GetData<FESolutesMaterial::Point>();
                 
                 FEFluidSolutesMaterial2* fs2 = dom.GetMaterial()->ExtractProperty<FEFluidSolutesMaterial2>();
                 
@@ -37,7 +37,7 @@ FEFluidStressCriterion::FEFluidStressCriterion(FEModel* fem) : FEMeshAdaptorCrit
 
 bool FEFluidStressCriterion::GetMaterialPointValue(FEMaterialPoint& mp, double& value)
 {
-	FEFluidMaterialPoint* fp = mp.ExtractData<FEFluidMaterialPoint>();
+	FEFluidMaterialPoint* fp = mp.GetData<FEFluidMaterialPoint>();
 	if (fp == nullptr) return false;
 	mat3ds& s = fp->m_sf;
 	value = s.max_shear();
@@ -77,8 +77,8 @@ bool FEIdealGas::Init()
 //! gage pressure
 double FEIdealGas::Pressure(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = m_Tr + tf.m_T;
     double Jf = 1 + fp.m_ef;
 
@@ -91,8 +91,8 @@ double FEIdealGas::Pressure(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J
 double FEIdealGas::Tangent_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = m_Tr + tf.m_T;
     double Jf = 1 + fp.m_ef;
 
@@ -105,8 +105,8 @@ double FEIdealGas::Tangent_Strain(FEMaterialPoint& mp)
 //! 2nd tangent of pressure with respect to strain J
 double FEIdealGas::Tangent_Strain_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = m_Tr + tf.m_T;
     double Jf = 1 + fp.m_ef;
 
@@ -119,7 +119,7 @@ double FEIdealGas::Tangent_Strain_Strain(FEMaterialPoint& mp)
 //! tangent of pressure with respect to temperature T
 double FEIdealGas::Tangent_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double Jf = 1 + fp.m_ef;
 
     double dp = m_Pr/(Jf*m_Tr);
@@ -138,7 +138,7 @@ double FEIdealGas::Tangent_Temperature_Temperature(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J and temperature T
 double FEIdealGas::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double Jf = 1 + fp.m_ef;
 
     double d2p = -m_Pr/(Jf*Jf*m_Tr);
@@ -150,8 +150,8 @@ double FEIdealGas::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 //! specific free energy
 double FEIdealGas::SpecificFreeEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double J = 1 + fp.m_ef;
     double T = tf.m_T + m_Tr;
@@ -173,8 +173,8 @@ double FEIdealGas::SpecificFreeEnergy(FEMaterialPoint& mp)
 //! specific entropy
 double FEIdealGas::SpecificEntropy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double J = 1 + fp.m_ef;
     double T = tf.m_T + m_Tr;
@@ -196,8 +196,8 @@ double FEIdealGas::SpecificEntropy(FEMaterialPoint& mp)
 //! specific strain energy
 double FEIdealGas::SpecificStrainEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double J = 1 + fp.m_ef;
     double T = tf.m_T;
@@ -213,7 +213,7 @@ double FEIdealGas::SpecificStrainEnergy(FEMaterialPoint& mp)
 //! isobaric specific heat capacity
 double FEIdealGas::IsobaricSpecificHeatCapacity(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = tf.m_T + m_Tr;
     
     double cp = m_cp->value(T);
@@ -241,7 +241,7 @@ double FEIdealGas::Tangent_cv_Strain(FEMaterialPoint& mp)
 //! tangent of isochoric specific heat capacity with respect to temperature T
 double FEIdealGas::Tangent_cv_Temperature(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = tf.m_T + m_Tr;
     
     double dcv = m_cp->derive(T);
@@ -82,7 +82,7 @@ double FEIdealGasIsentropic::Pressure(const double e, const double T)
 //! tangent of elastic pressure with respect to strain J
 double FEIdealGasIsentropic::Tangent_Pressure_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1 + fp.m_ef;
     double dp = -m_gamma*m_Pr*pow(J, -m_gamma-1);
     return dp;
@@ -92,7 +92,7 @@ double FEIdealGasIsentropic::Tangent_Pressure_Strain(FEMaterialPoint& mp)
 //! 2nd tangent of elastic pressure with respect to strain J
 double FEIdealGasIsentropic::Tangent_Pressure_Strain_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1+ fp.m_ef;
     double d2p = m_gamma*(m_gamma+1)*m_Pr*pow(J, -m_gamma-2);
     return d2p;
@@ -102,7 +102,7 @@ double FEIdealGasIsentropic::Tangent_Pressure_Strain_Strain(FEMaterialPoint& mp)
 //! evaluate temperature
 double FEIdealGasIsentropic::Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1 + fp.m_ef;
     double T = m_Tr*pow(J, 1-m_gamma);
     return T;
@@ -112,7 +112,7 @@ double FEIdealGasIsentropic::Temperature(FEMaterialPoint& mp)
 //! calculate free energy density (per reference volume)
 double FEIdealGasIsentropic::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1 + fp.m_ef;
     double sed = m_Pr*(J-1+(pow(J, 1-m_gamma)-1)/(m_gamma-1));
     return sed;
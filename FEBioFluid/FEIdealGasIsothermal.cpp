@@ -79,7 +79,7 @@ double FEIdealGasIsothermal::Pressure(const double e, const double T)
 //! tangent of elastic pressure with respect to strain J
 double FEIdealGasIsothermal::Tangent_Pressure_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1 + fp.m_ef;
     double dp = -m_Pr/J;
     return dp;
@@ -89,7 +89,7 @@ double FEIdealGasIsothermal::Tangent_Pressure_Strain(FEMaterialPoint& mp)
 //! 2nd tangent of elastic pressure with respect to strain J
 double FEIdealGasIsothermal::Tangent_Pressure_Strain_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1 + fp.m_ef;
     double d2p = 2*m_Pr/(J*J);
     return d2p;
@@ -106,7 +106,7 @@ double FEIdealGasIsothermal::Temperature(FEMaterialPoint& mp)
 //! calculate free energy density (per reference volume)
 double FEIdealGasIsothermal::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double J = 1 + fp.m_ef;
     double sed = m_Pr*(J-1-log(J));
     return sed;
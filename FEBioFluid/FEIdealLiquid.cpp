@@ -74,8 +74,8 @@ bool FEIdealLiquid::Init()
 //! gage pressure
 double FEIdealLiquid::Pressure(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double p = m_k*(-fp.m_ef) + m_beta*(tf.m_T);
 
@@ -121,8 +121,8 @@ double FEIdealLiquid::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 //! specific free energy
 double FEIdealLiquid::SpecificFreeEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double J = 1 + fp.m_ef;
     double T = tf.m_T + m_Tr;
@@ -138,8 +138,8 @@ double FEIdealLiquid::SpecificFreeEnergy(FEMaterialPoint& mp)
 //! specific entropy
 double FEIdealLiquid::SpecificEntropy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double J = 1 + fp.m_ef;
     double T = tf.m_T + m_Tr;
@@ -155,8 +155,8 @@ double FEIdealLiquid::SpecificEntropy(FEMaterialPoint& mp)
 //! specific strain energy
 double FEIdealLiquid::SpecificStrainEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double J = 1 + fp.m_ef;
     
@@ -191,7 +191,7 @@ double FEIdealLiquid::Tangent_cv_Temperature(FEMaterialPoint& mp)
 //! isobaric specific heat capacity
 double FEIdealLiquid::IsobaricSpecificHeatCapacity(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = tf.m_T + m_Tr;
     
     double cp = IsochoricSpecificHeatCapacity(mp) + m_beta*m_beta/(m_k*m_rhor)*T;
@@ -48,7 +48,7 @@ bool FELinearElasticFluid::Init()
 //! gage pressure
 double FELinearElasticFluid::Pressure(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double p = -m_k*fp.m_ef;
     
     return p;
@@ -93,7 +93,7 @@ double FELinearElasticFluid::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 //! specific free energy
 double FELinearElasticFluid::SpecificFreeEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double a = m_k/(2*m_rhor)*pow(fp.m_ef,2);
     return a;
 }
@@ -478,7 +478,7 @@ double FEMultiphasicFSI::ElectricPotential(FEMaterialPoint& pt, const bool eform
     int i, j;
     
     // if not neutral, solve electroneutrality polynomial for zeta
-    FEMultiphasicFSIMaterialPoint& set = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& set = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     const int nsol = (int)m_pSolute.size();
     double cF = FixedChargeDensity(pt);
     
@@ -552,10 +552,10 @@ void FEMultiphasicFSI::PartitionCoefficientFunctions(FEMaterialPoint& mp, vector
     
     int isol, jsol, ksol;
     
-    FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
-    FEFluidMaterialPoint& fpt = *(mp.ExtractData<FEFluidMaterialPoint>());
-    FEBiphasicFSIMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-    FEMultiphasicFSIMaterialPoint& spt = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+    FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
+    FEFluidMaterialPoint& fpt = *(mp.GetData<FEFluidMaterialPoint>());
+    FEBiphasicFSIMaterialPoint& ppt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+    FEMultiphasicFSIMaterialPoint& spt = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
     
     const int nsol = (int)m_pSolute.size();
     
@@ -691,7 +691,7 @@ vec3d FEMultiphasicFSI::CurrentDensity(FEMaterialPoint& pt)
 //! actual concentration
 double FEMultiphasicFSI::ConcentrationActual(FEMaterialPoint& pt, const int sol)
 {
-    FEMultiphasicFSIMaterialPoint& spt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& spt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // effective concentration
     double c = spt.m_c[sol];
@@ -710,7 +710,7 @@ double FEMultiphasicFSI::PressureActual(FEMaterialPoint& pt)
 {
     int i;
     
-    FEFluidMaterialPoint& fpt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fpt = *pt.GetData<FEFluidMaterialPoint>();
     const int nsol = (int)m_pSolute.size();
     
     // effective pressure
@@ -736,9 +736,9 @@ double FEMultiphasicFSI::PressureActual(FEMaterialPoint& pt)
 //! Fixed charge density in current configuration
 double FEMultiphasicFSI::FixedChargeDensity(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint& spt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& spt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // relative volume
     double J = et.m_J;
@@ -756,8 +756,8 @@ double FEMultiphasicFSI::FixedChargeDensity(FEMaterialPoint& pt)
 
 vec3d FEMultiphasicFSI::SoluteFlux(FEMaterialPoint& pt, const int sol)
 {
-    FEMultiphasicFSIMaterialPoint& spt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
-    FEFSIMaterialPoint& fpt = *pt.ExtractData<FEFSIMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& spt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
+    FEFSIMaterialPoint& fpt = *pt.GetData<FEFSIMaterialPoint>();
     
     // concentration gradient
     vec3d gradc = spt.m_gradc[sol];
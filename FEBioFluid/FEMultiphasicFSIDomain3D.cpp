@@ -35,6 +35,7 @@
 #include "FEFluidFSI.h"
 #include "FEBiphasicFSI.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
@@ -112,8 +113,8 @@ bool FEMultiphasicFSIDomain3D::Init()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEBiphasicFSIMaterialPoint& pb = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-            FEMultiphasicFSIMaterialPoint& ps = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+            FEBiphasicFSIMaterialPoint& pb = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+            FEMultiphasicFSIMaterialPoint& ps = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
             
             pb.m_phi0 = m_pMat->SolidReferentialVolumeFraction(mp);
             ps.m_cF = m_pMat->FixedChargeDensity(mp);
@@ -192,10 +193,10 @@ void FEMultiphasicFSIDomain3D::InitMaterialPoints()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEFluidMaterialPoint& ft = *(mp.ExtractData<FEFluidMaterialPoint>());
-            FEFSIMaterialPoint& fs = *(mp.ExtractData<FEFSIMaterialPoint>());
-            FEBiphasicFSIMaterialPoint& pt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-            FEMultiphasicFSIMaterialPoint& ps = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+            FEFluidMaterialPoint& ft = *(mp.GetData<FEFluidMaterialPoint>());
+            FEFSIMaterialPoint& fs = *(mp.GetData<FEFSIMaterialPoint>());
+            FEBiphasicFSIMaterialPoint& pt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+            FEMultiphasicFSIMaterialPoint& ps = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
             
             // initialize effective fluid pressure, its gradient, and fluid flux
             ft.m_ef = el.Evaluate(ef, n);
@@ -238,8 +239,8 @@ void FEMultiphasicFSIDomain3D::Reset()
     
     // initialize all element data
     ForEachMaterialPoint([=](FEMaterialPoint& mp) {
-        FEBiphasicFSIMaterialPoint& pt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-        FEMultiphasicFSIMaterialPoint& ps = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& pt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+        FEMultiphasicFSIMaterialPoint& ps = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
         
         // initialize referential solid volume fraction
         pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -300,8 +301,8 @@ void FEMultiphasicFSIDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
                 rt = el.Evaluate(xt, j);
                 
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-                FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+                FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+                FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
                 
                 et.m_r0 = r0;
                 et.m_rt = rt;
@@ -333,7 +334,7 @@ void FEMultiphasicFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -361,7 +362,7 @@ void FEMultiphasicFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the displacement dofs
             lm[ndpn*i  ] = id[m_dofSU[0]];
@@ -383,8 +384,9 @@ void FEMultiphasicFSIDomain3D::InternalForces(FEGlobalVector& R, const FETimeInf
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -437,11 +439,11 @@ void FEMultiphasicFSIDomain3D::ElementInternalForce(FESolidElement& el, vector<d
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFSIMaterialPoint& ft = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-        FEMultiphasicFSIMaterialPoint& mt = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFSIMaterialPoint& ft = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+        FEMultiphasicFSIMaterialPoint& mt = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
         double Jf =  1 + pt.m_ef;
         
         // calculate the jacobian
@@ -587,8 +589,9 @@ void FEMultiphasicFSIDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp
         FESolidElement& el = m_Elem[i];
         
         if (el.isActive()) {
-            vector<double> fe;
-            vector<int> lm;
+            FEElementWorkspace& ws = ElementWorkspace();
+            vector<double>& fe = ws.ForceVector();
+            vector<int>& lm = ws.LM();
             
             // get the element force vector and initialize it to zero
             int ndof = ndpn*el.Nodes();
@@ -635,8 +638,8 @@ void FEMultiphasicFSIDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement&
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
-        FEMultiphasicFSIMaterialPoint& mt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
+        FEMultiphasicFSIMaterialPoint& mt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
         
         double densTs = m_pMat->TrueSolidDensity(mp);
         double densTf = m_pMat->TrueFluidDensity(mp);
@@ -739,9 +742,9 @@ void FEMultiphasicFSIDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESoli
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
-        FEMultiphasicFSIMaterialPoint& mt = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+        FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
+        FEMultiphasicFSIMaterialPoint& mt = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         // calculate the jacobian
@@ -950,11 +953,11 @@ void FEMultiphasicFSIDomain3D::ElementStiffness(FESolidElement &el, matrix &ke,
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFSIMaterialPoint& fpt = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-        FEMultiphasicFSIMaterialPoint& mt = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFSIMaterialPoint& fpt = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bpt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+        FEMultiphasicFSIMaterialPoint& mt = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         // get the tangents
@@ -1246,7 +1249,8 @@ void FEMultiphasicFSIDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeI
         
         if (el.isActive()) {
             // element stiffness matrix
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = ndpn*el.Nodes();
@@ -1257,7 +1261,7 @@ void FEMultiphasicFSIDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeI
             ElementStiffness(el, ke, tp);
             
             // get the element's LM vector
-            vector<int> lm;
+            vector<int>& lm = ws.LM();
             UnpackLM(el, lm);
             ke.SetIndices(lm);
             
@@ -1282,7 +1286,8 @@ void FEMultiphasicFSIDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo&
         
         if (el.isActive()) {
             
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = ndpn*el.Nodes();
@@ -1293,7 +1298,7 @@ void FEMultiphasicFSIDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo&
             ElementMassMatrix(el, ke, tp);
             
             // get the element's LM vector
-            vector<int> lm;
+            vector<int>& lm = ws.LM();
             UnpackLM(el, lm);
             ke.SetIndices(lm);
             
@@ -1321,7 +1326,8 @@ void FEMultiphasicFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETi
         if (el.isActive()) {
             
             // element stiffness matrix
-            FEElementMatrix ke(el);
+            FEElementWorkspace& ws = ElementWorkspace();
+            FEElementMatrix& ke = ws.ElementMatrix(el);
             
             // create the element's stiffness matrix
             int ndof = ndpn*el.Nodes();
@@ -1332,7 +1338,7 @@ void FEMultiphasicFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETi
             ElementBodyForceStiffness(bf, el, ke, tp);
             
             // get the element's LM vector
-            vector<int> lm;
+            vector<int>& lm = ws.LM();
             UnpackLM(el, lm);
             ke.SetIndices(lm);
             
@@ -1403,10 +1409,10 @@ void FEMultiphasicFSIDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke,
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& et = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEFSIMaterialPoint& fpt = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+        FEElasticMaterialPoint& et = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEFSIMaterialPoint& fpt = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bpt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
         double Jf = 1 + pt.m_ef;
         
         double denss = m_pMat->SolidDensity(mp);
@@ -1567,11 +1573,11 @@ void FEMultiphasicFSIDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEFSIMaterialPoint& ft = *(mp.ExtractData<FEFSIMaterialPoint>());
-        FEBiphasicFSIMaterialPoint& bt = *(mp.ExtractData<FEBiphasicFSIMaterialPoint>());
-        FEMultiphasicFSIMaterialPoint& spt = *(mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
+        FEFSIMaterialPoint& ft = *(mp.GetData<FEFSIMaterialPoint>());
+        FEBiphasicFSIMaterialPoint& bt = *(mp.GetData<FEBiphasicFSIMaterialPoint>());
+        FEMultiphasicFSIMaterialPoint& spt = *(mp.GetData<FEMultiphasicFSIMaterialPoint>());
         
         // elastic material point data
         ept.m_r0 = el.Evaluate(r0, n);
@@ -1675,8 +1681,9 @@ void FEMultiphasicFSIDomain3D::InertialForces(FEGlobalVector& R, const FETimeInf
         
         if (el.isActive()) {
             // element force vector
-            vector<double> fe;
-            vector<int> lm;
+            FEElementWorkspace& ws = ElementWorkspace();
+            vector<double>& fe = ws.ForceVector();
+            vector<int>& lm = ws.LM();
             
             // get the element force vector and initialize it to zero
             int ndof = ndpn*el.Nodes();
@@ -1715,8 +1722,8 @@ void FEMultiphasicFSIDomain3D::ElementInertialForce(FESolidElement& el, vector<d
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
         double densTf = m_pMat->TrueFluidDensity(mp);
         double densTs = m_pMat->TrueSolidDensity(mp);
         double phis = m_pMat->SolidVolumeFrac(mp);
@@ -105,7 +105,7 @@ void FEMultiphasicFSIPressure::Update()
             double cao[FEElement::MAX_NODES];
             for (int j=0; j<se->GaussPoints(); ++j) {
                 FEMaterialPoint* pt = se->GetMaterialPoint(j);
-                FEMultiphasicFSIMaterialPoint* fsp = pt->ExtractData<FEMultiphasicFSIMaterialPoint>();
+                FEMultiphasicFSIMaterialPoint* fsp = pt->GetData<FEMultiphasicFSIMaterialPoint>();
                 if (fsp)
                 {
                     osci[j] = m_pfs->GetOsmoticCoefficient()->OsmoticCoefficient(*pt);
@@ -48,7 +48,7 @@ bool FENonlinearElasticFluid::Init()
 //! gage pressure
 double FENonlinearElasticFluid::Pressure(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double p =m_k*(1/(1+fp.m_ef)-1);
     
     return p;
@@ -58,7 +58,7 @@ double FENonlinearElasticFluid::Pressure(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J
 double FENonlinearElasticFluid::Tangent_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     return -m_k/pow(1+fp.m_ef,2);
 }
 
@@ -94,7 +94,7 @@ double FENonlinearElasticFluid::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 //! specific free energy
 double FENonlinearElasticFluid::SpecificFreeEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
     double a = m_k/m_rhor*(fp.m_ef-log(1+fp.m_ef));
     return a;
 }
@@ -51,7 +51,7 @@ FEPowellEyringFluid::FEPowellEyringFluid(FEModel* pfem) : FEViscousFluid(pfem)
 //! viscous stress
 mat3ds FEPowellEyringFluid::Stress(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double mu = ShearViscosity(pt);
     
@@ -71,7 +71,7 @@ mat3ds FEPowellEyringFluid::Tangent_Strain(FEMaterialPoint& mp)
 //! tangent of stress with respect to rate of deformation tensor D
 tens4ds FEPowellEyringFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamg = m_lam*gdot;
@@ -88,7 +88,7 @@ tens4ds FEPowellEyringFluid::Tangent_RateOfDeformation(FEMaterialPoint& pt)
 //! dynamic viscosity
 double FEPowellEyringFluid::ShearViscosity(FEMaterialPoint& pt)
 {
-    FEFluidMaterialPoint& vt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *pt.GetData<FEFluidMaterialPoint>();
     mat3ds D = vt.RateOfDeformation();
     double gdot = sqrt(2*(D.sqr()).tr());
     double lamg = m_lam*gdot;
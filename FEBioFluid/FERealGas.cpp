@@ -88,8 +88,8 @@ bool FERealGas::Init()
 //! gage pressure
 double FERealGas::Pressure(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double J = 1 + fp.m_ef;
@@ -105,8 +105,8 @@ double FERealGas::Pressure(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J
 double FERealGas::Tangent_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -123,8 +123,8 @@ double FERealGas::Tangent_Strain(FEMaterialPoint& mp)
 //! 2nd tangent of pressure with respect to strain J
 double FERealGas::Tangent_Strain_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -141,8 +141,8 @@ double FERealGas::Tangent_Strain_Strain(FEMaterialPoint& mp)
 //! tangent of pressure with respect to temperature T
 double FERealGas::Tangent_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -159,8 +159,8 @@ double FERealGas::Tangent_Temperature(FEMaterialPoint& mp)
 //! 2nd tangent of pressure with respect to temperature T
 double FERealGas::Tangent_Temperature_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -178,8 +178,8 @@ double FERealGas::Tangent_Temperature_Temperature(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J and temperature T
 double FERealGas::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -196,8 +196,8 @@ double FERealGas::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 //! specific free energy
 double FERealGas::SpecificFreeEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -230,8 +230,8 @@ double FERealGas::SpecificFreeEnergy(FEMaterialPoint& mp)
 //! specific entropy
 double FERealGas::SpecificEntropy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -274,7 +274,7 @@ double FERealGas::SpecificEntropy(FEMaterialPoint& mp)
 //! specific strain energy
 double FERealGas::SpecificStrainEnergy(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     // get the specific free energy
     double a = SpecificFreeEnergy(mp);
@@ -289,8 +289,8 @@ double FERealGas::SpecificStrainEnergy(FEMaterialPoint& mp)
 //! isochoric specific heat capacity
 double FERealGas::IsochoricSpecificHeatCapacity(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
 
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -341,8 +341,8 @@ double FERealGas::IsochoricSpecificHeatCapacity(FEMaterialPoint& mp)
 //! tangent of isochoric specific heat capacity with respect to strain J
 double FERealGas::Tangent_cv_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double dq = tf.m_T/m_Tr;
     double q = 1 + dq;
@@ -393,7 +393,7 @@ double FERealGas::Tangent_cv_Strain(FEMaterialPoint& mp)
 //! tangent of isochoric specific heat capacity with respect to temperature T
 double FERealGas::Tangent_cv_Temperature(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = m_Tr + tf.m_T;
     double dcvT = IsochoricSpecificHeatCapacity(mp)/T;  // this is incomplete
     return dcvT;
@@ -403,7 +403,7 @@ double FERealGas::Tangent_cv_Temperature(FEMaterialPoint& mp)
 //! isobaric specific heat capacity
 double FERealGas::IsobaricSpecificHeatCapacity(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double cv = IsochoricSpecificHeatCapacity(mp);
     double p = Pressure(mp);
     double dpT = Tangent_Temperature(mp);
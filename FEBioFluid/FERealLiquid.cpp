@@ -84,8 +84,8 @@ bool FERealLiquid::Init()
 //! gage pressure
 double FERealLiquid::Pressure(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double p = m_psat->value(q);
@@ -100,8 +100,8 @@ double FERealLiquid::Pressure(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J
 double FERealLiquid::Tangent_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double dpJ = m_B[0]->value(q);
@@ -116,8 +116,8 @@ double FERealLiquid::Tangent_Strain(FEMaterialPoint& mp)
 //! 2nd tangent of pressure with respect to strain J
 double FERealLiquid::Tangent_Strain_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double dpJ2 = 2*m_B[1]->value(q);
@@ -132,8 +132,8 @@ double FERealLiquid::Tangent_Strain_Strain(FEMaterialPoint& mp)
 //! tangent of pressure with respect to temperature T
 double FERealLiquid::Tangent_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double dpT = m_psat->derive(q);
@@ -150,8 +150,8 @@ double FERealLiquid::Tangent_Temperature(FEMaterialPoint& mp)
 //! 2nd tangent of pressure with respect to temperature T
 double FERealLiquid::Tangent_Temperature_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double dpT2 = m_psat->deriv2(q);
@@ -173,8 +173,8 @@ double FERealLiquid::Tangent_Temperature_Temperature(FEMaterialPoint& mp)
 //! tangent of pressure with respect to strain J and temperature T
 double FERealLiquid::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double dpJT = m_B[0]->derive(q);
@@ -191,8 +191,8 @@ double FERealLiquid::Tangent_Strain_Temperature(FEMaterialPoint& mp)
 //! specific free energy
 double FERealLiquid::SpecificFreeEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double de = fp.m_ef - m_esat->value(q);
@@ -207,8 +207,8 @@ double FERealLiquid::SpecificFreeEnergy(FEMaterialPoint& mp)
 //! specific entropy
 double FERealLiquid::SpecificEntropy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double de = fp.m_ef - m_esat->value(q);
@@ -224,8 +224,8 @@ double FERealLiquid::SpecificEntropy(FEMaterialPoint& mp)
 //! specific strain energy
 double FERealLiquid::SpecificStrainEnergy(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
 
     // get the specific free energy
     double a = SpecificFreeEnergy(mp);
@@ -252,8 +252,8 @@ double FERealLiquid::SpecificStrainEnergy(FEMaterialPoint& mp)
 //! isochoric specific heat capacity
 double FERealLiquid::IsochoricSpecificHeatCapacity(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double de = fp.m_ef - m_esat->value(q);
@@ -272,8 +272,8 @@ double FERealLiquid::IsochoricSpecificHeatCapacity(FEMaterialPoint& mp)
 //! tangent of isochoric specific heat capacity with respect to strain J
 double FERealLiquid::Tangent_cv_Strain(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& fp = *mp.ExtractData<FEFluidMaterialPoint>();
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEFluidMaterialPoint& fp = *mp.GetData<FEFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     
     double q = tf.m_T/m_Tr;
     double de = fp.m_ef - m_esat->value(q);
@@ -292,7 +292,7 @@ double FERealLiquid::Tangent_cv_Strain(FEMaterialPoint& mp)
 //! tangent of isochoric specific heat capacity with respect to temperature T
 double FERealLiquid::Tangent_cv_Temperature(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double T = m_Tr + tf.m_T;
     double dcvT = IsochoricSpecificHeatCapacity(mp)/T;  // this is incomplete
     return dcvT;
@@ -302,7 +302,7 @@ double FERealLiquid::Tangent_cv_Temperature(FEMaterialPoint& mp)
 //! isobaric specific heat capacity
 double FERealLiquid::IsobaricSpecificHeatCapacity(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double cv = IsochoricSpecificHeatCapacity(mp);
     double p = Pressure(mp);
     double dpT = Tangent_Temperature(mp);
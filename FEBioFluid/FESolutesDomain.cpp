@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioFluidSolutes.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -110,7 +111,7 @@ void FESolutesDomain::Reset()
 		for (int n = 0; n<nint; ++n)
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-			FESolutesMaterial::Point& ps = *(mp.ExtractData<FESolutesMaterial::Point>());
+			FESolutesMaterial::Point& ps = *(mp.GetData<FESolutesMaterial::Point>());
 
 			// initialize solutes
             ps.m_nsol = nsol;
@@ -177,7 +178,7 @@ void FESolutesDomain::InitMaterialPoints()
 		for (int n = 0; n<nint; ++n)
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-			FESolutesMaterial::Point& ps = *(mp.ExtractData<FESolutesMaterial::Point>());
+			FESolutesMaterial::Point& ps = *(mp.GetData<FESolutesMaterial::Point>());
 
 			// initialize solutes
 			ps.m_nsol = nsol;
@@ -232,8 +233,9 @@ void FESolutesDomain::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
 	for (int i = 0; i<NE; ++i)
 	{
 		// element force vector
-		vector<double> fe;
-		vector<int> lm;
+		FEElementWorkspace& ws = ElementWorkspace();
+		vector<double>& fe = ws.ForceVector();
+		vector<int>& lm = ws.LM();
 
 		// get the element
 		FESolidElement& el = m_Elem[i];
@@ -280,7 +282,7 @@ void FESolutesDomain::ElementInternalForce(FESolidElement& el, vector<double>& f
 	for (int n = 0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FESolutesMaterial::Point& spt = *(mp.ExtractData<FESolutesMaterial::Point>());
+		FESolutesMaterial::Point& spt = *(mp.GetData<FESolutesMaterial::Point>());
 
 		// calculate the jacobian
 		double detJ = invjac0(el, Ji, n)*gw[n];
@@ -375,7 +377,7 @@ void FESolutesDomain::ElementStiffness(FESolidElement &el, matrix &ke, const FET
 		// setup the material point
 		// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FESolutesMaterial::Point& spt = *(mp.ExtractData<FESolutesMaterial::Point>());
+		FESolutesMaterial::Point& spt = *(mp.GetData<FESolutesMaterial::Point>());
         
         double R = m_pMat->m_Rgas;
         double T = m_pMat->m_Tabs;
@@ -442,7 +444,8 @@ void FESolutesDomain::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 
 		// create the element's stiffness matrix
 		int nsol = m_pMat->Solutes();
@@ -454,7 +457,7 @@ void FESolutesDomain::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 		ElementStiffness(el, ke, tp);
 
 		// get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -536,7 +539,7 @@ void FESolutesDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 	for (int n = 0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FESolutesMaterial::Point& spt = *(mp.ExtractData<FESolutesMaterial::Point>());
+		FESolutesMaterial::Point& spt = *(mp.GetData<FESolutesMaterial::Point>());
 
 		// material point data
 		for (int isol = 0; isol < nsol; ++isol) {
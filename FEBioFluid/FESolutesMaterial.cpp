@@ -156,8 +156,8 @@ void FESolutesMaterial::PartitionCoefficientFunctions(FEMaterialPoint& mp, vecto
 {
     int isol, jsol;
     
-    FEFluidMaterialPoint& fpt = *(mp.ExtractData<FEFluidMaterialPoint>());
-    FESolutesMaterial::Point& spt = *mp.ExtractData<FESolutesMaterial::Point>();
+    FEFluidMaterialPoint& fpt = *(mp.GetData<FEFluidMaterialPoint>());
+    FESolutesMaterial::Point& spt = *mp.GetData<FESolutesMaterial::Point>();
     
     const int nsol = (int)m_pSolute.size();
     
@@ -188,7 +188,7 @@ void FESolutesMaterial::PartitionCoefficientFunctions(FEMaterialPoint& mp, vecto
 //! actual concentration
 double FESolutesMaterial::Concentration(FEMaterialPoint& pt, const int sol)
 {
-	FESolutesMaterial::Point& spt = *pt.ExtractData<FESolutesMaterial::Point>();
+	FESolutesMaterial::Point& spt = *pt.GetData<FESolutesMaterial::Point>();
     
     // effective concentration
     double c = spt.m_c[sol];
@@ -200,7 +200,7 @@ double FESolutesMaterial::Concentration(FEMaterialPoint& pt, const int sol)
 //! actual concentration
 double FESolutesMaterial::ConcentrationActual(FEMaterialPoint& pt, const int sol)
 {
-    FESolutesMaterial::Point& spt = *pt.ExtractData<FESolutesMaterial::Point>();
+    FESolutesMaterial::Point& spt = *pt.GetData<FESolutesMaterial::Point>();
     
     // effective concentration
     double ca = spt.m_c[sol];
@@ -219,7 +219,7 @@ double FESolutesMaterial::PressureActual(FEMaterialPoint& pt)
 {
     int i;
     
-    FEFluidMaterialPoint& fpt = *pt.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& fpt = *pt.GetData<FEFluidMaterialPoint>();
     const int nsol = (int)m_pSolute.size();
     
     // effective pressure
@@ -246,7 +246,7 @@ double FESolutesMaterial::PressureActual(FEMaterialPoint& pt)
 
 vec3d FESolutesMaterial::SoluteFlux(FEMaterialPoint& pt, const int sol)
 {
-	FESolutesMaterial::Point& spt = *pt.ExtractData<FESolutesMaterial::Point>();
+	FESolutesMaterial::Point& spt = *pt.GetData<FESolutesMaterial::Point>();
     
     // concentration gradient
     vec3d gradc = spt.m_gradc[sol];
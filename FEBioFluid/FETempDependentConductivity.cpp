@@ -67,7 +67,7 @@ bool FETempDependentConductivity::Init()
 //! calculate thermal conductivity at material point
 double FETempDependentConductivity::ThermalConductivity(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double q = tf.m_T/m_Tr;
     return m_K->value(q);
 }
@@ -83,7 +83,7 @@ double FETempDependentConductivity::Tangent_Strain(FEMaterialPoint& mp)
 //! tangent of thermal conductivity with respect to temperature T
 double FETempDependentConductivity::Tangent_Temperature(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tf = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tf = *mp.GetData<FEThermoFluidMaterialPoint>();
     double q = tf.m_T/m_Tr;
     return m_K->derive(q);
 }
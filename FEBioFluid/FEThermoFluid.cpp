@@ -64,7 +64,7 @@ FEMaterialPoint* FEThermoFluid::CreateMaterialPointData()
 //! evaluate temperature
 double FEThermoFluid::Temperature(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tp = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tp = *mp.GetData<FEThermoFluidMaterialPoint>();
     return tp.m_T;
 }
 
@@ -72,7 +72,7 @@ double FEThermoFluid::Temperature(FEMaterialPoint& mp)
 //! bulk modulus
 double FEThermoFluid::BulkModulus(FEMaterialPoint& mp)
 {
-    FEFluidMaterialPoint& vt = *mp.ExtractData<FEFluidMaterialPoint>();
+    FEFluidMaterialPoint& vt = *mp.GetData<FEFluidMaterialPoint>();
     return -(vt.m_ef+1)*Tangent_Pressure_Strain(mp);
 }
 
@@ -80,7 +80,7 @@ double FEThermoFluid::BulkModulus(FEMaterialPoint& mp)
 //! heat flux
 vec3d FEThermoFluid::HeatFlux(FEMaterialPoint& mp)
 {
-    FEThermoFluidMaterialPoint& tp = *mp.ExtractData<FEThermoFluidMaterialPoint>();
+    FEThermoFluidMaterialPoint& tp = *mp.GetData<FEThermoFluidMaterialPoint>();
     double k = m_pConduct->ThermalConductivity(mp);
     vec3d q = -tp.m_gradT*k;
     return q;
@@ -37,6 +37,7 @@ SOFTWARE.*/
 #include <FECore/FEAnalysis.h>
 #include <FECore/sys.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -113,7 +114,7 @@ void FEThermoFluidDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int j=0; j<n; ++j)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+            FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
             pt.m_r0 = el.Evaluate(x0, j);
             
             if (pt.m_ef <= -1) {
@@ -134,8 +135,9 @@ void FEThermoFluidDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo&
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -183,8 +185,8 @@ void FEThermoFluidDomain3D::ElementInternalForce(FESolidElement& el, vector<doub
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEThermoFluidMaterialPoint& tf = *(mp.ExtractData<FEThermoFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEThermoFluidMaterialPoint& tf = *(mp.GetData<FEThermoFluidMaterialPoint>());
 
         // calculate the jacobian
         detJ = invjac0(el, Ji, n)*gw[n];
@@ -247,8 +249,9 @@ void FEThermoFluidDomain3D::BodyForce(FEGlobalVector& R, const FETimeInfo& tp, F
     int NE = (int)m_Elem.size();
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -292,7 +295,7 @@ void FEThermoFluidDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement& el
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double dens = m_pMat->Density(mp);
         
         pt.m_r0 = el.Evaluate(r0, n);
@@ -319,8 +322,9 @@ void FEThermoFluidDomain3D::HeatSupply(FEGlobalVector& R, const FETimeInfo& tp,
     int NE = (int)m_Elem.size();
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -364,7 +368,7 @@ void FEThermoFluidDomain3D::ElementHeatSupply(FEFluidHeatSupply& BF, FESolidElem
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double dens = m_pMat->Density(mp);
         
         pt.m_r0 = el.Evaluate(r0, n);
@@ -404,7 +408,7 @@ void FEThermoFluidDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidEl
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
 
         // calculate the jacobian
         detJ = detJ0(el, n)*gw[n]*tp.alphaf;
@@ -451,7 +455,7 @@ void FEThermoFluidDomain3D::ElementHeatSupplyStiffness(FEFluidHeatSupply& BF, FE
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *mp.ExtractData<FEFluidMaterialPoint>();
+        FEFluidMaterialPoint& pt = *mp.GetData<FEFluidMaterialPoint>();
         double Jf = 1 + pt.m_ef;
 
         // calculate the jacobian
@@ -520,8 +524,8 @@ void FEThermoFluidDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, con
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEThermoFluidMaterialPoint& tf = *(mp.ExtractData<FEThermoFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEThermoFluidMaterialPoint& tf = *(mp.GetData<FEThermoFluidMaterialPoint>());
         double Jf = 1 + pt.m_ef;
 
         // get the tangents
@@ -615,7 +619,8 @@ void FEThermoFluidDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 5*el.Nodes();
@@ -626,7 +631,7 @@ void FEThermoFluidDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo
         ElementStiffness(el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
 
@@ -646,7 +651,8 @@ void FEThermoFluidDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 5*el.Nodes();
@@ -657,7 +663,7 @@ void FEThermoFluidDomain3D::MassMatrix(FELinearSystem& LS, const FETimeInfo& tp)
         ElementMassMatrix(el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
         
@@ -677,7 +683,8 @@ void FEThermoFluidDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeI
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 5*el.Nodes();
@@ -688,7 +695,7 @@ void FEThermoFluidDomain3D::BodyForceStiffness(FELinearSystem& LS, const FETimeI
         ElementBodyForceStiffness(bf, el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
         
@@ -708,7 +715,8 @@ void FEThermoFluidDomain3D::HeatSupplyStiffness(FELinearSystem& LS, const FETime
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 5*el.Nodes();
@@ -719,7 +727,7 @@ void FEThermoFluidDomain3D::HeatSupplyStiffness(FELinearSystem& LS, const FETime
         ElementHeatSupplyStiffness(bf, el, ke, tp);
         
         // get the element's LM vector
-        vector<int> lm;
+        vector<int>& lm = ws.LM();
         UnpackLM(el, lm);
         ke.SetIndices(lm);
         
@@ -772,7 +780,7 @@ void FEThermoFluidDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke, co
         // setup the material point
         // NOTE: deformation gradient and determinant have already been evaluated in the stress routine
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         
         double dens = m_pMat->Density(mp);
         
@@ -878,8 +886,8 @@ void FEThermoFluidDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
-        FEThermoFluidMaterialPoint& tf = *(mp.ExtractData<FEThermoFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
+        FEThermoFluidMaterialPoint& tf = *(mp.GetData<FEThermoFluidMaterialPoint>());
         
         // material point data
         pt.m_vft = el.Evaluate(v, n);
@@ -913,8 +921,9 @@ void FEThermoFluidDomain3D::InertialForces(FEGlobalVector& R, const FETimeInfo&
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -953,7 +962,7 @@ void FEThermoFluidDomain3D::ElementInertialForce(FESolidElement& el, vector<doub
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        FEFluidMaterialPoint& pt = *(mp.GetData<FEFluidMaterialPoint>());
         double dens = m_pMat->Density(mp);
         
         // calculate the jacobian
@@ -379,6 +379,13 @@ void FEBioModel::Write(unsigned int nevent)
 	// update plot file
 	if (m_plot) WritePlot(nevent);
 
+	// at the end of a step, make sure all plot states are on file
+	if (m_plot && (nevent == CB_STEP_SOLVED))
+	{
+		FEBioPlotFile* plt = dynamic_cast<FEBioPlotFile*>(m_plot);
+		if (plt) plt->Flush();
+	}
+
 	// Dump converged state to the archive
 	DumpData(nevent);
 
@@ -1602,6 +1609,10 @@ void FEBioModel::on_cb_stepSolved()
 		feLog("\n L I N E A R   S O L V E R   S T A T S\n\n");
 		feLog("\tTotal calls to linear solver ........ : %d\n\n", nsolves);
 		feLog("\tAvg iterations per solve ............ : %lg\n\n", avgiters);
+		if (stats.reused > 0)
+			feLog("\tReused symbolic factorizations ...... : %d\n\n", stats.reused);
+		if (stats.refinements > 0)
+			feLog("\tIterative refinement steps .......... : %d\n\n", stats.refinements);
 	}
 
 	// add to stats
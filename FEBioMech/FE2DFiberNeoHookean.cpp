@@ -66,7 +66,7 @@ FE2DFiberNeoHookean::FE2DFiberNeoHookean(FEModel* pfem) : FEElasticMaterial(pfem
 
 mat3ds FE2DFiberNeoHookean::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d &F = pt.m_F;
 	double detF = pt.m_J;
@@ -154,7 +154,7 @@ mat3ds FE2DFiberNeoHookean::Stress(FEMaterialPoint& mp)
 
 tens4ds FE2DFiberNeoHookean::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
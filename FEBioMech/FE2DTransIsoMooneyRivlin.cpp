@@ -90,7 +90,7 @@ FE2DTransIsoMooneyRivlin::FE2DTransIsoMooneyRivlin(FEModel* pfem) : FEUncoupledM
 //! \param pt material point at which to evaluate the stress
 mat3ds FE2DTransIsoMooneyRivlin::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	const double third = 1.0/3.0;
 
@@ -203,7 +203,7 @@ mat3ds FE2DTransIsoMooneyRivlin::DevStress(FEMaterialPoint& mp)
 //! \param pt material point at which to evaulate the elasticity tensor
 tens4ds FE2DTransIsoMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the "fiber" direction
 	vec3d r = m_fiber(mp); r.unit();
@@ -74,7 +74,7 @@ FE2DTransIsoVerondaWestmann::FE2DTransIsoVerondaWestmann(FEModel* pfem) : FEUnco
 //! \param pt material point at which to evaluate the stress
 mat3ds FE2DTransIsoVerondaWestmann::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -180,7 +180,7 @@ mat3ds FE2DTransIsoVerondaWestmann::DevStress(FEMaterialPoint& mp)
 //! \param pt material point at which to evaulate the elasticity tensor
 tens4ds FE2DTransIsoVerondaWestmann::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double eps = m_epsf * std::numeric_limits<double>::epsilon();
 
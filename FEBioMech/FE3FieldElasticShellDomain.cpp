@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FECore/log.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 BEGIN_FECORE_CLASS(FE3FieldElasticShellDomain, FEElasticShellDomain)
@@ -125,7 +126,8 @@ void FE3FieldElasticShellDomain::StiffnessMatrix(FELinearSystem& LS)
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // create the element's stiffness matrix
         int ndof = 6*el.Nodes();
@@ -139,7 +141,7 @@ void FE3FieldElasticShellDomain::StiffnessMatrix(FELinearSystem& LS)
         ElementDilatationalStiffness(fem, iel, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -291,7 +293,7 @@ void FE3FieldElasticShellDomain::ElementStiffness(int iel, matrix& ke)
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // calculate the jacobian
         detJt = detJ(el, n);
@@ -488,7 +490,7 @@ void FE3FieldElasticShellDomain::UpdateElementStress(int iel)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
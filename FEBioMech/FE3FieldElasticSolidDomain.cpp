@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEUncoupledMaterial.h"
 #include <FECore/FEModel.h>
 #include "FECore/log.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 BEGIN_FECORE_CLASS(FE3FieldElasticSolidDomain, FEElasticSolidDomain)
@@ -134,14 +135,12 @@ void FE3FieldElasticSolidDomain::StiffnessMatrix(FELinearSystem& LS)
 	FEModel& fem = *GetFEModel();
 
 	// repeat over all solid elements
-	int NE = (int)m_Elem.size();
-	#pragma omp parallel for
-	for (int iel=0; iel<NE; ++iel)
-	{
+	AssembleElements(LS, [&](int iel) {
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 
 		// create the element's stiffness matrix
 		int ndof = 3*el.Nodes();
@@ -165,13 +164,13 @@ void FE3FieldElasticSolidDomain::StiffnessMatrix(FELinearSystem& LS)
 				ke[j][i] = ke[i][j];
 
 		// get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
 		// assemble element matrix in global stiffness matrix
 		LS.Assemble(ke);
-	}
+	});
 }
 
 //-----------------------------------------------------------------------------
@@ -303,7 +302,7 @@ void FE3FieldElasticSolidDomain::ElementMaterialStiffness(int iel, matrix &ke)
 		// setup the material point
 		// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// get the material's tangent
 		// Note that we are only grabbing the deviatoric tangent. 
@@ -422,7 +421,7 @@ void FE3FieldElasticSolidDomain::ElementGeometricalStiffness(int iel, matrix &ke
 
 		// get the material point data
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// element's Cauchy-stress tensor at gauss point n
 		// s is the voight vector
@@ -534,7 +533,7 @@ void FE3FieldElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo&
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// material point coordinates
 		// TODO: I'm not entirly happy with this solution
@@ -66,7 +66,7 @@ bool FEActiveFiberContraction::Init()
 //-----------------------------------------------------------------------------
 mat3ds FEActiveFiberContraction::FiberStress(const vec3d& a0, FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the deformation gradient
 	mat3d F = pt.m_F;
@@ -112,7 +112,7 @@ mat3ds FEActiveFiberContraction::FiberStress(const vec3d& a0, FEMaterialPoint& m
 //-----------------------------------------------------------------------------
 tens4ds FEActiveFiberContraction::FiberStiffness(const vec3d& a0, FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the deformation gradient
 	mat3d F = pt.m_F;
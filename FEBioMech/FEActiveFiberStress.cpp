@@ -52,7 +52,7 @@ FEActiveFiberStress::FEActiveFiberStress(FEModel* fem) : FEElasticMaterial(fem)
 
 mat3ds FEActiveFiberStress::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double dt = 0.0;
 
@@ -79,7 +79,7 @@ mat3ds FEActiveFiberStress::Stress(FEMaterialPoint& mp)
 
 tens4ds FEActiveFiberStress::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double dt = 1.0;
 
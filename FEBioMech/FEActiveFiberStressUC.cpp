@@ -52,7 +52,7 @@ FEActiveFiberStressUC::FEActiveFiberStressUC(FEModel* fem) : FEUncoupledMaterial
 
 mat3ds FEActiveFiberStressUC::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double dt = 0.0;
 
@@ -80,7 +80,7 @@ mat3ds FEActiveFiberStressUC::DevStress(FEMaterialPoint& mp)
 
 tens4ds FEActiveFiberStressUC::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double dt = 1.0;
 
@@ -39,7 +39,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEArrudaBoyce::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	const double a[] = {0.5, 0.1, 11.0/350.0, 19.0/1750.0, 519.0/134750.0};
 
@@ -67,7 +67,7 @@ mat3ds FEArrudaBoyce::DevStress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEArrudaBoyce::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	const double a[] = {0.5, 0.1, 11.0/350.0, 19.0/1750.0, 519.0/134750.0};
 
@@ -120,7 +120,7 @@ tens4ds FEArrudaBoyce::DevTangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEArrudaBoyce::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	const double a[] = {0.5, 0.1, 11.0/350.0, 19.0/1750.0, 519.0/134750.0};
     
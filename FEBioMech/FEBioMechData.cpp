@@ -156,7 +156,7 @@ double FENodeForceX::value(int nnode)
 	{
 		vector<double>& Fr = psolid_solver->m_Fr;
 		vector<double>& Fn = psolid_solver->m_Fn;
-		vector<int>& id = mesh.Node(nnode).m_ID;
+		int* id = mesh.Node(nnode).m_ID;
 
 		double Fx = 0.0;
 		if (id[0] >= 0) Fx = Fn[id[0]];
@@ -174,7 +174,7 @@ double FENodeForceY::value(int nnode)
 	if (psolid_solver)
 	{
 		vector<double>& Fr = psolid_solver->m_Fr;
-		vector<int>& id = mesh.Node(nnode).m_ID;
+		int* id = mesh.Node(nnode).m_ID;
 		return (-id[1] - 2 >= 0 ? Fr[-id[1]-2] : 0);
 	}
 	return 0;
@@ -188,7 +188,7 @@ double FENodeForceZ::value(int nnode)
 	if (psolid_solver)
 	{
 		vector<double>& Fr = psolid_solver->m_Fr;
-		vector<int>& id = mesh.Node(nnode).m_ID;
+		int* id = mesh.Node(nnode).m_ID;
 		return (-id[2] - 2 >= 0 ? Fr[-id[2]-2] : 0);
 	}
 	return 0;
@@ -201,7 +201,7 @@ double FELogContactGap::value(FESurfaceElement& el)
 	for (int i = 0; i < el.GaussPoints(); ++i)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(i);
-		FEContactMaterialPoint* cp = mp.ExtractData<FEContactMaterialPoint>();
+		FEContactMaterialPoint* cp = mp.GetData<FEContactMaterialPoint>();
 		if (cp)
 		{
 			g += cp->m_gap;
@@ -219,7 +219,7 @@ double FELogContactPressure::value(FESurfaceElement& el)
 	for (int i = 0; i < el.GaussPoints(); ++i)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(i);
-		FEContactMaterialPoint* cp = mp.ExtractData<FEContactMaterialPoint>();
+		FEContactMaterialPoint* cp = mp.GetData<FEContactMaterialPoint>();
 		if (cp)
 		{
 			Lm += cp->m_Ln;
@@ -237,7 +237,7 @@ double FELogElemPosX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_rt.x;
 	}
 	return val / (double) nint;
@@ -250,7 +250,7 @@ double FELogElemPosY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_rt.y;
 	}
 	return val / (double) nint;
@@ -263,7 +263,7 @@ double FELogElemPosZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_rt.z;
 	}
 	return val / (double) nint;
@@ -276,7 +276,7 @@ double FELogElemJacobian::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_J;
 	}
 	return val / (double) nint;
@@ -289,7 +289,7 @@ double FELogElemStrainX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		val += E.xx();
 	}
@@ -303,7 +303,7 @@ double FELogElemStrainY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		val += E.yy();
 	}
@@ -317,7 +317,7 @@ double FELogElemStrainZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		val += E.zz();
 	}
@@ -331,7 +331,7 @@ double FELogElemStrainXY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		val += E.xy();
 	}
@@ -345,7 +345,7 @@ double FELogElemStrainYZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		val += E.yz();
 	}
@@ -359,7 +359,7 @@ double FELogElemStrainXZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		val += E.xz();
 	}
@@ -374,7 +374,7 @@ double FELogElemStrain1::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		E.exact_eigen(l);
 		val += l[0];
@@ -390,7 +390,7 @@ double FELogElemStrainEffective::value(FEElement& el)
 	for (int n = 0; n < nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 		mat3ds C = ep.LeftCauchyGreen();
 		mat3dd I(1.0);
@@ -412,7 +412,7 @@ double FELogElemStrain2::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		E.exact_eigen(l);
 		val += l[1];
@@ -428,7 +428,7 @@ double FELogElemStrain3::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds E = pt.Strain();
 		E.exact_eigen(l);
 		val += l[2];
@@ -443,7 +443,7 @@ double FELogElemInfStrainX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds e = pt.SmallStrain();
 		val += e.xx();
 	}
@@ -457,7 +457,7 @@ double FELogElemInfStrainY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds e = pt.SmallStrain();
 		val += e.yy();
 	}
@@ -471,7 +471,7 @@ double FELogElemInfStrainZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds e = pt.SmallStrain();
 		val += e.zz();
 	}
@@ -485,7 +485,7 @@ double FELogElemInfStrainXY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds e = pt.SmallStrain();
 		val += e.xy();
 	}
@@ -499,7 +499,7 @@ double FELogElemInfStrainYZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds e = pt.SmallStrain();
 		val += e.yz();
 	}
@@ -513,7 +513,7 @@ double FELogElemInfStrainXZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds e = pt.SmallStrain();
 		val += e.xz();
 	}
@@ -527,7 +527,7 @@ double FELogElemRightStretchX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         val += U.xx();
     }
@@ -541,7 +541,7 @@ double FELogElemRightStretchY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         val += U.yy();
     }
@@ -555,7 +555,7 @@ double FELogElemRightStretchZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         val += U.zz();
     }
@@ -569,7 +569,7 @@ double FELogElemRightStretchXY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         val += U.xy();
     }
@@ -583,7 +583,7 @@ double FELogElemRightStretchYZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         val += U.yz();
     }
@@ -597,7 +597,7 @@ double FELogElemRightStretchXZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         val += U.xz();
     }
@@ -612,7 +612,7 @@ double FELogElemRightStretch1::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         U.exact_eigen(l);
         val += l[0];
@@ -628,7 +628,7 @@ double FELogElemRightStretch2::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         U.exact_eigen(l);
         val += l[1];
@@ -644,7 +644,7 @@ double FELogElemRightStretch3::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds U = pt.RightStretch();
         U.exact_eigen(l);
         val += l[2];
@@ -660,7 +660,7 @@ double FELogElemRightStretchEffective::value(FEElement& el)
     for (int n = 0; n < nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
         
         mat3ds U = ep.RightStretch();
         
@@ -679,7 +679,7 @@ double FELogElemLeftStretchX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         val += V.xx();
     }
@@ -693,7 +693,7 @@ double FELogElemLeftStretchY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         val += V.yy();
     }
@@ -707,7 +707,7 @@ double FELogElemLeftStretchZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         val += V.zz();
     }
@@ -721,7 +721,7 @@ double FELogElemLeftStretchXY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         val += V.xy();
     }
@@ -735,7 +735,7 @@ double FELogElemLeftStretchYZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         val += V.yz();
     }
@@ -749,7 +749,7 @@ double FELogElemLeftStretchXZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         val += V.xz();
     }
@@ -764,7 +764,7 @@ double FELogElemLeftStretch1::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         V.exact_eigen(l);
         val += l[0];
@@ -780,7 +780,7 @@ double FELogElemLeftStretch2::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         V.exact_eigen(l);
         val += l[1];
@@ -796,7 +796,7 @@ double FELogElemLeftStretch3::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds V = pt.LeftStretch();
         V.exact_eigen(l);
         val += l[2];
@@ -812,7 +812,7 @@ double FELogElemLeftStretchEffective::value(FEElement& el)
     for (int n = 0; n < nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
         
         mat3ds V = ep.LeftStretch();
         
@@ -831,7 +831,7 @@ double FELogElemRightHenckyX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         val += H.xx();
     }
@@ -845,7 +845,7 @@ double FELogElemRightHenckyY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         val += H.yy();
     }
@@ -859,7 +859,7 @@ double FELogElemRightHenckyZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         val += H.zz();
     }
@@ -873,7 +873,7 @@ double FELogElemRightHenckyXY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         val += H.xy();
     }
@@ -887,7 +887,7 @@ double FELogElemRightHenckyYZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         val += H.yz();
     }
@@ -901,7 +901,7 @@ double FELogElemRightHenckyXZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         val += H.xz();
     }
@@ -916,7 +916,7 @@ double FELogElemRightHencky1::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         H.exact_eigen(l);
         val += l[0];
@@ -932,7 +932,7 @@ double FELogElemRightHencky2::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         H.exact_eigen(l);
         val += l[1];
@@ -948,7 +948,7 @@ double FELogElemRightHencky3::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds H = pt.RightHencky();
         H.exact_eigen(l);
         val += l[2];
@@ -964,7 +964,7 @@ double FELogElemRightHenckyEffective::value(FEElement& el)
     for (int n = 0; n < nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
         
         mat3ds H = ep.RightHencky();
         
@@ -983,7 +983,7 @@ double FELogElemLeftHenckyX::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         val += h.xx();
     }
@@ -997,7 +997,7 @@ double FELogElemLeftHenckyY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         val += h.yy();
     }
@@ -1011,7 +1011,7 @@ double FELogElemLeftHenckyZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         val += h.zz();
     }
@@ -1025,7 +1025,7 @@ double FELogElemLeftHenckyXY::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         val += h.xy();
     }
@@ -1039,7 +1039,7 @@ double FELogElemLeftHenckyYZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         val += h.yz();
     }
@@ -1053,7 +1053,7 @@ double FELogElemLeftHenckyXZ::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         val += h.xz();
     }
@@ -1068,7 +1068,7 @@ double FELogElemLeftHencky1::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         h.exact_eigen(l);
         val += l[0];
@@ -1084,7 +1084,7 @@ double FELogElemLeftHencky2::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         h.exact_eigen(l);
         val += l[1];
@@ -1100,7 +1100,7 @@ double FELogElemLeftHencky3::value(FEElement& el)
     int nint = el.GaussPoints();
     for (int i=0; i<nint; ++i)
     {
-        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
         mat3ds h = pt.LeftHencky();
         h.exact_eigen(l);
         val += l[2];
@@ -1116,7 +1116,7 @@ double FELogElemLeftHenckyEffective::value(FEElement& el)
     for (int n = 0; n < nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
         
         mat3ds h = ep.LeftHencky();
         
@@ -1135,7 +1135,7 @@ double FELogElemStressX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_s.xx();
 	}
 	return val / (double) nint;
@@ -1148,7 +1148,7 @@ double FELogElemStressY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_s.yy();
 	}
 	return val / (double) nint;
@@ -1161,7 +1161,7 @@ double FELogElemStressZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_s.zz();
 	}
 	return val / (double) nint;
@@ -1174,7 +1174,7 @@ double FELogElemStressXY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_s.xy();
 	}
 	return val / (double) nint;
@@ -1187,7 +1187,7 @@ double FELogElemStressYZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_s.yz();
 	}
 	return val / (double) nint;
@@ -1200,7 +1200,7 @@ double FELogElemStressXZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_s.xz();
 	}
 	return val / (double) nint;
@@ -1214,7 +1214,7 @@ double FELogElemStressEffective::value(FEElement& el)
 	for (int n = 0; n < nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 		savg += ep.m_s;
 	}
@@ -1233,7 +1233,7 @@ double FELogElemStress1::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		pt.m_s.exact_eigen(l);
 		val += l[0];
 	}
@@ -1248,7 +1248,7 @@ double FELogElemStress2::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		pt.m_s.exact_eigen(l);
 		val += l[1];
 	}
@@ -1263,7 +1263,7 @@ double FELogElemStress3::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		pt.m_s.exact_eigen(l);
 		val += l[2];
 	}
@@ -1277,7 +1277,7 @@ double FELogElemPK2StressX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds S = pt.pull_back(pt.m_s);
 		val += S.xx();
 	}
@@ -1291,7 +1291,7 @@ double FELogElemPK2StressY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds S = pt.pull_back(pt.m_s);
 		val += S.yy();
 	}
@@ -1305,7 +1305,7 @@ double FELogElemPK2StressZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds S = pt.pull_back(pt.m_s);
 		val += S.zz();
 	}
@@ -1319,7 +1319,7 @@ double FELogElemPK2StressXY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds S = pt.pull_back(pt.m_s);
 		val += S.xy();
 	}
@@ -1333,7 +1333,7 @@ double FELogElemPK2StressYZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds S = pt.pull_back(pt.m_s);
 		val += S.yz();
 	}
@@ -1347,7 +1347,7 @@ double FELogElemPK2StressXZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		mat3ds S = pt.pull_back(pt.m_s);
 		val += S.xz();
 	}
@@ -1365,7 +1365,7 @@ double FELogElemStressEigenVector::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		s += pt.m_s;
 	}
 	s /= (double)nint;
@@ -1394,7 +1394,7 @@ double FELogElemDeformationGradientXX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(0,0);
 	}
 	return val / (double) nint;
@@ -1407,7 +1407,7 @@ double FELogElemDeformationGradientXY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(0,1);
 	}
 	return val / (double) nint;
@@ -1420,7 +1420,7 @@ double FELogElemDeformationGradientXZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(0,2);
 	}
 	return val / (double) nint;
@@ -1433,7 +1433,7 @@ double FELogElemDeformationGradientYX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(1,0);
 	}
 	return val / (double) nint;
@@ -1446,7 +1446,7 @@ double FELogElemDeformationGradientYY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(1,1);
 	}
 	return val / (double) nint;
@@ -1459,7 +1459,7 @@ double FELogElemDeformationGradientYZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(1,2);
 	}
 	return val / (double) nint;
@@ -1472,7 +1472,7 @@ double FELogElemDeformationGradientZX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(2,0);
 	}
 	return val / (double) nint;
@@ -1485,7 +1485,7 @@ double FELogElemDeformationGradientZY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(2,1);
 	}
 	return val / (double) nint;
@@ -1498,7 +1498,7 @@ double FELogElemDeformationGradientZZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *el.GetMaterialPoint(i)->GetData<FEElasticMaterialPoint>();
 		val += pt.m_F(2,2);
 	}
 	return val / (double) nint;
@@ -1570,7 +1570,7 @@ double FELogElemFiberStretch::value(FEElement& el)
 	for (int j=0; j<n; ++j)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-		FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 		mat3d Q = mat->GetLocalCS(mp);
 		vec3d ri = Q.col(0);
 		vec3d r = pt.m_F*ri;
@@ -1592,7 +1592,7 @@ double FELogElemFiberVectorX::value(FEElement& el)
 	for (int j = 0; j<n; ++j)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-		FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 		mat3d Q = mat->GetLocalCS(mp);
 
 		vec3d ri = Q.col(0);
@@ -1615,7 +1615,7 @@ double FELogElemFiberVectorY::value(FEElement& el)
 	for (int j = 0; j<n; ++j)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-		FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 		mat3d Q = mat->GetLocalCS(mp);
 
 		vec3d ri = Q.col(0);
@@ -1638,7 +1638,7 @@ double FELogElemFiberVectorZ::value(FEElement& el)
 	for (int j = 0; j<n; ++j)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-		FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 		mat3d Q = mat->GetLocalCS(mp);
 
 		vec3d ri = Q.col(0);
@@ -1658,28 +1658,28 @@ double FELogDamage::value(FEElement& el)
     for (int j=0; j<nint; ++j)
     {
         FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-        FEDamageMaterialPoint* ppd = pt.ExtractData<FEDamageMaterialPoint>();
-        FEElasticMixtureMaterialPoint* pem = pt.ExtractData<FEElasticMixtureMaterialPoint>();
-        FEMultigenerationMaterialPoint* pmg = pt.ExtractData<FEMultigenerationMaterialPoint>();
+        FEDamageMaterialPoint* ppd = pt.GetData<FEDamageMaterialPoint>();
+        FEElasticMixtureMaterialPoint* pem = pt.GetData<FEElasticMixtureMaterialPoint>();
+        FEMultigenerationMaterialPoint* pmg = pt.GetData<FEMultigenerationMaterialPoint>();
         if (ppd) D += (float) ppd->m_D;
         else if (pem) {
             for (int k=0; k<pem->Components(); ++k)
             {
-                FEDamageMaterialPoint* ppd = pem->GetPointData(k)->ExtractData<FEDamageMaterialPoint>();
+                FEDamageMaterialPoint* ppd = pem->GetPointData(k)->GetData<FEDamageMaterialPoint>();
                 if (ppd) D += (float) ppd->m_D;
             }
         }
         else if (pmg) {
             for (int k=0; k<pmg->Components(); ++k)
             {
-                FEDamageMaterialPoint* ppd = pt.GetPointData(k)->ExtractData<FEDamageMaterialPoint>();
-                FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
+                FEDamageMaterialPoint* ppd = pt.GetPointData(k)->GetData<FEDamageMaterialPoint>();
+                FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
                 if (ppd) D += (float) ppd->m_D;
                 else if (pem)
                 {
                     for (int l=0; l<pem->Components(); ++l)
                     {
-                        FEDamageMaterialPoint* ppd = pem->GetPointData(l)->ExtractData<FEDamageMaterialPoint>();
+                        FEDamageMaterialPoint* ppd = pem->GetPointData(l)->GetData<FEDamageMaterialPoint>();
                         if (ppd) D += (float) ppd->m_D;
                     }
                 }
@@ -1698,17 +1698,17 @@ double FELogOctahedralPlasticStrain::value(FEElement& el)
     for (int j=0; j<nint; ++j)
     {
         FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-        FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-        FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
-        FEElasticMixtureMaterialPoint* pem = pt.ExtractData<FEElasticMixtureMaterialPoint>();
-        FEMultigenerationMaterialPoint* pmg = pt.ExtractData<FEMultigenerationMaterialPoint>();
+        FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+        FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
+        FEElasticMixtureMaterialPoint* pem = pt.GetData<FEElasticMixtureMaterialPoint>();
+        FEMultigenerationMaterialPoint* pmg = pt.GetData<FEMultigenerationMaterialPoint>();
         if (prp) D += (float) prp->m_gp[0];
         else if (prd) D += (float) prd->m_gp[0];
         else if (pem) {
             for (int k=0; k<pem->Components(); ++k)
             {
-                FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-                FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+                FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
                 if (prp) D += (float) prp->m_gp[0];
                 else if (prd) D += (float) prd->m_gp[0];
             }
@@ -1716,17 +1716,17 @@ double FELogOctahedralPlasticStrain::value(FEElement& el)
         else if (pmg) {
             for (int k=0; k<pmg->Components(); ++k)
             {
-                FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-                FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
+                FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+                FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
+                FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
                 if (prp) D += (float) prp->m_gp[0];
                 else if (prd) D += (float) prd->m_gp[0];
                 else if (pem)
                 {
                     for (int l=0; l<pem->Components(); ++l)
                     {
-                        FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-                        FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                        FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+                        FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
                         if (prp) D += (float) prp->m_gp[0];
                         else if (prd) D += (float) prd->m_gp[0];
                     }
@@ -203,7 +203,7 @@ bool FEPlotContactGap::Save(FESurface& surf, FEDataStream& a)
 	}
 
 	writeAverageElementValue<double>(surf, a, [=](const FEMaterialPoint& mp) {
-		const FEContactMaterialPoint* pt = mp.ExtractData<FEContactMaterialPoint>();
+		const FEContactMaterialPoint* pt = mp.GetData<FEContactMaterialPoint>();
 		return (pt ? pt->m_gap : 0.0);
 	});
 	
@@ -252,7 +252,7 @@ bool FEPlotContactPressure::Save(FESurface &surf, FEDataStream& a)
 	}
 
 	writeAverageElementValue<double>(surf, a, [](const FEMaterialPoint& mp) {
-		const FEContactMaterialPoint* pt = mp.ExtractData<FEContactMaterialPoint>();
+		const FEContactMaterialPoint* pt = mp.GetData<FEContactMaterialPoint>();
 		return (pt ? pt->m_Ln : 0.0);
 	});
 
@@ -298,7 +298,7 @@ bool FEPlotNodalContactGap::Save(FESurface& surf, FEDataStream& a)
 	}
 
 	writeNodalProjectedElementValues<double>(surf, a, [](const FEMaterialPoint& mp) {
-		const FEContactMaterialPoint* pt = mp.ExtractData<FEContactMaterialPoint>();
+		const FEContactMaterialPoint* pt = mp.GetData<FEContactMaterialPoint>();
 		return (pt ? pt->m_gap : 0.0);
 	});
 	return true;
@@ -334,7 +334,7 @@ bool FEPlotNodalContactPressure::Save(FESurface &surf, FEDataStream& a)
     if (pcs == 0) return false;
     
 	writeNodalProjectedElementValues<double>(surf, a, [](const FEMaterialPoint& mp) {
-		const FEContactMaterialPoint* pt = mp.ExtractData<FEContactMaterialPoint>();
+		const FEContactMaterialPoint* pt = mp.GetData<FEContactMaterialPoint>();
 		return (pt ? pt->m_Ln : 0.0);
 	});
 
@@ -454,7 +454,7 @@ bool FEPlotContactPenalty::Save(FESurface& surf, FEDataStream& a)
 	if (ps)
 	{
 		writeAverageElementValue<double>(surf, a, [](const FEMaterialPoint& mp) {
-			const FEFacetSlidingSurface::Data& pt = *mp.ExtractData<FEFacetSlidingSurface::Data>();
+			const FEFacetSlidingSurface::Data& pt = *mp.GetData<FEFacetSlidingSurface::Data>();
 			return pt.m_eps;
 		});
 		return true;
@@ -464,7 +464,7 @@ bool FEPlotContactPenalty::Save(FESurface& surf, FEDataStream& a)
 	if (pse)
 	{
 		writeAverageElementValue<double>(surf, a, [](const FEMaterialPoint& mp) {
-			const FESlidingElasticSurface::Data& pt = *mp.ExtractData<FESlidingElasticSurface::Data>();
+			const FESlidingElasticSurface::Data& pt = *mp.GetData<FESlidingElasticSurface::Data>();
 			return pt.m_epsn;
 			});
 		return true;
@@ -488,7 +488,7 @@ bool FEPlotContactStatus::Save(FESurface& surf, FEDataStream& a)
 		for (int j = 0; j < nint; ++j)
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			FEFacetSlidingSurface::Data& pt = *mp.ExtractData<FEFacetSlidingSurface::Data>();
+			FEFacetSlidingSurface::Data& pt = *mp.GetData<FEFacetSlidingSurface::Data>();
 
 			if (pt.m_pme) nc++;
 		}
@@ -565,7 +565,7 @@ bool FEPlotElementVelocity::Save(FEDomain &dom, FEDataStream& a)
 	if ((pme == 0) || pme->IsRigid()) return false;
 
 	writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 		return pt.m_v;
 	});
 
@@ -579,7 +579,7 @@ bool FEPlotElementAcceleration::Save(FEDomain &dom, FEDataStream& a)
     if ((pme == 0) || pme->IsRigid()) return false;
 
 	writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 		return pt.m_a;
 	});
 
@@ -592,7 +592,7 @@ class FEStress
 public:
 	mat3ds operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
 		return (pt ? pt->m_s : mat3ds(0));
 	}
 };
@@ -620,7 +620,7 @@ bool FEPlotElementPK2Stress::Save(FEDomain& dom, FEDataStream& a)
 	if ((pme == 0) || pme->IsRigid()) return false;
 
 	writeAverageElementValue<mat3ds>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEElasticMaterialPoint& ep = *mp.ExtractData< FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData< FEElasticMaterialPoint>();
 		mat3ds s = ep.m_s;
 		mat3ds S = ep.pull_back(s);
 		return S;
@@ -637,7 +637,7 @@ bool FEPlotElementPK1Stress::Save(FEDomain& dom, FEDataStream& a)
 	if ((pme == 0) || pme->IsRigid()) return false;
 
 	writeAverageElementValue<mat3d>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEElasticMaterialPoint& ep = *mp.ExtractData< FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData< FEElasticMaterialPoint>();
 		mat3d  F = ep.m_F;
 		double J = F.det();
 		mat3ds s = ep.m_s;	// Cauchy stress
@@ -715,10 +715,10 @@ bool FEPlotElementMixtureStress::Save(FEDomain& dom, FEDataStream& a)
 		for (int n = 0; n < el.GaussPoints(); ++n)
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-			FEElasticMixtureMaterialPoint* mmp = mp.ExtractData< FEElasticMixtureMaterialPoint>();
+			FEElasticMixtureMaterialPoint* mmp = mp.GetData< FEElasticMixtureMaterialPoint>();
 			if (mmp)
 			{
-				FEElasticMaterialPoint& ep = *mmp->GetPointData(m_comp)->ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& ep = *mmp->GetPointData(m_comp)->GetData<FEElasticMaterialPoint>();
 				savg += ep.m_s;
 			}
 		}
@@ -739,7 +739,7 @@ bool FEPlotElementUncoupledPressure::Save(FEDomain& dom, FEDataStream& a)
    
     // write element data
 	writeAverageElementValue<double>(dom, a, [=](const FEMaterialPoint& mp) {
-		const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
 		if (pt == 0) return 0.0;
 		return -pmu->UJ(pt->m_J);   // use negative sign to get positive pressure in compression
 	});
@@ -843,7 +843,7 @@ class FESpecificStrainEnergy
 public:
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FERemodelingMaterialPoint* rpt = mp.ExtractData<FERemodelingMaterialPoint>();
+		const FERemodelingMaterialPoint* rpt = mp.GetData<FERemodelingMaterialPoint>();
 		return (rpt ? rpt->m_sed / rpt->m_rhor : 0.0);
 	}
 };
@@ -969,7 +969,7 @@ public:
 	FEDensity(FEElasticMaterial* pm) : m_mat(pm) {}
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 		double J = ep.m_F.det();
 		return m_mat->Density(const_cast<FEMaterialPoint&>(mp)) / J;
 	}
@@ -982,7 +982,7 @@ class FERemodelingDensity
 public:
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FERemodelingMaterialPoint* pt = (mp.ExtractData<FERemodelingMaterialPoint>());
+		const FERemodelingMaterialPoint* pt = (mp.GetData<FERemodelingMaterialPoint>());
 		return (pt ? pt->m_rhor : 0.0);
 	}
 };
@@ -1042,7 +1042,7 @@ public:
 	FEKineticEnergyDensity(FEElasticMaterial* pm) : m_mat(pm) {}
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& ep = *(mp.ExtractData<FEElasticMaterialPoint>());
+		const FEElasticMaterialPoint& ep = *(mp.GetData<FEElasticMaterialPoint>());
 		return 0.5*(ep.m_v*ep.m_v)*m_mat->Density(const_cast<FEMaterialPoint&>(mp));
 	}
 private:
@@ -1089,7 +1089,7 @@ bool FEPlotElementCenterOfMass::Save(FEDomain &dom, FEDataStream& a)
 			double m = 0;
 			for (int j = 0; j<el.GaussPoints(); ++j)
 			{
-				FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(j)->ExtractData<FEElasticMaterialPoint>());
+				FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(j)->GetData<FEElasticMaterialPoint>());
 				double detJ = bd.detJ0(el, j)*gw[j];
 				ew += pt.m_rt*(pme->Density(pt)*detJ);
 				m += pme->Density(pt)*detJ;
@@ -1113,7 +1113,7 @@ bool FEPlotElementCenterOfMass::Save(FEDomain &dom, FEDataStream& a)
 			double m = 0;
 			for (int j = 0; j<el.GaussPoints(); ++j)
 			{
-				FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(j)->ExtractData<FEElasticMaterialPoint>());
+				FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(j)->GetData<FEElasticMaterialPoint>());
 				double detJ = bd->detJ0(el, j)*gw[j];
 				ew += pt.m_rt*(pme->Density(pt)*detJ);
 				m += pme->Density(pt)*detJ;
@@ -1133,7 +1133,7 @@ public:
 	FEElementLinearMomentum(FEElasticMaterial* pm) : m_mat(pm) {}
 	vec3d operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		const FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 		return pt.m_v*m_mat->Density(const_cast<FEMaterialPoint&>(mp));
 	}
 
@@ -1170,7 +1170,7 @@ public:
 	FEElementAngularMomentum(FEElasticMaterial* pm) : m_mat(pm) {}
 	vec3d operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		const FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 		return (pt.m_rt ^ pt.m_v)*m_mat->Density(const_cast<FEMaterialPoint&>(mp));
 	}
 
@@ -1204,7 +1204,7 @@ class FEElementStressPower
 public:
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 		return  ep.m_s.dotdot(ep.m_L.sym())*ep.m_J;
 	}
 };
@@ -1236,7 +1236,7 @@ class FECurrentElementStrainEnergy
 public:
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 		return ep.m_Wt;
 	}
 };
@@ -1615,7 +1615,7 @@ bool FEPlotRelativeVolume::Save(FEDomain &dom, FEDataStream& a)
 	if (dom.Class() != FE_DOMAIN_SOLID) return false;
 
 	writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
 		return (pt ? pt->m_J : 0.0);
 	});
 
@@ -1647,7 +1647,7 @@ bool FEPlotFiberStretch::Save(FEDomain &dom, FEDataStream& a)
 
 	if (dom.Class() != FE_DOMAIN_SOLID) return false;
 	writeAverageElementValue<double>(dom, a, [&](const FEMaterialPoint& mp) -> double { 
-		const FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 		mat3d Q = pme->GetLocalCS(mp);
 		vec3d a0 = vec(mp); a0.unit();
 		vec3d ar = Q * a0;
@@ -1666,7 +1666,7 @@ public:
 	FEFiberVector(FEMaterial* pm, FEParamVec3& vec) : m_pm(pm), m_vec(vec) {}
 	vec3d operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint* pt = mp.ExtractData<const FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint* pt = mp.GetData<const FEElasticMaterialPoint>();
 		if (pt)
 		{
 			mat3d Q = m_pm->GetLocalCS(mp);
@@ -1758,7 +1758,7 @@ public:
 public:
 	double operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 		// get the deformation gradient
 		const mat3d& F = pt.m_F;
@@ -1814,7 +1814,7 @@ class FEPrincStresses
 public:
 	mat3dd operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 		const mat3ds& s = ep.m_s;
 		double l[3];
 		s.exact_eigen(l);
@@ -1841,7 +1841,7 @@ class FELagrangeStrain
 public:
 	mat3ds operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+		const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
 		if (pt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
 
 		mat3d C = pt->RightCauchyGreen();
@@ -1876,7 +1876,7 @@ class FERightStretch
 public:
     mat3ds operator()(const FEMaterialPoint& mp)
     {
-        const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+        const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
         if (pt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
             
         return pt->RightStretch();
@@ -1899,7 +1899,7 @@ class FELeftStretch
 public:
     mat3ds operator()(const FEMaterialPoint& mp)
     {
-        const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+        const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
         if (pt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
             
             return pt->LeftStretch();
@@ -1922,7 +1922,7 @@ class FERightHencky
 public:
     mat3ds operator()(const FEMaterialPoint& mp)
     {
-        const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+        const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
         if (pt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
             
         return pt->RightHencky();
@@ -1945,7 +1945,7 @@ class FELeftHencky
 public:
     mat3ds operator()(const FEMaterialPoint& mp)
     {
-        const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+        const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
         if (pt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
             
         return pt->LeftHencky();
@@ -1968,7 +1968,7 @@ class FERateOfDeformation
 public:
     mat3ds operator()(const FEMaterialPoint& mp)
     {
-        const FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+        const FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
         if (pt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
             
             return pt->RateOfDeformation();
@@ -2081,11 +2081,11 @@ bool FEPlotDamage::Save(FEDomain &dom, FEDataStream& a)
 			int nint = el.GaussPoints();
 			for (int j=0; j<nint; ++j)
 			{
-				FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEElasticMixtureMaterialPoint>();
+				FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEElasticMixtureMaterialPoint>();
 				for (int k=0; k<NC; ++k)
 				{
-					FEDamageMaterialPoint* ppd = pt.GetPointData(k)->ExtractData<FEDamageMaterialPoint>();
-                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->ExtractData<FEFatigueMaterialPoint>();
+					FEDamageMaterialPoint* ppd = pt.GetPointData(k)->GetData<FEDamageMaterialPoint>();
+                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->GetData<FEFatigueMaterialPoint>();
 					if (ppd) D += (float) ppd->m_D;
                     else if (ppf) D += (float) ppf->m_D;
 				}
@@ -2106,12 +2106,12 @@ bool FEPlotDamage::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEMultigenerationMaterialPoint>();
+                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEMultigenerationMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEDamageMaterialPoint* ppd = pt.GetPointData(k)->ExtractData<FEDamageMaterialPoint>();
-                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->ExtractData<FEFatigueMaterialPoint>();
-                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
+                    FEDamageMaterialPoint* ppd = pt.GetPointData(k)->GetData<FEDamageMaterialPoint>();
+                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->GetData<FEFatigueMaterialPoint>();
+                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
                     if (ppd) D += (float) ppd->m_D;
                     else if (ppf) D += (float) ppf->m_D;
                     else if (pem)
@@ -2119,8 +2119,8 @@ bool FEPlotDamage::Save(FEDomain &dom, FEDataStream& a)
                         int NE = (int)pem->m_w.size();
                         for (int l=0; l<NE; ++l)
                         {
-                            FEDamageMaterialPoint* ppd = pem->GetPointData(l)->ExtractData<FEDamageMaterialPoint>();
-                            FEFatigueMaterialPoint* ppf = pem->GetPointData(l)->ExtractData<FEFatigueMaterialPoint>();
+                            FEDamageMaterialPoint* ppd = pem->GetPointData(l)->GetData<FEDamageMaterialPoint>();
+                            FEFatigueMaterialPoint* ppf = pem->GetPointData(l)->GetData<FEFatigueMaterialPoint>();
                             if (ppd) D += (float) ppd->m_D;
                             else if (ppf) D += (float) ppf->m_D;
                         }
@@ -2142,9 +2142,9 @@ bool FEPlotDamage::Save(FEDomain &dom, FEDataStream& a)
 			for (int j=0; j<nint; ++j)
 			{
 				FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-				FEDamageMaterialPoint* ppd = pt.ExtractData<FEDamageMaterialPoint>();
-                FEFatigueMaterialPoint* ppf = pt.ExtractData<FEFatigueMaterialPoint>();
-                FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+				FEDamageMaterialPoint* ppd = pt.GetData<FEDamageMaterialPoint>();
+                FEFatigueMaterialPoint* ppf = pt.GetData<FEFatigueMaterialPoint>();
+                FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
 				if (ppd) D += (float) ppd->m_D;
                 else if (ppf) D += (float) ppf->m_D;
                 else if (prd) D += (float) prd->m_D;
@@ -2176,9 +2176,9 @@ bool FEPlotNestedDamage::Save(FEDomain &dom, FEDataStream& a)
         {
 			writeAverageElementValue<double>(dom, a, [=](const FEMaterialPoint& mp) {
 				FEMaterialPoint& mp_noconst = const_cast<FEMaterialPoint&>(mp);
-				FEElasticMixtureMaterialPoint& pt = *mp_noconst.ExtractData<FEElasticMixtureMaterialPoint>();
-				FEDamageMaterialPoint* ppd = pt.GetPointData(m_nmat)->ExtractData<FEDamageMaterialPoint>();
-				FEFatigueMaterialPoint* ppf = pt.GetPointData(m_nmat)->ExtractData<FEFatigueMaterialPoint>();
+				FEElasticMixtureMaterialPoint& pt = *mp_noconst.GetData<FEElasticMixtureMaterialPoint>();
+				FEDamageMaterialPoint* ppd = pt.GetPointData(m_nmat)->GetData<FEDamageMaterialPoint>();
+				FEFatigueMaterialPoint* ppf = pt.GetPointData(m_nmat)->GetData<FEFatigueMaterialPoint>();
 				double D = 0.0;
 				if (ppd) D += (float)ppd->m_D;
 				else if (ppf) D += (float)ppf->m_D;
@@ -2194,10 +2194,10 @@ bool FEPlotNestedDamage::Save(FEDomain &dom, FEDataStream& a)
         {
 			writeAverageElementValue<double>(dom, a, [=](const FEMaterialPoint& mp) {
 				FEMaterialPoint& mp_noconst = const_cast<FEMaterialPoint&>(mp);
-				FEMultigenerationMaterialPoint& pt = *mp_noconst.ExtractData<FEMultigenerationMaterialPoint>();
-				FEDamageMaterialPoint* ppd = pt.GetPointData(m_nmat)->ExtractData<FEDamageMaterialPoint>();
-				FEFatigueMaterialPoint* ppf = pt.GetPointData(m_nmat)->ExtractData<FEFatigueMaterialPoint>();
-				FEElasticMixtureMaterialPoint* pem = pt.GetPointData(m_nmat)->ExtractData<FEElasticMixtureMaterialPoint>();
+				FEMultigenerationMaterialPoint& pt = *mp_noconst.GetData<FEMultigenerationMaterialPoint>();
+				FEDamageMaterialPoint* ppd = pt.GetPointData(m_nmat)->GetData<FEDamageMaterialPoint>();
+				FEFatigueMaterialPoint* ppf = pt.GetPointData(m_nmat)->GetData<FEFatigueMaterialPoint>();
+				FEElasticMixtureMaterialPoint* pem = pt.GetPointData(m_nmat)->GetData<FEElasticMixtureMaterialPoint>();
 
 				double D = 0.0;
 				if (ppd) D += (float)ppd->m_D;
@@ -2207,8 +2207,8 @@ bool FEPlotNestedDamage::Save(FEDomain &dom, FEDataStream& a)
 					int NE = (int)pem->m_w.size();
 					for (int l = 0; l<NE; ++l)
 					{
-						FEDamageMaterialPoint* ppd = pem->GetPointData(l)->ExtractData<FEDamageMaterialPoint>();
-						FEFatigueMaterialPoint* ppf = pem->GetPointData(l)->ExtractData<FEFatigueMaterialPoint>();
+						FEDamageMaterialPoint* ppd = pem->GetPointData(l)->GetData<FEDamageMaterialPoint>();
+						FEFatigueMaterialPoint* ppf = pem->GetPointData(l)->GetData<FEFatigueMaterialPoint>();
 						if (ppd) D += (float)ppd->m_D;
 						else if (ppf) D += (float)ppf->m_D;
 					}
@@ -2221,8 +2221,8 @@ bool FEPlotNestedDamage::Save(FEDomain &dom, FEDataStream& a)
     else
     {
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEDamageMaterialPoint* ppd = mp.ExtractData<FEDamageMaterialPoint>();
-			const FEFatigueMaterialPoint* ppf = mp.ExtractData<FEFatigueMaterialPoint>();
+			const FEDamageMaterialPoint* ppd = mp.GetData<FEDamageMaterialPoint>();
+			const FEFatigueMaterialPoint* ppf = mp.GetData<FEFatigueMaterialPoint>();
 			double D = 0.0;
 			if (ppd) D += (float)ppd->m_D;
 			else if (ppf) D += (float)ppf->m_D;
@@ -2248,13 +2248,13 @@ bool FEPlotIntactBondFraction::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->ExtractData<FEFatigueMaterialPoint>();
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                    FEDamageMaterialPoint* ppd = pt.GetPointData(k)->ExtractData<FEDamageMaterialPoint>();
+                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->GetData<FEFatigueMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
+                    FEDamageMaterialPoint* ppd = pt.GetPointData(k)->GetData<FEDamageMaterialPoint>();
                     if (ppf) D += (float) ppf->m_wit;
                     else if (prp) D += (float) (1.0 - prp->YieldedBonds());
                     else if (prd) D += (float) prd->IntactBonds();
@@ -2277,14 +2277,14 @@ bool FEPlotIntactBondFraction::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEMultigenerationMaterialPoint>();
+                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEMultigenerationMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->ExtractData<FEFatigueMaterialPoint>();
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
-                    FEDamageMaterialPoint* ppd = pt.GetPointData(k)->ExtractData<FEDamageMaterialPoint>();
+                    FEFatigueMaterialPoint* ppf = pt.GetPointData(k)->GetData<FEFatigueMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
+                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
+                    FEDamageMaterialPoint* ppd = pt.GetPointData(k)->GetData<FEDamageMaterialPoint>();
                     if (ppf) D += (float) ppf->m_wit;
                     else if (prp) D += (float) (1 - prp->YieldedBonds());
                     else if (prd) D += (float) prd->IntactBonds();
@@ -2294,10 +2294,10 @@ bool FEPlotIntactBondFraction::Save(FEDomain &dom, FEDataStream& a)
                         int NE = (int)pem->m_w.size();
                         for (int l=0; l<NE; ++l)
                         {
-                            FEFatigueMaterialPoint* ppf = pem->GetPointData(l)->ExtractData<FEFatigueMaterialPoint>();
-                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                            FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                            FEDamageMaterialPoint* ppd = pem->GetPointData(l)->ExtractData<FEDamageMaterialPoint>();
+                            FEFatigueMaterialPoint* ppf = pem->GetPointData(l)->GetData<FEFatigueMaterialPoint>();
+                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                            FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
+                            FEDamageMaterialPoint* ppd = pem->GetPointData(l)->GetData<FEDamageMaterialPoint>();
                             if (ppf) D += (float) ppf->m_wit;
                             else if (prp) D += (float) (1-prp->YieldedBonds());
                             else if (prd) D += (float) prd->IntactBonds();
@@ -2321,10 +2321,10 @@ bool FEPlotIntactBondFraction::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<nint; ++j)
             {
                 FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-                FEFatigueMaterialPoint* ppf = pt.ExtractData<FEFatigueMaterialPoint>();
-                FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-                FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                FEDamageMaterialPoint* ppd = pt.ExtractData<FEDamageMaterialPoint>();
+                FEFatigueMaterialPoint* ppf = pt.GetData<FEFatigueMaterialPoint>();
+                FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+                FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
+                FEDamageMaterialPoint* ppd = pt.GetData<FEDamageMaterialPoint>();
                 if (ppf) D += (float) ppf->m_wit;
                 else if (prp) D += (float) (1-prp->YieldedBonds());
                 else if (prd) D += (float) prd->IntactBonds();
@@ -2352,11 +2352,11 @@ bool FEPlotYieldedBondFraction::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEReactivePlasticDamageMaterialPoint* ppp = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticDamageMaterialPoint* ppp = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
                     if (prp) D += (float) prp->YieldedBonds();
                     else if (ppp) D += (float) ppp->YieldedBonds();
                 }
@@ -2376,12 +2376,12 @@ bool FEPlotYieldedBondFraction::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEMultigenerationMaterialPoint>();
+                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEMultigenerationMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEReactivePlasticDamageMaterialPoint* ppp = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticDamageMaterialPoint* ppp = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
+                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
                     if (prp) D += (float) prp->YieldedBonds();
                     else if (ppp) D += (float) ppp->YieldedBonds();
                     else if (pem)
@@ -2389,8 +2389,8 @@ bool FEPlotYieldedBondFraction::Save(FEDomain &dom, FEDataStream& a)
                         int NE = (int)pem->m_w.size();
                         for (int l=0; l<NE; ++l)
                         {
-                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                            FEReactivePlasticDamageMaterialPoint* ppp = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                            FEReactivePlasticDamageMaterialPoint* ppp = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
                             if (prp) D += (float) prp->YieldedBonds();
                             else if (ppp) D += (float) ppp->YieldedBonds();
                         }
@@ -2411,8 +2411,8 @@ bool FEPlotYieldedBondFraction::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<nint; ++j)
             {
                 FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-                FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-                FEReactivePlasticDamageMaterialPoint* ppp = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+                FEReactivePlasticDamageMaterialPoint* ppp = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
                 if (prp) D += (float) prp->YieldedBonds();
                 else if (ppp) D += (float) ppp->YieldedBonds();
             }
@@ -2439,10 +2439,10 @@ bool FEPlotReactivePlasticityHeatSupply::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
                     if (prp) R += (float) prp->m_Rhat;
                 }
             }
@@ -2462,18 +2462,18 @@ bool FEPlotReactivePlasticityHeatSupply::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEMultigenerationMaterialPoint>();
+                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEMultigenerationMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
                     if (prp) R += (float) prp->m_Rhat;
                     else if (pem)
                     {
                         int NE = (int)pem->m_w.size();
                         for (int l=0; l<NE; ++l)
                         {
-                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
+                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
                             if (prp) R += (float) prp->m_Rhat;
                         }
                     }
@@ -2494,7 +2494,7 @@ bool FEPlotReactivePlasticityHeatSupply::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<nint; ++j)
             {
                 FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-                FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+                FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
                 if (prp) R += (float) prp->m_Rhat;
             }
             R /= (float) nint;
@@ -2520,11 +2520,11 @@ bool FEPlotOctahedralPlasticStrain::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
                     if (prp) D += (float) prp->m_gp[0];
                     else if (prd) D += (float) prd->m_gp[0];
                 }
@@ -2545,12 +2545,12 @@ bool FEPlotOctahedralPlasticStrain::Save(FEDomain &dom, FEDataStream& a)
             int nint = el.GaussPoints();
             for (int j=0; j<nint; ++j)
             {
-                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->ExtractData<FEMultigenerationMaterialPoint>();
+                FEMultigenerationMaterialPoint& pt = *el.GetMaterialPoint(j)->GetData<FEMultigenerationMaterialPoint>();
                 for (int k=0; k<NC; ++k)
                 {
-                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
-                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->ExtractData<FEElasticMixtureMaterialPoint>();
+                    FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                    FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
+                    FEElasticMixtureMaterialPoint* pem = pt.GetPointData(k)->GetData<FEElasticMixtureMaterialPoint>();
                     if (prp) D += (float) prp->m_gp[0];
                     else if (prd) D += (float) prd->m_gp[0];
                     else if (pem)
@@ -2558,8 +2558,8 @@ bool FEPlotOctahedralPlasticStrain::Save(FEDomain &dom, FEDataStream& a)
                         int NE = (int)pem->m_w.size();
                         for (int l=0; l<NE; ++l)
                         {
-                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->ExtractData<FEReactivePlasticityMaterialPoint>();
-                            FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                            FEReactivePlasticityMaterialPoint* prp = pt.GetPointData(k)->GetData<FEReactivePlasticityMaterialPoint>();
+                            FEReactivePlasticDamageMaterialPoint* prd = pt.GetPointData(k)->GetData<FEReactivePlasticDamageMaterialPoint>();
                             if (prp) D += (float) prp->m_gp[0];
                             else if (prd) D += (float) prd->m_gp[0];
                         }
@@ -2581,8 +2581,8 @@ bool FEPlotOctahedralPlasticStrain::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<nint; ++j)
             {
                 FEMaterialPoint& pt = *el.GetMaterialPoint(j);
-                FEReactivePlasticityMaterialPoint* prp = pt.ExtractData<FEReactivePlasticityMaterialPoint>();
-                FEReactivePlasticDamageMaterialPoint* prd = pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+                FEReactivePlasticityMaterialPoint* prp = pt.GetData<FEReactivePlasticityMaterialPoint>();
+                FEReactivePlasticDamageMaterialPoint* prd = pt.GetData<FEReactivePlasticDamageMaterialPoint>();
                 if (prp) D += (float) prp->m_gp[0];
                 else if (prd) D += (float) prd->m_gp[0];
             }
@@ -2602,7 +2602,7 @@ bool FEPlotMixtureVolumeFraction::Save(FEDomain &dom, FEDataStream &a)
 	if (pm == 0) return false;
 
 	writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-		const FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+		const FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 		return pt.m_w[0];
 	});
 
@@ -2645,7 +2645,7 @@ bool FEPlotShellStrain::Save(FEDomain &dom, FEDataStream &a)
     else 
 	{
 		writeAverageElementValue<mat3ds>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+			const FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 			return pt.Strain();
 		});
     }
@@ -2676,7 +2676,7 @@ bool FEPlotShellRelativeVolume::Save(FEDomain &dom, FEDataStream &a)
     }
     else {
 		writeAverageElementValue<mat3ds, double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+			const FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 			return pt.Strain();
 		}, getJfromE);
     }
@@ -2950,7 +2950,7 @@ bool FEPlotRigidReactionTorque::Save(FEDomain& dom, FEDataStream& a)
 bool FEPlotStressError::Save(FEDomain& dom, FEDataStream& a)
 {
 	writeRelativeError(dom, a, [](FEMaterialPoint& mp) {
-		FEElasticMaterialPoint* ep = mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint* ep = mp.GetData<FEElasticMaterialPoint>();
 		mat3ds& s = ep->m_s;
 		double v = s.effective_norm();
 		return v;
@@ -2988,8 +2988,8 @@ bool FEPlotFiberTargetStretch::Save(FEDomain& dom, FEDataStream& a)
 		for (int j = 0; j<nint; ++j)
 		{
 			FEMaterialPoint& mp = *e.GetMaterialPoint(j)->GetPointData(0);
-			FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
-			FEPrestrainMaterialPoint& pp = *mp.ExtractData<FEPrestrainMaterialPoint>();
+			FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
+			FEPrestrainMaterialPoint& pp = *mp.GetData<FEPrestrainMaterialPoint>();
 
 			mat3d Fp = pp.initialPrestrain();
 			mat3d Q = mat->GetLocalCS(mp);
@@ -3036,8 +3036,8 @@ bool FEPlotPreStrainStretch::Save(FEDomain& dom, FEDataStream& a)
 		for (int j = 0; j<nint; ++j)
 		{
 			FEMaterialPoint& mp = *e.GetMaterialPoint(j)->GetPointData(0);
-			FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-			FEPrestrainMaterialPoint& pp = *mp.ExtractData<FEPrestrainMaterialPoint>();
+			FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+			FEPrestrainMaterialPoint& pp = *mp.GetData<FEPrestrainMaterialPoint>();
 
 			mat3d& F = pt.m_F;
 			mat3d Fp = pp.prestrain();
@@ -3087,8 +3087,8 @@ bool FEPlotPreStrainStretchError::Save(FEDomain& dom, FEDataStream& a)
 		for (int j = 0; j<nint; ++j)
 		{
 			FEMaterialPoint& mp = *e.GetMaterialPoint(j)->GetPointData(0);
-			FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-			FEPrestrainMaterialPoint& pp = *mp.ExtractData<FEPrestrainMaterialPoint>();
+			FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+			FEPrestrainMaterialPoint& pp = *mp.GetData<FEPrestrainMaterialPoint>();
 
 			// initial fiber vector
 			mat3d Q = mat->GetLocalCS(mp);
@@ -3134,7 +3134,7 @@ bool FEPlotPreStrainCorrection::Save(FEDomain& dom, FEDataStream& a)
 		for (int j = 0; j<nint; ++j)
 		{
 			FEMaterialPoint& mp = *e.GetMaterialPoint(j)->GetPointData(0);
-			FEPrestrainMaterialPoint& pt = *mp.ExtractData<FEPrestrainMaterialPoint>();
+			FEPrestrainMaterialPoint& pt = *mp.GetData<FEPrestrainMaterialPoint>();
 
 			Fc += pt.PrestrainCorrection();
 		}
@@ -3186,7 +3186,7 @@ bool FEPlotSPRPreStrainCorrection::Save(FEDomain& dom, FEDataStream& a)
 			for (int j = 0; j<nint; ++j)
 			{
 				FEMaterialPoint& mp = *el.GetMaterialPoint(j)->GetPointData(0);
-				FEPrestrainMaterialPoint& pt = *mp.ExtractData<FEPrestrainMaterialPoint>();
+				FEPrestrainMaterialPoint& pt = *mp.GetData<FEPrestrainMaterialPoint>();
 				const mat3d& F = pt.PrestrainCorrection();
 				ED[i][j] = F(LUT[n][0], LUT[n][1]);
 			}
@@ -3271,7 +3271,7 @@ bool FEPlotPreStrainCompatibility::Save(FEDomain& dom, FEDataStream& a)
 			for (int j = 0; j<nint; ++j)
 			{
 				FEMaterialPoint& mp = *el.GetMaterialPoint(j)->GetPointData(0);
-				FEPrestrainMaterialPoint& pt = *mp.ExtractData<FEPrestrainMaterialPoint>();
+				FEPrestrainMaterialPoint& pt = *mp.GetData<FEPrestrainMaterialPoint>();
 				mat3d Fp = pt.prestrain();
 				ED[i][j] = Fp(LUT[n][0], LUT[n][1]);
 			}
@@ -93,7 +93,7 @@ double FEBondRelaxationExpDistortion::Relaxation(FEMaterialPoint& mp, const doub
     double tau0 = m_tau0(mp);
     double tau1 = m_tau1(mp);
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -140,7 +140,7 @@ bool FEBondRelaxationExpDistUser::Init()
 double FEBondRelaxationExpDistUser::Relaxation(FEMaterialPoint& mp, const double t, const mat3ds D)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -270,7 +270,7 @@ double FEBondRelaxationParkDistortion::Relaxation(FEMaterialPoint& mp, const dou
     double beta1 = m_beta1(mp);
 
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -322,7 +322,7 @@ double FEBondRelaxationParkDistUser::Relaxation(FEMaterialPoint& mp, const doubl
     double g;
     
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -401,7 +401,7 @@ double FEBondRelaxationPowerDistortion::Relaxation(FEMaterialPoint& mp, const do
     double alpha = m_alpha(mp);
 
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -454,7 +454,7 @@ double FEBondRelaxationPowerDistUser::Relaxation(FEMaterialPoint& mp, const doub
     double g;
     
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -659,7 +659,7 @@ double FEBondRelaxationMalkinDistUser::Relaxation(FEMaterialPoint& mp, const dou
     if (t == 0) return g;
     
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
@@ -753,7 +753,7 @@ double FEBondRelaxationCSexpDistUser::Relaxation(FEMaterialPoint& mp, const doub
     if (t == 0) return g;
 
     // get the elastic material point data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = pt.LeftHencky();
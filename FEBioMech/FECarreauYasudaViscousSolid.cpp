@@ -43,7 +43,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FECarreauYasudaViscousSolid::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     mat3ds D = pt.RateOfDeformation();
 //    double d[3];
@@ -67,7 +67,7 @@ mat3ds FECarreauYasudaViscousSolid::Stress(FEMaterialPoint& mp)
 tens4ds FECarreauYasudaViscousSolid::Tangent(FEMaterialPoint& mp)
 {
     FETimeInfo& tp = GetFEModel()->GetTime();
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     tens4ds Cv;
 
@@ -42,8 +42,8 @@ END_FECORE_CLASS();
 
 double FECarterHayesOld::StrainEnergy(FEMaterialPoint& mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	double detF = pt.m_J;
 	double lndetF = log(detF);
@@ -65,8 +65,8 @@ double FECarterHayesOld::StrainEnergy(FEMaterialPoint& mp)
 
 mat3ds FECarterHayesOld::Stress(FEMaterialPoint& mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	double detF = pt.m_J;
 	double detFi = 1.0/detF;
@@ -92,8 +92,8 @@ mat3ds FECarterHayesOld::Stress(FEMaterialPoint& mp)
 
 tens4ds FECarterHayesOld::Tangent(FEMaterialPoint& mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	double detF = pt.m_J;
@@ -121,14 +121,14 @@ tens4ds FECarterHayesOld::Tangent(FEMaterialPoint& mp)
 //! calculate tangent of strain energy density with mass density
 double FECarterHayesOld::Tangent_SE_Density(FEMaterialPoint& mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
     return StrainEnergy(mp)*m_g/rpt.m_rhor;
 }
 
 //! calculate tangent of stress with mass density
 mat3ds FECarterHayesOld::Tangent_Stress_Density(FEMaterialPoint& mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
     return Stress(mp)*m_g/rpt.m_rhor;
 }
 
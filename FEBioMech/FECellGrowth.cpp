@@ -56,7 +56,7 @@ bool FECellGrowth::Init()
 //-----------------------------------------------------------------------------
 mat3ds FECellGrowth::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -76,7 +76,7 @@ mat3ds FECellGrowth::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FECellGrowth::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -45,7 +45,7 @@ FECentrifugalBodyForce::FECentrifugalBodyForce(FEModel* pfem) : FEBodyForce(pfem
 
 vec3d FECentrifugalBodyForce::force(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3ds K = stiffness(mp);
 	return K*(pt.m_rt - c);
 }
@@ -74,7 +74,7 @@ FEMaterialPoint* FEConstPrestrainGradient::CreateMaterialPointData()
 //-----------------------------------------------------------------------------
 mat3d FEConstPrestrainGradient::Prestrain(FEMaterialPoint& mp)
 {
-	MaterialPointData& ep = *mp.ExtractData<MaterialPointData>();
+	MaterialPointData& ep = *mp.GetData<MaterialPointData>();
 
 	mat3d Fp = mat3dd(1.0) * (1.0 - m_ramp) + m_Fp(mp) * m_ramp;
 
@@ -84,8 +84,8 @@ mat3d FEConstPrestrainGradient::Prestrain(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 void FEConstPrestrainGradient::Initialize(const mat3d& F, FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
-	FEConstPrestrainGradient::MaterialPointData* ps = mp.ExtractData<FEConstPrestrainGradient::MaterialPointData>();
+	FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
+	FEConstPrestrainGradient::MaterialPointData* ps = mp.GetData<FEConstPrestrainGradient::MaterialPointData>();
 /*
 	// calculate left polar decomposition
 	mat3d R;
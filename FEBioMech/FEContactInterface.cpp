@@ -77,7 +77,7 @@ double FEContactInterface::AutoPenalty(FESurfaceElement& el, FESurface &s)
     if (pme) {
         // get a material point
         FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// backup the material point
 		mat3d F0 = pt.m_F;
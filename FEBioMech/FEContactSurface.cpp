@@ -106,7 +106,7 @@ void FEContactSurface::GetSurfaceTraction(int nface, vec3d& pt)
         mat3ds so[FEElement::MAX_NODES];
         for (int i=0; i<se->GaussPoints(); ++i) {
             FEMaterialPoint* pt = se->GetMaterialPoint(i);
-            FEElasticMaterialPoint* ep = pt->ExtractData<FEElasticMaterialPoint>();
+            FEElasticMaterialPoint* ep = pt->GetData<FEElasticMaterialPoint>();
             if (ep)
                 si[i] = ep->m_s;
             else
@@ -150,7 +150,7 @@ void FEContactSurface::GetNodalSurfaceTraction(int nface, vec3d* pt)
         mat3ds so[FEElement::MAX_NODES];
         for (int i=0; i<se->GaussPoints(); ++i) {
             FEMaterialPoint* pt = se->GetMaterialPoint(i);
-            FEElasticMaterialPoint* ep = pt->ExtractData<FEElasticMaterialPoint>();
+            FEElasticMaterialPoint* ep = pt->GetData<FEElasticMaterialPoint>();
             if (ep)
                 si[i] = ep->m_s;
             else
@@ -191,7 +191,7 @@ void FEContactSurface::GetGPSurfaceTraction(int nface, vec3d* pt)
         mat3ds so[FEElement::MAX_NODES];
         for (int i=0; i<se->GaussPoints(); ++i) {
             FEMaterialPoint* pt = se->GetMaterialPoint(i);
-            FEElasticMaterialPoint* ep = pt->ExtractData<FEElasticMaterialPoint>();
+            FEElasticMaterialPoint* ep = pt->GetData<FEElasticMaterialPoint>();
             if (ep)
                 si[i] = ep->m_s;
             else
@@ -229,7 +229,7 @@ void FEContactSurface::UnpackLM(FEElement& el, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		lm[3*i  ] = id[m_dofX];
 		lm[3*i+1] = id[m_dofY];
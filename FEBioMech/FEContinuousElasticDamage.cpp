@@ -139,13 +139,13 @@ FEDamageElasticFiber::FEDamageElasticFiber(FEModel* fem) : FEElasticFiberMateria
 
 double FEDamageElasticFiber::Damage(FEMaterialPoint& mp)
 {
-	FEFiberDamagePoint& damagePoint = *mp.ExtractData<FEFiberDamagePoint>();
+	FEFiberDamagePoint& damagePoint = *mp.GetData<FEFiberDamagePoint>();
 	return damagePoint.m_D;
 }
 
 double FEDamageElasticFiber::Damage(FEMaterialPoint& mp, int n)
 {
-	FEFiberDamagePoint& damagePoint = *mp.ExtractData<FEFiberDamagePoint>();
+	FEFiberDamagePoint& damagePoint = *mp.GetData<FEFiberDamagePoint>();
 	switch (n)
 	{
 	case 0: return damagePoint.m_D; break;
@@ -165,8 +165,8 @@ double FEDamageElasticFiber::Damage(FEMaterialPoint& mp, int n)
 //! Strain energy density
 double FEDamageElasticFiber::FiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEFiberDamagePoint& damagePoint = *mp.ExtractData<FEFiberDamagePoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEFiberDamagePoint& damagePoint = *mp.GetData<FEFiberDamagePoint>();
 
 	double D = damagePoint.m_D;
 	double psi0 = Psi0(mp, a0);
@@ -180,8 +180,8 @@ double FEDamageElasticFiber::FiberStrainEnergyDensity(FEMaterialPoint& mp, const
 // calculate stress in fiber direction a0
 mat3ds FEDamageElasticFiber::FiberStress(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEFiberDamagePoint& damagePoint = *mp.ExtractData<FEFiberDamagePoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEFiberDamagePoint& damagePoint = *mp.GetData<FEFiberDamagePoint>();
 
 	mat3d F = pt.m_F;
 
@@ -275,8 +275,8 @@ mat3ds FEDamageElasticFiber::FiberStress(FEMaterialPoint& mp, const vec3d& a0)
 // Spatial tangent
 tens4ds FEDamageElasticFiber::FiberTangent(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEFiberDamagePoint& damagePoint = *mp.ExtractData<FEFiberDamagePoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEFiberDamagePoint& damagePoint = *mp.GetData<FEFiberDamagePoint>();
 
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
@@ -379,7 +379,7 @@ FEMaterialPoint* FEDamageFiberPower::CreateMaterialPointData()
 
 double FEDamageFiberPower::Psi0(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3ds C = pt.RightCauchyGreen();
 	mat3ds C2 = C.sqr();
@@ -396,7 +396,7 @@ double FEDamageFiberPower::Psi0(FEMaterialPoint& mp, const vec3d& a0)
 
 mat3ds FEDamageFiberPower::dPsi0_dC(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d F = pt.m_F;
 	mat3ds C = pt.RightCauchyGreen();
@@ -421,8 +421,8 @@ mat3ds FEDamageFiberPower::dPsi0_dC(FEMaterialPoint& mp, const vec3d& a0)
 
 tens4ds FEDamageFiberPower::d2Psi0_dC(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEFiberDamagePoint& damagePoint = *mp.ExtractData<FEFiberDamagePoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEFiberDamagePoint& damagePoint = *mp.GetData<FEFiberDamagePoint>();
 
 	double k = 1.0 - 3.0*m_kappa / 2.0;
 
@@ -475,7 +475,7 @@ FEMaterialPoint* FEDamageFiberExponential::CreateMaterialPointData()
 //! Strain energy density
 double FEDamageFiberExponential::Psi0(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3ds C = pt.RightCauchyGreen();
 	double I1 = C.tr();
@@ -548,7 +548,7 @@ FEMaterialPoint* FEDamageFiberExpLinear::CreateMaterialPointData()
 
 double FEDamageFiberExpLinear::Psi0(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3ds C = pt.RightCauchyGreen();
 	double I4 = a0 * (C*a0);
 
@@ -558,7 +558,7 @@ double FEDamageFiberExpLinear::Psi0(FEMaterialPoint& mp, const vec3d& a0)
 
 mat3ds FEDamageFiberExpLinear::dPsi0_dC(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3ds C = pt.RightCauchyGreen();
 	double I4 = a0 * (C*a0);
 	double l = sqrt(I4);
@@ -570,7 +570,7 @@ mat3ds FEDamageFiberExpLinear::dPsi0_dC(FEMaterialPoint& mp, const vec3d& a0)
 
 tens4ds FEDamageFiberExpLinear::d2Psi0_dC(FEMaterialPoint& mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3ds C = pt.RightCauchyGreen();
 	double I4 = a0 * (C*a0);
 	double l = sqrt(I4);
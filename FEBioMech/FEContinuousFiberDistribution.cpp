@@ -76,8 +76,8 @@ void FEContinuousFiberDistribution::Serialize(DumpStream& ar)
 //! calculate stress at material point
 mat3ds FEContinuousFiberDistribution::Stress(FEMaterialPoint& mp)
 { 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEFiberMaterialPoint& fp = *mp.ExtractData<FEFiberMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FEFiberMaterialPoint& fp = *mp.GetData<FEFiberMaterialPoint>();
 
 	// calculate stress
 	mat3ds s; s.zero();
@@ -120,8 +120,8 @@ mat3ds FEContinuousFiberDistribution::Stress(FEMaterialPoint& mp)
 //! calculate tangent stiffness at material point
 tens4ds FEContinuousFiberDistribution::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEFiberMaterialPoint& fp = *mp.ExtractData<FEFiberMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FEFiberMaterialPoint& fp = *mp.GetData<FEFiberMaterialPoint>();
 
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
@@ -164,8 +164,8 @@ tens4ds FEContinuousFiberDistribution::Tangent(FEMaterialPoint& mp)
 //double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& pt) { return m_pFint->StrainEnergyDensity(pt); }
 double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
 { 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEFiberMaterialPoint& fp = *mp.ExtractData<FEFiberMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FEFiberMaterialPoint& fp = *mp.GetData<FEFiberMaterialPoint>();
 
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
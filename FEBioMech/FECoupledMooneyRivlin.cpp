@@ -42,7 +42,7 @@ END_FECORE_CLASS();
 mat3ds FECoupledMooneyRivlin::Stress(FEMaterialPoint& mp)
 {
 	// get the elastic material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -68,7 +68,7 @@ mat3ds FECoupledMooneyRivlin::Stress(FEMaterialPoint& mp)
 tens4ds FECoupledMooneyRivlin::Tangent(FEMaterialPoint& mp)
 {
 	// get material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor: B = F*Ft
 	mat3ds B = pt.LeftCauchyGreen();
@@ -97,7 +97,7 @@ tens4ds FECoupledMooneyRivlin::Tangent(FEMaterialPoint& mp)
 double FECoupledMooneyRivlin::StrainEnergyDensity(FEMaterialPoint& mp)
 {
 	// get the elastic material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// determinant of deformation gradient
 	double J = pt.m_J;
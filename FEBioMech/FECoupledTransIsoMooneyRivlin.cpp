@@ -56,7 +56,7 @@ FECoupledTransIsoMooneyRivlin::FECoupledTransIsoMooneyRivlin(FEModel* pfem) : FE
 mat3ds FECoupledTransIsoMooneyRivlin::Stress(FEMaterialPoint& mp)
 {
 	// get the material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor
 	mat3ds B = pt.LeftCauchyGreen();
@@ -119,7 +119,7 @@ mat3ds FECoupledTransIsoMooneyRivlin::Stress(FEMaterialPoint& mp)
 tens4ds FECoupledTransIsoMooneyRivlin::Tangent(FEMaterialPoint& mp)
 {
 	// get material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor: B = F*Ft
 	mat3ds B = pt.LeftCauchyGreen();
@@ -187,7 +187,7 @@ tens4ds FECoupledTransIsoMooneyRivlin::Tangent(FEMaterialPoint& mp)
 double FECoupledTransIsoMooneyRivlin::StrainEnergyDensity(FEMaterialPoint& mp)
 {
 	// get the material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate left Cauchy-Green tensor
 	mat3ds B = pt.LeftCauchyGreen();
@@ -55,7 +55,7 @@ FECoupledTransIsoVerondaWestmann::FECoupledTransIsoVerondaWestmann(FEModel* pfem
 mat3ds FECoupledTransIsoVerondaWestmann::Stress(FEMaterialPoint& mp)
 {
 	// get the material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor
 	mat3ds B = pt.LeftCauchyGreen();
@@ -118,7 +118,7 @@ mat3ds FECoupledTransIsoVerondaWestmann::Stress(FEMaterialPoint& mp)
 tens4ds FECoupledTransIsoVerondaWestmann::Tangent(FEMaterialPoint& mp)
 {
 	// get material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor: B = F*Ft
 	mat3ds B = pt.LeftCauchyGreen();
@@ -187,7 +187,7 @@ tens4ds FECoupledTransIsoVerondaWestmann::Tangent(FEMaterialPoint& mp)
 double FECoupledTransIsoVerondaWestmann::StrainEnergyDensity(FEMaterialPoint& mp)
 {
 	// get the material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate left Cauchy-Green tensor
 	mat3ds B = pt.LeftCauchyGreen();
@@ -85,7 +85,7 @@ bool FECubicCLE::Validate()
 //! Calculates the stress
 mat3ds FECubicCLE::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // Evaluate Lame coefficients
     double	lam[3][3];
@@ -137,7 +137,7 @@ mat3ds FECubicCLE::Stress(FEMaterialPoint& mp)
 //! Calculates the elasticity tensor
 tens4ds FECubicCLE::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // Evaluate Lame coefficients
     double	lam[3][3];
@@ -190,7 +190,7 @@ tens4ds FECubicCLE::Tangent(FEMaterialPoint& mp)
 //! Calculates the strain energy density
 double FECubicCLE::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // Evaluate Lame coefficients
     double	lam[3][3];
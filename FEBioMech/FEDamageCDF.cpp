@@ -50,7 +50,7 @@ END_FECORE_CLASS();
 double FEDamageCDF::Damage(FEMaterialPoint& mp) {
     
     // get the damage material point data
-    FEDamageMaterialPoint& dp = *mp.ExtractData<FEDamageMaterialPoint>();
+    FEDamageMaterialPoint& dp = *mp.GetData<FEDamageMaterialPoint>();
     
     // get the damage criterion (assuming dp.m_Etrial is up-to-date)
     double Es = max(dp.m_Etrial, dp.m_Emax);
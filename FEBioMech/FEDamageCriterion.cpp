@@ -229,7 +229,7 @@ mat3ds FEDamageCriterionMNS::CriterionStressTangent(FEMaterialPoint& pt)
 double FEDamageCriterionMNLS::DamageCriterion(FEMaterialPoint& mp)
 {
     // evaluate strain tensor
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     mat3ds E = pt.Strain();
     
     // evaluate principal normal strains
@@ -247,7 +247,7 @@ double FEDamageCriterionMNLS::DamageCriterion(FEMaterialPoint& mp)
 double FEDamageCriterionOSS::DamageCriterion(FEMaterialPoint& mp)
 {
     // evaluate strain tensor
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     mat3ds E = pt.Strain();
     
     mat3ds devE = E.dev();
@@ -261,7 +261,7 @@ double FEDamageCriterionOSS::DamageCriterion(FEMaterialPoint& mp)
 double FEDamageCriterionONS::DamageCriterion(FEMaterialPoint& mp)
 {
     // evaluate strain tensor
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     mat3ds h = pt.LeftHencky();
     
     mat3ds devh = h.dev();
@@ -111,7 +111,7 @@ double FEDamageMaterial::StrainEnergyDensity(FEMaterialPoint& pt)
 double FEDamageMaterial::Damage(FEMaterialPoint& pt)
 {
     // get the damage material point data
-    FEDamageMaterialPoint& pd = *pt.ExtractData<FEDamageMaterialPoint>();
+    FEDamageMaterialPoint& pd = *pt.GetData<FEDamageMaterialPoint>();
 
     // evaluate the trial value of the damage criterion
     // this must be done before evaluating the damage
@@ -37,6 +37,8 @@ SOFTWARE.*/
 // Define a material point that stores the damage variable.
 class FEDamageMaterialPoint : public FEMaterialPoint
 {
+	FEMATERIALPOINT_FLAT_ARENA_ALLOCATION(FEDamageMaterialPoint)
+
 public:
     FEDamageMaterialPoint(FEMaterialPoint *pt) : FEMaterialPoint(pt) {}
     
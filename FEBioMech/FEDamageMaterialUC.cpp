@@ -60,7 +60,7 @@ FEMaterialPoint* FEDamageMaterialUC::CreateMaterialPointData()
 mat3ds FEDamageMaterialUC::DevStress(FEMaterialPoint& pt)
 {
     // get the damage material point data
-	FEDamageMaterialPoint& pd = *pt.ExtractData<FEDamageMaterialPoint>();
+	FEDamageMaterialPoint& pd = *pt.GetData<FEDamageMaterialPoint>();
     
     // evaluate the trial value of the damage criterion
     // this must be done before evaluating the damage
@@ -81,7 +81,7 @@ mat3ds FEDamageMaterialUC::DevStress(FEMaterialPoint& pt)
 tens4ds FEDamageMaterialUC::DevTangent(FEMaterialPoint& pt)
 {
     // get the damage material point data
-	FEDamageMaterialPoint& pd = *pt.ExtractData<FEDamageMaterialPoint>();
+	FEDamageMaterialPoint& pd = *pt.GetData<FEDamageMaterialPoint>();
     
     // evaluate the trial value of the damage criterion
     // this must be done before evaluating the damage
@@ -102,7 +102,7 @@ tens4ds FEDamageMaterialUC::DevTangent(FEMaterialPoint& pt)
 double FEDamageMaterialUC::DevStrainEnergyDensity(FEMaterialPoint& pt)
 {
     // get the damage material point data
-	FEDamageMaterialPoint& pd = *pt.ExtractData<FEDamageMaterialPoint>();
+	FEDamageMaterialPoint& pd = *pt.GetData<FEDamageMaterialPoint>();
     
     // evaluate the trial value of the damage criterion
     // this must be done before evaluating the damage
@@ -123,7 +123,7 @@ double FEDamageMaterialUC::DevStrainEnergyDensity(FEMaterialPoint& pt)
 double FEDamageMaterialUC::Damage(FEMaterialPoint& pt)
 {
     // get the damage material point data
-    FEDamageMaterialPoint& pd = *pt.ExtractData<FEDamageMaterialPoint>();
+    FEDamageMaterialPoint& pd = *pt.GetData<FEDamageMaterialPoint>();
     
     // evaluate the trial value of the damage criterion
     // this must be done before evaluating the damage
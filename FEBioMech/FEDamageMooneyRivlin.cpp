@@ -60,7 +60,7 @@ bool FEDamageMooneyRivlin::Validate()
 //! Calculate the deviatoric stress
 mat3ds FEDamageMooneyRivlin::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -99,7 +99,7 @@ mat3ds FEDamageMooneyRivlin::DevStress(FEMaterialPoint& mp)
 //! Calculate the deviatoric tangent
 tens4ds FEDamageMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -156,7 +156,7 @@ tens4ds FEDamageMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 //! calculate deviatoric strain energy density
 double FEDamageMooneyRivlin::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate deviatoric left Cauchy-Green tensor
 	mat3ds B = pt.DevLeftCauchyGreen();
@@ -185,7 +185,7 @@ double FEDamageMooneyRivlin::DevStrainEnergyDensity(FEMaterialPoint& mp)
 // Calculate damage reduction factor 
 double FEDamageMooneyRivlin::Damage(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate right Cauchy-Green tensor
 	mat3ds C = pt.DevRightCauchyGreen();
@@ -199,7 +199,7 @@ double FEDamageMooneyRivlin::Damage(FEMaterialPoint &mp)
 	double SEF = c1*(I1 - 3) + c2*(I2 - 3);
 
 	// get the damage material point data
-	FEDamageMaterialPoint& dp = *mp.ExtractData<FEDamageMaterialPoint>();
+	FEDamageMaterialPoint& dp = *mp.GetData<FEDamageMaterialPoint>();
 
 	// calculate trial-damage parameter
 	dp.m_Etrial = sqrt(2.0*fabs(SEF));
@@ -68,7 +68,7 @@ bool FEDamageNeoHookean::Init()
 mat3ds FEDamageNeoHookean::Stress(FEMaterialPoint& mp)
 {
 	// --- A. Calculate neo-Hookean stress ----
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double detF = pt.m_J;
 	double detFi = 1.0/detF;
@@ -93,7 +93,7 @@ mat3ds FEDamageNeoHookean::Stress(FEMaterialPoint& mp)
 // Calculate damage reduction factor 
 double FEDamageNeoHookean::Damage(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate right Cauchy-Green tensor
 	mat3ds C = pt.RightCauchyGreen();
@@ -107,7 +107,7 @@ double FEDamageNeoHookean::Damage(FEMaterialPoint &mp)
 	double SEF = 0.5*m_mu*(I1 - 3) - m_mu*lnJ + 0.5*m_lam*(lnJ*lnJ);
 
 	// get the damage material point data
-	FEDamageMaterialPoint& dp = *mp.ExtractData<FEDamageMaterialPoint>();
+	FEDamageMaterialPoint& dp = *mp.GetData<FEDamageMaterialPoint>();
 
 	// calculate trial-damage parameter
 	dp.m_Etrial = sqrt(2.0*fabs(SEF));
@@ -129,7 +129,7 @@ double FEDamageNeoHookean::Damage(FEMaterialPoint &mp)
 // damage model For now, I don't modify it.
 tens4ds FEDamageNeoHookean::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	double detF = pt.m_J;
@@ -159,7 +159,7 @@ tens4ds FEDamageNeoHookean::Tangent(FEMaterialPoint& mp)
 double FEDamageNeoHookean::StrainEnergyDensity(FEMaterialPoint& mp)
 {
 	// --- A. Calculate neo-Hookean strain energy density ----
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	double J = pt.m_J;
     double lnJ = log(J);
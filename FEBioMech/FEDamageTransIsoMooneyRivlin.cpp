@@ -110,7 +110,7 @@ mat3ds FEDamageTransIsoMooneyRivlin::DevStress(FEMaterialPoint& mp)
 //! Calculate the deviatoric stress
 mat3ds FEDamageTransIsoMooneyRivlin::MatrixStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -145,7 +145,7 @@ mat3ds FEDamageTransIsoMooneyRivlin::MatrixStress(FEMaterialPoint& mp)
 // Calculate the fiber stress
 mat3ds FEDamageTransIsoMooneyRivlin::FiberStress(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -204,7 +204,7 @@ tens4ds FEDamageTransIsoMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 //! Calculate the deviatoric tangent
 tens4ds FEDamageTransIsoMooneyRivlin::MatrixTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -260,7 +260,7 @@ tens4ds FEDamageTransIsoMooneyRivlin::MatrixTangent(FEMaterialPoint& mp)
 //
 tens4ds FEDamageTransIsoMooneyRivlin::FiberTangent(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -306,7 +306,7 @@ tens4ds FEDamageTransIsoMooneyRivlin::FiberTangent(FEMaterialPoint &mp)
 	tens4ds c = (Id4 - IxI/3.0)*(4.0/3.0*Ji*WC) + IxI*(4.0/9.0*Ji*CWWC) + cw;
 
 	// see if we need to add the stress
-	FETIMRDamageMaterialPoint& dp = *mp.ExtractData<FETIMRDamageMaterialPoint>();
+	FETIMRDamageMaterialPoint& dp = *mp.GetData<FETIMRDamageMaterialPoint>();
 	if (dp.m_FEtrial > dp.m_FEmax)
 	{
 		mat3ds devs = pt.m_s.dev();
@@ -339,7 +339,7 @@ double FEDamageTransIsoMooneyRivlin::DevStrainEnergyDensity(FEMaterialPoint& mp)
 //! Calculate the matrix strain energy density
 double FEDamageTransIsoMooneyRivlin::MatrixStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate deviatoric left Cauchy-Green tensor
 	mat3ds B = pt.DevLeftCauchyGreen();
@@ -365,7 +365,7 @@ double FEDamageTransIsoMooneyRivlin::MatrixStrainEnergyDensity(FEMaterialPoint&
 // Calculate the fiber strain energy density
 double FEDamageTransIsoMooneyRivlin::FiberStrainEnergyDensity(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -400,7 +400,7 @@ double FEDamageTransIsoMooneyRivlin::FiberStrainEnergyDensity(FEMaterialPoint &m
 // Calculate damage reduction factor for matrix
 double FEDamageTransIsoMooneyRivlin::MatrixDamage(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate right Cauchy-Green tensor
 	mat3ds C = pt.DevRightCauchyGreen();
@@ -414,7 +414,7 @@ double FEDamageTransIsoMooneyRivlin::MatrixDamage(FEMaterialPoint &mp)
 	double SEF = m_c1*(I1 - 3) + m_c2*(I2 - 3);
 
 	// get the damage material point data
-	FETIMRDamageMaterialPoint& dp = *mp.ExtractData<FETIMRDamageMaterialPoint>();
+	FETIMRDamageMaterialPoint& dp = *mp.GetData<FETIMRDamageMaterialPoint>();
 
 	// calculate trial-damage parameter
 	dp.m_MEtrial = sqrt(2.0*fabs(SEF));
@@ -440,7 +440,7 @@ double FEDamageTransIsoMooneyRivlin::MatrixDamage(FEMaterialPoint &mp)
 // Calculate damage reduction factor for matrix
 double FEDamageTransIsoMooneyRivlin::MatrixDamageDerive(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate right Cauchy-Green tensor
 	mat3ds C = pt.DevRightCauchyGreen();
@@ -454,7 +454,7 @@ double FEDamageTransIsoMooneyRivlin::MatrixDamageDerive(FEMaterialPoint &mp)
 	double SEF = m_c1*(I1 - 3) + m_c2*(I2 - 3);
 
 	// get the damage material point data
-	FETIMRDamageMaterialPoint& dp = *mp.ExtractData<FETIMRDamageMaterialPoint>();
+	FETIMRDamageMaterialPoint& dp = *mp.GetData<FETIMRDamageMaterialPoint>();
 
 	// calculate trial-damage parameter
 	dp.m_MEtrial = sqrt(2.0*fabs(SEF));
@@ -481,7 +481,7 @@ double FEDamageTransIsoMooneyRivlin::MatrixDamageDerive(FEMaterialPoint &mp)
 // Calculate damage reduction factor for fibers
 double FEDamageTransIsoMooneyRivlin::FiberDamage(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -509,7 +509,7 @@ double FEDamageTransIsoMooneyRivlin::FiberDamage(FEMaterialPoint &mp)
 	double SEF = 0.5*m_c3/m_c4*(exp(m_c4*(I4-1)*(I4-1))-1);
 
 	// get the damage material point data
-	FETIMRDamageMaterialPoint& dp = *mp.ExtractData<FETIMRDamageMaterialPoint>();
+	FETIMRDamageMaterialPoint& dp = *mp.GetData<FETIMRDamageMaterialPoint>();
 
 	// calculate trial-damage parameter
 	dp.m_FEtrial = sqrt(2.0*fabs(SEF));
@@ -536,7 +536,7 @@ double FEDamageTransIsoMooneyRivlin::FiberDamage(FEMaterialPoint &mp)
 // Calculate damage reduction factor for fibers
 double FEDamageTransIsoMooneyRivlin::FiberDamageDerive(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -564,7 +564,7 @@ double FEDamageTransIsoMooneyRivlin::FiberDamageDerive(FEMaterialPoint &mp)
 	double SEF = 0.5*m_c3/m_c4*(exp(m_c4*(I4-1)*(I4-1))-1);
 
 	// get the damage material point data
-	FETIMRDamageMaterialPoint& dp = *mp.ExtractData<FETIMRDamageMaterialPoint>();
+	FETIMRDamageMaterialPoint& dp = *mp.GetData<FETIMRDamageMaterialPoint>();
 
 	// calculate trial-damage parameter
 	dp.m_FEtrial = sqrt(2.0*fabs(SEF));
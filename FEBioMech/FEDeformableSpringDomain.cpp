@@ -75,7 +75,7 @@ void FEDeformableSpringDomain::BuildMatrixProfile(FEGlobalMatrix& K)
 		for (int j=0; j<3; ++j)
 		{
 			int n = i-1+j;
-			vector<int>& id = Node(n).m_ID;
+			int* id = Node(n).m_ID;
 
 			// first the displacement dofs
 			lm[6 * j    ] = id[m_dofU[0]];
@@ -100,7 +100,7 @@ void FEDeformableSpringDomain::UnpackLM(FEElement &el, vector<int>& lm)
 	for (int i = 0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i    ] = id[m_dofU[0]];
@@ -449,9 +449,9 @@ void FEDeformableSpringDomain::StiffnessMatrix(FELinearSystem& LS)
 			ke[1][1] = -eps; ke[1][4] = 0.5*eps; ke[1][7] = 0.5*eps;
 			ke[2][2] = -eps; ke[2][5] = 0.5*eps; ke[2][8] = 0.5*eps;
 
-			vector<int>& IDi = Node(i).m_ID;
-			vector<int>& ID0 = Node(i0).m_ID;
-			vector<int>& ID1 = Node(i1).m_ID;
+			int* IDi = Node(i).m_ID;
+			int* ID0 = Node(i0).m_ID;
+			int* ID1 = Node(i1).m_ID;
 
 			lmi[0] = IDi[m_dofU[0]];
 			lmi[1] = IDi[m_dofU[1]];
@@ -546,7 +546,7 @@ void FEDeformableSpringDomain2::UnpackLM(FEElement &el, vector<int>& lm)
 	{
 		int n = (i==0? 0 : N-1);
 		FENode& node = Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i    ] = id[m_dofU[0]];
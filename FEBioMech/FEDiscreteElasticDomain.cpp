@@ -67,7 +67,7 @@ void FEDiscreteElasticDomain::UnpackLM(FEElement &el, vector<int>& lm)
 	for (int i = 0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i] = id[m_dofU[0]];
@@ -127,7 +127,7 @@ void FEDiscreteElasticDomain::InternalForces(FEGlobalVector& R)
 		{
 			// get the material point data
 			FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-			FEDiscreteElasticMaterialPoint& ep = *mp.ExtractData<FEDiscreteElasticMaterialPoint>();
+			FEDiscreteElasticMaterialPoint& ep = *mp.GetData<FEDiscreteElasticMaterialPoint>();
 
 			// evaluate the force
 			vec3d F = ep.m_Ft;
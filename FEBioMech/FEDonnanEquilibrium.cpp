@@ -110,7 +110,7 @@ bool FEDonnanEquilibrium::Init()
 //-----------------------------------------------------------------------------
 mat3ds FEDonnanEquilibrium::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -134,7 +134,7 @@ mat3ds FEDonnanEquilibrium::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEDonnanEquilibrium::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -170,7 +170,7 @@ tens4ds FEDonnanEquilibrium::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEDonnanEquilibrium::FixedChargeDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // jacobian
     double J = pt.m_J;
@@ -199,7 +199,7 @@ double FEDonnanEquilibrium::OsmoticPressure(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEDonnanEquilibrium::OsmoticPressureTangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // jacobian
     double J = pt.m_J;
@@ -231,7 +231,7 @@ double FEDonnanEquilibrium::Osmolarity(FEMaterialPoint& mp)
 void FEDonnanEquilibrium::UpdateSpecializedMaterialPoints(FEMaterialPoint& pt, const FETimeInfo& tp)
 {
     // get the Donnan equilibrium material point data
-    FEDonnanEquilibriumMaterialPoint& pd = *pt.ExtractData<FEDonnanEquilibriumMaterialPoint>();
+    FEDonnanEquilibriumMaterialPoint& pd = *pt.GetData<FEDonnanEquilibriumMaterialPoint>();
     
     pd.m_cFr = m_cFr(pt);
     pd.m_cF = FixedChargeDensity(pt);
@@ -53,7 +53,7 @@ FEEFDUncoupled::FEEFDUncoupled(FEModel* pfem) : FEUncoupledMaterial(pfem) {}
 //-----------------------------------------------------------------------------
 mat3ds FEEFDUncoupled::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	double J = pt.m_J;
 	// deviatoric deformation gradient
@@ -132,7 +132,7 @@ mat3ds FEEFDUncoupled::DevStress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEEFDUncoupled::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	double J = pt.m_J;
 	// deviatoric deformation gradient
@@ -231,7 +231,7 @@ double FEEFDUncoupled::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
     double sed = 0.0;
     
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	double J = pt.m_J;
 	// deviatoric deformation gradient
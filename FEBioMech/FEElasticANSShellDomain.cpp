@@ -37,6 +37,7 @@ SOFTWARE.*/
 #include <FECore/FESolidDomain.h>
 #include <FECore/FELinearSystem.h>
 #include "FEBioMech.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEElasticANSShellDomain::FEElasticANSShellDomain(FEModel* pfem) : FESSIShellDomain(pfem), FEElasticDomain(pfem), m_dofSA(pfem), m_dofR(pfem), m_dof(pfem)
@@ -123,8 +124,9 @@ void FEElasticANSShellDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NS; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
 		FEShellElementNew& el = m_Elem[i];
@@ -227,8 +229,9 @@ void FEElasticANSShellDomain::BodyForce(FEGlobalVector& R, FEBodyForce& BF)
     for (int i=0; i<NS; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
 		FEShellElementNew& el = m_Elem[i];
@@ -309,7 +312,8 @@ void FEElasticANSShellDomain::InertialForces(FEGlobalVector& R, vector<double>&
     
     for (int iel=0; iel<NE; ++iel)
     {
-        vector<double> fe;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
         vector<int> lm;
         
         FEShellElement& el = Element(iel);
@@ -439,7 +443,8 @@ void FEElasticANSShellDomain::StiffnessMatrix(FELinearSystem& LS)
 		FEShellElement& el = m_Elem[iel];
 
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         
@@ -447,7 +452,7 @@ void FEElasticANSShellDomain::StiffnessMatrix(FELinearSystem& LS)
         ElementStiffness(iel, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -467,7 +472,8 @@ void FEElasticANSShellDomain::MassMatrix(FELinearSystem& LS, double scale)
 		FEShellElementNew& el = m_Elem[iel];
 
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         ke.zero();
@@ -476,7 +482,7 @@ void FEElasticANSShellDomain::MassMatrix(FELinearSystem& LS, double scale)
         ElementMassMatrix(el, ke, scale);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -496,7 +502,8 @@ void FEElasticANSShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce
 		FEShellElementNew& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         ke.zero();
@@ -505,7 +512,7 @@ void FEElasticANSShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce
         ElementBodyForceStiffness(bf, el, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -809,7 +816,7 @@ void FEElasticANSShellDomain::ElementBodyForce(FEModel& fem, FEShellElementNew&
             for (int n=0; n<nint; ++n)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-                FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+                FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 				double dens0 = m_pMat->Density(mp);
                 
@@ -877,7 +884,7 @@ void FEElasticANSShellDomain::Update(const FETimeInfo& tp)
         for (n=0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-            FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+            FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
             
             // material point coordinates
             // TODO: I'm not entirly happy with this solution
@@ -911,7 +918,7 @@ void FEElasticANSShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[6*i  ] = id[m_dofU[0]];
@@ -1241,7 +1248,7 @@ void FEElasticANSShellDomain::EvaluateEh(FEShellElementNew& el, const int n, con
     int neln = el.Nodes();
     
     FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-    FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+    FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
     
     E = pt.Strain();
     
@@ -37,6 +37,7 @@ SOFTWARE.*/
 #include <FECore/FESolidDomain.h>
 #include <FECore/FELinearSystem.h>
 #include "FEBioMech.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEElasticEASShellDomain::FEElasticEASShellDomain(FEModel* pfem) : FESSIShellDomain(pfem), FEElasticDomain(pfem), m_dofSA(pfem), m_dofR(pfem), m_dof(pfem)
@@ -150,8 +151,9 @@ void FEElasticEASShellDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NS; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
 		FEShellElementNew& el = m_Elem[i];
@@ -277,8 +279,9 @@ void FEElasticEASShellDomain::BodyForce(FEGlobalVector& R, FEBodyForce& BF)
     for (int i=0; i<NS; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
 		FEShellElementNew& el = m_Elem[i];
@@ -359,7 +362,8 @@ void FEElasticEASShellDomain::InertialForces(FEGlobalVector& R, vector<double>&
     
     for (int iel=0; iel<NE; ++iel)
     {
-        vector<double> fe;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
         vector<int> lm;
         
         FEShellElement& el = Element(iel);
@@ -489,7 +493,8 @@ void FEElasticEASShellDomain::StiffnessMatrix(FELinearSystem& LS)
 		FEShellElement& el = m_Elem[iel];
 
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         
@@ -497,7 +502,7 @@ void FEElasticEASShellDomain::StiffnessMatrix(FELinearSystem& LS)
         ElementStiffness(iel, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -517,7 +522,8 @@ void FEElasticEASShellDomain::MassMatrix(FELinearSystem& LS, double scale)
 		FEShellElementNew& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         ke.zero();
@@ -526,7 +532,7 @@ void FEElasticEASShellDomain::MassMatrix(FELinearSystem& LS, double scale)
         ElementMassMatrix(el, ke, scale);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -546,7 +552,8 @@ void FEElasticEASShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce
 		FEShellElementNew& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         ke.zero();
@@ -555,7 +562,7 @@ void FEElasticEASShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce
         ElementBodyForceStiffness(bf, el, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -895,7 +902,7 @@ void FEElasticEASShellDomain::ElementBodyForce(FEModel& fem, FEShellElementNew&
             for (int n=0; n<nint; ++n)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-                FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+                FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
                 
                 // calculate density in current configuration
 				double dens0 = m_pMat->Density(mp);
@@ -1037,7 +1044,7 @@ void FEElasticEASShellDomain::Update(const FETimeInfo& tp)
         for (n=0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-            FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+            FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
             
             // material point coordinates
             // TODO: I'm not entirly happy with this solution
@@ -1085,7 +1092,7 @@ void FEElasticEASShellDomain::Update(const FETimeInfo& tp)
  for (n=0; n<nint; ++n)
  {
  FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
- FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+ FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
  
  // material point coordinates
  // TODO: I'm not entirly happy with this solution
@@ -1115,7 +1122,7 @@ void FEElasticEASShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[6*i  ] = id[m_dofU[0]];
@@ -1640,7 +1647,7 @@ void FEElasticEASShellDomain::EvaluateEh(FEShellElementNew& el, const int n, con
     int neln = el.Nodes();
     
     FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-    FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+    FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
     
     E = pt.Strain();
     
@@ -58,7 +58,7 @@ mat3ds FEElasticMaterial::SolidStress(FEMaterialPoint& pt)
 mat3ds FEElasticMaterial::SecantStress(FEMaterialPoint& mp)
 {
 	// extract the deformation gradient
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
 	mat3ds E = pt.Strain();
@@ -111,6 +111,6 @@ FEElasticStress::FEElasticStress() : FEDomainParameter("stress")
 
 FEParamValue FEElasticStress::value(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 	return ep.m_s;
 }
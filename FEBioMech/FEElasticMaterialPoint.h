@@ -36,6 +36,8 @@ SOFTWARE.*/
 //! This class defines material point data for elastic materials.
 class FEBIOMECH_API FEElasticMaterialPoint : public FEMaterialPoint
 {
+	FEMATERIALPOINT_FLAT_ARENA_ALLOCATION(FEElasticMaterialPoint)
+
 public:
 	//! constructor
 	FEElasticMaterialPoint();
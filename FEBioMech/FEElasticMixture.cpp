@@ -119,12 +119,12 @@ bool FEElasticMixture::Init()
 //! individual stress components. 
 mat3ds FEElasticMixture::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+	FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 	vector<double>& w = pt.m_w;
 	assert(w.size() == m_pMat.size());
 
 	// get the elastic material point
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate stress
 	mat3ds s; s.zero();
@@ -135,7 +135,7 @@ mat3ds FEElasticMixture::Stress(FEMaterialPoint& mp)
 		mpi->m_index = mp.m_index;
 
 		// copy the elastic material point data to the components
-		FEElasticMaterialPoint& epi = *mpi->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& epi = *mpi->GetData<FEElasticMaterialPoint>();
 		epi.m_rt = ep.m_rt;
 		epi.m_r0 = mp.m_r0;// ep.m_r0;
 		epi.m_F = ep.m_F;
@@ -153,12 +153,12 @@ mat3ds FEElasticMixture::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEElasticMixture::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+	FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 	vector<double>& w = pt.m_w;
 	assert(w.size() == m_pMat.size());
 
 	// get the elastic material point
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate elasticity tensor
 	tens4ds c(0.);
@@ -169,7 +169,7 @@ tens4ds FEElasticMixture::Tangent(FEMaterialPoint& mp)
 		mpi->m_index = mp.m_index;
 
 		// copy the elastic material point data to the components
-		FEElasticMaterialPoint& epi = *mpi->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& epi = *mpi->GetData<FEElasticMaterialPoint>();
 		epi.m_rt = ep.m_rt;
 		epi.m_r0 = mp.m_r0;// ep.m_r0;
 		epi.m_F = ep.m_F;
@@ -189,12 +189,12 @@ tens4ds FEElasticMixture::Tangent(FEMaterialPoint& mp)
 //! individual stress components.
 double FEElasticMixture::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+	FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 	vector<double>& w = pt.m_w;
 	assert(w.size() == m_pMat.size());
     
 	// get the elastic material point
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate strain energy density
 	double sed = 0.0;
@@ -205,7 +205,7 @@ double FEElasticMixture::StrainEnergyDensity(FEMaterialPoint& mp)
 		mpi->m_index = mp.m_index;
 
 		// copy the elastic material point data to the components
-		FEElasticMaterialPoint& epi = *mpi->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& epi = *mpi->GetData<FEElasticMaterialPoint>();
 		epi.m_rt = ep.m_rt;
 		epi.m_r0 = mp.m_r0;// ep.m_r0;
 		epi.m_F = ep.m_F;
@@ -225,12 +225,12 @@ double FEElasticMixture::StrainEnergyDensity(FEMaterialPoint& mp)
 //! individual stress components.
 double FEElasticMixture::StrongBondSED(FEMaterialPoint& mp)
 {
-    FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+    FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
     vector<double>& w = pt.m_w;
     assert(w.size() == m_pMat.size());
     
     // get the elastic material point
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate strain energy density
     double sed = 0.0;
@@ -241,7 +241,7 @@ double FEElasticMixture::StrongBondSED(FEMaterialPoint& mp)
         mpi->m_index = mp.m_index;
         
         // copy the elastic material point data to the components
-        FEElasticMaterialPoint& epi = *mpi->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *mpi->GetData<FEElasticMaterialPoint>();
         epi.m_rt = ep.m_rt;
         epi.m_r0 = mp.m_r0;// ep.m_r0;
         epi.m_F = ep.m_F;
@@ -261,12 +261,12 @@ double FEElasticMixture::StrongBondSED(FEMaterialPoint& mp)
 //! individual stress components.
 double FEElasticMixture::WeakBondSED(FEMaterialPoint& mp)
 {
-    FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+    FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
     vector<double>& w = pt.m_w;
     assert(w.size() == m_pMat.size());
     
     // get the elastic material point
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate strain energy density
     double sed = 0.0;
@@ -277,7 +277,7 @@ double FEElasticMixture::WeakBondSED(FEMaterialPoint& mp)
         mpi->m_index = mp.m_index;
         
         // copy the elastic material point data to the components
-        FEElasticMaterialPoint& epi = *mpi->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *mpi->GetData<FEElasticMaterialPoint>();
         epi.m_rt = ep.m_rt;
         epi.m_r0 = mp.m_r0;// ep.m_r0;
         epi.m_F = ep.m_F;
@@ -296,11 +296,11 @@ double FEElasticMixture::WeakBondSED(FEMaterialPoint& mp)
 //! specialized material points
 void FEElasticMixture::UpdateSpecializedMaterialPoints(FEMaterialPoint& mp, const FETimeInfo& tp)
 {
-    FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+    FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
     
     for (int i=0; i < (int) m_pMat.size(); ++i)
     {
-        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
         epi.m_elem = mp.m_elem;
         FEMaterial* pmj = GetMaterial(i);
         pmj->UpdateSpecializedMaterialPoints(epi, tp);
@@ -153,12 +153,12 @@ void FEMultigenerationMaterialPoint::Update(const FETimeInfo& timeInfo)
 	t = m_pmat->m_MG[igen]->btime;
 	if (t>m_tgen)
 	{
-		FEElasticMaterialPoint& pt = *((*this).ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *((*this).GetData<FEElasticMaterialPoint>());
 					
 		// push back F and J to define relative deformation gradient of this generation
 		mat3d F = pt.m_F;
 		double J = pt.m_J;
-        FEElasticMaterialPoint& pe = *(m_mp[m_ngen]->ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pe = *(m_mp[m_ngen]->GetData<FEElasticMaterialPoint>());
         pe.m_F = F.inverse();
         pe.m_J = 1.0/J;
 		m_tgen = t;
@@ -204,8 +204,8 @@ int FEElasticMultigeneration::CheckGeneration(const double t)
 //-----------------------------------------------------------------------------
 mat3ds FEElasticMultigeneration::Stress(FEMaterialPoint& mp)
 {
-	FEMultigenerationMaterialPoint& pt = *mp.ExtractData<FEMultigenerationMaterialPoint>();
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEMultigenerationMaterialPoint& pt = *mp.GetData<FEMultigenerationMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3ds s;
 	
@@ -219,7 +219,7 @@ mat3ds FEElasticMultigeneration::Stress(FEMaterialPoint& mp)
 	for (int i=0; i < pt.m_ngen; ++i)
 	{
         // evaluate deformation gradient for this generation
-        FEElasticMaterialPoint& epi = *pt.m_mp[i]->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.m_mp[i]->GetData<FEElasticMaterialPoint>();
         
         // store safe copies of Fi and Ji for this generation
         mat3d Fi = epi.m_F;
@@ -247,8 +247,8 @@ mat3ds FEElasticMultigeneration::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEElasticMultigeneration::Tangent(FEMaterialPoint& mp)
 {
-	FEMultigenerationMaterialPoint& pt = *mp.ExtractData<FEMultigenerationMaterialPoint>();
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEMultigenerationMaterialPoint& pt = *mp.GetData<FEMultigenerationMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 	
 	tens4ds c(0.);
 	
@@ -259,7 +259,7 @@ tens4ds FEElasticMultigeneration::Tangent(FEMaterialPoint& mp)
 	for (int i=0; i < pt.m_ngen; ++i)
 	{
 		// evaluate deformation gradient for this generation
-        FEElasticMaterialPoint& epi = *pt.m_mp[i]->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.m_mp[i]->GetData<FEElasticMaterialPoint>();
         
         // store safe copies of Fi and Ji for this generation
         mat3d Fi = epi.m_F;
@@ -287,8 +287,8 @@ tens4ds FEElasticMultigeneration::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEElasticMultigeneration::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEMultigenerationMaterialPoint& pt = *mp.ExtractData<FEMultigenerationMaterialPoint>();
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEMultigenerationMaterialPoint& pt = *mp.GetData<FEMultigenerationMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
 	double sed = 0.0;
 	
@@ -299,7 +299,7 @@ double FEElasticMultigeneration::StrainEnergyDensity(FEMaterialPoint& mp)
 	for (int i=0; i < pt.m_ngen; ++i)
 	{
         // evaluate deformation gradient for this generation
-        FEElasticMaterialPoint& epi = *pt.m_mp[i]->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.m_mp[i]->GetData<FEElasticMaterialPoint>();
         
         // store safe copies of Fi and Ji for this generation
         mat3d Fi = epi.m_F;
@@ -328,8 +328,8 @@ double FEElasticMultigeneration::StrainEnergyDensity(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEElasticMultigeneration::StrongBondSED(FEMaterialPoint& mp)
 {
-    FEMultigenerationMaterialPoint& pt = *mp.ExtractData<FEMultigenerationMaterialPoint>();
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEMultigenerationMaterialPoint& pt = *mp.GetData<FEMultigenerationMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     double sed = 0.0;
     
@@ -340,7 +340,7 @@ double FEElasticMultigeneration::StrongBondSED(FEMaterialPoint& mp)
     for (int i=0; i < pt.m_ngen; ++i)
     {
         // evaluate deformation gradient for this generation
-        FEElasticMaterialPoint& epi = *pt.m_mp[i]->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.m_mp[i]->GetData<FEElasticMaterialPoint>();
         
         // store safe copies of Fi and Ji for this generation
         mat3d Fi = epi.m_F;
@@ -369,8 +369,8 @@ double FEElasticMultigeneration::StrongBondSED(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEElasticMultigeneration::WeakBondSED(FEMaterialPoint& mp)
 {
-    FEMultigenerationMaterialPoint& pt = *mp.ExtractData<FEMultigenerationMaterialPoint>();
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEMultigenerationMaterialPoint& pt = *mp.GetData<FEMultigenerationMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     double sed = 0.0;
     
@@ -381,7 +381,7 @@ double FEElasticMultigeneration::WeakBondSED(FEMaterialPoint& mp)
     for (int i=0; i < pt.m_ngen; ++i)
     {
         // evaluate deformation gradient for this generation
-        FEElasticMaterialPoint& epi = *pt.m_mp[i]->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.m_mp[i]->GetData<FEElasticMaterialPoint>();
         
         // store safe copies of Fi and Ji for this generation
         mat3d Fi = epi.m_F;
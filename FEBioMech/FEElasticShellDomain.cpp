@@ -37,6 +37,7 @@ SOFTWARE.*/
 #include <FECore/FESolidDomain.h>
 #include <FECore/FELinearSystem.h>
 #include "FEBioMech.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEElasticShellDomain::FEElasticShellDomain(FEModel* pfem) : FESSIShellDomain(pfem), FEElasticDomain(pfem), m_dofV(pfem), m_dofSV(pfem), m_dofSA(pfem), m_dofR(pfem), m_dof(pfem)
@@ -137,7 +138,7 @@ void FEElasticShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int j=0; j<n; ++j)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+            FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
             pt.m_Wp = pt.m_Wt;
             
             mp.Update(timeInfo);
@@ -154,8 +155,9 @@ void FEElasticShellDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NS; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -200,7 +202,7 @@ void FEElasticShellDomain::ElementInternalForce(FEShellElement& el, vector<doubl
 	// repeat for all integration points
 	for (n=0; n<nint; ++n)
 	{
-		FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(n)->ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(n)->GetData<FEElasticMaterialPoint>());
 
 		// calculate the jacobian
         detJt = detJ(el, n, m_alphaf)*gw[n];
@@ -246,8 +248,9 @@ void FEElasticShellDomain::BodyForce(FEGlobalVector& R, FEBodyForce& BF)
     for (int i=0; i<NS; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -319,8 +322,9 @@ void FEElasticShellDomain::InertialForces(FEGlobalVector& R, vector<double>& F)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -350,7 +354,7 @@ void FEElasticShellDomain::ElementInertialForce(FEShellElement& el, vector<doubl
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         double dens = m_pMat->Density(mp);
         double J0 = detJ0(el, n)*el.GaussWeights()[n];
         
@@ -442,14 +446,12 @@ void FEElasticShellDomain::ElementBodyForceStiffness(FEBodyForce& BF, FEShellEle
 void FEElasticShellDomain::StiffnessMatrix(FELinearSystem& LS)
 {
     // repeat over all shell elements
-    int NS = (int)m_Elem.size();
-#pragma omp parallel for shared (NS)
-    for (int iel=0; iel<NS; ++iel)
-    {
+	AssembleElements(LS, [&](int iel) {
 		FEShellElement& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         
@@ -457,13 +459,13 @@ void FEElasticShellDomain::StiffnessMatrix(FELinearSystem& LS)
         ElementStiffness(iel, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
         // assemble element matrix in global stiffness matrix
 		LS.Assemble(ke);
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -476,7 +478,8 @@ void FEElasticShellDomain::MassMatrix(FELinearSystem& LS, double scale)
 		FEShellElement& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         ke.zero();
@@ -485,7 +488,7 @@ void FEElasticShellDomain::MassMatrix(FELinearSystem& LS, double scale)
         ElementMassMatrix(el, ke, scale);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -505,7 +508,8 @@ void FEElasticShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce& b
 		FEShellElement& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
         ke.resize(ndof, ndof);
         ke.zero();
@@ -514,7 +518,7 @@ void FEElasticShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce& b
         ElementBodyForceStiffness(bf, el, ke);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -553,7 +557,7 @@ void FEElasticShellDomain::ElementStiffness(int iel, matrix& ke)
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // calculate the jacobian
         detJt = detJ(el, n, m_alphaf)*gw[n]*m_alphaf;
@@ -836,7 +840,7 @@ void FEElasticShellDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
@@ -898,7 +902,7 @@ void FEElasticShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
 	for (int i=0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[6*i  ] = id[m_dofU[0]];
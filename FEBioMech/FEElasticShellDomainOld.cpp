@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/FELinearSystem.h>
 #include <math.h>
 #include "FEBioMech.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEElasticShellDomainOld::FEElasticShellDomainOld(FEModel* pfem) : FEShellDomainOld(pfem), FEElasticDomain(pfem), m_dofSU(pfem), m_dofSR(pfem), m_dofR(pfem), m_dof(pfem)
@@ -400,7 +401,7 @@ void FEElasticShellDomainOld::ElementInternalForce(FEShellElementOld& el, vector
 	// repeat for all integration points
 	for (n=0; n<nint; ++n)
 	{
-		FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(n)->ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(n)->GetData<FEElasticMaterialPoint>());
 
 		// calculate the jacobian
         detJt = detJ(el, n);
@@ -485,7 +486,7 @@ void FEElasticShellDomainOld::ElementBodyForce(FEBodyForce& BF, FEShellElementOl
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
         
         // calculate density in current configuration
         double dens = m_pMat->Density(mp)/pt.m_J;
@@ -528,7 +529,8 @@ void FEElasticShellDomainOld::StiffnessMatrix(FELinearSystem& LS)
 		FEMaterial* pmat = m_pMat;
 
 		// create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 6*el.Nodes();
 		ke.resize(ndof, ndof);
 
@@ -536,7 +538,7 @@ void FEElasticShellDomainOld::StiffnessMatrix(FELinearSystem& LS)
 		ElementStiffness(iel, ke);
 
 		// get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -575,7 +577,7 @@ void FEElasticShellDomainOld::ElementStiffness(int iel, matrix& ke)
 	for (n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
         // calculate the jacobian
         detJt = detJ(el, n);
@@ -690,7 +692,7 @@ void FEElasticShellDomainOld::ElementBodyForce(FEModel& fem, FEShellElementOld&
             for (int n=0; n<nint; ++n)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-                FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+                FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
                 
                 // calculate density in current configuration
                 double dens = m_pMat->Density(mp)/pt.m_J;
@@ -762,7 +764,7 @@ void FEElasticShellDomainOld::Update(const FETimeInfo& tp)
 		for (n=0; n<nint; ++n)
 		{
 			FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
-			FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+			FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 			// material point coordinates
 			// TODO: I'm not entirly happy with this solution
@@ -793,7 +795,7 @@ void FEElasticShellDomainOld::UnpackLM(FEElement& el, vector<int>& lm)
 	for (int i=0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[6*i  ] = id[m_dofSU[0]];
@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioMech.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -48,6 +49,12 @@ FEElasticSolidDomain::FEElasticSolidDomain(FEModel* pfem) : FESolidDomain(pfem),
     m_alpham = 2;
 	m_update_dynamic = true; // default for backward compatibility
 
+	// use the generic element kernels until the element type is known
+	m_forceKernel = &FEElasticSolidDomain::InternalForceGeneric;
+	m_geomKernel  = &FEElasticSolidDomain::GeometricalStiffnessGeneric;
+	m_matKernel   = &FEElasticSolidDomain::MaterialStiffnessGeneric;
+	m_kinKernel   = &FEElasticSolidDomain::KinematicsGeneric;
+
 	// TODO: Move this elsewhere since there is no error checking
 	if (pfem)
 	{
@@ -147,7 +154,7 @@ void FEElasticSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 			for (int j = 0; j < n; ++j)
 			{
 				FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-				FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 				pt.m_Wp = pt.m_Wt;
 
 				mp.Update(timeInfo);
@@ -168,8 +175,9 @@ void FEElasticSolidDomain::InternalForces(FEGlobalVector& R)
 
 		if (el.isActive()) {
 			// element force vector
-			vector<double> fe;
-			vector<int> lm;
+			FEElementWorkspace& ws = ElementWorkspace();
+			vector<double>& fe = ws.ForceVector();
+			vector<int>& lm = ws.LM();
 
 			// get the element force vector and initialize it to zero
 			int ndof = 3 * el.Nodes();
@@ -191,6 +199,12 @@ void FEElasticSolidDomain::InternalForces(FEGlobalVector& R)
 //! calculates the internal equivalent nodal forces for solid elements
 
 void FEElasticSolidDomain::ElementInternalForce(FESolidElement& el, vector<double>& fe)
+{
+	(this->*m_forceKernel)(el, fe);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::InternalForceGeneric(FESolidElement& el, vector<double>& fe)
 {
 	// jacobian matrix, inverse jacobian matrix and determinants
 	double Ji[3][3];
@@ -204,7 +218,7 @@ void FEElasticSolidDomain::ElementInternalForce(FESolidElement& el, vector<doubl
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// calculate the jacobian
 		double detJt = (m_update_dynamic ? invjact(el, Ji, n, m_alphaf) : invjact(el, Ji, n));
@@ -278,6 +292,25 @@ void FEElasticSolidDomain::BodyForce(FEGlobalVector& R, FEBodyForce& BF)
 //-----------------------------------------------------------------------------
 //! calculates element's geometrical stiffness component for integration point n
 void FEElasticSolidDomain::ElementGeometricalStiffness(FESolidElement &el, matrix &ke)
+{
+	GeometricalStiffness(el, ke, false);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::ElementGeometricalStiffnessSymm(FESolidElement &el, matrix &ke)
+{
+	GeometricalStiffness(el, ke, true);
+}
+
+//-----------------------------------------------------------------------------
+// If bsymm is true, only the blocks j >= i are evaluated.
+void FEElasticSolidDomain::GeometricalStiffness(FESolidElement &el, matrix &ke, bool bsymm)
+{
+	(this->*m_geomKernel)(el, ke, bsymm);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::GeometricalStiffnessGeneric(FESolidElement &el, matrix &ke, bool bsymm)
 {
 	// spatial derivatives of shape functions
 	vec3d G[FEElement::MAX_NODES];
@@ -295,13 +328,13 @@ void FEElasticSolidDomain::ElementGeometricalStiffness(FESolidElement &el, matri
 
 		// get the material point data
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// element's Cauchy-stress tensor at gauss point n
 		mat3ds& s = pt.m_s;
 
 		for (int i = 0; i<neln; ++i)
-			for (int j = 0; j<neln; ++j)
+			for (int j = (bsymm ? i : 0); j<neln; ++j)
 			{
 				double kab = (G[i]*(s * G[j]))*w;
 
@@ -316,6 +349,25 @@ void FEElasticSolidDomain::ElementGeometricalStiffness(FESolidElement &el, matri
 //! Calculates element material stiffness element matrix
 
 void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &ke)
+{
+	MaterialStiffness(el, ke, false);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::ElementMaterialStiffnessSymm(FESolidElement &el, matrix &ke)
+{
+	MaterialStiffness(el, ke, true);
+}
+
+//-----------------------------------------------------------------------------
+// If bsymm is true, only the blocks j >= i are evaluated.
+void FEElasticSolidDomain::MaterialStiffness(FESolidElement &el, matrix &ke, bool bsymm)
+{
+	(this->*m_matKernel)(el, ke, bsymm);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::MaterialStiffnessGeneric(FESolidElement &el, matrix &ke, bool bsymm)
 {
 	// Get the current element's data
 	const int nint = el.GaussPoints();
@@ -339,31 +391,31 @@ void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &
 	// weights at gauss points
 	const double *gw = el.GaussWeights();
 
+	// evaluate the material tangent at all integration points
+	// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
+	FEMaterialPoint* mps[FEElement::MAX_INTPOINTS];
+	tens4dmm C[FEElement::MAX_INTPOINTS];
+	for (int n=0; n<nint; ++n) mps[n] = el.GetMaterialPoint(n);
+	m_pMat->BatchTangent(mps, C, nint);
+
 	// calculate element stiffness matrix
 	for (int n=0; n<nint; ++n)
 	{
 		// calculate jacobian and shape function gradients
 		detJt = ShapeGradient(el, n, G, m_alphaf)*gw[n]*m_alphaf;
 
-		// setup the material point
-		// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
-		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-
 		// get the 'D' matrix
-//		tens4ds C = m_pMat->Tangent(mp);
-        tens4dmm C = m_pMat->SolidTangent(mp);
-		C.extract(D);
+		C[n].extract(D);
 
-		// we only calculate the upper triangular part
-		// since ke is symmetric. The other part is
-		// determined below using this symmetry.
+		// for symmetric matrices we only calculate the upper triangular part.
 		for (int i=0, i3=0; i<neln; ++i, i3 += 3)
 		{
 			Gxi = G[i].x;
 			Gyi = G[i].y;
 			Gzi = G[i].z;
 
-			for (int j=0, j3 = 0; j<neln; ++j, j3 += 3)
+			int j0 = (bsymm ? i : 0);
+			for (int j=j0, j3 = 3*j0; j<neln; ++j, j3 += 3)
 			{
 				Gxj = G[j].x;
 				Gyj = G[j].y;
@@ -413,45 +465,48 @@ void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &
 //-----------------------------------------------------------------------------
 void FEElasticSolidDomain::StiffnessMatrix(FELinearSystem& LS)
 {
+	// For symmetric systems, we only need the upper triangular part of the element matrices.
+	bool bsymm = LS.SymmetricElementMatrices();
+
 	// repeat over all solid elements
-	int NE = Elements();
-	
-	#pragma omp parallel for shared (NE)
-	for (int iel=0; iel<NE; ++iel)
-	{
+	AssembleElements(LS, [&](int iel) {
 		FESolidElement& el = m_Elem[iel];
 
 		if (el.isActive()) {
 
 			// get the element's LM vector
-			vector<int> lm;
+			FEElementWorkspace& ws = ElementWorkspace();
+			vector<int>& lm = ws.LM();
 			UnpackLM(el, lm);
 
 			// element stiffness matrix
-			FEElementMatrix ke(el, lm);
+			FEElementMatrix& ke = ws.ElementMatrix(el, lm);
 
 			// create the element's stiffness matrix
 			int ndof = 3 * el.Nodes();
 			ke.resize(ndof, ndof);
 			ke.zero();
 
-			// calculate geometrical stiffness
-			ElementGeometricalStiffness(el, ke);
+			if (bsymm)
+			{
+				// calculate the upper triangular part of the geometrical and material stiffness
+				ke.SetSymmetric(true);
+				ElementGeometricalStiffnessSymm(el, ke);
+				ElementMaterialStiffnessSymm(el, ke);
+			}
+			else
+			{
+				// calculate geometrical stiffness
+				ElementGeometricalStiffness(el, ke);
 
-			// calculate material stiffness
-			ElementMaterialStiffness(el, ke);
+				// calculate material stiffness
+				ElementMaterialStiffness(el, ke);
+			}
 
-/*			// assign symmetic parts
-			// TODO: Can this be omitted by changing the Assemble routine so that it only
-			// grabs elements from the upper diagonal matrix?
-			for (int i = 0; i < ndof; ++i)
-				for (int j = i + 1; j < ndof; ++j)
-					ke[j][i] = ke[i][j];
-*/
 			// assemble element matrix in global stiffness matrix
 			LS.Assemble(ke);
 		}
-	}
+	});
 }
 
 //-----------------------------------------------------------------------------
@@ -605,21 +660,28 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 		}
 	}
 
-	// loop over the integration points and calculate
-	// the stress at the integration point
+	// get the deformation gradients at the current and previous time
+	const int NINT = FEElement::MAX_INTPOINTS;
+	mat3d Ftn[NINT], Fpn[NINT];
+	double Jtn[NINT];
+	ElementKinematics(el, Ftn, Jtn, Fpn);
+
+	// loop over the integration points and update the kinematics
+	FEMaterialPoint* mps[NINT];
+	mat3ds s[NINT];
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+		mps[n] = &mp;
 
 		// material point coordinates
 		pt.m_rt = el.Evaluate(r, n);
 
 		// get the deformation gradient and determinant at intermediate time
-        double Jt;
-        mat3d Ft, Fp;
-        Jt = defgrad(el, Ft, n);
-        defgradp(el, Fp, n);
+        double Jt = Jtn[n];
+        const mat3d& Ft = Ftn[n];
+        const mat3d& Fp = Fpn[n];
 
 		if (m_alphaf == 1.0)
 		{
@@ -642,10 +704,16 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 
         // update specialized material points
         m_pMat->UpdateSpecializedMaterialPoints(mp, tp);
-        
-		// calculate the stress at this material point
-//		pt.m_s = m_pMat->Stress(mp);
-		pt.m_s = m_pMat->SolidStress(mp);
+	}
+
+	// calculate the stress at all integration points
+	m_pMat->BatchStress(mps, s, nint);
+
+	for (int n=0; n<nint; ++n)
+	{
+		FEMaterialPoint& mp = *mps[n];
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+		pt.m_s = s[n];
         
         // adjust stress for strain energy conservation
         if (m_alphaf == 0.5) 
@@ -655,8 +723,8 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 			// evaluate strain energy at current time
 			mat3d Ftmp = pt.m_F;
 			double Jtmp = pt.m_J;
-			pt.m_F = Ft;
-			pt.m_J = Jt;
+			pt.m_F = Ftn[n];
+			pt.m_J = Jtn[n];
 			pt.m_Wt = pme->StrainEnergyDensity(mp);
 			pt.m_F = Ftmp;
 			pt.m_J = Jtmp;
@@ -678,7 +746,7 @@ void FEElasticSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
 	for (int i=0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofU[0]];
@@ -697,7 +765,7 @@ void FEElasticSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the displacement dofs
             lm[3*i  ] = id[m_dofSU[0]];
@@ -719,8 +787,9 @@ void FEElasticSolidDomain::InertialForces(FEGlobalVector& R, vector<double>& F)
 
 		if (el.isActive()) {
 			// element force vector
-			vector<double> fe;
-			vector<int> lm;
+			FEElementWorkspace& ws = ElementWorkspace();
+			vector<double>& fe = ws.ForceVector();
+			vector<int>& lm = ws.LM();
 
 			// get the element force vector and initialize it to zero
 			int ndof = 3 * el.Nodes();
@@ -750,7 +819,7 @@ void FEElasticSolidDomain::ElementInertialForce(FESolidElement& el, vector<doubl
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         double dens = m_pMat->Density(mp);
         double J0 = detJ0(el, n)*gw[n];
         
@@ -764,3 +833,226 @@ void FEElasticSolidDomain::ElementInertialForce(FESolidElement& el, vector<doubl
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+//! Calculates the deformation gradients (and the determinant of the current one)
+//! at all integration points.
+void FEElasticSolidDomain::ElementKinematics(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp)
+{
+	(this->*m_kinKernel)(el, Ft, Jt, Fp);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::KinematicsGeneric(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp)
+{
+	int nint = el.GaussPoints();
+	for (int n = 0; n < nint; ++n)
+	{
+		Jt[n] = defgrad(el, Ft[n], n);
+		defgradp(el, Fp[n], n);
+	}
+}
+
+//=============================================================================
+// Element kernels for a fixed number of nodes and integration points. These 
+// do the same calculations as the generic functions above, but the nodal 
+// coordinates are only collected once per element, and the loops over the 
+// nodes have compile-time bounds.
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+template <int NEN, int NINT>
+void FEElasticSolidDomain::KinematicsT(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp)
+{
+	typedef FESolidKernel<NEN, NINT> Kernel;
+
+	vec3d rt[NEN], rp[NEN], r0[NEN];
+	GetCurrentNodalCoordinates(el, rt);
+	GetPreviousNodalCoordinates(el, rp);
+
+	// without the shape cache, invjac0 would collect the reference coordinates
+	// at each integration point, so we collect them once here
+	bool bcache = HasShapeCache();
+	if (bcache == false) GetReferenceNodalCoordinates(el, r0);
+
+	for (int n = 0; n < NINT; ++n)
+	{
+		Jt[n] = defgrad(el, Ft[n], n, rt);
+
+		double Ji[3][3];
+		if (bcache) invjac0(el, Ji, n);
+		else Kernel::invjac(el, r0, Ji, n);
+		defgrad(el, Fp[n], n, rp, mat3d(Ji));
+	}
+}
+
+//-----------------------------------------------------------------------------
+template <int NEN, int NINT>
+void FEElasticSolidDomain::InternalForceT(FESolidElement& el, vector<double>& fe)
+{
+	typedef FESolidKernel<NEN, NINT> Kernel;
+
+	// nodal coordinates
+	vec3d rt[NEN];
+	if (m_update_dynamic) GetCurrentNodalCoordinates(el, rt, m_alphaf);
+	else GetCurrentNodalCoordinates(el, rt);
+
+	const double* gw = el.GaussWeights();
+	for (int n = 0; n < NINT; ++n)
+	{
+		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+
+		// calculate the shape function gradients
+		vec3d G[NEN];
+		double detJt = Kernel::ShapeGradient(el, rt, n, G)*gw[n];
+
+		// get the stress vector for this integration point
+		const mat3ds& s = pt.m_s;
+
+		for (int i = 0; i < NEN; ++i)
+		{
+			double Gx = G[i].x;
+			double Gy = G[i].y;
+			double Gz = G[i].z;
+
+			// the '-' sign is so that the internal forces get subtracted
+			// from the global residual vector
+			fe[3*i  ] -= (Gx*s.xx() + Gy*s.xy() + Gz*s.xz())*detJt;
+			fe[3*i+1] -= (Gy*s.yy() + Gx*s.xy() + Gz*s.yz())*detJt;
+			fe[3*i+2] -= (Gz*s.zz() + Gy*s.yz() + Gx*s.xz())*detJt;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+template <int NEN, int NINT>
+void FEElasticSolidDomain::GeometricalStiffnessT(FESolidElement& el, matrix& ke, bool bsymm)
+{
+	typedef FESolidKernel<NEN, NINT> Kernel;
+
+	// nodal coordinates at intermediate time
+	vec3d rt[NEN];
+	GetCurrentNodalCoordinates(el, rt, m_alphaf);
+
+	const double* gw = el.GaussWeights();
+	for (int n = 0; n < NINT; ++n)
+	{
+		// calculate shape function gradients and jacobian
+		vec3d G[NEN];
+		double w = Kernel::ShapeGradient(el, rt, n, G)*gw[n]*m_alphaf;
+
+		// element's Cauchy-stress tensor at gauss point n
+		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+		mat3ds& s = pt.m_s;
+
+		for (int i = 0; i < NEN; ++i)
+			for (int j = (bsymm ? i : 0); j < NEN; ++j)
+			{
+				double kab = (G[i]*(s * G[j]))*w;
+
+				ke[3*i  ][3*j  ] += kab;
+				ke[3*i+1][3*j+1] += kab;
+				ke[3*i+2][3*j+2] += kab;
+			}
+	}
+}
+
+//-----------------------------------------------------------------------------
+template <int NEN, int NINT>
+void FEElasticSolidDomain::MaterialStiffnessT(FESolidElement& el, matrix& ke, bool bsymm)
+{
+	typedef FESolidKernel<NEN, NINT> Kernel;
+
+	// nodal coordinates at intermediate time
+	vec3d rt[NEN];
+	GetCurrentNodalCoordinates(el, rt, m_alphaf);
+
+	// evaluate the material tangent at all integration points
+	FEMaterialPoint* mps[NINT];
+	tens4dmm C[NINT];
+	for (int n = 0; n < NINT; ++n) mps[n] = el.GetMaterialPoint(n);
+	m_pMat->BatchTangent(mps, C, NINT);
+
+	const double* gw = el.GaussWeights();
+	double D[6][6];
+	double DBL[6][3];
+	for (int n = 0; n < NINT; ++n)
+	{
+		// calculate jacobian and shape function gradients
+		vec3d G[NEN];
+		double detJt = Kernel::ShapeGradient(el, rt, n, G)*gw[n]*m_alphaf;
+
+		// get the 'D' matrix
+		C[n].extract(D);
+
+		for (int i = 0, i3 = 0; i < NEN; ++i, i3 += 3)
+		{
+			double Gxi = G[i].x;
+			double Gyi = G[i].y;
+			double Gzi = G[i].z;
+
+			int j0 = (bsymm ? i : 0);
+			for (int j = j0, j3 = 3*j0; j < NEN; ++j, j3 += 3)
+			{
+				double Gxj = G[j].x;
+				double Gyj = G[j].y;
+				double Gzj = G[j].z;
+
+				// calculate D*BL matrices
+				for (int k = 0; k < 6; ++k)
+				{
+					DBL[k][0] = (D[k][0]*Gxj + D[k][3]*Gyj + D[k][5]*Gzj);
+					DBL[k][1] = (D[k][1]*Gyj + D[k][3]*Gxj + D[k][4]*Gzj);
+					DBL[k][2] = (D[k][2]*Gzj + D[k][4]*Gyj + D[k][5]*Gxj);
+				}
+
+				ke[i3  ][j3  ] += (Gxi*DBL[0][0] + Gyi*DBL[3][0] + Gzi*DBL[5][0])*detJt;
+				ke[i3  ][j3+1] += (Gxi*DBL[0][1] + Gyi*DBL[3][1] + Gzi*DBL[5][1])*detJt;
+				ke[i3  ][j3+2] += (Gxi*DBL[0][2] + Gyi*DBL[3][2] + Gzi*DBL[5][2])*detJt;
+
+				ke[i3+1][j3  ] += (Gyi*DBL[1][0] + Gxi*DBL[3][0] + Gzi*DBL[4][0])*detJt;
+				ke[i3+1][j3+1] += (Gyi*DBL[1][1] + Gxi*DBL[3][1] + Gzi*DBL[4][1])*detJt;
+				ke[i3+1][j3+2] += (Gyi*DBL[1][2] + Gxi*DBL[3][2] + Gzi*DBL[4][2])*detJt;
+
+				ke[i3+2][j3  ] += (Gzi*DBL[2][0] + Gyi*DBL[4][0] + Gxi*DBL[5][0])*detJt;
+				ke[i3+2][j3+1] += (Gzi*DBL[2][1] + Gyi*DBL[4][1] + Gxi*DBL[5][1])*detJt;
+				ke[i3+2][j3+2] += (Gzi*DBL[2][2] + Gyi*DBL[4][2] + Gxi*DBL[5][2])*detJt;
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+template <int NEN, int NINT>
+void FEElasticSolidDomain::SetKernels()
+{
+	m_forceKernel = &FEElasticSolidDomain::InternalForceT<NEN, NINT>;
+	m_geomKernel  = &FEElasticSolidDomain::GeometricalStiffnessT<NEN, NINT>;
+	m_matKernel   = &FEElasticSolidDomain::MaterialStiffnessT<NEN, NINT>;
+	m_kinKernel   = &FEElasticSolidDomain::KinematicsT<NEN, NINT>;
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticSolidDomain::FindElementKernel()
+{
+	FESolidDomain::FindElementKernel();
+
+	switch (ElementKernel())
+	{
+	case FE_KERNEL_HEX8G8   : SetKernels< 8,  8>(); break;
+	case FE_KERNEL_TET4G1   : SetKernels< 4,  1>(); break;
+	case FE_KERNEL_TET4G4   : SetKernels< 4,  4>(); break;
+	case FE_KERNEL_TET10G4  : SetKernels<10,  4>(); break;
+	case FE_KERNEL_TET10G8  : SetKernels<10,  8>(); break;
+	case FE_KERNEL_TET10GL11: SetKernels<10, 11>(); break;
+	case FE_KERNEL_HEX20G8  : SetKernels<20,  8>(); break;
+	case FE_KERNEL_HEX20G27 : SetKernels<20, 27>(); break;
+	default:
+		m_forceKernel = &FEElasticSolidDomain::InternalForceGeneric;
+		m_geomKernel  = &FEElasticSolidDomain::GeometricalStiffnessGeneric;
+		m_matKernel   = &FEElasticSolidDomain::MaterialStiffnessGeneric;
+		m_kinKernel   = &FEElasticSolidDomain::KinematicsGeneric;
+	}
+}
@@ -108,6 +108,11 @@ public:
 	//! material stiffness component
 	virtual void ElementMaterialStiffness(FESolidElement& el, matrix& ke);
 
+	//! geometrical and material stiffness of symmetric element matrices. These only
+	//! evaluate the upper triangular node blocks (see FEElementMatrix::SetSymmetric).
+	void ElementGeometricalStiffnessSymm(FESolidElement& el, matrix& ke);
+	void ElementMaterialStiffnessSymm(FESolidElement& el, matrix& ke);
+
 	// --- R E S I D U A L ---
 
 	//! Calculates the internal stress vector for solid elements
@@ -116,6 +121,41 @@ public:
     //! Calculates the inertial force vector for solid elements
     void ElementInertialForce(FESolidElement& el, vector<double>& fe);
     
+protected:
+	//! select the element kernels (overridden from FESolidDomain)
+	void FindElementKernel() override;
+
+private:
+	void GeometricalStiffness(FESolidElement& el, matrix& ke, bool bsymm);
+	void MaterialStiffness(FESolidElement& el, matrix& ke, bool bsymm);
+
+	// calculates the deformation gradients at the current and previous time at all integration points
+	void ElementKinematics(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp);
+
+	// generic implementations of the element kernels
+	void InternalForceGeneric(FESolidElement& el, vector<double>& fe);
+	void GeometricalStiffnessGeneric(FESolidElement& el, matrix& ke, bool bsymm);
+	void MaterialStiffnessGeneric(FESolidElement& el, matrix& ke, bool bsymm);
+	void KinematicsGeneric(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp);
+
+	// element kernels for a fixed number of nodes and integration points (see FESolidKernel.h)
+	template <int NEN, int NINT> void InternalForceT(FESolidElement& el, vector<double>& fe);
+	template <int NEN, int NINT> void GeometricalStiffnessT(FESolidElement& el, matrix& ke, bool bsymm);
+	template <int NEN, int NINT> void MaterialStiffnessT(FESolidElement& el, matrix& ke, bool bsymm);
+	template <int NEN, int NINT> void KinematicsT(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp);
+	template <int NEN, int NINT> void SetKernels();
+
+private:
+	// The element kernels are selected once, when the element types of the domain are known.
+	typedef void (FEElasticSolidDomain::*ForceKernel)(FESolidElement& el, vector<double>& fe);
+	typedef void (FEElasticSolidDomain::*StiffnessKernel)(FESolidElement& el, matrix& ke, bool bsymm);
+	typedef void (FEElasticSolidDomain::*KinematicsKernel)(FESolidElement& el, mat3d* Ft, double* Jt, mat3d* Fp);
+
+	ForceKernel			m_forceKernel;
+	StiffnessKernel		m_geomKernel;
+	StiffnessKernel		m_matKernel;
+	KinematicsKernel	m_kinKernel;
+
 protected:
     double              m_alphaf;
     double              m_alpham;
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FECore/FELinearSystem.h>
 #include "FEBioMech.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! Constructor
@@ -121,7 +122,8 @@ void FEElasticTrussDomain::StiffnessMatrix(FELinearSystem& LS)
 	for (int iel =0; iel<NT; ++iel)
 	{
 		FETrussElement& el = m_Elem[iel];
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		ElementStiffness(iel, ke);
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
@@ -150,7 +152,7 @@ void FEElasticTrussDomain::ElementStiffness(int iel, matrix& ke)
 
 	// get the elastic tangent
 	FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-	FETrussMaterialPoint& pt = *mp.ExtractData<FETrussMaterialPoint>();
+	FETrussMaterialPoint& pt = *mp.GetData<FETrussMaterialPoint>();
 	double E = m_pMat->Tangent(pt);
 
 	// element initial volume
@@ -204,7 +206,7 @@ void FEElasticTrussDomain::InternalForces(FEGlobalVector& R)
 void FEElasticTrussDomain::ElementInternalForces(FETrussElement& el, vector<double>& fe)
 {
 	FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-	FETrussMaterialPoint& pt = *(mp.ExtractData<FETrussMaterialPoint>());
+	FETrussMaterialPoint& pt = *(mp.GetData<FETrussMaterialPoint>());
 
 	// get the element's normal
 	vec3d n = TrussNormal(el);
@@ -252,7 +254,7 @@ void FEElasticTrussDomain::Update(const FETimeInfo& tp)
 
 		// setup the material point
 		FEMaterialPoint& mp = *(el.GetMaterialPoint(0));
-		FETrussMaterialPoint& pt = *(mp.ExtractData<FETrussMaterialPoint>());
+		FETrussMaterialPoint& pt = *(mp.GetData<FETrussMaterialPoint>());
 
 		// nodal coordinates
 		for (int j=0; j<2; ++j)
@@ -47,7 +47,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEEllipsoidalFiberDistribution::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -180,7 +180,7 @@ mat3ds FEEllipsoidalFiberDistribution::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEEllipsoidalFiberDistribution::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -328,7 +328,7 @@ double FEEllipsoidalFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
 {
     double sed = 0.0;
     
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -516,7 +516,7 @@ void FEEllipsoidalFiberDistributionOld::Serialize(DumpStream& ar)
 //-----------------------------------------------------------------------------
 mat3ds FEEllipsoidalFiberDistributionOld::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -586,7 +586,7 @@ mat3ds FEEllipsoidalFiberDistributionOld::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEEllipsoidalFiberDistributionOld::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -665,7 +665,7 @@ double FEEllipsoidalFiberDistributionOld::StrainEnergyDensity(FEMaterialPoint& m
 {
     double sed = 0.0;
     
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -44,14 +44,27 @@ SOFTWARE.*/
 #include <FECore/FELinearConstraintManager.h>
 #include "FEResidualVector.h"
 #include "FEBioMech.h"
+#include <math.h>
 
 //-----------------------------------------------------------------------------
 // define the parameter list
 BEGIN_FECORE_CLASS(FEExplicitSolidSolver, FESolver)
 	ADD_PARAMETER(m_mass_lumping, "mass_lumping");
 	ADD_PARAMETER(m_dyn_damping, "dyn_damping");
+	ADD_PARAMETER(m_auto_dt, "auto_dt");
+	ADD_PARAMETER(m_dt_safety, FE_RANGE_GREATER(0.0), "dt_safety");
+	ADD_PARAMETER(m_dt_update, FE_RANGE_GREATER_OR_EQUAL(0), "dt_update");
+	ADD_PARAMETER(m_ms_dt, FE_RANGE_GREATER_OR_EQUAL(0.0), "mass_scaling_dt");
+	ADD_PARAMETER(m_log_norms, "log_norms");
 END_FECORE_CLASS();
 
+//-----------------------------------------------------------------------------
+// access to a component of a vector
+static inline double& vec3d_comp(vec3d& v, int k)
+{
+	return (k == 0 ? v.x : (k == 1 ? v.y : v.z));
+}
+
 //-----------------------------------------------------------------------------
 FEExplicitSolidSolver::FEExplicitSolidSolver(FEModel* pfem) : 
 	FESolver(pfem), 
@@ -64,6 +77,16 @@ FEExplicitSolidSolver::FEExplicitSolidSolver(FEModel* pfem) :
 
 	m_mass_lumping = HRZ_LUMPING;
 
+	m_auto_dt = false;
+	m_dt_safety = 0.9;
+	m_dt_update = 10;
+	m_ms_dt = 0.0;
+	m_log_norms = true;
+
+	m_dtcrit = 0.0;
+	m_dtcount = 0;
+	m_brestored = false;
+
 	// Allocate degrees of freedom
 	DOFS& dofs = pfem->GetDOFS();
 	int varD = dofs.AddVariable("displacement", VAR_VEC3);
@@ -146,6 +169,9 @@ bool FEExplicitSolidSolver::CalculateMassMatrix()
 					FESolidElement& el = pbd->Element(iel);
 					pbd->UnpackLM(el, lm);
 
+					// mass scale factor (for selective mass scaling)
+					double ms = (m_massScale[nd].empty() ? 1.0 : m_massScale[nd][iel]);
+
 					int nint = el.GaussPoints();
 					int neln = el.Nodes();
 
@@ -156,7 +182,7 @@ bool FEExplicitSolidSolver::CalculateMassMatrix()
 					for (int n = 0; n < nint; ++n)
 					{
 						FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-						double d = pme->Density(mp);
+						double d = pme->Density(mp)*ms;
 						double detJ0 = pbd->detJ0(el, n)*el.GaussWeights()[n];
 
 						double* H = el.H(n);
@@ -241,6 +267,9 @@ bool FEExplicitSolidSolver::CalculateMassMatrix()
 					FESolidElement& el = pbd->Element(iel);
 					pbd->UnpackLM(el, lm);
 
+					// mass scale factor (for selective mass scaling)
+					double ms = (m_massScale[nd].empty() ? 1.0 : m_massScale[nd][iel]);
+
 					int nint = el.GaussPoints();
 					int neln = el.Nodes();
 
@@ -253,7 +282,7 @@ bool FEExplicitSolidSolver::CalculateMassMatrix()
 					for (int n = 0; n < nint; ++n)
 					{
 						FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-						double d = pme->Density(mp);
+						double d = pme->Density(mp)*ms;
 						double detJ0 = pbd->detJ0(el, n)*el.GaussWeights()[n];
 						Me += d * detJ0 * w[n];
 
@@ -355,6 +384,198 @@ bool FEExplicitSolidSolver::CalculateMassMatrix()
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+//! Build the map from the equations to the nodal degrees of freedom. This allows
+//! the predictor and corrector to loop over the equations directly.
+void FEExplicitSolidSolver::BuildEquationMap()
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+
+	EquationDof q0 = { -1, -1, -1, -1, 0 };
+	m_eqMap.assign(m_neq, q0);
+	for (int i = 0; i < mesh.Nodes(); ++i)
+	{
+		FENode& node = mesh.Node(i);
+		for (int k = 0; k < 3; ++k)
+		{
+			int n;
+			if ((n = node.m_ID[m_dofU[k]]) >= 0)
+			{
+				EquationDof q = { i, m_dofU[k], m_dofV[k], -1, k };
+				m_eqMap[n] = q;
+			}
+			if ((n = node.m_ID[m_dofSQ[k]]) >= 0)
+			{
+				EquationDof q = { i, m_dofSQ[k], -1, -1, k };
+				m_eqMap[n] = q;
+			}
+			if ((n = node.m_ID[m_dofSU[k]]) >= 0)
+			{
+				EquationDof q = { i, m_dofSU[k], m_dofSV[k], m_dofSA[k], k };
+				m_eqMap[n] = q;
+			}
+		}
+	}
+
+	m_vh.assign(m_neq, 0.0);
+}
+
+//-----------------------------------------------------------------------------
+//! Estimate the critical time step of a solid element as the time it takes a 
+//! dilatational wave to cross the element. The characteristic length is taken as
+//! the smallest distance between two nodes of the element and the wave speed is
+//! evaluated from the largest normal component of the spatial tangent. 
+//! Returns zero if no estimate can be made.
+double FEExplicitSolidSolver::ElementCriticalTimeStep(FEElasticSolidDomain& dom, FESolidMaterial& mat, FESolidElement& el)
+{
+	FEMesh& mesh = *dom.GetMesh();
+
+	// characteristic length
+	const int neln = el.Nodes();
+	double L2 = 0.0;
+	for (int i = 0; i < neln; ++i)
+	{
+		vec3d ri = mesh.Node(el.m_node[i]).m_rt;
+		for (int j = i + 1; j < neln; ++j)
+		{
+			vec3d rj = mesh.Node(el.m_node[j]).m_rt;
+			double d2 = (ri - rj).norm2();
+			if ((L2 == 0.0) || (d2 < L2)) L2 = d2;
+		}
+	}
+	if (L2 <= 0.0) return 0.0;
+
+	// evaluate the tangents at all integration points
+	const int nint = el.GaussPoints();
+	FEMaterialPoint* mps[FEElement::MAX_INTPOINTS];
+	tens4dmm C[FEElement::MAX_INTPOINTS];
+	for (int n = 0; n < nint; ++n) mps[n] = el.GetMaterialPoint(n);
+	mat.BatchTangent(mps, C, nint);
+
+	// square of the wave speed
+	double c2 = 0.0;
+	double D[6][6];
+	for (int n = 0; n < nint; ++n)
+	{
+		FEElasticMaterialPoint& pt = *mps[n]->ExtractData<FEElasticMaterialPoint>();
+		double rho = mat.Density(*mps[n]) / pt.m_J;
+		if (rho <= 0.0) continue;
+
+		C[n].extract(D);
+		double k = D[0][0];
+		if (D[1][1] > k) k = D[1][1];
+		if (D[2][2] > k) k = D[2][2];
+
+		if (k / rho > c2) c2 = k / rho;
+	}
+	if (c2 <= 0.0) return 0.0;
+
+	return sqrt(L2 / c2);
+}
+
+//-----------------------------------------------------------------------------
+//! Estimate the critical time step as the smallest element critical time step
+//! of all (non-rigid) elastic solid domains, taking mass scaling into account.
+double FEExplicitSolidSolver::CriticalTimeStep()
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+
+	double dtmin = 0.0;
+	for (int nd = 0; nd < mesh.Domains(); ++nd)
+	{
+		FEElasticSolidDomain* pbd = dynamic_cast<FEElasticSolidDomain*>(&mesh.Domain(nd));
+		if ((pbd == nullptr) || (pbd->IsActive() == false)) continue;
+
+		FESolidMaterial* pme = dynamic_cast<FESolidMaterial*>(pbd->GetMaterial());
+		if ((pme == nullptr) || dynamic_cast<FERigidMaterial*>(pme)) continue;
+
+		const vector<double>* ms = ((nd < (int)m_massScale.size()) && (m_massScale[nd].empty() == false) ? &m_massScale[nd] : nullptr);
+
+		const int NE = pbd->Elements();
+#pragma omp parallel
+		{
+			double dtl = 0.0;
+#pragma omp for
+			for (int i = 0; i < NE; ++i)
+			{
+				FESolidElement& el = pbd->Element(i);
+				if (el.isActive() == false) continue;
+
+				double dte = ElementCriticalTimeStep(*pbd, *pme, el);
+				if (dte <= 0.0) continue;
+
+				// added mass increases the critical time step
+				if (ms) dte *= sqrt((*ms)[i]);
+
+				if ((dtl == 0.0) || (dte < dtl)) dtl = dte;
+			}
+
+#pragma omp critical (explicit_dtcrit)
+			{
+				if ((dtl > 0.0) && ((dtmin == 0.0) || (dtl < dtmin))) dtmin = dtl;
+			}
+		}
+	}
+
+	return dtmin;
+}
+
+//-----------------------------------------------------------------------------
+//! Calculate the element mass scale factors for selective mass scaling. Only the
+//! elements whose critical time step is smaller than needed for taking time 
+//! steps of size m_ms_dt are scaled. Since the critical time step scales with the
+//! square root of the density, the scale factor is the squared ratio of the two.
+void FEExplicitSolidSolver::CalculateMassScaling()
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+	m_massScale.assign(mesh.Domains(), vector<double>());
+	if (m_ms_dt <= 0.0) return;
+
+	// the stable time step we need to reach
+	double dtmin = m_ms_dt / m_dt_safety;
+
+	int nscaled = 0;
+	double smax = 1.0;
+	for (int nd = 0; nd < mesh.Domains(); ++nd)
+	{
+		FEElasticSolidDomain* pbd = dynamic_cast<FEElasticSolidDomain*>(&mesh.Domain(nd));
+		if ((pbd == nullptr) || (pbd->IsActive() == false)) continue;
+
+		FESolidMaterial* pme = dynamic_cast<FESolidMaterial*>(pbd->GetMaterial());
+		if ((pme == nullptr) || dynamic_cast<FERigidMaterial*>(pme)) continue;
+
+		const int NE = pbd->Elements();
+		vector<double>& ms = m_massScale[nd];
+		ms.assign(NE, 1.0);
+
+#pragma omp parallel for
+		for (int i = 0; i < NE; ++i)
+		{
+			FESolidElement& el = pbd->Element(i);
+			double dte = ElementCriticalTimeStep(*pbd, *pme, el);
+			if ((dte > 0.0) && (dte < dtmin))
+			{
+				double r = dtmin / dte;
+				ms[i] = r*r;
+			}
+		}
+
+		for (int i = 0; i < NE; ++i)
+		{
+			if (ms[i] > 1.0)
+			{
+				nscaled++;
+				if (ms[i] > smax) smax = ms[i];
+			}
+		}
+	}
+
+	if (nscaled > 0)
+	{
+		feLog("\tselective mass scaling: %d elements scaled (max. scale factor = %lg)\n", nscaled, smax);
+	}
+}
+
 //-----------------------------------------------------------------------------
 bool FEExplicitSolidSolver::Init()
 {
@@ -385,6 +606,16 @@ bool FEExplicitSolidSolver::Init()
 	gather(m_Ut, mesh, m_dofSU[1]);
 	gather(m_Ut, mesh, m_dofSU[2]);
 
+	// build the map from equations to nodal dofs
+	BuildEquationMap();
+
+	// find the element mass scale factors
+	// On a restart they are restored instead, since they depend on the configuration
+	// in which they were calculated. The same goes for the time step estimate.
+	bool brestored = m_brestored;
+	m_brestored = false;
+	if (brestored == false) CalculateMassScaling();
+
 	// calculate the inverse mass vector for the explicit analysis
 	if (CalculateMassMatrix() == false)
 	{
@@ -392,21 +623,43 @@ bool FEExplicitSolidSolver::Init()
 		return false;
 	}
 
+	// The automatic time step size would fight with a time stepper over the step size.
+	if (m_auto_dt && fem.GetCurrentStep()->m_timeController)
+	{
+		feLogError("auto_dt cannot be used together with a time stepper.");
+		return false;
+	}
+
+	// estimate the stable time step
+	if (brestored == false)
+	{
+		m_dtcrit = CriticalTimeStep();
+		m_dtcount = 0;
+	}
+	if (m_dtcrit > 0.0)
+	{
+		feLog("\tcritical time step estimate : %lg\n", m_dtcrit);
+		double dt = fem.GetCurrentStep()->m_dt0;
+		if ((m_auto_dt == false) && (dt > m_dtcrit))
+		{
+			feLogWarning("The time step size (%lg) exceeds the critical time step (%lg).\nThe solution may be unstable.", dt, m_dtcrit);
+		}
+	}
+
 	// Calculate initial residual to be used on the first time step
 	if (Residual(m_R0) == false) return false;
 
 	// calculate the initial acceleration
-	for (int i = 0; i < mesh.Nodes(); ++i)
+#pragma omp parallel for
+	for (int i = 0; i < neq; ++i)
 	{
-		FENode& node = mesh.Node(i);
-		int n;
-		if ((n = node.m_ID[m_dofU[0]]) >= 0) node.m_at.x = m_R0[n] * m_Mi[n];
-		if ((n = node.m_ID[m_dofU[1]]) >= 0) node.m_at.y = m_R0[n] * m_Mi[n];
-		if ((n = node.m_ID[m_dofU[2]]) >= 0) node.m_at.z = m_R0[n] * m_Mi[n];
-
-		if ((n = node.m_ID[m_dofSU[0]]) >= 0) node.set(m_dofSA[0], m_R0[n] * m_Mi[n]);
-		if ((n = node.m_ID[m_dofSU[1]]) >= 0) node.set(m_dofSA[1], m_R0[n] * m_Mi[n]);
-		if ((n = node.m_ID[m_dofSU[2]]) >= 0) node.set(m_dofSA[2], m_R0[n] * m_Mi[n]);
+		const EquationDof& q = m_eqMap[i];
+		if (q.vdof >= 0)
+		{
+			FENode& node = mesh.Node(q.node);
+			double a = m_R0[i] * m_Mi[i];
+			if (q.adof >= 0) node.set(q.adof, a); else vec3d_comp(node.m_at, q.comp) = a;
+		}
 	}
 
 	// set the dynamic update flag only if we are running a dynamic analysis
@@ -422,6 +675,42 @@ bool FEExplicitSolidSolver::Init()
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+//! When automatic time stepping is on, the time step size is limited by the 
+//! (periodically re-evaluated) critical time step. This is called by the analysis
+//! before it updates the time, so the time step is reported with its final size.
+double FEExplicitSolidSolver::TimeStepSize(double dt)
+{
+	if (m_auto_dt == false) return dt;
+
+	FEModel& fem = *GetFEModel();
+	FEAnalysis* pstep = fem.GetCurrentStep();
+
+	// update the critical time step estimate
+	if ((m_dt_update > 0) && (++m_dtcount >= m_dt_update))
+	{
+		double dtc = CriticalTimeStep();
+		if (dtc > 0.0) m_dtcrit = dtc;
+		m_dtcount = 0;
+	}
+
+	if (m_dtcrit > 0.0)
+	{
+		double t0 = fem.GetCurrentTime();
+		double dts = m_dt_safety*m_dtcrit;
+		if (dts > pstep->m_dt0) dts = pstep->m_dt0;
+		if (t0 + dts > pstep->m_tend) dts = pstep->m_tend - t0;
+
+		if (dts != dt)
+		{
+			feLog("\tstable time step : %lg\n", dts);
+			dt = dts;
+		}
+	}
+
+	return dt;
+}
+
 //-----------------------------------------------------------------------------
 //! Updates the current state of the model
 void FEExplicitSolidSolver::Update(vector<double>& ui)
@@ -448,23 +737,15 @@ void FEExplicitSolidSolver::UpdateKinematics(vector<double>& ui)
 	// update rigid bodies
 	UpdateRigidBodies(ui);
 
-	// total displacements
-	vector<double> U(m_Ut.size());
-	for (size_t i=0; i<m_Ut.size(); ++i) U[i] = ui[i] + m_Ut[i];
-
-	// update flexible nodes
-	// translational dofs
-	scatter(U, mesh, m_dofU[0]);
-	scatter(U, mesh, m_dofU[1]);
-	scatter(U, mesh, m_dofU[2]);
-	// rotational dofs
-	scatter(U, mesh, m_dofSQ[0]);
-	scatter(U, mesh, m_dofSQ[1]);
-	scatter(U, mesh, m_dofSQ[2]);
-	// shell displacement
-	scatter(U, mesh, m_dofSU[0]);
-	scatter(U, mesh, m_dofSU[1]);
-	scatter(U, mesh, m_dofSU[2]);
+	// update flexible nodes with the total displacements
+	// (translational, rotational and shell displacement dofs)
+	const int neq = (int) m_eqMap.size();
+#pragma omp parallel for
+	for (int i = 0; i < neq; ++i)
+	{
+		const EquationDof& q = m_eqMap[i];
+		if (q.dof >= 0) mesh.Node(q.node).set(q.dof, ui[i] + m_Ut[i]);
+	}
 
 	// make sure the prescribed displacements are fullfilled
 	int ndis = fem.BoundaryConditions();
@@ -485,7 +766,9 @@ void FEExplicitSolidSolver::UpdateKinematics(vector<double>& ui)
 
 	// Update the spatial nodal positions
 	// Don't update rigid nodes since they are already updated
-	for (int i=0; i<mesh.Nodes(); ++i)
+	const int NN = mesh.Nodes();
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
 		if (node.m_rid == -1)
@@ -586,6 +869,24 @@ void FEExplicitSolidSolver::Serialize(DumpStream& ar)
 {
 	FESolver::Serialize(ar);
 	ar & m_nrhs & m_niter & m_nref & m_ntotref & m_naug & m_neq & m_nreq;
+	ar & m_dtcrit & m_dtcount;
+
+	// the mass scale factors are only needed for restarts
+	if (ar.IsShallow()) return;
+	if (ar.IsSaving())
+	{
+		int ND = (int)m_massScale.size();
+		ar << ND;
+		for (int i = 0; i < ND; ++i) ar << m_massScale[i];
+	}
+	else
+	{
+		int ND = 0;
+		ar >> ND;
+		m_massScale.assign(ND, vector<double>());
+		for (int i = 0; i < ND; ++i) ar >> m_massScale[i];
+		m_brestored = true;
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -814,83 +1115,68 @@ bool FEExplicitSolidSolver::DoSolve()
 
 	// get the mesh
 	FEMesh& mesh = fem.GetMesh();
-	int N = mesh.Nodes(); // this is the total number of nodes in the mesh
-    double dt = fem.GetTime().timeIncrement;
-
-	// collect accelerations, velocities, displacements
-	vector<double> an(m_neq, 0.0), vn(m_neq, 0.0), un(m_neq, 0.0);
-	for (int i = 0; i < mesh.Nodes(); ++i)
-	{
-		FENode& node = mesh.Node(i);
-		vec3d vt = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-		int n;
-		if ((n = node.m_ID[m_dofU[0]]) >= 0) { un[n] = node.m_rt.x - node.m_r0.x; vn[n] = vt.x; an[n] = node.m_at.x; }
-		if ((n = node.m_ID[m_dofU[1]]) >= 0) { un[n] = node.m_rt.y - node.m_r0.y; vn[n] = vt.y; an[n] = node.m_at.y; }
-		if ((n = node.m_ID[m_dofU[2]]) >= 0) { un[n] = node.m_rt.z - node.m_r0.z; vn[n] = vt.z; an[n] = node.m_at.z; }
+	const double dt = fem.GetTime().timeIncrement;
+	const int neq = m_neq;
 
-		if ((n = node.m_ID[m_dofSU[0]]) >= 0) { un[n] = node.get(m_dofSU[0]); vn[n] = node.get(m_dofSV[0]); an[n] = node.get(m_dofSA[0]); }
-		if ((n = node.m_ID[m_dofSU[1]]) >= 0) { un[n] = node.get(m_dofSU[1]); vn[n] = node.get(m_dofSV[1]); an[n] = node.get(m_dofSA[1]); }
-		if ((n = node.m_ID[m_dofSU[2]]) >= 0) { un[n] = node.get(m_dofSU[2]); vn[n] = node.get(m_dofSV[2]); an[n] = node.get(m_dofSA[2]); }
-	}
+	// the equation map is rebuilt when the equations have changed
+	if ((int)m_eqMap.size() != neq) BuildEquationMap();
 
-	// velocity predictor
-	vector<double> v_pred(m_neq, 0.0);
-	for (int i = 0; i < m_neq; ++i)
+	// predictor: evaluate the mid-step velocities from the current nodal 
+	// velocities and accelerations, and the displacement increments.
+	double Dnorm2 = 0.0;
+#pragma omp parallel for reduction(+:Dnorm2)
+	for (int i = 0; i < neq; ++i)
 	{
-		v_pred[i] = vn[i] + an[i] * dt*0.5;
-	}
-
-	// update displacements
-	for (int i = 0; i < m_neq; ++i)
-	{
-		m_ui[i] = dt * v_pred[i];
+		const EquationDof& q = m_eqMap[i];
+		double vh = 0.0;
+		if (q.vdof >= 0)
+		{
+			FENode& node = mesh.Node(q.node);
+			double vn = node.get(q.vdof);
+			double an = (q.adof >= 0 ? node.get(q.adof) : vec3d_comp(node.m_at, q.comp));
+			vh = vn + an*dt*0.5;
+		}
+		m_vh[i] = vh;
+		m_ui[i] = dt*vh;
+		Dnorm2 += m_ui[i] * m_ui[i];
 	}
-	double Dnorm = sqrt(m_ui * m_ui);
-	feLog("\t displacement norm : %lg\n", Dnorm);
+	if (m_log_norms) feLog("\t displacement norm : %lg\n", sqrt(Dnorm2));
 	Update(m_ui);
 
 	// evaluate acceleration
 	Residual(m_R1);
-	double Rnorm = sqrt(m_R1 * m_R1);
-	feLog("\t force vector norm : %lg\n", Rnorm);
 
-	vector<double> anp1(m_neq);
-	for (int i = 0; i < m_neq; ++i)
+	// corrector: update the accelerations and velocities, store them
+	// on the nodes, and update the total displacements
+	double Rnorm2 = 0.0;
+#pragma omp parallel for reduction(+:Rnorm2)
+	for (int i = 0; i < neq; ++i)
 	{
-		anp1[i] = m_R1[i] * m_Mi[i];
-	}
+		double R = m_R1[i];
+		Rnorm2 += R*R;
 
-	// update velocity
-	vector<double> vnp1(m_neq, 0.0);
-	for (int i = 0; i < m_neq; ++i)
-	{
-		vnp1[i] = v_pred[i] + anp1[i]*dt*0.5;
+		const EquationDof& q = m_eqMap[i];
+		if (q.vdof >= 0)
+		{
+			double a = R*m_Mi[i];
+			double v = m_vh[i] + a*dt*0.5;
+
+			FENode& node = mesh.Node(q.node);
+			node.set(q.vdof, v);
+			if (q.adof >= 0) node.set(q.adof, a); else vec3d_comp(node.m_at, q.comp) = a;
+		}
+
+		m_Ut[i] += m_ui[i];
 	}
+	if (m_log_norms) feLog("\t force vector norm : %lg\n", sqrt(Rnorm2));
 
 	// increase iteration number
 	m_niter++;
 
-	// scatter velocity and accelerations
-	for (int i = 0; i < mesh.Nodes(); ++i)
-	{
-		FENode& node = mesh.Node(i);
-		int n;
-		if ((n = node.m_ID[m_dofU[0]]) >= 0) { node.set(m_dofV[0], vnp1[n]); node.m_at.x = anp1[n]; }
-		if ((n = node.m_ID[m_dofU[1]]) >= 0) { node.set(m_dofV[1], vnp1[n]); node.m_at.y = anp1[n]; }
-		if ((n = node.m_ID[m_dofU[2]]) >= 0) { node.set(m_dofV[2], vnp1[n]); node.m_at.z = anp1[n]; }
-
-		if ((n = node.m_ID[m_dofSU[0]]) >= 0) { node.set(m_dofSV[0], vnp1[n]); node.set(m_dofSA[0], anp1[n]); }
-		if ((n = node.m_ID[m_dofSU[1]]) >= 0) { node.set(m_dofSV[1], vnp1[n]); node.set(m_dofSA[1], anp1[n]); }
-		if ((n = node.m_ID[m_dofSU[2]]) >= 0) { node.set(m_dofSV[2], vnp1[n]); node.set(m_dofSA[2], anp1[n]); }
-	}
-
 	// do minor iterations callbacks
 	fem.DoCallback(CB_MINOR_ITERS);
 
-	// update the total displacements
-	m_Ut += m_ui;
-
-	m_R0 = m_R1;
+	m_R0.swap(m_R1);
 
 	return true;
 }
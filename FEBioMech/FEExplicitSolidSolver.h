@@ -32,6 +32,10 @@ SOFTWARE.*/
 #include <FECore/FETimeInfo.h>
 #include <FECore/FEDofList.h>
 
+class FEElasticSolidDomain;
+class FESolidMaterial;
+class FESolidElement;
+
 //-----------------------------------------------------------------------------
 //! This class implements a nonlinear explicit solver for solid mechanics
 //! problems.
@@ -58,6 +62,9 @@ public:
 	//! clean up
 	void Clean() override;
 
+	//! Limit the time step size to the stable time step (if auto_dt is on)
+	double TimeStepSize(double dt) override;
+
 	//! Solve an analysis step
 	bool SolveStep() override;
 
@@ -85,12 +92,26 @@ public:
 
 	void ContactForces(FEGlobalVector& R);
 
+	//! estimate the critical time step of the solid domains (returns 0 if no estimate is available)
+	double CriticalTimeStep();
+
 private:
 	bool CalculateMassMatrix();
 
+	void CalculateMassScaling();
+
+	void BuildEquationMap();
+
+	double ElementCriticalTimeStep(FEElasticSolidDomain& dom, FESolidMaterial& mat, FESolidElement& el);
+
 public:
 	int			m_mass_lumping;	//!< specify mass lumping method
 	double		m_dyn_damping;	//!< velocity damping for the explicit solver
+	bool		m_auto_dt;		//!< limit the time step size to the stable time step
+	double		m_dt_safety;	//!< safety factor applied to the critical time step
+	int			m_dt_update;	//!< nr of time steps between critical time step estimates (0 = only at start)
+	double		m_ms_dt;		//!< target time step for selective mass scaling (0 = off)
+	bool		m_log_norms;	//!< print the displacement and force norms at each time step
 
 public:
 	// equation numbers
@@ -106,6 +127,26 @@ public:
 	vector<double> m_R0;	//!< residual at iteration i-1
 	vector<double> m_R1;	//!< residual at iteration i
 
+	vector<double> m_vh;	//!< mid-step (predicted) velocities
+
+	double	m_dtcrit;		//!< last estimate of the critical time step
+	int		m_dtcount;		//!< nr of time steps since the last estimate
+
+private:
+	// maps an equation to the nodal degrees of freedom it updates
+	struct EquationDof
+	{
+		int	node;	//!< node index (-1 if the equation is not a nodal dof)
+		int	dof;	//!< displacement (or rotation) dof
+		int	vdof;	//!< velocity dof (-1 if the equation is not integrated)
+		int	adof;	//!< acceleration dof (-1 if stored in FENode::m_at)
+		int	comp;	//!< vector component
+	};
+	vector<EquationDof>	m_eqMap;
+
+	vector< vector<double> >	m_massScale;	//!< element mass scale factors for each domain
+	bool						m_brestored;	//!< mass scaling and time step estimate were restored from an archive
+
 protected:
 	FEDofList	m_dofU, m_dofV, m_dofSQ, m_dofRQ;
 	FEDofList	m_dofSU, m_dofSV, m_dofSA;
@@ -314,7 +314,7 @@ void FEFacet2FacetSliding::BuildMatrixProfile(FEGlobalMatrix& K)
 
 					for (int l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						int* id = mesh.Node(sn[l]).m_ID;
 						lm[6*l  ] = id[dof_X];
 						lm[6*l+1] = id[dof_Y];
 						lm[6*l+2] = id[dof_Z];
@@ -325,7 +325,7 @@ void FEFacet2FacetSliding::BuildMatrixProfile(FEGlobalMatrix& K)
 
 					for (int l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						int* id = mesh.Node(mn[l]).m_ID;
 						lm[6*(l+nseln)  ] = id[dof_X];
 						lm[6*(l+nseln)+1] = id[dof_Y];
 						lm[6*(l+nseln)+2] = id[dof_Z];
@@ -193,7 +193,7 @@ double FEFatigueMaterial::StrainEnergyDensity(FEMaterialPoint& pt)
 double FEFatigueMaterial::Damage(FEMaterialPoint& pt)
 {
     // get the damage material point data
-    FEFatigueMaterialPoint& pd = *pt.ExtractData<FEFatigueMaterialPoint>();
+    FEFatigueMaterialPoint& pd = *pt.GetData<FEFatigueMaterialPoint>();
     
     pd.m_D = 1 - pd.m_wi - pd.m_wf;
     
@@ -205,7 +205,7 @@ double FEFatigueMaterial::Damage(FEMaterialPoint& pt)
 void FEFatigueMaterial::UpdateSpecializedMaterialPoints(FEMaterialPoint& pt, const FETimeInfo& tp)
 {
     // get the fatigue material point data
-    FEFatigueMaterialPoint& pd = *pt.ExtractData<FEFatigueMaterialPoint>();
+    FEFatigueMaterialPoint& pd = *pt.GetData<FEFatigueMaterialPoint>();
     
     // evaluate intermediate time point variables
     pd.m_wi = (1-tp.alphaf)*pd.m_wip + tp.alphaf*pd.m_wit;
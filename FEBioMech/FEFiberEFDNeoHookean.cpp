@@ -85,7 +85,7 @@ bool FEFiberEFDNeoHookean::Init()
 
 mat3ds FEFiberEFDNeoHookean::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d &F = pt.m_F;
 	double detF = pt.m_J;
@@ -171,7 +171,7 @@ mat3ds FEFiberEFDNeoHookean::Stress(FEMaterialPoint& mp)
 
 tens4ds FEFiberEFDNeoHookean::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -197,7 +197,7 @@ tens4ds FEFiberEFDNeoHookean::Tangent(FEMaterialPoint& mp)
 
 double FEFiberEFDNeoHookean::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	double J = pt.m_J;
 	double lnJ = log(J);
@@ -59,7 +59,7 @@ FEFiberExpPow::FEFiberExpPow(FEModel* pfem) : FEElasticFiberMaterial(pfem)
 //-----------------------------------------------------------------------------
 mat3ds FEFiberExpPow::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -112,7 +112,7 @@ mat3ds FEFiberExpPow::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberExpPow::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -169,7 +169,7 @@ double FEFiberExpPow::FiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d&
 {
     double sed = 0.0;
     
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// loop over all integration points
 	mat3ds C = pt.RightCauchyGreen();
@@ -247,7 +247,7 @@ bool FEFiberExponentialPower::Validate()
 //-----------------------------------------------------------------------------
 mat3ds FEFiberExponentialPower::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
@@ -300,7 +300,7 @@ mat3ds FEFiberExponentialPower::FiberStress(FEMaterialPoint& mp, const vec3d& n0
 //-----------------------------------------------------------------------------
 tens4ds FEFiberExponentialPower::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
@@ -358,7 +358,7 @@ double FEFiberExponentialPower::FiberStrainEnergyDensity(FEMaterialPoint& mp, co
 {
     double sed = 0.0;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // loop over all integration points
     mat3ds C = pt.RightCauchyGreen();
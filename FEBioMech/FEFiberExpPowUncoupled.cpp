@@ -53,7 +53,7 @@ FEFiberExpPowUncoupled::FEFiberExpPowUncoupled(FEModel* pfem) : FEElasticFiberMa
 //-----------------------------------------------------------------------------
 mat3ds FEFiberExpPowUncoupled::DevFiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	double J = pt.m_J;
@@ -99,7 +99,7 @@ mat3ds FEFiberExpPowUncoupled::DevFiberStress(FEMaterialPoint& mp, const vec3d&
 //-----------------------------------------------------------------------------
 tens4ds FEFiberExpPowUncoupled::DevFiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	double J = pt.m_J;
@@ -165,7 +165,7 @@ double FEFiberExpPowUncoupled::DevFiberStrainEnergyDensity(FEMaterialPoint& mp,
 {
     double sed = 0.0;
     
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// loop over all integration points
 	mat3ds C = pt.DevRightCauchyGreen();
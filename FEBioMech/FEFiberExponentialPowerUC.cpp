@@ -60,7 +60,7 @@ bool FEFiberExponentialPowerUC::Validate()
 //-----------------------------------------------------------------------------
 mat3ds FEFiberExponentialPowerUC::DevFiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J = pt.m_J;
 	// distortional part of deformation gradient
@@ -104,7 +104,7 @@ mat3ds FEFiberExponentialPowerUC::DevFiberStress(FEMaterialPoint& mp, const vec3
 //-----------------------------------------------------------------------------
 tens4ds FEFiberExponentialPowerUC::DevFiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J = pt.m_J;
 	// distortional part of deformation gradient
@@ -167,7 +167,7 @@ tens4ds FEFiberExponentialPowerUC::DevFiberTangent(FEMaterialPoint& mp, const ve
 //! Strain energy density
 double FEFiberExponentialPowerUC::DevFiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// loop over all integration points
 	mat3ds C = pt.DevRightCauchyGreen();
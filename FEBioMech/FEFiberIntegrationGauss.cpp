@@ -49,7 +49,7 @@ public:
 		const double eps = 1e-9;
 		if (mp)
 		{
-			FEElasticMaterialPoint& pt = *mp->ExtractData<FEElasticMaterialPoint>();
+			FEElasticMaterialPoint& pt = *mp->GetData<FEElasticMaterialPoint>();
 			// right Cauchy-Green tensor and its eigenvalues & eigenvectors
 			mat3ds C = (pt.m_buncoupled ? pt.DevRightCauchyGreen() : pt.RightCauchyGreen());
 			C.eigen(lC, vC);
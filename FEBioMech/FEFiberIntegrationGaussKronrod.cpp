@@ -50,7 +50,7 @@ public:
 		const double eps = std::numeric_limits<double>::epsilon();
 		if (mp)
 		{
-			FEElasticMaterialPoint& pt = *mp->ExtractData<FEElasticMaterialPoint>();
+			FEElasticMaterialPoint& pt = *mp->GetData<FEElasticMaterialPoint>();
 
 			// right Cauchy-Green tensor and its eigenvalues & eigenvectors
 			// TODO: for uncoupled formulations we need to use the deviatoric strain-energy
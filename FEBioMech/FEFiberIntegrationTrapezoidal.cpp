@@ -110,7 +110,7 @@ FEFiberIntegrationSchemeIterator* FEFiberIntegrationTrapezoidal::GetIterator(FEM
 //-----------------------------------------------------------------------------
 mat3ds FEFiberIntegrationTrapezoidal::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
     // initialize stress tensor
 	mat3ds s;
@@ -151,7 +151,7 @@ mat3ds FEFiberIntegrationTrapezoidal::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberIntegrationTrapezoidal::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
     // initialize stress tensor
 	tens4ds c;
@@ -192,7 +192,7 @@ tens4ds FEFiberIntegrationTrapezoidal::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEFiberIntegrationTrapezoidal::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
     // initialize strain energy density
 	double sed = 0.0;
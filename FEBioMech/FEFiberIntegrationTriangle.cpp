@@ -370,7 +370,7 @@ FEFiberIntegrationSchemeIterator* FEFiberIntegrationTriangle::GetIterator(FEMate
 //-----------------------------------------------------------------------------
 mat3ds FEFiberIntegrationTriangle::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -404,7 +404,7 @@ mat3ds FEFiberIntegrationTriangle::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberIntegrationTriangle::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -439,7 +439,7 @@ tens4ds FEFiberIntegrationTriangle::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEFiberIntegrationTriangle::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
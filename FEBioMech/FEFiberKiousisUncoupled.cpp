@@ -49,7 +49,7 @@ FEFiberKiousisUncoupled::FEFiberKiousisUncoupled(FEModel* pfem) : FEElasticFiber
 //-----------------------------------------------------------------------------
 mat3ds FEFiberKiousisUncoupled::DevFiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     double J = pt.m_J;
@@ -90,7 +90,7 @@ mat3ds FEFiberKiousisUncoupled::DevFiberStress(FEMaterialPoint& mp, const vec3d&
 //-----------------------------------------------------------------------------
 tens4ds FEFiberKiousisUncoupled::DevFiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     double J = pt.m_J;
@@ -142,7 +142,7 @@ double FEFiberKiousisUncoupled::DevFiberStrainEnergyDensity(FEMaterialPoint& mp,
 {
     double sed = 0.0;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // loop over all integration points
     mat3ds C = pt.DevRightCauchyGreen();
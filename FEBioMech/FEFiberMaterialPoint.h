@@ -33,6 +33,8 @@ SOFTWARE.*/
 // Define a material point that stores the fiber pre-stretch
 class FEFiberMaterialPoint : public FEMaterialPoint
 {
+	FEMATERIALPOINT_FLAT_ARENA_ALLOCATION(FEFiberMaterialPoint)
+
 public:
     FEFiberMaterialPoint(FEMaterialPoint *pt) : FEMaterialPoint(pt) {}
     
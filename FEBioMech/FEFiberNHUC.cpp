@@ -37,7 +37,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEFiberNHUC::DevFiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J = pt.m_J;
 	// distortional part of deformation gradient
@@ -74,7 +74,7 @@ mat3ds FEFiberNHUC::DevFiberStress(FEMaterialPoint& mp, const vec3d& n0)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberNHUC::DevFiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J = pt.m_J;
 	// distortional part of deformation gradient
@@ -126,7 +126,7 @@ double FEFiberNHUC::DevFiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d
 {
 	double sed = 0.0;
 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// loop over all integration points
 	const double eps = 0;
@@ -52,7 +52,7 @@ FEFiberNaturalNH::FEFiberNaturalNH(FEModel* pfem) : FEElasticFiberMaterial(pfem)
 //-----------------------------------------------------------------------------
 mat3ds FEFiberNaturalNH::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
@@ -88,7 +88,7 @@ mat3ds FEFiberNaturalNH::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberNaturalNH::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
@@ -126,7 +126,7 @@ tens4ds FEFiberNaturalNH::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 //! Strain energy density
 double FEFiberNaturalNH::FiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
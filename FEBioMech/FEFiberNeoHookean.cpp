@@ -50,7 +50,7 @@ FEFiberNH::FEFiberNH(FEModel* pfem) : FEElasticFiberMaterial(pfem)
 //-----------------------------------------------------------------------------
 mat3ds FEFiberNH::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -86,7 +86,7 @@ mat3ds FEFiberNH::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberNH::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -126,7 +126,7 @@ tens4ds FEFiberNH::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 double FEFiberNH::FiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d& n0)
 {
     
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// loop over all integration points
 	mat3ds C = pt.RightCauchyGreen();
@@ -50,7 +50,7 @@ FEFiberPowLinear::FEFiberPowLinear(FEModel* pfem) : FEElasticFiberMaterial(pfem)
 //-----------------------------------------------------------------------------
 mat3ds FEFiberPowLinear::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // initialize material constants
     double I0 = m_lam0*m_lam0;
@@ -97,7 +97,7 @@ mat3ds FEFiberPowLinear::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberPowLinear::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // initialize material constants
     double I0 = m_lam0*m_lam0;
@@ -146,7 +146,7 @@ double FEFiberPowLinear::FiberStrainEnergyDensity(FEMaterialPoint& mp, const vec
 {
     double sed = 0.0;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // initialize material constants
     double I0 = m_lam0*m_lam0;
@@ -209,7 +209,7 @@ bool FEFiberPowerLinear::Validate()
 //-----------------------------------------------------------------------------
 mat3ds FEFiberPowerLinear::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -251,7 +251,7 @@ mat3ds FEFiberPowerLinear::FiberStress(FEMaterialPoint& mp, const vec3d& n0)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberPowerLinear::FiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -296,7 +296,7 @@ double FEFiberPowerLinear::FiberStrainEnergyDensity(FEMaterialPoint& mp, const v
 {
 	double sed = 0.0;
 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// loop over all integration points
 	mat3ds C = pt.RightCauchyGreen();
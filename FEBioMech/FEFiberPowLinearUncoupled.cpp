@@ -58,7 +58,7 @@ bool FEFiberPowLinearUncoupled::Validate()
 //-----------------------------------------------------------------------------
 mat3ds FEFiberPowLinearUncoupled::DevFiberStress(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     double J = pt.m_J;
@@ -100,7 +100,7 @@ mat3ds FEFiberPowLinearUncoupled::DevFiberStress(FEMaterialPoint& mp, const vec3
 //-----------------------------------------------------------------------------
 tens4ds FEFiberPowLinearUncoupled::DevFiberTangent(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     double J = pt.m_J;
@@ -159,7 +159,7 @@ tens4ds FEFiberPowLinearUncoupled::DevFiberTangent(FEMaterialPoint& mp, const ve
 //-----------------------------------------------------------------------------
 double FEFiberPowLinearUncoupled::DevFiberStrainEnergyDensity(FEMaterialPoint& mp, const vec3d& n0)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // loop over all integration points
     const double eps = 0;
@@ -78,7 +78,7 @@ bool FEFungOrthoCompressible::Validate()
 //! Calculates the stress
 mat3ds FEFungOrthoCompressible::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -139,7 +139,7 @@ mat3ds FEFungOrthoCompressible::Stress(FEMaterialPoint& mp)
 //! Calculates the tangent
 tens4ds FEFungOrthoCompressible::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -208,7 +208,7 @@ tens4ds FEFungOrthoCompressible::Tangent(FEMaterialPoint& mp)
 //! Calculates the strain energy density
 double FEFungOrthoCompressible::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -82,7 +82,7 @@ bool FEFungOrthotropic::Validate()
 //! Calculates the deviatoric stress
 mat3ds FEFungOrthotropic::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -141,7 +141,7 @@ mat3ds FEFungOrthotropic::DevStress(FEMaterialPoint& mp)
 //! Calculates the deviatoric tangent
 tens4ds FEFungOrthotropic::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -213,7 +213,7 @@ tens4ds FEFungOrthotropic::DevTangent(FEMaterialPoint& mp)
 //! Calculates the strain energy density
 double FEFungOrthotropic::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -93,7 +93,7 @@ bool FEGenericHyperelastic::Init()
 
 mat3ds FEGenericHyperelastic::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -120,7 +120,7 @@ mat3ds FEGenericHyperelastic::Stress(FEMaterialPoint& mp)
 
 tens4ds FEGenericHyperelastic::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -166,7 +166,7 @@ tens4ds FEGenericHyperelastic::Tangent(FEMaterialPoint& mp)
 
 double FEGenericHyperelastic::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
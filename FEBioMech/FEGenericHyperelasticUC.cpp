@@ -91,7 +91,7 @@ bool FEGenericHyperelasticUC::Init()
 //! Deviatoric Cauchy stress
 mat3ds FEGenericHyperelasticUC::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -123,7 +123,7 @@ mat3ds FEGenericHyperelasticUC::DevStress(FEMaterialPoint& mp)
 //! Deviatoric spatial Tangent
 tens4ds FEGenericHyperelasticUC::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -179,7 +179,7 @@ tens4ds FEGenericHyperelasticUC::DevTangent(FEMaterialPoint& mp)
 //! Deviatoric strain energy density
 double FEGenericHyperelasticUC::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -122,7 +122,7 @@ bool FEGenericTransIsoHyperelastic::Init()
 
 mat3ds FEGenericTransIsoHyperelastic::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -166,7 +166,7 @@ mat3ds FEGenericTransIsoHyperelastic::Stress(FEMaterialPoint& mp)
 
 tens4ds FEGenericTransIsoHyperelastic::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -262,7 +262,7 @@ tens4ds FEGenericTransIsoHyperelastic::Tangent(FEMaterialPoint& mp)
 
 double FEGenericTransIsoHyperelastic::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
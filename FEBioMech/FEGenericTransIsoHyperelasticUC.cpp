@@ -121,7 +121,7 @@ bool FEGenericTransIsoHyperelasticUC::Init()
 
 mat3ds FEGenericTransIsoHyperelasticUC::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -166,7 +166,7 @@ mat3ds FEGenericTransIsoHyperelasticUC::DevStress(FEMaterialPoint& mp)
 
 tens4ds FEGenericTransIsoHyperelasticUC::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -259,7 +259,7 @@ tens4ds FEGenericTransIsoHyperelasticUC::DevTangent(FEMaterialPoint& mp)
 
 double FEGenericTransIsoHyperelasticUC::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d& F = pt.m_F;
 	double J = pt.m_J;
@@ -45,7 +45,7 @@ FEGentMaterial::FEGentMaterial(FEModel* pfem) : FEUncoupledMaterial(pfem)
 //-----------------------------------------------------------------------------
 mat3ds FEGentMaterial::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J  = ep.m_J;
 	mat3ds b  = ep.DevLeftCauchyGreen();
@@ -64,7 +64,7 @@ mat3ds FEGentMaterial::DevStress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEGentMaterial::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// determinant of deformation gradient
 	double J = pt.m_J;
@@ -119,7 +119,7 @@ FECompressibleGentMaterial::FECompressibleGentMaterial(FEModel* pfem) : FEElasti
 //-----------------------------------------------------------------------------
 mat3ds FECompressibleGentMaterial::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J = ep.m_J;
 	mat3ds b = ep.RightCauchyGreen();
@@ -143,7 +143,7 @@ mat3ds FECompressibleGentMaterial::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FECompressibleGentMaterial::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	double J = ep.m_J;
 	mat3ds b = ep.RightCauchyGreen();
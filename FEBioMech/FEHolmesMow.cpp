@@ -53,7 +53,7 @@ bool FEHolmesMow::Validate()
 //-----------------------------------------------------------------------------
 mat3ds FEHolmesMow::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double detF = pt.m_J;
 	double detFi = 1.0/detF;
@@ -80,7 +80,7 @@ mat3ds FEHolmesMow::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEHolmesMow::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double detF = pt.m_J;
 	double detFi = 1.0/detF;
@@ -111,7 +111,7 @@ tens4ds FEHolmesMow::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEHolmesMow::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate left Cauchy-Green tensor
 	mat3ds b = pt.LeftCauchyGreen(); //(F*F.transpose()).sym();
@@ -39,7 +39,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEHolmesMowUC::DevStress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate left Cauchy-Green tensor
     mat3ds bt = pt.DevLeftCauchyGreen();
@@ -59,7 +59,7 @@ mat3ds FEHolmesMowUC::DevStress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEHolmesMowUC::DevTangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate left Cauchy-Green tensor
     mat3ds bt = pt.DevLeftCauchyGreen();
@@ -92,7 +92,7 @@ tens4ds FEHolmesMowUC::DevTangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEHolmesMowUC::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate left Cauchy-Green tensor
     mat3ds bt = pt.DevLeftCauchyGreen();
@@ -48,7 +48,7 @@ mat3ds FEHolzapfelGasserOgden::DevStress(FEMaterialPoint& mp)
     double kappa = m_kappa(mp);
     double g = m_gdeg(mp)*PI/180;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // determinant of deformation gradient
     double J = pt.m_J;
@@ -109,7 +109,7 @@ tens4ds FEHolzapfelGasserOgden::DevTangent(FEMaterialPoint& mp)
     double kappa = m_kappa(mp);
     double g = m_gdeg(mp)*PI/180;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // determinant of deformation gradient
     double J = pt.m_J;
@@ -181,7 +181,7 @@ double FEHolzapfelGasserOgden::DevStrainEnergyDensity(FEMaterialPoint& mp)
     double kappa = m_kappa(mp);
     double g = m_gdeg(mp)*PI/180;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     vec3d n[3];			// local element basis directions
     mat3ds h[2];		// structural tensor in current configuration
@@ -50,7 +50,7 @@ mat3ds FEHolzapfelUnconstrained::Stress(FEMaterialPoint& mp)
     double g = m_gdeg(mp)*PI/180;
     double k = m_k(mp);
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // determinant of deformation gradient
     double J = pt.m_J;
@@ -108,7 +108,7 @@ tens4ds FEHolzapfelUnconstrained::Tangent(FEMaterialPoint& mp)
     double g = m_gdeg(mp)*PI/180;
     double k = m_k(mp);
 
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // determinant of deformation gradient
     double J = pt.m_J;
@@ -170,7 +170,7 @@ double FEHolzapfelUnconstrained::StrainEnergyDensity(FEMaterialPoint& mp)
     double g = m_gdeg(mp)*PI/180;
     double k = m_k(mp);
 
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // determinant of deformation gradient
     double J = pt.m_J;
@@ -47,7 +47,7 @@ FEHuiskesSupply::FEHuiskesSupply(FEModel* pfem) : FESolidSupply(pfem)
 //! Solid supply
 double FEHuiskesSupply::Supply(FEMaterialPoint& mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
 	double rhor = rpt.m_rhor;
 	double sed = rpt.m_sed;
 	double rhorhat = m_B*(sed/rhor - m_k);
@@ -58,8 +58,8 @@ double FEHuiskesSupply::Supply(FEMaterialPoint& mp)
 //! Tangent of solid supply with respect to strain
 mat3ds FEHuiskesSupply::Tangent_Supply_Strain(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
     mat3ds ruhat = pt.m_s*(m_B/rpt.m_rhor);
 	return ruhat;
 }
@@ -68,7 +68,7 @@ mat3ds FEHuiskesSupply::Tangent_Supply_Strain(FEMaterialPoint &mp)
 //! Tangent of solid supply with respect to referential density
 double FEHuiskesSupply::Tangent_Supply_Density(FEMaterialPoint &mp)
 {
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
     double rhor = rpt.m_rhor;
     double sed = rpt.m_sed;
     double dsed = rpt.m_dsed;
@@ -64,7 +64,7 @@ bool FEInSituStretchGradient::Init()
 //-----------------------------------------------------------------------------
 mat3d FEInSituStretchGradient::Prestrain(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the in-situ stretch
 	double lam = m_lam(mp);
@@ -89,7 +89,7 @@ mat3d FEInSituStretchGradient::Prestrain(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 void FEInSituStretchGradient::Initialize(const mat3d& F, FEMaterialPoint& mp)
 {
-/*	FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
+/*	FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left polar decomposition
 	mat3d R;
@@ -45,7 +45,7 @@ FEIncompNeoHookean::FEIncompNeoHookean(FEModel* pfem) : FEUncoupledMaterial(pfem
 //! Calculate deviatoric stress
 mat3ds FEIncompNeoHookean::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// shear modulus
 	double G = m_G(mp);
@@ -64,7 +64,7 @@ mat3ds FEIncompNeoHookean::DevStress(FEMaterialPoint& mp)
 //! Calculate deviatoric tangent
 tens4ds FEIncompNeoHookean::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// shear modulus
 	double G = m_G(mp);
@@ -93,7 +93,7 @@ tens4ds FEIncompNeoHookean::DevTangent(FEMaterialPoint& mp)
 //! Calculate deviatoric strain energy density
 double FEIncompNeoHookean::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // shear modulus
     double G = m_G(mp);
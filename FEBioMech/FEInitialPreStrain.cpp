@@ -73,8 +73,8 @@ void FEInitialPreStrain::Activate()
 					for (int n=0; n<nint; ++n)
 					{
 						FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-						FEElasticMaterialPoint* pt = mp.ExtractData<FEElasticMaterialPoint>();
-						FEPrestrainMaterialPoint& pp = *mp.ExtractData<FEPrestrainMaterialPoint>();
+						FEElasticMaterialPoint* pt = mp.GetData<FEElasticMaterialPoint>();
+						FEPrestrainMaterialPoint& pp = *mp.GetData<FEPrestrainMaterialPoint>();
 
 						// get the deformation gradient
 						mat3d& F = pt->m_F;
@@ -39,7 +39,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEIsotropicElastic::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d &F = pt.m_F;
 	double Ji = 1.0 / pt.m_J;
@@ -70,7 +70,7 @@ mat3ds FEIsotropicElastic::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEIsotropicElastic::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double E = m_E(mp);
 	double v = m_v(mp);
@@ -92,7 +92,7 @@ tens4ds FEIsotropicElastic::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEIsotropicElastic::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double mE = m_E(mp);
 	double mv = m_v(mp);
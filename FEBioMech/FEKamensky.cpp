@@ -49,7 +49,7 @@ FEKamensky::FEKamensky(FEModel* pfem) : FEElasticMaterial(pfem)
 //! Calculates the strain energy density
 double FEKamensky::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate right Cauchy-Green tensor and Lagrange strain tensor
 	mat3ds b = pt.LeftCauchyGreen();
@@ -74,7 +74,7 @@ double FEKamensky::StrainEnergyDensity(FEMaterialPoint& mp)
 //! Calculates the deviatoric stress
 mat3ds FEKamensky::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate deviatoric
 	mat3ds b = pt.LeftCauchyGreen();
@@ -98,7 +98,7 @@ mat3ds FEKamensky::Stress(FEMaterialPoint& mp)
 //! Calculates the deviatoric tangent
 tens4ds FEKamensky::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// apply tangent scale
 	double c0 = m_c0 * m_tangent_scale;
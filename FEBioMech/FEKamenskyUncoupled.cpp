@@ -47,7 +47,7 @@ FEKamenskyUncoupled::FEKamenskyUncoupled(FEModel* pfem) : FEUncoupledMaterial(pf
 //! Calculates the strain energy density
 double FEKamenskyUncoupled::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor and invariants
 	mat3ds b = pt.DevLeftCauchyGreen();
@@ -67,7 +67,7 @@ double FEKamenskyUncoupled::DevStrainEnergyDensity(FEMaterialPoint& mp)
 //! Calculates the deviatoric stress
 mat3ds FEKamenskyUncoupled::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate left Cauchy-Green tensor and invariants
 	mat3ds b = pt.DevLeftCauchyGreen();
@@ -88,7 +88,7 @@ mat3ds FEKamenskyUncoupled::DevStress(FEMaterialPoint& mp)
 //! Calculates the deviatoric tangent
 tens4ds FEKamenskyUncoupled::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// apply tangent scale
 	double c0 = m_c0 * m_tangent_scale;
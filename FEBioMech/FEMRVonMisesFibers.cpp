@@ -170,8 +170,8 @@ FEMaterialPoint* FEMRVonMisesFibers::CreateMaterialPointData()
 //-----------------------------------------------------------------------------
 mat3ds FEMRVonMisesFibers::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEMRVonMisesMaterialPoint& vmpt = *mp.ExtractData<FEMRVonMisesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEMRVonMisesMaterialPoint& vmpt = *mp.GetData<FEMRVonMisesMaterialPoint>();
 
 	// get some of the material parmaters from the material point
 	double kf = vmpt.m_kf;
@@ -314,8 +314,8 @@ mat3ds FEMRVonMisesFibers::DevStress(FEMaterialPoint& mp)
 
 tens4ds FEMRVonMisesFibers::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEMRVonMisesMaterialPoint& vmpt = *mp.ExtractData<FEMRVonMisesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEMRVonMisesMaterialPoint& vmpt = *mp.GetData<FEMRVonMisesMaterialPoint>();
 
 	// get some of the material parmaters from the material point
 	double kf = vmpt.m_kf;
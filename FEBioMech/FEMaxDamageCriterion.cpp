@@ -48,11 +48,11 @@ bool FEDamageAdaptorCriterion::GetMaterialPointValue(FEMaterialPoint& mp, double
 		for (int i = 0; i < mp.Components(); ++i)
 		{
 			FEMaterialPoint* mpi = mp.GetPointData(i);
-			dp = mpi->ExtractData<FEDamageMaterialPoint>();
+			dp = mpi->GetData<FEDamageMaterialPoint>();
 			if (dp) break;
 		}
 	}
-	else dp = mp.ExtractData<FEDamageMaterialPoint>();
+	else dp = mp.GetData<FEDamageMaterialPoint>();
 	if (dp == nullptr) return false;
 
 	// evaluate the damage at this point
@@ -42,7 +42,7 @@ FEStressCriterion::FEStressCriterion(FEModel* fem) : FEMeshAdaptorCriterion(fem)
 
 bool FEStressCriterion::GetMaterialPointValue(FEMaterialPoint& mp, double& value)
 {
-	FEElasticMaterialPoint* ep = mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint* ep = mp.GetData<FEElasticMaterialPoint>();
 	if (ep == nullptr) return false;
 
 	mat3ds s = ep->m_s;
@@ -86,7 +86,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 void FEElasticMembrane::Stress(FEMaterialPoint &mp, double s[])
 {
-	FEMembraneMaterialPoint& pt = *mp.ExtractData<FEMembraneMaterialPoint>();
+	FEMembraneMaterialPoint& pt = *mp.GetData<FEMembraneMaterialPoint>();
 
 	// get the material point strain
 	double e[3];
@@ -110,7 +110,7 @@ void FEElasticMembrane::Stress(FEMaterialPoint &mp, double s[])
 //-----------------------------------------------------------------------------
 void FEElasticMembrane::Tangent(FEMaterialPoint &mp, double D[][3])
 {
-	FEMembraneMaterialPoint& pt = *mp.ExtractData<FEMembraneMaterialPoint>();
+	FEMembraneMaterialPoint& pt = *mp.GetData<FEMembraneMaterialPoint>();
 
 	// elasticity tangent
 	double E = 1.0;
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEMooneyRivlin.h"
+#include <FECore/FEElement.h>
 
 //-----------------------------------------------------------------------------
 // define the material parameters
@@ -40,7 +41,7 @@ END_FECORE_CLASS();
 //! Calculate the deviatoric stress
 mat3ds FEMooneyRivlin::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get material parameters
 	double c1 = m_c1(mp);
@@ -76,11 +77,86 @@ mat3ds FEMooneyRivlin::DevStress(FEMaterialPoint& mp)
 	return T.dev()*(2.0/J);
 }
 
+//-----------------------------------------------------------------------------
+//! Batch version of DevStress. The point data is gathered into contiguous arrays
+//! so that the evaluation loop can be vectorized.
+void FEMooneyRivlin::BatchDevStress(FEMaterialPoint** mp, mat3ds* s, int n)
+{
+	const int NMAX = FEElement::MAX_INTPOINTS;
+	double F[9][NMAX], J[NMAX], c1[NMAX], c2[NMAX];
+	double T[6][NMAX];
+
+	for (int i0 = 0; i0 < n; i0 += NMAX)
+	{
+		int m = (n - i0 < NMAX ? n - i0 : NMAX);
+
+		// gather
+		for (int i = 0; i < m; ++i)
+		{
+			FEMaterialPoint& mpi = *mp[i0 + i];
+			FEElasticMaterialPoint& pt = *mpi.GetData<FEElasticMaterialPoint>();
+			const mat3d& Fi = pt.m_F;
+			F[0][i] = Fi[0][0]; F[1][i] = Fi[0][1]; F[2][i] = Fi[0][2];
+			F[3][i] = Fi[1][0]; F[4][i] = Fi[1][1]; F[5][i] = Fi[1][2];
+			F[6][i] = Fi[2][0]; F[7][i] = Fi[2][1]; F[8][i] = Fi[2][2];
+			J[i] = pt.m_J;
+			c1[i] = m_c1(mpi);
+			c2[i] = m_c2(mpi);
+		}
+
+		// evaluate
+		#pragma omp simd
+		for (int i = 0; i < m; ++i)
+		{
+			double Jm23 = pow(J[i], -2.0/3.0);
+
+			// deviatoric left Cauchy-Green tensor
+			double Bxx = Jm23*(F[0][i]*F[0][i] + F[1][i]*F[1][i] + F[2][i]*F[2][i]);
+			double Byy = Jm23*(F[3][i]*F[3][i] + F[4][i]*F[4][i] + F[5][i]*F[5][i]);
+			double Bzz = Jm23*(F[6][i]*F[6][i] + F[7][i]*F[7][i] + F[8][i]*F[8][i]);
+			double Bxy = Jm23*(F[0][i]*F[3][i] + F[1][i]*F[4][i] + F[2][i]*F[5][i]);
+			double Byz = Jm23*(F[3][i]*F[6][i] + F[4][i]*F[7][i] + F[5][i]*F[8][i]);
+			double Bxz = Jm23*(F[0][i]*F[6][i] + F[1][i]*F[7][i] + F[2][i]*F[8][i]);
+
+			// B*B
+			double B2xx = Bxx*Bxx + Bxy*Bxy + Bxz*Bxz;
+			double B2yy = Bxy*Bxy + Byy*Byy + Byz*Byz;
+			double B2zz = Bxz*Bxz + Byz*Byz + Bzz*Bzz;
+			double B2xy = Bxx*Bxy + Bxy*Byy + Bxz*Byz;
+			double B2yz = Bxy*Bxz + Byy*Byz + Byz*Bzz;
+			double B2xz = Bxx*Bxz + Bxy*Byz + Bxz*Bzz;
+
+			double I1 = Bxx + Byy + Bzz;
+			double a = c1[i] + c2[i]*I1;
+			double W2 = c2[i];
+
+			// T = B*(W1 + W2*I1) - B2*W2
+			double Txx = Bxx*a - B2xx*W2;
+			double Tyy = Byy*a - B2yy*W2;
+			double Tzz = Bzz*a - B2zz*W2;
+
+			// s = dev(T)*2/J
+			double f = 2.0 / J[i];
+			double tr = (Txx + Tyy + Tzz) / 3.0;
+			T[0][i] = (Txx - tr)*f;
+			T[1][i] = (Tyy - tr)*f;
+			T[2][i] = (Tzz - tr)*f;
+			T[3][i] = (Bxy*a - B2xy*W2)*f;
+			T[4][i] = (Byz*a - B2yz*W2)*f;
+			T[5][i] = (Bxz*a - B2xz*W2)*f;
+		}
+
+		// scatter
+		for (int i = 0; i < m; ++i)
+			s[i0 + i] = mat3ds(T[0][i], T[1][i], T[2][i], T[3][i], T[4][i], T[5][i]);
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! Calculate the deviatoric tangent
 tens4ds FEMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get material parameters
 	double c1 = m_c1(mp);
@@ -139,7 +215,7 @@ tens4ds FEMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 //! calculate deviatoric strain energy density
 double FEMooneyRivlin::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// get material parameters
 	double c1 = m_c1(mp);
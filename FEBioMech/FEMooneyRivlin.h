@@ -49,6 +49,9 @@ public:
 	//! calculate deviatoric tangent stiffness at material point
 	tens4ds DevTangent(FEMaterialPoint& pt) override;
 
+	//! calculate deviatoric stress at a batch of material points
+	void BatchDevStress(FEMaterialPoint** mp, mat3ds* s, int n) override;
+
 	//! calculate deviatoric strain energy density
 	double DevStrainEnergyDensity(FEMaterialPoint& mp) override;
     
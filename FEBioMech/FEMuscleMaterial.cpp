@@ -68,7 +68,7 @@ FEMuscleMaterial::FEMuscleMaterial(FEModel* pfem) : FEUncoupledMaterial(pfem)
 //!
 mat3ds FEMuscleMaterial::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -219,7 +219,7 @@ mat3ds FEMuscleMaterial::DevStress(FEMaterialPoint& mp)
 //!
 tens4ds FEMuscleMaterial::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
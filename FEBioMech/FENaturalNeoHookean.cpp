@@ -39,7 +39,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FENaturalNeoHookean::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     double J = pt.m_J;
     
@@ -76,7 +76,7 @@ mat3ds FENaturalNeoHookean::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FENaturalNeoHookean::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the material parameters
     double E = m_E(mp);
@@ -139,7 +139,7 @@ tens4ds FENaturalNeoHookean::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FENaturalNeoHookean::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the material parameters
     double E = m_E(mp);
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FENeoHookean.h"
+#include <FECore/FEElement.h>
 
 //-----------------------------------------------------------------------------
 // define the material parameters
@@ -39,7 +40,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FENeoHookean::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	double detF = pt.m_J;
 	double detFi = 1.0/detF;
@@ -68,7 +69,7 @@ mat3ds FENeoHookean::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FENeoHookean::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	double detF = pt.m_J;
@@ -89,10 +90,111 @@ tens4ds FENeoHookean::Tangent(FEMaterialPoint& mp)
 	return dyad1s(I)*lam1 + dyad4s(I)*(2*mu1);
 }
 
+//-----------------------------------------------------------------------------
+// The batch versions gather the point data into contiguous arrays first so that
+// the arithmetic loops can be vectorized by the compiler.
+void FENeoHookean::BatchStress(FEMaterialPoint** mp, mat3ds* s, int n)
+{
+	if (m_secant_stress) { FEElasticMaterial::BatchStress(mp, s, n); return; }
+
+	const int NMAX = FEElement::MAX_INTPOINTS;
+	double F[9][NMAX], J[NMAX], E[NMAX], v[NMAX];
+	double b[6][NMAX];
+
+	for (int i0 = 0; i0 < n; i0 += NMAX)
+	{
+		int m = (n - i0 < NMAX ? n - i0 : NMAX);
+
+		// gather
+		for (int i = 0; i < m; ++i)
+		{
+			FEMaterialPoint& mpi = *mp[i0 + i];
+			FEElasticMaterialPoint& pt = *mpi.GetData<FEElasticMaterialPoint>();
+			const mat3d& Fi = pt.m_F;
+			F[0][i] = Fi[0][0]; F[1][i] = Fi[0][1]; F[2][i] = Fi[0][2];
+			F[3][i] = Fi[1][0]; F[4][i] = Fi[1][1]; F[5][i] = Fi[1][2];
+			F[6][i] = Fi[2][0]; F[7][i] = Fi[2][1]; F[8][i] = Fi[2][2];
+			J[i] = pt.m_J;
+			E[i] = m_E(mpi);
+			v[i] = m_v(mpi);
+		}
+
+		// evaluate
+		#pragma omp simd
+		for (int i = 0; i < m; ++i)
+		{
+			double Ji = 1.0 / J[i];
+			double lam = v[i]*E[i]/((1 + v[i])*(1 - 2*v[i]));
+			double mu  = 0.5*E[i]/(1 + v[i]);
+			double a = mu*Ji;
+			double p = lam*log(J[i])*Ji - a;
+
+			// b = F*Ft
+			double bxx = F[0][i]*F[0][i] + F[1][i]*F[1][i] + F[2][i]*F[2][i];
+			double byy = F[3][i]*F[3][i] + F[4][i]*F[4][i] + F[5][i]*F[5][i];
+			double bzz = F[6][i]*F[6][i] + F[7][i]*F[7][i] + F[8][i]*F[8][i];
+			double bxy = F[0][i]*F[3][i] + F[1][i]*F[4][i] + F[2][i]*F[5][i];
+			double byz = F[3][i]*F[6][i] + F[4][i]*F[7][i] + F[5][i]*F[8][i];
+			double bxz = F[0][i]*F[6][i] + F[1][i]*F[7][i] + F[2][i]*F[8][i];
+
+			// s = (b - I)*mu/J + I*lam*lnJ/J
+			b[0][i] = bxx*a + p;
+			b[1][i] = byy*a + p;
+			b[2][i] = bzz*a + p;
+			b[3][i] = bxy*a;
+			b[4][i] = byz*a;
+			b[5][i] = bxz*a;
+		}
+
+		// scatter
+		for (int i = 0; i < m; ++i)
+			s[i0 + i] = mat3ds(b[0][i], b[1][i], b[2][i], b[3][i], b[4][i], b[5][i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FENeoHookean::BatchTangent(FEMaterialPoint** mp, tens4dmm* c, int n)
+{
+	if (m_secant_tangent) { FEElasticMaterial::BatchTangent(mp, c, n); return; }
+
+	const int NMAX = FEElement::MAX_INTPOINTS;
+	double J[NMAX], E[NMAX], v[NMAX];
+	double lam1[NMAX], mu1[NMAX];
+
+	mat3dd I(1);
+	tens4ds IxI = dyad1s(I);
+	tens4ds I4  = dyad4s(I);
+
+	for (int i0 = 0; i0 < n; i0 += NMAX)
+	{
+		int m = (n - i0 < NMAX ? n - i0 : NMAX);
+
+		for (int i = 0; i < m; ++i)
+		{
+			FEMaterialPoint& mpi = *mp[i0 + i];
+			J[i] = mpi.GetData<FEElasticMaterialPoint>()->m_J;
+			E[i] = m_E(mpi);
+			v[i] = m_v(mpi);
+		}
+
+		#pragma omp simd
+		for (int i = 0; i < m; ++i)
+		{
+			double lam = v[i]*E[i]/((1 + v[i])*(1 - 2*v[i]));
+			double mu  = 0.5*E[i]/(1 + v[i]);
+			lam1[i] = lam / J[i];
+			mu1[i]  = 2.0*(mu - lam*log(J[i])) / J[i];
+		}
+
+		for (int i = 0; i < m; ++i)
+			c[i0 + i] = tens4dmm(IxI*lam1[i] + I4*mu1[i]);
+	}
+}
+
 //-----------------------------------------------------------------------------
 double FENeoHookean::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	double J = pt.m_J;
 	double lnJ = log(J);
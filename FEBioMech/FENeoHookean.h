@@ -50,6 +50,12 @@ public:
 	//! calculate tangent stiffness at material point
 	virtual tens4ds Tangent(FEMaterialPoint& pt) override;
 
+	//! calculate stress at a batch of material points
+	void BatchStress(FEMaterialPoint** mp, mat3ds* s, int n) override;
+
+	//! calculate tangent at a batch of material points
+	void BatchTangent(FEMaterialPoint** mp, tens4dmm* c, int n) override;
+
 	//! calculate strain energy density at material point
 	virtual double StrainEnergyDensity(FEMaterialPoint& pt) override;
     
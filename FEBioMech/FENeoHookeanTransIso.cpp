@@ -45,7 +45,7 @@ END_FECORE_CLASS();
 
 mat3ds FENeoHookeanTransIso::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d &F = pt.m_F;
 	double detF = pt.m_J;
@@ -144,7 +144,7 @@ mat3ds FENeoHookeanTransIso::Stress(FEMaterialPoint& mp)
 
 tens4ds FENeoHookeanTransIso::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	mat3d &F = pt.m_F;
 	double detF = pt.m_J;
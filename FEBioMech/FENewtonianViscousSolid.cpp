@@ -40,7 +40,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FENewtonianViscousSolid::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     mat3ds D = pt.RateOfDeformation();
     
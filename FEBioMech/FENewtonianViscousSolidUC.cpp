@@ -40,7 +40,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FENewtonianViscousSolidUC::DevStress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pe = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *mp.GetData<FEElasticMaterialPoint>();
     
     mat3ds D = pe.RateOfDeformation();
     
@@ -79,7 +79,7 @@ void FEOgdenMaterial::EigenValues(mat3ds& A, double l[3], vec3d r[3], const doub
 mat3ds FEOgdenMaterial::DevStress(FEMaterialPoint &mp)
 {
     // extract elastic material data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // jacobian
     double J = pt.m_J;
@@ -122,7 +122,7 @@ tens4ds FEOgdenMaterial::DevTangent(FEMaterialPoint& mp)
     int i,j,k;
     
     // extract elastic material data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // jacobian
     double J = pt.m_J;
@@ -210,7 +210,7 @@ tens4ds FEOgdenMaterial::DevTangent(FEMaterialPoint& mp)
 double FEOgdenMaterial::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
     // extract elastic material data
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the left Cauchy-Green tensor
     mat3ds b = pt.DevLeftCauchyGreen();
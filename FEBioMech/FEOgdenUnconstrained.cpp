@@ -79,7 +79,7 @@ void FEOgdenUnconstrained::EigenValues(mat3ds& A, double l[3], vec3d r[3], const
 mat3ds FEOgdenUnconstrained::Stress(FEMaterialPoint &mp)
 {
 	// extract elastic material data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -124,7 +124,7 @@ tens4ds FEOgdenUnconstrained::Tangent(FEMaterialPoint& mp)
 	int i,j,k;
 	
 	// extract elastic material data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -206,7 +206,7 @@ tens4ds FEOgdenUnconstrained::Tangent(FEMaterialPoint& mp)
 double FEOgdenUnconstrained::StrainEnergyDensity(FEMaterialPoint& mp)
 {
 	// extract elastic material data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
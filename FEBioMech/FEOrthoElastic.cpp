@@ -88,7 +88,7 @@ bool FEOrthoElastic::Validate()
 //! Calculates the stress for a linear orthotropic material
 mat3ds FEOrthoElastic::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -136,7 +136,7 @@ mat3ds FEOrthoElastic::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEOrthoElastic::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	int i,j;
 	vec3d a0[3];		// texture direction in reference configuration
@@ -179,7 +179,7 @@ tens4ds FEOrthoElastic::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEOrthoElastic::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     mat3ds E = (pt.RightCauchyGreen() - mat3dd(1))/2;
     mat3ds E2 = E.sqr();
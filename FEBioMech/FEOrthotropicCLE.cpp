@@ -92,7 +92,7 @@ bool FEOrthotropicCLE::Validate()
 //! Calculates the stress
 mat3ds FEOrthotropicCLE::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // Evaluate Lame coefficients
     double	lam[3][3];
@@ -145,7 +145,7 @@ mat3ds FEOrthotropicCLE::Stress(FEMaterialPoint& mp)
 //! Calculates the elasticity tensor
 tens4ds FEOrthotropicCLE::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // Evaluate Lame coefficients
     double	lam[3][3];
@@ -198,7 +198,7 @@ tens4ds FEOrthotropicCLE::Tangent(FEMaterialPoint& mp)
 //! Calculates the strain energy density
 double FEOrthotropicCLE::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // Evaluate Lame coefficients
     double	lam[3][3];
@@ -49,7 +49,7 @@ FEOsmoticVirialExpansion::FEOsmoticVirialExpansion(FEModel* pfem) : FEElasticMat
 //-----------------------------------------------------------------------------
 mat3ds FEOsmoticVirialExpansion::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // jacobian
     double J = pt.m_J;
@@ -69,7 +69,7 @@ mat3ds FEOsmoticVirialExpansion::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEOsmoticVirialExpansion::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // jacobian
     double J = pt.m_J;
@@ -55,7 +55,7 @@ FEPRLig::FEPRLig(FEModel* pfem) : FEElasticMaterial(pfem)
 
 mat3ds FEPRLig::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// obtain the deformation tensor F
 	mat3d &F = pt.m_F;
@@ -147,7 +147,7 @@ mat3ds FEPRLig::Stress(FEMaterialPoint& mp)
 
 tens4ds FEPRLig::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// obtain the deformation tensor F
 	mat3d &F = pt.m_F;
@@ -346,7 +346,7 @@ double FEPRLig::StrainEnergyDensity(FEMaterialPoint& pt)
 {
     double sed = 0;
 
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // obtain the deformation tensor F
     mat3d &F = mp.m_F;
@@ -63,7 +63,7 @@ bool FEPerfectOsmometer::Init()
 //-----------------------------------------------------------------------------
 mat3ds FEPerfectOsmometer::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -83,7 +83,7 @@ mat3ds FEPerfectOsmometer::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEPerfectOsmometer::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// jacobian
 	double J = pt.m_J;
@@ -51,7 +51,7 @@ FEPointBodyForce::FEPointBodyForce(FEModel* pfem) : FEBodyForce(pfem)
 //-----------------------------------------------------------------------------
 vec3d FEPointBodyForce::force(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	vec3d x = pt.m_rt;
 	vec3d n = x - m_rc;
 	double l = n.unit();
@@ -63,7 +63,7 @@ vec3d FEPointBodyForce::force(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 mat3ds FEPointBodyForce::stiffness(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	vec3d x = pt.m_rt;
 	vec3d n = x - m_rc;
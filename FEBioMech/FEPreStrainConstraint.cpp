@@ -108,8 +108,8 @@ bool FEPreStrainConstraint::Augment(FESolidDomain* psd, int n, int naug)
 		for (int i=0; i<nint; ++i)
 		{
 			FEMaterialPoint& mp = *(el.GetMaterialPoint(i)->GetPointData(n));
-			FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
-			FEPrestrainMaterialPoint& pt = *mp.ExtractData<FEPrestrainMaterialPoint>();
+			FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
+			FEPrestrainMaterialPoint& pt = *mp.GetData<FEPrestrainMaterialPoint>();
 
 			const mat3d& Fc = pt.PrestrainCorrection();
 			const mat3d& F = ep.m_F;
@@ -139,8 +139,8 @@ bool FEPreStrainConstraint::Augment(FESolidDomain* psd, int n, int naug)
 			for (int i=0; i<nint; ++i)
 			{
 				FEMaterialPoint& mp = *(el.GetMaterialPoint(i)->GetPointData(n));
-				FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
-				FEPrestrainMaterialPoint& pt = *mp.ExtractData<FEPrestrainMaterialPoint>();
+				FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
+				FEPrestrainMaterialPoint& pt = *mp.GetData<FEPrestrainMaterialPoint>();
 
 				const mat3d& Fc = pt.PrestrainCorrection();
 				const mat3d& F = ep.m_F;
@@ -176,8 +176,8 @@ FEInSituStretchConstraint::FEInSituStretchConstraint(FEModel* pfem) : FEPreStrai
 //-----------------------------------------------------------------------------
 mat3d FEInSituStretchConstraint::UpdateFc(const mat3d& F, const mat3d& Fc_prev, FEMaterialPoint& mp, FEPrestrainMaterial* pmat)
 {
-	FEPrestrainMaterialPoint& psp = *mp.ExtractData<FEPrestrainMaterialPoint>();
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEPrestrainMaterialPoint& psp = *mp.GetData<FEPrestrainMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	FEElasticMaterial* elasticMat = pmat->GetElasticMaterial();
 	if (elasticMat == nullptr) return mat3dd(1.0);
@@ -62,7 +62,7 @@ mat3d FEPreStrainUncoupledElastic::PrestrainGradient(FEMaterialPoint& mp)
 	mat3d F0 = mat3d::identity();
 	if (m_Fp) F0 = m_Fp->Prestrain(mp);
 
-	FEPrestrainMaterialPoint& pt = *(mp.ExtractData<FEPrestrainMaterialPoint>());
+	FEPrestrainMaterialPoint& pt = *(mp.GetData<FEPrestrainMaterialPoint>());
 	pt.setInitialPrestrain(F0);
 
 	return pt.prestrain();
@@ -71,8 +71,8 @@ mat3d FEPreStrainUncoupledElastic::PrestrainGradient(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 mat3ds FEPreStrainUncoupledElastic::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ep = *(mp.ExtractData<FEElasticMaterialPoint>());
-	FEPrestrainMaterialPoint& pp = *(mp.ExtractData<FEPrestrainMaterialPoint>());
+	FEElasticMaterialPoint& ep = *(mp.GetData<FEElasticMaterialPoint>());
+	FEPrestrainMaterialPoint& pp = *(mp.GetData<FEPrestrainMaterialPoint>());
 
 	// store the original deformation gradient
 	mat3d F0 = ep.m_F;
@@ -99,8 +99,8 @@ mat3ds FEPreStrainUncoupledElastic::DevStress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEPreStrainUncoupledElastic::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ep = *(mp.ExtractData<FEElasticMaterialPoint>());
-	FEPrestrainMaterialPoint& pt = *(mp.ExtractData<FEPrestrainMaterialPoint>());
+	FEElasticMaterialPoint& ep = *(mp.GetData<FEElasticMaterialPoint>());
+	FEPrestrainMaterialPoint& pt = *(mp.GetData<FEPrestrainMaterialPoint>());
 
 	// store the original deformation gradient
 	mat3d F0 = ep.m_F;
@@ -44,7 +44,7 @@ FEPrescribedActiveContractionIsotropic::FEPrescribedActiveContractionIsotropic(F
 //-----------------------------------------------------------------------------
 mat3ds FEPrescribedActiveContractionIsotropic::Stress(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
     double J = pt.m_J;
     mat3ds b = pt.LeftCauchyGreen();
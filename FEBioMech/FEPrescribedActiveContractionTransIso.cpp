@@ -65,7 +65,7 @@ void FEPrescribedActiveContractionTransIso::Serialize(DumpStream& ar)
 //-----------------------------------------------------------------------------
 mat3ds FEPrescribedActiveContractionTransIso::Stress(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
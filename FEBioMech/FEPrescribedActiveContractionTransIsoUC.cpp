@@ -64,7 +64,7 @@ void FEPrescribedActiveContractionTransIsoUC::Serialize(DumpStream& ar)
 //-----------------------------------------------------------------------------
 mat3ds FEPrescribedActiveContractionTransIsoUC::DevStress(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     double J = pt.m_J;
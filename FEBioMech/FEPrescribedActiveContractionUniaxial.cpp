@@ -65,7 +65,7 @@ void FEPrescribedActiveContractionUniaxial::Serialize(DumpStream& ar)
 //-----------------------------------------------------------------------------
 mat3ds FEPrescribedActiveContractionUniaxial::Stress(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     mat3d &F = pt.m_F;
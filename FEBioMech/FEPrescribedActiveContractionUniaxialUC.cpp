@@ -65,7 +65,7 @@ void FEPrescribedActiveContractionUniaxialUC::Serialize(DumpStream& ar)
 //-----------------------------------------------------------------------------
 mat3ds FEPrescribedActiveContractionUniaxialUC::DevStress(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // deformation gradient
     double J = pt.m_J;
@@ -114,7 +114,7 @@ double FERVEDamageMaterial::StrainEnergyDensity(FEMaterialPoint& pt)
 double FERVEDamageMaterial::Damage(FEMaterialPoint& pt)
 {
     // get the damage material point data
-    FEDamageMaterialPoint& pd = *pt.ExtractData<FEDamageMaterialPoint>();
+    FEDamageMaterialPoint& pd = *pt.GetData<FEDamageMaterialPoint>();
     
     // evaluate the trial value of the damage criterion
     // this must be done before evaluating the damage
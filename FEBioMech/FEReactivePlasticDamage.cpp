@@ -113,9 +113,9 @@ FEMaterialPoint* FEReactivePlasticDamage::CreateMaterialPointData()
 void FEReactivePlasticDamage::ElasticDeformationGradient(FEMaterialPoint& pt)
 {
     // extract total deformation gradient
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract inverse of plastic deformation gradient and evaluate elastic deformation gradient
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     FEShellElementNew* sel = dynamic_cast<FEShellElementNew*>(pt.m_elem);
 
     for (int i=0; i<m_n; ++i) {
@@ -256,9 +256,9 @@ void FEReactivePlasticDamage::UpdateSpecializedMaterialPoints(FEMaterialPoint& p
     ElasticDeformationGradient(pt);
     
     // extract total deformation gradient
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic damage material point
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     // zero the total damage variable
     pp.m_D = 0.0;
@@ -315,9 +315,9 @@ mat3ds FEReactivePlasticDamage::Stress(FEMaterialPoint& pt)
     ElasticDeformationGradient(pt);
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic damage material point
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     mat3ds s = m_pBase->Stress(pt)*pp.IntactBonds();
     
@@ -347,9 +347,9 @@ tens4ds FEReactivePlasticDamage::Tangent(FEMaterialPoint& pt)
     ElasticDeformationGradient(pt);
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     tens4ds c = m_pBase->Tangent(pt)*pp.IntactBonds();
     
@@ -379,9 +379,9 @@ double FEReactivePlasticDamage::StrainEnergyDensity(FEMaterialPoint& pt)
     ElasticDeformationGradient(pt);
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     double sed = m_pBase->StrainEnergyDensity(pt)*pp.IntactBonds();
     
@@ -410,7 +410,7 @@ double FEReactivePlasticDamage::StrainEnergyDensity(FEMaterialPoint& pt)
 double FEReactivePlasticDamage::Damage(FEMaterialPoint& pt, int k)
 {
     //get plastic damage material point data
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     return pp.m_d[k];
 }
@@ -434,7 +434,7 @@ mat3ds FEReactivePlasticDamage::YieldSurfaceNormal(FEElasticMaterialPoint& pe)
 void FEReactivePlasticDamage::OctahedralPlasticStrain(FEMaterialPoint& pt)
 {
     // extract plastic material point
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     double ev[3];
     for (int i=0; i<m_n; ++i) {
@@ -454,9 +454,9 @@ void FEReactivePlasticDamage::ReactiveHeatSupplyDensity(FEMaterialPoint& pt)
     double dt = GetFEModel()->GetTime().timeIncrement;
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticDamageMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticDamageMaterialPoint>();
+    FEReactivePlasticDamageMaterialPoint& pp = *pt.GetData<FEReactivePlasticDamageMaterialPoint>();
     
     if (dt == 0) {
         pp.m_Rhat = 0;
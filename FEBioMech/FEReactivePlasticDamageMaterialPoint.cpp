@@ -98,7 +98,7 @@ void FEReactivePlasticDamageMaterialPoint::Init()
 //-----------------------------------------------------------------------------
 void FEReactivePlasticDamageMaterialPoint::Update(const FETimeInfo& timeInfo)
 {
-    FEElasticMaterialPoint& pt = *m_pNext->ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *m_pNext->GetData<FEElasticMaterialPoint>();
     for (int i=0; i<m_Fusi.size(); ++i) {
         m_Fusi[i] = m_Fvsi[i];
         m_Ku[i] = m_Kv[i];
@@ -85,9 +85,9 @@ FEMaterialPoint* FEReactivePlasticity::CreateMaterialPointData()
 void FEReactivePlasticity::ElasticDeformationGradient(FEMaterialPoint& pt)
 {
     // extract total deformation gradient
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract inverse of plastic deformation gradient and evaluate elastic deformation gradient
-    FEReactivePlasticityMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+    FEReactivePlasticityMaterialPoint& pp = *pt.GetData<FEReactivePlasticityMaterialPoint>();
     FEShellElementNew* sel = dynamic_cast<FEShellElementNew*>(pt.m_elem);
 
     for (int i=0; i<m_n; ++i) {
@@ -222,9 +222,9 @@ mat3ds FEReactivePlasticity::Stress(FEMaterialPoint& pt)
     ElasticDeformationGradient(pt);
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticityMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+    FEReactivePlasticityMaterialPoint& pp = *pt.GetData<FEReactivePlasticityMaterialPoint>();
     
     mat3ds s = m_pBase->Stress(pt)*(1 - pp.YieldedBonds());
     
@@ -256,9 +256,9 @@ tens4ds FEReactivePlasticity::Tangent(FEMaterialPoint& pt)
     ElasticDeformationGradient(pt);
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticityMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+    FEReactivePlasticityMaterialPoint& pp = *pt.GetData<FEReactivePlasticityMaterialPoint>();
     
     tens4ds c = m_pBase->Tangent(pt)*(1 - pp.YieldedBonds());
     
@@ -290,9 +290,9 @@ double FEReactivePlasticity::StrainEnergyDensity(FEMaterialPoint& pt)
     ElasticDeformationGradient(pt);
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticityMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+    FEReactivePlasticityMaterialPoint& pp = *pt.GetData<FEReactivePlasticityMaterialPoint>();
     
     double sed = m_pBase->StrainEnergyDensity(pt)*(1 - pp.YieldedBonds());
     
@@ -337,7 +337,7 @@ mat3ds FEReactivePlasticity::YieldSurfaceNormal(FEElasticMaterialPoint& pe)
 void FEReactivePlasticity::OctahedralPlasticStrain(FEMaterialPoint& pt)
 {
     // extract plastic material point
-    FEReactivePlasticityMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+    FEReactivePlasticityMaterialPoint& pp = *pt.GetData<FEReactivePlasticityMaterialPoint>();
     
     double ev[3];
     for (int i=0; i<m_n; ++i) {
@@ -357,9 +357,9 @@ void FEReactivePlasticity::ReactiveHeatSupplyDensity(FEMaterialPoint& pt)
     double dt = GetFEModel()->GetTime().timeIncrement;
     
     // extract elastic material point
-    FEElasticMaterialPoint& pe = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pe = *pt.GetData<FEElasticMaterialPoint>();
     // extract plastic material point
-    FEReactivePlasticityMaterialPoint& pp = *pt.ExtractData<FEReactivePlasticityMaterialPoint>();
+    FEReactivePlasticityMaterialPoint& pp = *pt.GetData<FEReactivePlasticityMaterialPoint>();
     
     if (dt == 0) {
         pp.m_Rhat = 0;
@@ -118,10 +118,10 @@ FEMaterialPoint* FEReactiveViscoelasticMaterial::CreateMaterialPointData()
 FEMaterialPoint* FEReactiveViscoelasticMaterial::GetBaseMaterialPoint(FEMaterialPoint& mp)
 {
     // get the reactive viscoelastic point data
-    FEReactiveViscoelasticMaterialPoint& rvp = *mp.ExtractData<FEReactiveViscoelasticMaterialPoint>();
+    FEReactiveViscoelasticMaterialPoint& rvp = *mp.GetData<FEReactiveViscoelasticMaterialPoint>();
     
     // get the elastic material point
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // extract the strong bond material point data
     FEMaterialPoint* sb = rvp.GetPointData(0);
@@ -129,7 +129,7 @@ FEMaterialPoint* FEReactiveViscoelasticMaterial::GetBaseMaterialPoint(FEMaterial
     sb->m_index = mp.m_index;
     
     // copy the elastic material point data to the strong bond component
-    FEElasticMaterialPoint& epi = *sb->ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& epi = *sb->GetData<FEElasticMaterialPoint>();
     epi.m_rt = ep.m_rt;
     epi.m_r0 = mp.m_r0;
     epi.m_F = ep.m_F;
@@ -146,10 +146,10 @@ FEMaterialPoint* FEReactiveViscoelasticMaterial::GetBaseMaterialPoint(FEMaterial
 FEMaterialPoint* FEReactiveViscoelasticMaterial::GetBondMaterialPoint(FEMaterialPoint& mp)
 {
     // get the reactive viscoelastic point data
-    FEReactiveViscoelasticMaterialPoint& rvp = *mp.ExtractData<FEReactiveViscoelasticMaterialPoint>();
+    FEReactiveViscoelasticMaterialPoint& rvp = *mp.GetData<FEReactiveViscoelasticMaterialPoint>();
     
     // get the elastic material point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // extract the weak bond material point data
     FEMaterialPoint* wb = rvp.GetPointData(1);
@@ -157,7 +157,7 @@ FEMaterialPoint* FEReactiveViscoelasticMaterial::GetBondMaterialPoint(FEMaterial
     wb->m_index = mp.m_index;
     
     // copy the elastic material point data to the weak bond component
-    FEElasticMaterialPoint& epi = *wb->ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& epi = *wb->GetData<FEElasticMaterialPoint>();
     epi.m_rt = ep.m_rt;
     epi.m_r0 = mp.m_r0;
     epi.m_F = ep.m_F;
@@ -180,10 +180,10 @@ bool FEReactiveViscoelasticMaterial::NewGeneration(FEMaterialPoint& mp)
     if (ReformingBondMassFraction(mp) < m_wmin) return false;
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // check if the current deformation gradient is different from that of
     // the last generation, in which case store the current state
@@ -239,7 +239,7 @@ bool FEReactiveViscoelasticMaterial::NewGeneration(FEMaterialPoint& mp)
 double FEReactiveViscoelasticMaterial::BreakingBondMassFraction(FEMaterialPoint& mp, const int ig, const mat3ds D)
 {
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     // bond mass fraction
     double w = 0;
@@ -282,10 +282,10 @@ double FEReactiveViscoelasticMaterial::BreakingBondMassFraction(FEMaterialPoint&
 double FEReactiveViscoelasticMaterial::ReformingBondMassFraction(FEMaterialPoint& mp)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
         
     mat3ds D = ep.RateOfDeformation();
     
@@ -336,13 +336,13 @@ mat3ds FEReactiveViscoelasticMaterial::StressWeakBonds(FEMaterialPoint& mp)
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
 
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
     
     // get fiber material point data (if it exists)
-    FEFiberMaterialPoint* fp = pt.ExtractData<FEFiberMaterialPoint>();
+    FEFiberMaterialPoint* fp = pt.GetData<FEFiberMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
     
@@ -424,13 +424,13 @@ tens4ds FEReactiveViscoelasticMaterial::TangentWeakBonds(FEMaterialPoint& mp)
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
 
     // get fiber material point data (if it exists)
-    FEFiberMaterialPoint* fp = pt.ExtractData<FEFiberMaterialPoint>();
+    FEFiberMaterialPoint* fp = pt.GetData<FEFiberMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
     
@@ -513,13 +513,13 @@ double FEReactiveViscoelasticMaterial::WeakBondSED(FEMaterialPoint& mp)
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
 
     // get fiber material point data (if it exists)
-    FEFiberMaterialPoint* fp = pt.ExtractData<FEFiberMaterialPoint>();
+    FEFiberMaterialPoint* fp = pt.GetData<FEFiberMaterialPoint>();
     
     // get the viscous point data
     mat3ds D = ep.RateOfDeformation();
@@ -589,10 +589,10 @@ double FEReactiveViscoelasticMaterial::StrainEnergyDensity(FEMaterialPoint& mp)
 void FEReactiveViscoelasticMaterial::CullGenerations(FEMaterialPoint& mp)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
     
@@ -641,10 +641,10 @@ void FEReactiveViscoelasticMaterial::UpdateSpecializedMaterialPoints(FEMaterialP
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
 
     mat3ds Uv = ep.RightStretch();
     double Jv = ep.m_J;
@@ -677,7 +677,7 @@ int FEReactiveViscoelasticMaterial::RVEGenerations(FEMaterialPoint& mp)
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // return the bond mass fraction of the reforming generation
     return (int)pt.m_v.size();
@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include "FECore/FEAnalysis.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -50,7 +51,7 @@ void FERemodelingElasticDomain::Reset()
 
 	// initialize rhor for each material point
 	ForEachMaterialPoint([&](FEMaterialPoint& mp) {
-		FERemodelingMaterialPoint& pt = *mp.ExtractData<FERemodelingMaterialPoint>();
+		FERemodelingMaterialPoint& pt = *mp.GetData<FERemodelingMaterialPoint>();
 		pt.m_rhor = pme->Density(mp);
 	});
 }
@@ -70,7 +71,7 @@ bool FERemodelingElasticDomain::Init()
 
 	// initialize rhor for each material point
 	ForEachMaterialPoint([&](FEMaterialPoint& mp) {
-		FERemodelingMaterialPoint& pt = *mp.ExtractData<FERemodelingMaterialPoint>();
+		FERemodelingMaterialPoint& pt = *mp.GetData<FERemodelingMaterialPoint>();
 		pt.m_rhor = pme->Density(mp);
 	});
 
@@ -94,7 +95,8 @@ void FERemodelingElasticDomain::StiffnessMatrix(FELinearSystem& LS)
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = 3*el.Nodes();
 		ke.resize(ndof, ndof);
 		ke.zero();
@@ -116,7 +118,7 @@ void FERemodelingElasticDomain::StiffnessMatrix(FELinearSystem& LS)
 				ke[j][i] = ke[i][j];
 
 		// get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -102,7 +102,7 @@ mat3ds FERemodelingElasticMaterial::Stress(FEMaterialPoint& mp)
 {
 	double dt = GetFEModel()->GetTime().timeIncrement;
 
-    FERemodelingMaterialPoint& rpt = *(mp.ExtractData<FERemodelingMaterialPoint>());
+    FERemodelingMaterialPoint& rpt = *(mp.GetData<FERemodelingMaterialPoint>());
 
 	// calculate the strain energy density at this material point
 	rpt.m_sed = StrainEnergyDensity(mp);
@@ -52,7 +52,7 @@ void FESRIElasticSolidDomain::ElementInternalForce(FESolidElement& el, vector<do
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// calculate the jacobian
 		double detJt = invjact(el, Ji, n);
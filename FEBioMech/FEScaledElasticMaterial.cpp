@@ -40,7 +40,7 @@ FEScaledElasticMaterial::FEScaledElasticMaterial(FEModel* pfem, FEElasticMateria
 mat3ds FEScaledElasticMaterial::Stress(FEMaterialPoint& pt)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = mp.LeftHencky();
@@ -57,7 +57,7 @@ mat3ds FEScaledElasticMaterial::Stress(FEMaterialPoint& pt)
 tens4ds FEScaledElasticMaterial::Tangent(FEMaterialPoint& pt)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = mp.LeftHencky();
@@ -74,7 +74,7 @@ tens4ds FEScaledElasticMaterial::Tangent(FEMaterialPoint& pt)
 double FEScaledElasticMaterial::StrainEnergyDensity(FEMaterialPoint& pt)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = mp.LeftHencky();
@@ -40,7 +40,7 @@ FEScaledUncoupledMaterial::FEScaledUncoupledMaterial(FEModel* pfem, FEUncoupledM
 mat3ds FEScaledUncoupledMaterial::DevStress(FEMaterialPoint& pt)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = mp.LeftHencky();
@@ -57,7 +57,7 @@ mat3ds FEScaledUncoupledMaterial::DevStress(FEMaterialPoint& pt)
 tens4ds FEScaledUncoupledMaterial::DevTangent(FEMaterialPoint& pt)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = mp.LeftHencky();
@@ -74,7 +74,7 @@ tens4ds FEScaledUncoupledMaterial::DevTangent(FEMaterialPoint& pt)
 double FEScaledUncoupledMaterial::DevStrainEnergyDensity(FEMaterialPoint& pt)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& mp = *pt.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& mp = *pt.GetData<FEElasticMaterialPoint>();
     
     // evaluate spatial Hencky (logarithmic) strain
     mat3ds h = mp.LeftHencky();
@@ -47,6 +47,7 @@ BEGIN_FECORE_CLASS(FESlidingElasticInterface, FEContactInterface)
 	ADD_PARAMETER(m_stol     , "search_tol"         );
 	ADD_PARAMETER(m_bsymm    , "symmetric_stiffness");
 	ADD_PARAMETER(m_srad     , "search_radius"      );
+	ADD_PARAMETER(m_skin     , "search_skin"        );
 	ADD_PARAMETER(m_nsegup   , "seg_up"             );
 	ADD_PARAMETER(m_btension , "tension"            );
 	ADD_PARAMETER(m_naugmin  , "minaug"             );
@@ -299,6 +300,7 @@ FESlidingElasticInterface::FESlidingElasticInterface(FEModel* pfem) : FEContactI
     m_stol = 0.01;
     m_bsymm = true;
     m_srad = 1.0;
+    m_skin = 0.0;
     m_nsegup = 0;
     m_bautopen = false;
 	m_bupdtpen = false;
@@ -423,7 +425,7 @@ void FESlidingElasticInterface::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        int* id = mesh.Node(sn[l]).m_ID;
                         lm[6*l  ] = id[dof_X];
                         lm[6*l+1] = id[dof_Y];
                         lm[6*l+2] = id[dof_Z];
@@ -434,7 +436,7 @@ void FESlidingElasticInterface::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        int* id = mesh.Node(mn[l]).m_ID;
                         lm[6*(l+nseln)  ] = id[dof_X];
                         lm[6*(l+nseln)+1] = id[dof_Y];
                         lm[6*(l+nseln)+2] = id[dof_Z];
@@ -557,6 +559,11 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
         }
     }
     
+    // update the contact candidate lists
+    FEContactCandidateList& cl = m_cand[&ss == &m_ss ? 0 : 1];
+    cl.SetSkin(m_skin);
+    cl.Update(ss, ms, m_srad);
+
     // loop over all integration points
 #pragma omp parallel for schedule(dynamic)
     for (int i=0; i<ss.Elements(); ++i)
@@ -596,7 +603,7 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
             }
             
             // find the intersection point with the secondary surface
-            if (pme == 0 && bupseg) pme = np.Project(r, nu, rs);
+            if (pme == 0 && bupseg) pme = np.Project(r, nu, rs, cl, i, j);
             
             data.m_pme = pme;
             data.m_nu = nu;
@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "FEContactInterface.h"
 #include "FEContactSurface.h"
+#include <FECore/FEContactCandidateList.h>
 
 // Elastic sliding contact, reducing the algorithm of biphasic sliding contact
 // (FESlidingInterface2) to elastic case.  The algorithm derives from Bonet
@@ -157,6 +158,7 @@ protected:
 public:
     FESlidingElasticSurface	m_ss;	//!< primary surface
 	FESlidingElasticSurface	m_ms;	//!< secondary surface
+	FEContactCandidateList	m_cand[2];	//!< contact candidates for both projection directions
 
     int				m_knmult;		//!< higher order stiffness multiplier
     bool			m_btwo_pass;	//!< two-pass flag
@@ -165,6 +167,7 @@ public:
     double			m_stol;			//!< search tolerance
     bool			m_bsymm;		//!< use symmetric stiffness components only
     double			m_srad;			//!< contact search radius
+    double			m_skin;			//!< skin distance of the contact candidate lists (0 = off)
     int				m_naugmax;		//!< maximum nr of augmentations
     int				m_naugmin;		//!< minimum nr of augmentations
     int				m_nsegup;		//!< segment update parameter
@@ -29,7 +29,7 @@ SOFTWARE.*/
 #include "FESolidLinearSystem.h"
 #include "FESolidSolver.h"
 #include <FECore/FELinearConstraintManager.h>
-#include <FECore/FEModel.h>
+#include "FEMechModel.h"
 
 FESolidLinearSystem::FESolidLinearSystem(FESolver* solver, FERigidSolver* rigidSolver, FEGlobalMatrix& K, std::vector<double>& F, std::vector<double>& u, bool bsymm, double alpha, int nreq) : FELinearSystem(solver, K, F, u, bsymm)
 {
@@ -45,8 +45,29 @@ void FESolidLinearSystem::StiffnessAssemblyScaleFactor(double a)
 	m_stiffnessScale = a;
 }
 
+// The rigid body contributions need the full element matrix
+bool FESolidLinearSystem::SymmetricElementMatrices()
+{
+	if (FELinearSystem::SymmetricElementMatrices() == false) return false;
+
+	FEMechModel* fem = dynamic_cast<FEMechModel*>(m_solver->GetFEModel());
+	if (fem && (fem->RigidBodies() > 0)) return false;
+
+	return true;
+}
+
 void FESolidLinearSystem::Assemble(const FEElementMatrix& ke)
 {
+	// symmetric element matrices only define the upper triangular part, but the 
+	// linear constraints and rigid bodies need the full matrix.
+	if (ke.IsSymmetric() && (SymmetricElementMatrices() == false))
+	{
+		FEElementMatrix kf(ke);
+		kf.CompleteSymmetric();
+		Assemble(kf);
+		return;
+	}
+
 	// Rigid joints require a different assembly approach in that we can do 
 	// a direct assembly as defined by the base class. 
 	// Currently, we assume that if the node list of the element matrix is not
@@ -109,8 +130,12 @@ void FESolidLinearSystem::Assemble(const FEElementMatrix& ke)
 						if (I >= 0)
 						{
 							// dof i is not a prescribed degree of freedom
-							#pragma omp atomic
-							m_F[I] -= ke[i][j] * ui[J];
+							if (m_batomic)
+							{
+								#pragma omp atomic
+								m_F[I] -= ke.value(i, j) * ui[J];
+							}
+							else m_F[I] -= ke.value(i, j) * ui[J];
 						}
 					}
 
@@ -42,6 +42,9 @@ public:
 	// The contributions of prescribed degrees of freedom will be stored in m_F
 	void Assemble(const FEElementMatrix& ke) override;
 
+	// symmetric element matrices can't be used with rigid bodies
+	bool SymmetricElementMatrices() override;
+
 	// scale factor for stiffness matrix
 	void StiffnessAssemblyScaleFactor(double a);
 
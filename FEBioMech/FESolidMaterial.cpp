@@ -63,6 +63,18 @@ tens4dmm FESolidMaterial::SolidTangent(FEMaterialPoint& mp)
 	return m_secant_tangent ? SecantTangent(mp) : Tangent(mp);
 }
 
+//-----------------------------------------------------------------------------
+void FESolidMaterial::BatchStress(FEMaterialPoint** mp, mat3ds* s, int n)
+{
+	for (int i = 0; i < n; ++i) s[i] = SolidStress(*mp[i]);
+}
+
+//-----------------------------------------------------------------------------
+void FESolidMaterial::BatchTangent(FEMaterialPoint** mp, tens4dmm* c, int n)
+{
+	for (int i = 0; i < n; ++i) c[i] = SolidTangent(*mp[i]);
+}
+
 //-----------------------------------------------------------------------------
 //! calculate the 2nd Piola-Kirchhoff stress at material point, using prescribed Lagrange strain
 //! needed for EAS analyses where the compatible strain (calculated from displacements) is enhanced
@@ -80,7 +92,7 @@ mat3ds FESolidMaterial::PK2Stress(FEMaterialPoint& mp, const mat3ds E)
     double J = lam[0]*lam[1]*lam[2];
     
     // temporarily replace F in material point with U
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     mat3d Fsafe = pt.m_F;
     double Jsafe = pt.m_J;
     pt.m_F = U;
@@ -117,7 +129,7 @@ tens4dmm FESolidMaterial::MaterialTangent(FEMaterialPoint& mp, const mat3ds E)
     double J = lam[0]*lam[1]*lam[2];
     
     // temporarily replace F in material point with U
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     mat3d Fsafe = pt.m_F;
     double Jsafe = pt.m_J;
     pt.m_F = U;
@@ -142,7 +154,7 @@ tens4dmm FESolidMaterial::MaterialTangent(FEMaterialPoint& mp, const mat3ds E)
 tens4dmm FESolidMaterial::SecantTangent(FEMaterialPoint& mp)
 {
     // extract the deformation gradient
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     mat3d F = pt.m_F;
     double J = pt.m_J;
     mat3ds E = pt.Strain();
@@ -69,6 +69,15 @@ public:
 
 	tens4dmm SolidTangent(FEMaterialPoint& pt);
 
+	//! evaluate the stress at a batch of n material points (e.g. all integration points of an element).
+	//! The default calls SolidStress for each point. Materials can override this to evaluate
+	//! all points in one (vectorizable) pass.
+	virtual void BatchStress(FEMaterialPoint** mp, mat3ds* s, int n);
+
+	//! evaluate the spatial tangent at a batch of n material points.
+	//! The default calls SolidTangent for each point.
+	virtual void BatchTangent(FEMaterialPoint** mp, tens4dmm* c, int n);
+
 protected:
 	FEParamDouble	m_density;	//!< material density
     
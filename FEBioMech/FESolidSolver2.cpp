@@ -638,6 +638,7 @@ void FESolidSolver2::PrepStep()
 	// store previous mesh state
 	// we need them for velocity and acceleration calculations
 	FEMesh& mesh = fem.GetMesh();
+	mesh.UpdateNodalValues();
 	for (int i=0; i<mesh.Nodes(); ++i)
 	{
 		FENode& ni = mesh.Node(i);
@@ -645,7 +646,6 @@ void FESolidSolver2::PrepStep()
 		ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
 		ni.m_ap = ni.m_at;
         ni.m_dp = ni.m_dt;
-		ni.UpdateValues();
 
         // initial guess at start of new time step
         // solid
@@ -55,7 +55,7 @@ FESphericalFiberDistribution::FESphericalFiberDistribution(FEModel* pfem) : FEEl
 //-----------------------------------------------------------------------------
 mat3ds FESphericalFiberDistribution::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -180,7 +180,7 @@ mat3ds FESphericalFiberDistribution::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FESphericalFiberDistribution::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -323,7 +323,7 @@ tens4ds FESphericalFiberDistribution::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FESphericalFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
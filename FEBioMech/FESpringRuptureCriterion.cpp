@@ -38,7 +38,7 @@ FESpringForceCriterion::FESpringForceCriterion(FEModel* fem) : FEMeshAdaptorCrit
 
 bool FESpringForceCriterion::GetMaterialPointValue(FEMaterialPoint& mp, double& value)
 {
-	FEDiscreteElasticMaterialPoint* ep = mp.ExtractData<FEDiscreteElasticMaterialPoint>();
+	FEDiscreteElasticMaterialPoint* ep = mp.GetData<FEDiscreteElasticMaterialPoint>();
 	if (ep == nullptr) return false;
 
 	vec3d& Ft = ep->m_Ft;
@@ -57,7 +57,7 @@ FESpringStretchCriterion::FESpringStretchCriterion(FEModel* fem) : FEMeshAdaptor
 
 bool FESpringStretchCriterion::GetMaterialPointValue(FEMaterialPoint& mp, double& value)
 {
-	FEDiscreteElasticMaterialPoint* ep = mp.ExtractData<FEDiscreteElasticMaterialPoint>();
+	FEDiscreteElasticMaterialPoint* ep = mp.GetData<FEDiscreteElasticMaterialPoint>();
 	if (ep == nullptr) return false;
 
 	double L0 = ep->m_dr0.norm();
@@ -42,7 +42,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEStVenantKirchhoff::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// lame parameters
 	double lam = m_v*m_E/((1+m_v)*(1-2*m_v));
@@ -66,7 +66,7 @@ mat3ds FEStVenantKirchhoff::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEStVenantKirchhoff::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// jacobian
 	double J = pt.m_J;
@@ -89,7 +89,7 @@ tens4ds FEStVenantKirchhoff::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEStVenantKirchhoff::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// lame parameters
 	double lam = m_v*m_E/((1+m_v)*(1-2*m_v));
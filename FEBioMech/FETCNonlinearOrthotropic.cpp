@@ -57,7 +57,7 @@ FETCNonlinearOrthotropic::FETCNonlinearOrthotropic(FEModel* pfem) : FEUncoupledM
 // Calculate the deviatoric Cauchy stress
 mat3ds FETCNonlinearOrthotropic::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -180,7 +180,7 @@ mat3ds FETCNonlinearOrthotropic::DevStress(FEMaterialPoint& mp)
 //! Calculate the deviatoric tangent
 tens4ds FETCNonlinearOrthotropic::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	const double third = 1.0 / 3.0;
 
@@ -556,7 +556,7 @@ tens4ds FETCNonlinearOrthotropic::DevTangent(FEMaterialPoint& mp)
 // Calculate the deviatoric strain energy density
 double FETCNonlinearOrthotropic::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// deformation gradient
 	mat3d& F = pt.m_F;
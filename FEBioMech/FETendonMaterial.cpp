@@ -56,7 +56,7 @@ FETendonMaterial::FETendonMaterial(FEModel* pfem) : FEUncoupledMaterial(pfem) {}
 //!
 mat3ds FETendonMaterial::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -184,7 +184,7 @@ mat3ds FETendonMaterial::DevStress(FEMaterialPoint& mp)
 //!
 tens4ds FETendonMaterial::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
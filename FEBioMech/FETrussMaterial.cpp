@@ -38,7 +38,7 @@ END_FECORE_CLASS();
 // Note that this function returns the Kirchhoff stress!
 double FETrussMaterial::Stress(FEMaterialPoint &mp)
 {
-	FETrussMaterialPoint& pt = *mp.ExtractData<FETrussMaterialPoint>();
+	FETrussMaterialPoint& pt = *mp.GetData<FETrussMaterialPoint>();
 	return m_E*log(pt.m_l);
 }
 
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEElasticMaterial.h"
 #include <FECore/FEModel.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 BEGIN_FECORE_CLASS(FEUDGHexDomain, FEElasticSolidDomain)
@@ -88,7 +89,7 @@ void FEUDGHexDomain::UDGInternalForces(FESolidElement& el, vector<double>& fe)
 {
 	// get the stress data
 	FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-	FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+	FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 	mat3ds& s = pt.m_s;
 
 	// calculate the average cartesian derivatives
@@ -225,7 +226,8 @@ void FEUDGHexDomain::StiffnessMatrix(FELinearSystem& LS)
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 
 		// create the element's stiffness matrix
 		int ndof = 3*el.Nodes();
@@ -340,7 +342,7 @@ void FEUDGHexDomain::UDGGeometricalStiffness(FESolidElement& el, matrix& ke)
 
 	// get the material point data
 	FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-	FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+	FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 	// element's Cauchy-stress tensor at gauss point n
 	// s is the voight vector
@@ -434,7 +436,7 @@ void FEUDGHexDomain::UDGMaterialStiffness(FESolidElement &el, matrix &ke)
 	// setup the material point
 	// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
 	FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-	FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+	FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 	// get the 'D' matrix
 	tens4ds C = m_pMat->Tangent(mp);
@@ -529,7 +531,7 @@ void FEUDGHexDomain::Update(const FETimeInfo& tp)
 
 		// get the material point data
 		FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// material point coordinates
 		// TODO: I'm not entirly happy with this solution
@@ -571,7 +571,7 @@ void FEUT4Domain::ElementInternalForces(FESolidElement& el, vector<double>& fe)
 	for (n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// calculate the jacobian
 		detJt = invjact(el, Ji, n);
@@ -1056,7 +1056,7 @@ void FEUT4Domain::ElementGeometricalStiffness(FESolidElement &el, matrix &ke)
 
 		// get the material point data
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// element's Cauchy-stress tensor at gauss point n
 		// s is the voight vector
@@ -1119,7 +1119,7 @@ void FEUT4Domain::ElementMaterialStiffness(FESolidElement &el, matrix &ke)
 		// setup the material point
 		// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// Calculate the tangent
 		tens4ds C = m_pMat->Tangent(mp);
@@ -49,7 +49,7 @@ FEUncoupledActiveContraction::FEUncoupledActiveContraction(FEModel* pfem) : FEUn
 //-----------------------------------------------------------------------------
 mat3ds FEUncoupledActiveContraction::DevStress(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d& F = pt.m_F;
@@ -83,19 +83,19 @@ bool FEUncoupledElasticMixture::Init()
 //-----------------------------------------------------------------------------
 mat3ds FEUncoupledElasticMixture::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+	FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 	vector<double>& w = pt.m_w;
 	assert(w.size() == m_pMat.size());
 
 	// get the elastic material point
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate stress
 	mat3ds s; s.zero();
 	for (int i=0; i < (int)m_pMat.size(); ++i)
 	{
 		// copy the elastic material point data to the components
-		FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
 		epi.m_elem = mp.m_elem;
 		epi.m_index = mp.m_index;
 		epi.m_rt = ep.m_rt;
@@ -119,19 +119,19 @@ mat3ds FEUncoupledElasticMixture::DevStress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEUncoupledElasticMixture::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+	FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 	vector<double>& w = pt.m_w;
 	assert(w.size() == m_pMat.size());
 
 	// get the elastic material point
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate elasticity tensor
 	tens4ds c(0.);
 	for (int i=0; i < (int)m_pMat.size(); ++i)
 	{
 		// copy the elastic material point data to the components
-		FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
 		epi.m_elem = mp.m_elem;
 		epi.m_index = mp.m_index;
 		epi.m_rt = ep.m_rt;
@@ -155,19 +155,19 @@ tens4ds FEUncoupledElasticMixture::DevTangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEUncoupledElasticMixture::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+	FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
 	vector<double>& w = pt.m_w;
 	assert(w.size() == m_pMat.size());
     
 	// get the elastic material point
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate strain energy density
 	double sed = 0.0;
 	for (int i=0; i < (int)m_pMat.size(); ++i)
 	{
 		// copy the elastic material point data to the components
-		FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
 		epi.m_elem = mp.m_elem;
 		epi.m_index = mp.m_index;
 		epi.m_rt = ep.m_rt;
@@ -191,19 +191,19 @@ double FEUncoupledElasticMixture::DevStrainEnergyDensity(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEUncoupledElasticMixture::StrongBondDevSED(FEMaterialPoint& mp)
 {
-    FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+    FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
     vector<double>& w = pt.m_w;
     assert(w.size() == m_pMat.size());
     
     // get the elastic material point
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate strain energy density
     double sed = 0.0;
     for (int i=0; i < (int)m_pMat.size(); ++i)
     {
         // copy the elastic material point data to the components
-        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
         epi.m_elem = mp.m_elem;
         epi.m_index = mp.m_index;
         epi.m_rt = ep.m_rt;
@@ -227,19 +227,19 @@ double FEUncoupledElasticMixture::StrongBondDevSED(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEUncoupledElasticMixture::WeakBondDevSED(FEMaterialPoint& mp)
 {
-    FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+    FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
     vector<double>& w = pt.m_w;
     assert(w.size() == m_pMat.size());
     
     // get the elastic material point
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate strain energy density
     double sed = 0.0;
     for (int i=0; i < (int)m_pMat.size(); ++i)
     {
         // copy the elastic material point data to the components
-        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
         epi.m_elem = mp.m_elem;
         epi.m_index = mp.m_index;
         epi.m_rt = ep.m_rt;
@@ -264,11 +264,11 @@ double FEUncoupledElasticMixture::WeakBondDevSED(FEMaterialPoint& mp)
 //! specialized material points
 void FEUncoupledElasticMixture::UpdateSpecializedMaterialPoints(FEMaterialPoint& mp, const FETimeInfo& tp)
 {
-    FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+    FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
     
     for (int i=0; i < (int) m_pMat.size(); ++i)
     {
-        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& epi = *pt.GetPointData(i)->GetData<FEElasticMaterialPoint>();
         epi.m_elem = mp.m_elem;
         FEMaterial* pmj = GetMaterial(i);
         pmj->UpdateSpecializedMaterialPoints(epi, tp);
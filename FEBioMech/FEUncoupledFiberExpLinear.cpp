@@ -55,7 +55,7 @@ FEUncoupledFiberExpLinear::FEUncoupledFiberExpLinear(FEModel* pfem) : FEElasticF
 //! Fiber material stress
 mat3ds FEUncoupledFiberExpLinear::DevFiberStress(FEMaterialPoint &mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the deformation gradient
 	mat3d F = pt.m_F;
@@ -114,7 +114,7 @@ mat3ds FEUncoupledFiberExpLinear::DevFiberStress(FEMaterialPoint &mp, const vec3
 //! Fiber material tangent
 tens4ds FEUncoupledFiberExpLinear::DevFiberTangent(FEMaterialPoint &mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the deformation gradient
 	mat3d F = pt.m_F;
@@ -185,7 +185,7 @@ tens4ds FEUncoupledFiberExpLinear::DevFiberTangent(FEMaterialPoint &mp, const ve
 //! Fiber material strain energy density
 double FEUncoupledFiberExpLinear::DevFiberStrainEnergyDensity(FEMaterialPoint &mp, const vec3d& a0)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the deformation gradient
 	mat3d F = pt.m_F;
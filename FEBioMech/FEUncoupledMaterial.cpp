@@ -29,6 +29,7 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FEUncoupledMaterial.h"
 #include <FECore/log.h>
+#include <FECore/FEElement.h>
 
 //-----------------------------------------------------------------------------
 // Material parameters for FEUncoupledMaterial
@@ -78,7 +79,7 @@ bool FEUncoupledMaterial::Init()
 //! two terms, namely the deviatoric stress and the pressure. 
 mat3ds FEUncoupledMaterial::Stress(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// calculate the stress as a sum of deviatoric stress and pressure
 	return mat3dd(UJ(pt.m_J)) + DevStress(mp);
@@ -93,7 +94,7 @@ mat3ds FEUncoupledMaterial::Stress(FEMaterialPoint &mp)
 //!
 tens4ds FEUncoupledMaterial::Tangent(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// 2nd-order identity tensor
 	mat3dd I(1);
@@ -119,12 +120,65 @@ tens4ds FEUncoupledMaterial::Tangent(FEMaterialPoint &mp)
 	return DevTangent(mp) + (IxI - I4*2)*p + IxI*(UJJ(pt.m_J)*pt.m_J);
 }
 
+//-----------------------------------------------------------------------------
+void FEUncoupledMaterial::BatchDevStress(FEMaterialPoint** mp, mat3ds* s, int n)
+{
+	for (int i = 0; i < n; ++i) s[i] = DevStress(*mp[i]);
+}
+
+//-----------------------------------------------------------------------------
+void FEUncoupledMaterial::BatchDevTangent(FEMaterialPoint** mp, tens4ds* c, int n)
+{
+	for (int i = 0; i < n; ++i) c[i] = DevTangent(*mp[i]);
+}
+
+//-----------------------------------------------------------------------------
+//! Batch version of Stress. The deviatoric stress is evaluated with BatchDevStress
+//! and the pressure is added here.
+void FEUncoupledMaterial::BatchStress(FEMaterialPoint** mp, mat3ds* s, int n)
+{
+	if (m_secant_stress) { FEElasticMaterial::BatchStress(mp, s, n); return; }
+
+	BatchDevStress(mp, s, n);
+	for (int i = 0; i < n; ++i)
+	{
+		double J = mp[i]->GetData<FEElasticMaterialPoint>()->m_J;
+		s[i] += mat3dd(UJ(J));
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Batch version of Tangent. 
+void FEUncoupledMaterial::BatchTangent(FEMaterialPoint** mp, tens4dmm* c, int n)
+{
+	if (m_secant_tangent) { FEElasticMaterial::BatchTangent(mp, c, n); return; }
+
+	const int NMAX = FEElement::MAX_INTPOINTS;
+	tens4ds cd[NMAX];
+
+	mat3dd I(1);
+	tens4ds IxI = dyad1s(I);
+	tens4ds I4  = dyad4s(I);
+
+	for (int i0 = 0; i0 < n; i0 += NMAX)
+	{
+		int m = (n - i0 < NMAX ? n - i0 : NMAX);
+		BatchDevTangent(mp + i0, cd, m);
+		for (int i = 0; i < m; ++i)
+		{
+			double J = mp[i0 + i]->GetData<FEElasticMaterialPoint>()->m_J;
+			double p = UJ(J);
+			c[i0 + i] = tens4dmm(cd[i] + (IxI - I4*2)*p + IxI*(UJJ(J)*J));
+		}
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! The strain energy density function calculates the total sed as a sum of
 //! two terms, namely the deviatoric sed and U(J).
 double FEUncoupledMaterial::StrainEnergyDensity(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate the stress as a sum of deviatoric stress and pressure
 	return U(pt.m_J) + DevStrainEnergyDensity(mp);
@@ -135,7 +189,7 @@ double FEUncoupledMaterial::StrainEnergyDensity(FEMaterialPoint &mp)
 //! two terms, namely the deviatoric sed and U(J).
 double FEUncoupledMaterial::StrongBondSED(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     // calculate the stress as a sum of deviatoric stress and pressure
     return U(pt.m_J) + StrongBondDevSED(mp);
@@ -154,7 +208,7 @@ double FEUncoupledMaterial::WeakBondSED(FEMaterialPoint &mp)
 FEMaterialPoint* FEUncoupledMaterial::CreateMaterialPointData()
 {
 	FEMaterialPoint* mp = FEElasticMaterial::CreateMaterialPointData();
-	FEElasticMaterialPoint& pt = *mp->ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp->GetData<FEElasticMaterialPoint>();
 	pt.m_buncoupled = true;
 	return mp;
 }
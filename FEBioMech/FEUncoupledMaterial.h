@@ -71,6 +71,12 @@ public:
 
 	//! Deviatoric strain energy density
 	virtual double DevStrainEnergyDensity(FEMaterialPoint& mp) { return 0; }
+
+	//! Deviatoric Cauchy stress at a batch of material points
+	virtual void BatchDevStress(FEMaterialPoint** mp, mat3ds* s, int n);
+
+	//! Deviatoric spatial tangent at a batch of material points
+	virtual void BatchDevTangent(FEMaterialPoint** mp, tens4ds* c, int n);
     
 public:
     virtual double StrongBondDevSED(FEMaterialPoint& pt) { return DevStrainEnergyDensity(pt); }
@@ -122,6 +128,12 @@ public:
 	//! total spatial tangent (do not overload!)
 	tens4ds Tangent(FEMaterialPoint& mp) final;
 
+	//! total Cauchy stress at a batch of material points (do not overload!)
+	void BatchStress(FEMaterialPoint** mp, mat3ds* s, int n) final;
+
+	//! total spatial tangent at a batch of material points (do not overload!)
+	void BatchTangent(FEMaterialPoint** mp, tens4dmm* c, int n) final;
+
 	//! calculate strain energy (do not overload!)
 	double StrainEnergyDensity(FEMaterialPoint& pt) final;
     double StrongBondSED(FEMaterialPoint& pt) final;
@@ -105,10 +105,10 @@ FEMaterialPoint* FEUncoupledReactiveViscoelasticMaterial::CreateMaterialPointDat
 FEMaterialPoint* FEUncoupledReactiveViscoelasticMaterial::GetBaseMaterialPoint(FEMaterialPoint& mp)
 {
     // get the reactive viscoelastic point data
-    FEReactiveViscoelasticMaterialPoint& rvp = *mp.ExtractData<FEReactiveViscoelasticMaterialPoint>();
+    FEReactiveViscoelasticMaterialPoint& rvp = *mp.GetData<FEReactiveViscoelasticMaterialPoint>();
     
     // get the elastic material point
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // extract the strong bond material point data
     FEMaterialPoint* sb = rvp.GetPointData(0);
@@ -116,7 +116,7 @@ FEMaterialPoint* FEUncoupledReactiveViscoelasticMaterial::GetBaseMaterialPoint(F
     sb->m_index = mp.m_index;
     
     // copy the elastic material point data to the strong bond component
-    FEElasticMaterialPoint& epi = *sb->ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& epi = *sb->GetData<FEElasticMaterialPoint>();
     epi.m_rt = ep.m_rt;
     epi.m_r0 = mp.m_r0;
     epi.m_F = ep.m_F;
@@ -133,10 +133,10 @@ FEMaterialPoint* FEUncoupledReactiveViscoelasticMaterial::GetBaseMaterialPoint(F
 FEMaterialPoint* FEUncoupledReactiveViscoelasticMaterial::GetBondMaterialPoint(FEMaterialPoint& mp)
 {
     // get the reactive viscoelastic point data
-    FEReactiveViscoelasticMaterialPoint& rvp = *mp.ExtractData<FEReactiveViscoelasticMaterialPoint>();
+    FEReactiveViscoelasticMaterialPoint& rvp = *mp.GetData<FEReactiveViscoelasticMaterialPoint>();
     
     // get the elastic material point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // extract the weak bond material point data
     FEMaterialPoint* wb = rvp.GetPointData(1);
@@ -144,7 +144,7 @@ FEMaterialPoint* FEUncoupledReactiveViscoelasticMaterial::GetBondMaterialPoint(F
     wb->m_index = mp.m_index;
     
     // copy the elastic material point data to the weak bond component
-    FEElasticMaterialPoint& epi = *wb->ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& epi = *wb->GetData<FEElasticMaterialPoint>();
     epi.m_rt = ep.m_rt;
     epi.m_r0 = mp.m_r0;
     epi.m_F = ep.m_F;
@@ -167,10 +167,10 @@ bool FEUncoupledReactiveViscoelasticMaterial::NewGeneration(FEMaterialPoint& mp)
     if (ReformingBondMassFraction(mp) < m_wmin) return false;
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
         
     // check if the current deformation gradient is different from that of
     // the last generation, in which case store the current state
@@ -226,7 +226,7 @@ bool FEUncoupledReactiveViscoelasticMaterial::NewGeneration(FEMaterialPoint& mp)
 double FEUncoupledReactiveViscoelasticMaterial::BreakingBondMassFraction(FEMaterialPoint& mp, const int ig, const mat3ds D)
 {
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     // bond mass fraction
     double w = 0;
@@ -269,10 +269,10 @@ double FEUncoupledReactiveViscoelasticMaterial::BreakingBondMassFraction(FEMater
 double FEUncoupledReactiveViscoelasticMaterial::ReformingBondMassFraction(FEMaterialPoint& mp)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
     
@@ -323,12 +323,12 @@ mat3ds FEUncoupledReactiveViscoelasticMaterial::DevStressWeakBonds(FEMaterialPoi
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
     // get fiber material point data (if it exists)
-    FEFiberMaterialPoint* fp = pt.ExtractData<FEFiberMaterialPoint>();
+    FEFiberMaterialPoint* fp = pt.GetData<FEFiberMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
 
@@ -411,13 +411,13 @@ tens4ds FEUncoupledReactiveViscoelasticMaterial::DevTangentWeakBonds(FEMaterialP
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
 
     // get fiber material point data (if it exists)
-    FEFiberMaterialPoint* fp = pt.ExtractData<FEFiberMaterialPoint>();
+    FEFiberMaterialPoint* fp = pt.GetData<FEFiberMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
 
@@ -500,13 +500,13 @@ double FEUncoupledReactiveViscoelasticMaterial::WeakBondDevSED(FEMaterialPoint&
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
 
     // get fiber material point data (if it exists)
-    FEFiberMaterialPoint* fp = pt.ExtractData<FEFiberMaterialPoint>();
+    FEFiberMaterialPoint* fp = pt.GetData<FEFiberMaterialPoint>();
     
     // get the viscous point data
     mat3ds D = ep.RateOfDeformation();
@@ -576,10 +576,10 @@ double FEUncoupledReactiveViscoelasticMaterial::DevStrainEnergyDensity(FEMateria
 void FEUncoupledReactiveViscoelasticMaterial::CullGenerations(FEMaterialPoint& mp)
 {
     // get the elastic material point data
-    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *mp.GetData<FEReactiveVEMaterialPoint>();
     
     mat3ds D = ep.RateOfDeformation();
     
@@ -628,10 +628,10 @@ void FEUncoupledReactiveViscoelasticMaterial::UpdateSpecializedMaterialPoints(FE
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // get the elastic point data
-    FEElasticMaterialPoint& ep = *wb.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& ep = *wb.GetData<FEElasticMaterialPoint>();
     
     mat3ds Uv = ep.RightStretch();
     double Jv = ep.m_J;
@@ -664,7 +664,7 @@ int FEUncoupledReactiveViscoelasticMaterial::RVEGenerations(FEMaterialPoint& mp)
     FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
     
     // get the reactive viscoelastic point data
-    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    FEReactiveVEMaterialPoint& pt = *wb.GetData<FEReactiveVEMaterialPoint>();
     
     // return the bond mass fraction of the reforming generation
     return (int)pt.m_v.size();
@@ -96,10 +96,10 @@ mat3ds FEUncoupledViscoElasticMaterial::DevStress(FEMaterialPoint& mp)
 	if (dt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
     
 	// get the elastic part
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// get the viscoelastic point data
-	FEViscoElasticMaterialPoint& pt = *mp.ExtractData<FEViscoElasticMaterialPoint>();
+	FEViscoElasticMaterialPoint& pt = *mp.GetData<FEViscoElasticMaterialPoint>();
 	
 	// Calculate the new elastic Cauchy stress
 	mat3ds se = m_pBase->DevStress(mp);
@@ -158,7 +158,7 @@ double FEUncoupledViscoElasticMaterial::DevStrainEnergyDensity(FEMaterialPoint&
 /*    if (mp.dt == 0) return 0;
     
 	// get the viscoelastic point data
-	FEViscoElasticMaterialPoint& pt = *mp.ExtractData<FEViscoElasticMaterialPoint>();
+	FEViscoElasticMaterialPoint& pt = *mp.GetData<FEViscoElasticMaterialPoint>();
 	
 	// Calculate the new elastic strain energy density
 	pt.m_sed = m_pBase->DevStrainEnergyDensity(mp);
@@ -40,7 +40,7 @@ END_FECORE_CLASS();
 //! Calculate deviatoric stress
 mat3ds FEVerondaWestmann::DevStress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient and its determinant
 	mat3d &F = pt.m_F;
@@ -80,7 +80,7 @@ mat3ds FEVerondaWestmann::DevStress(FEMaterialPoint& mp)
 //! Calculate deviatoric tangent
 tens4ds FEVerondaWestmann::DevTangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -141,7 +141,7 @@ tens4ds FEVerondaWestmann::DevTangent(FEMaterialPoint& mp)
 double FEVerondaWestmann::DevStrainEnergyDensity(FEMaterialPoint& mp)
 {
 	// get the elastic material point data
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
 	// calculate left Cauchy-Green tensor
 	mat3ds B = pt.DevLeftCauchyGreen();
@@ -69,7 +69,7 @@ FEMaterialPoint* FEViscoElasticMaterialPoint::Copy()
 //! Initializes material point data.
 void FEViscoElasticMaterialPoint::Init()
 {
-	FEElasticMaterialPoint& pt = *m_pNext->ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *m_pNext->GetData<FEElasticMaterialPoint>();
 
 	// intialize data to zero
 	m_Se.zero();
@@ -91,7 +91,7 @@ void FEViscoElasticMaterialPoint::Init()
 //! Update material point data.
 void FEViscoElasticMaterialPoint::Update(const FETimeInfo& timeInfo)
 {
-	FEElasticMaterialPoint& pt = *m_pNext->ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *m_pNext->GetData<FEElasticMaterialPoint>();
 
 	// the elastic stress stored in pt is the Cauchy stress.
 	// however, we need to store the 2nd PK stress
@@ -161,10 +161,10 @@ mat3ds FEViscoElasticMaterial::Stress(FEMaterialPoint& mp)
 	if (dt == 0) return mat3ds(0, 0, 0, 0, 0, 0);
     
 	// get the elastic part
-	FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ep = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the viscoelastic point data
-	FEViscoElasticMaterialPoint& pt = *mp.ExtractData<FEViscoElasticMaterialPoint>();
+	FEViscoElasticMaterialPoint& pt = *mp.GetData<FEViscoElasticMaterialPoint>();
 
 	// Calculate the new elastic Cauchy stress
 	mat3ds se = m_Base->Stress(mp);
@@ -223,7 +223,7 @@ double FEViscoElasticMaterial::StrainEnergyDensity(FEMaterialPoint& mp)
 /*    if (mp.dt == 0) return 0;
     
 	// get the viscoelastic point data
-	FEViscoElasticMaterialPoint& pt = *mp.ExtractData<FEViscoElasticMaterialPoint>();
+	FEViscoElasticMaterialPoint& pt = *mp.GetData<FEViscoElasticMaterialPoint>();
     
 	// Calculate the new elastic strain energy density
 	pt.m_sed = m_pBase->StrainEnergyDensity(mp);
@@ -51,7 +51,7 @@ void FEViscousMaterialPoint::Init()
 
 void FEViscousMaterialPoint::Update(const FETimeInfo& timeInfo)
 {
-	FEElasticMaterialPoint& pt = *this->ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *this->GetData<FEElasticMaterialPoint>();
     m_Fp = pt.m_F;
 
 	m_dt = timeInfo.timeIncrement;
@@ -68,7 +68,7 @@ void FEViscousMaterialPoint::Serialize(DumpStream& ar)
 
 mat3d FEViscousMaterialPoint::VelocityGradient()
 {
-    FEElasticMaterialPoint& pt = *this->ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *this->GetData<FEElasticMaterialPoint>();
     mat3d Fi = pt.m_F.inverse();
     mat3d L = (mat3dd(1) - m_Fp*Fi)/m_dt;
     return L;
@@ -68,8 +68,8 @@ FEMaterialPoint* FEVonMisesPlasticity::CreateMaterialPointData()
 //-----------------------------------------------------------------------------
 mat3ds FEVonMisesPlasticity::Stress(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEJ2PlasticMaterialPoint& pp = *mp.ExtractData<FEJ2PlasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEJ2PlasticMaterialPoint& pp = *mp.GetData<FEJ2PlasticMaterialPoint>();
 	mat3d& F = pt.m_F;
 	
 	// get the current strain
@@ -117,8 +117,8 @@ mat3ds FEVonMisesPlasticity::Stress(FEMaterialPoint &mp)
 //-----------------------------------------------------------------------------
 tens4ds FEVonMisesPlasticity::Tangent(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEJ2PlasticMaterialPoint& pp = *mp.ExtractData<FEJ2PlasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEJ2PlasticMaterialPoint& pp = *mp.GetData<FEJ2PlasticMaterialPoint>();
 
 	// lame parameters
 	double lam = m_K - m_G*2.0/3.0;
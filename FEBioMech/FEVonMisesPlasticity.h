@@ -58,7 +58,7 @@ public:
 
 	void Update(const FETimeInfo& timeInfo)
 	{
-		FEElasticMaterialPoint& pt = *m_pNext->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *m_pNext->GetData<FEElasticMaterialPoint>();
 		e0 = e1;
 		sn = pt.m_s;
 		Y0 = Y1;
@@ -55,7 +55,7 @@ FEWrinkleOgdenMaterial::FEWrinkleOgdenMaterial(FEModel* pfem) : FEMembraneMateri
 //-----------------------------------------------------------------------------
 void FEWrinkleOgdenMaterial::principals(FEMaterialPoint& mp, double l[2], double v[4])
 {
-	FEMembraneMaterialPoint& pt = *mp.ExtractData<FEMembraneMaterialPoint>();
+	FEMembraneMaterialPoint& pt = *mp.GetData<FEMembraneMaterialPoint>();
 
 	// get the def gradient
 	double* g = pt.g;
@@ -47,7 +47,7 @@ FEActiveConstantSupply::FEActiveConstantSupply(FEModel* pfem) : FEActiveMomentum
 //! The momentum supply is oriented along the first material axis
 vec3d FEActiveConstantSupply::ActiveSupply(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -49,7 +49,7 @@ double FELogElemFluidPressure::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEBiphasicMaterialPoint>();
+		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEBiphasicMaterialPoint>();
 		if (ppt) val += ppt->m_pa;
 	}
 	return val / (double) nint;
@@ -62,7 +62,7 @@ double FELogElemFluidFluxX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEBiphasicMaterialPoint>();
+		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEBiphasicMaterialPoint>();
 		if (ppt) val += ppt->m_w.x;
 	}
 	return val / (double) nint;
@@ -75,7 +75,7 @@ double FELogElemFluidFluxY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEBiphasicMaterialPoint>();
+		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEBiphasicMaterialPoint>();
 		if (ppt) val += ppt->m_w.y;
 	}
 	return val / (double) nint;
@@ -88,7 +88,7 @@ double FELogElemFluidFluxZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FEBiphasicMaterialPoint>();
+		FEBiphasicMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FEBiphasicMaterialPoint>();
 		if (ppt) val += ppt->m_w.z;
 	}
 	return val / (double) nint;
@@ -101,7 +101,7 @@ double FELogElemSoluteConcentration::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_ca[0];
 	}
 	return val / (double) nint;
@@ -114,7 +114,7 @@ double FELogElemSoluteFluxX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_j[0].x;
 	}
 	return val / (double) nint;
@@ -127,7 +127,7 @@ double FELogElemSoluteFluxY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_j[0].y;
 	}
 	return val / (double) nint;
@@ -140,7 +140,7 @@ double FELogElemSoluteFluxZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_j[0].z;
 	}
 	return val / (double) nint;
@@ -153,7 +153,7 @@ double FELogElemSoluteRefConcentration::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_sbmr[0];
 	}
 	return val / (double) nint;
@@ -166,7 +166,7 @@ double FELogFixedChargeDensity::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i = 0; i < nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_cF;
 	}
 	return val / (double)nint;
@@ -179,7 +179,7 @@ double FELogElemSoluteConcentration_::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_ca[m_nsol];
 	}
 	return val / (double) nint;
@@ -192,7 +192,7 @@ double FELogElemSoluteFluxX_::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_j[m_nsol].x;
 	}
 	return val / (double) nint;
@@ -205,7 +205,7 @@ double FELogElemSoluteFluxY_::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_j[m_nsol].y;
 	}
 	return val / (double) nint;
@@ -218,7 +218,7 @@ double FELogElemSoluteFluxZ_::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_j[m_nsol].z;
 	}
 	return val / (double) nint;
@@ -231,7 +231,7 @@ double FELogElemElectricPotential::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_psi;
 	}
 	return val / (double) nint;
@@ -244,7 +244,7 @@ double FELogElemCurrentDensityX::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_Ie.x;
 	}
 	return val / (double) nint;
@@ -257,7 +257,7 @@ double FELogElemCurrentDensityY::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_Ie.y;
 	}
 	return val / (double) nint;
@@ -270,7 +270,7 @@ double FELogElemCurrentDensityZ::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_Ie.z;
 	}
 	return val / (double) nint;
@@ -283,7 +283,7 @@ double FELogElemSBMConcentration_::value(FEElement& el)
 	int nint = el.GaussPoints();
 	for (int i=0; i<nint; ++i)
 	{
-		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint* ppt = el.GetMaterialPoint(i)->GetData<FESolutesMaterialPoint>();
 		if (ppt) val += ppt->m_sbmr[m_nsol];
 	}
 	return val / (double) nint;
@@ -297,8 +297,8 @@ double FELogElemPorosity::value(FEElement& el)
 	for (int i = 0; i < nint; ++i)
 	{
 		const FEMaterialPoint* mp = el.GetMaterialPoint(i);
-		const FEElasticMaterialPoint* et = (mp->ExtractData<FEElasticMaterialPoint>());
-		const FEBiphasicMaterialPoint* pt = (mp->ExtractData<FEBiphasicMaterialPoint>());
+		const FEElasticMaterialPoint* et = (mp->GetData<FEElasticMaterialPoint>());
+		const FEBiphasicMaterialPoint* pt = (mp->GetData<FEBiphasicMaterialPoint>());
 
 		double p = (et && pt ? (1 - pt->m_phi0 / et->m_J) : 0.0);
 		val += p;
@@ -128,7 +128,7 @@ bool FEPlotMixtureFluidFlowRate::Save(FESurface &surf, FEDataStream &a)
             for (int n = 0; n<nint; ++n)
             {
                 FEMaterialPoint& mp = *pe->GetMaterialPoint(n);
-                FEBiphasicMaterialPoint* ptf = mp.ExtractData<FEBiphasicMaterialPoint>();
+                FEBiphasicMaterialPoint* ptf = mp.GetData<FEBiphasicMaterialPoint>();
                 if (ptf) w += ptf->m_w;
             }
             w /= nint;
@@ -152,7 +152,7 @@ bool FEPlotPressureGap::Save(FESurface& surf, FEDataStream& a)
 	if (pcs == 0) return false;
     
 	writeNodalProjectedElementValues<double>(surf, a, [](const FEMaterialPoint& mp) {
-		const FEBiphasicContactPoint* pt = mp.ExtractData<FEBiphasicContactPoint>();
+		const FEBiphasicContactPoint* pt = mp.GetData<FEBiphasicContactPoint>();
 		return (pt ? pt->m_pg : 0);
 	});
 
@@ -277,7 +277,7 @@ bool FEPlotActualFluidPressure::Save(FEDomain &dom, FEDataStream& a)
 		(dynamic_cast<FEMultiphasicSolidDomain*   >(&bd)))
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEBiphasicMaterialPoint* pt = mp.ExtractData<FEBiphasicMaterialPoint>();
+			const FEBiphasicMaterialPoint* pt = mp.GetData<FEBiphasicMaterialPoint>();
 			return (pt ? pt->m_pa : 0.0);
 		});
 		return true;
@@ -296,9 +296,9 @@ bool FEPlotActualFluidPressure::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<el.GaussPoints(); ++j)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<pem->Materials(); ++k) {
-                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->ExtractData<FEDonnanEquilibriumMaterialPoint>();
+                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->GetData<FEDonnanEquilibriumMaterialPoint>();
                     if (pd) ew += pd->m_p;
                 }
             }
@@ -325,7 +325,7 @@ bool FEPlotSolidStress::Save(FEDomain &dom, FEDataStream& a)
                (dynamic_cast<FEMultiphasicSolidDomain*>(bd))))
     {
         writeAverageElementValue<mat3ds>(dom, a, [](const FEMaterialPoint& mp) {
-            const FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
+            const FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
             return (pt ? pt->m_ss : mat3ds(0.0));
         });
         return true;
@@ -337,7 +337,7 @@ bool FEPlotSolidStress::Save(FEDomain &dom, FEDataStream& a)
                      ))
     {
         writeAverageElementValue<mat3ds>(dom, a, [](const FEMaterialPoint& mp) {
-            const FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
+            const FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
             return (pt ? pt->m_ss : mat3ds(0.0));
         });
         return true;
@@ -358,7 +358,7 @@ bool FEPlotFluidFlux::Save(FEDomain &dom, FEDataStream& a)
 		(dynamic_cast<FEMultiphasicSolidDomain*>(bd))))
 	{
 		writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
+			const FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
 			return (pt ? pt->m_w : vec3d(0.0));
 		});
 		return true;
@@ -370,7 +370,7 @@ bool FEPlotFluidFlux::Save(FEDomain &dom, FEDataStream& a)
                      ))
     {
 		writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
+			const FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
 			return (pt ? pt->m_w : vec3d(0.0));
 		});
 		return true;
@@ -389,7 +389,7 @@ bool FEPlotNodalFluidFlux::Save(FEDomain &dom, FEDataStream& a)
 		(dynamic_cast<FEMultiphasicSolidDomain*>(&bd)))
 	{
 		writeNodalProjectedElementValues<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEBiphasicMaterialPoint* pt = mp.ExtractData<FEBiphasicMaterialPoint>();
+			const FEBiphasicMaterialPoint* pt = mp.GetData<FEBiphasicMaterialPoint>();
 			return pt->m_w;
 		});
 		return true;
@@ -540,10 +540,10 @@ bool FEPlotActualSoluteConcentration::Save(FEDomain &dom, FEDataStream& a)
 				for (int j = 0; j<el.GaussPoints(); ++j)
 				{
 					FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-					FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
-                    FEFluidSolutesMaterialPoint* spt = (mp.ExtractData<FEFluidSolutesMaterialPoint>());
-                    FESolutesMaterial::Point* spt2 = (mp.ExtractData<FESolutesMaterial::Point>());
-                    FEMultiphasicFSIMaterialPoint* mfpt = (mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+					FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
+                    FEFluidSolutesMaterialPoint* spt = (mp.GetData<FEFluidSolutesMaterialPoint>());
+                    FESolutesMaterial::Point* spt2 = (mp.GetData<FESolutesMaterial::Point>());
+                    FEMultiphasicFSIMaterialPoint* mfpt = (mp.GetData<FEMultiphasicFSIMaterialPoint>());
 
 					if (pt) ew += pt->m_ca[nsid];
                     else if (spt) ew += spt->m_ca[nsid];
@@ -617,10 +617,10 @@ bool FEPlotPartitionCoefficient::Save(FEDomain &dom, FEDataStream& a)
                 for (int j = 0; j<el.GaussPoints(); ++j)
                 {
                     FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                    FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
-                    FEFluidSolutesMaterialPoint* spt = (mp.ExtractData<FEFluidSolutesMaterialPoint>());
-                    FESolutesMaterial::Point* spt2 = (mp.ExtractData<FESolutesMaterial::Point>());
-                    FEMultiphasicFSIMaterialPoint* mfpt = (mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+                    FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
+                    FEFluidSolutesMaterialPoint* spt = (mp.GetData<FEFluidSolutesMaterialPoint>());
+                    FESolutesMaterial::Point* spt2 = (mp.GetData<FESolutesMaterial::Point>());
+                    FEMultiphasicFSIMaterialPoint* mfpt = (mp.GetData<FEMultiphasicFSIMaterialPoint>());
                     
                     if (pt) ew += pt->m_k[nsid];
                     else if (spt) ew += spt->m_k[nsid];
@@ -691,10 +691,10 @@ bool FEPlotSoluteFlux::Save(FEDomain &dom, FEDataStream& a)
 				for (int j = 0; j<el.GaussPoints(); ++j)
 				{
 					FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-					FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
-                    FEFluidSolutesMaterialPoint* spt = (mp.ExtractData<FEFluidSolutesMaterialPoint>());
-                    FESolutesMaterial::Point* spt2 = (mp.ExtractData<FESolutesMaterial::Point>());
-                    FEMultiphasicFSIMaterialPoint* mfpt = (mp.ExtractData<FEMultiphasicFSIMaterialPoint>());
+					FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
+                    FEFluidSolutesMaterialPoint* spt = (mp.GetData<FEFluidSolutesMaterialPoint>());
+                    FESolutesMaterial::Point* spt2 = (mp.GetData<FESolutesMaterial::Point>());
+                    FEMultiphasicFSIMaterialPoint* mfpt = (mp.GetData<FEMultiphasicFSIMaterialPoint>());
 
 					if (pt) ew += pt->m_j[nsid];
                     else if (spt) ew += spt->m_j[nsid];
@@ -724,9 +724,9 @@ bool FEPlotOsmolarity::Save(FEDomain &dom, FEDataStream& a)
         dynamic_cast<FEMultiphasicSolidDomain*>(&dom) || fsdom || mfsdom)) {
 
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FESolutesMaterialPoint* pt = mp.ExtractData<FESolutesMaterialPoint>();
-            const FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-            const FEMultiphasicFSIMaterialPoint* mfspt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+			const FESolutesMaterialPoint* pt = mp.GetData<FESolutesMaterialPoint>();
+            const FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+            const FEMultiphasicFSIMaterialPoint* mfspt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
 			double ew = 0.0;
 			for (int isol = 0; isol<(int)pt->m_ca.size(); ++isol)
             {
@@ -755,9 +755,9 @@ bool FEPlotOsmolarity::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<el.GaussPoints(); ++j)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<pem->Materials(); ++k) {
-                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->ExtractData<FEDonnanEquilibriumMaterialPoint>();
+                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->GetData<FEDonnanEquilibriumMaterialPoint>();
                     if (pd) ew += pd->m_osm;
                 }
             }
@@ -773,7 +773,7 @@ bool FEPlotOsmolarity::Save(FEDomain &dom, FEDataStream& a)
              dynamic_cast<FEMultiphasicShellDomain*>(&dom))) {
 
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FESolutesMaterialPoint* pt = mp.ExtractData<FESolutesMaterialPoint>();
+			const FESolutesMaterialPoint* pt = mp.GetData<FESolutesMaterialPoint>();
 			double ew = 0.0;
 			for (int isol = 0; isol<(int)pt->m_ca.size(); ++isol) ew += pt->m_ca[isol];
 			return ew;
@@ -840,7 +840,7 @@ bool FEPlotSBMConcentration::Save(FEDomain &dom, FEDataStream& a)
 				for (int j = 0; j<el.GaussPoints(); ++j)
 				{
 					FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-					FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
+					FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
 
 					if (pt) ew += pm->SBMConcentration(mp, nk);
 				}
@@ -864,9 +864,9 @@ bool FEPlotElectricPotential::Save(FEDomain &dom, FEDataStream& a)
 	if (ptd || pmd || psd || fsdom || mfsdom)
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
-            const FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-            const FEMultiphasicFSIMaterialPoint* mfspt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+			const FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
+            const FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+            const FEMultiphasicFSIMaterialPoint* mfspt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
             if (pt)
                 return pt->m_psi;
             else if (fspt)
@@ -892,9 +892,9 @@ bool FEPlotCurrentDensity::Save(FEDomain &dom, FEDataStream& a)
 	if (ptd || pmd || psd || fsdom || mfsdom)
 	{
 		writeAverageElementValue<vec3d>(dom, a, [](const FEMaterialPoint& mp) {
-			const FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
-            const FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-            const FEMultiphasicFSIMaterialPoint* mfspt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+			const FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
+            const FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+            const FEMultiphasicFSIMaterialPoint* mfspt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
             if (pt)
                 return pt->m_Ie;
             else if (fspt)
@@ -920,8 +920,8 @@ bool FEPlotReferentialSolidVolumeFraction::Save(FEDomain &dom, FEDataStream& a)
 	if (bmd || bsd || pmd || psd || bfsdom)
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
-            const FEBiphasicFSIMaterialPoint* bpt = (mp.ExtractData<FEBiphasicFSIMaterialPoint>());
+			const FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
+            const FEBiphasicFSIMaterialPoint* bpt = (mp.GetData<FEBiphasicFSIMaterialPoint>());
             double phif0 = 0;
             if (pt)
                 phif0 = pt->m_phi0;
@@ -944,8 +944,8 @@ bool FEPlotPorosity::Save(FEDomain &dom, FEDataStream& a)
     if (bmd || bsd || pmd || psd)
     {
         writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-            const FEElasticMaterialPoint* et = (mp.ExtractData<FEElasticMaterialPoint>());
-            const FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
+            const FEElasticMaterialPoint* et = (mp.GetData<FEElasticMaterialPoint>());
+            const FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
             return (pt ? (1 - pt->m_phi0/et->m_J) : 0.0);
         });
         return true;
@@ -976,8 +976,8 @@ bool FEPlotFixedChargeDensity::Save(FEDomain &dom, FEDataStream& a)
 	if (ptd || pmd || psd || mfsdom)
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
-            const FEMultiphasicFSIMaterialPoint* mfspt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+			const FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
+            const FEMultiphasicFSIMaterialPoint* mfspt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
             double cf = 0;
             if (pt)
                 cf = pt->m_cF;
@@ -1001,9 +1001,9 @@ bool FEPlotFixedChargeDensity::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<el.GaussPoints(); ++j)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<pem->Materials(); ++k) {
-                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->ExtractData<FEDonnanEquilibriumMaterialPoint>();
+                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->GetData<FEDonnanEquilibriumMaterialPoint>();
                     if (pd) ew += pd->m_cF;
                 }
             }
@@ -1028,11 +1028,11 @@ bool FEPlotReferentialFixedChargeDensity::Save(FEDomain &dom, FEDataStream& a)
 	if (ptd || pmd || psd || mfsdom)
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEElasticMaterialPoint*  ept = (mp.ExtractData<FEElasticMaterialPoint >());
-			const FEBiphasicMaterialPoint* bpt = (mp.ExtractData<FEBiphasicMaterialPoint>());
-			const FESolutesMaterialPoint*  spt = (mp.ExtractData<FESolutesMaterialPoint >());
-            const FEMultiphasicFSIMaterialPoint* mfspt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
-            const FEBiphasicFSIMaterialPoint* bfspt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+			const FEElasticMaterialPoint*  ept = (mp.GetData<FEElasticMaterialPoint >());
+			const FEBiphasicMaterialPoint* bpt = (mp.GetData<FEBiphasicMaterialPoint>());
+			const FESolutesMaterialPoint*  spt = (mp.GetData<FESolutesMaterialPoint >());
+            const FEMultiphasicFSIMaterialPoint* mfspt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
+            const FEBiphasicFSIMaterialPoint* bfspt = mp.GetData<FEBiphasicFSIMaterialPoint>();
             double cf = 0;
             if (spt)
                 cf = (ept->m_J - bpt->m_phi0)*spt->m_cF / (1 - bpt->m_phi0);
@@ -1056,9 +1056,9 @@ bool FEPlotReferentialFixedChargeDensity::Save(FEDomain &dom, FEDataStream& a)
             for (int j=0; j<el.GaussPoints(); ++j)
             {
                 FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-                FEElasticMixtureMaterialPoint& pt = *mp.ExtractData<FEElasticMixtureMaterialPoint>();
+                FEElasticMixtureMaterialPoint& pt = *mp.GetData<FEElasticMixtureMaterialPoint>();
                 for (int k=0; k<pem->Materials(); ++k) {
-                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->ExtractData<FEDonnanEquilibriumMaterialPoint>();
+                    FEDonnanEquilibriumMaterialPoint* pd = pt.GetPointData(k)->GetData<FEDonnanEquilibriumMaterialPoint>();
                     if (pd) ew += pd->m_cFr;
                 }
             }
@@ -1279,7 +1279,7 @@ bool FEPlotReceptorLigandConcentration::Save(FEDomain &dom, FEDataStream& a)
 	if (pbd || psd)
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
+			const FESolutesMaterialPoint* pt = (mp.GetData<FESolutesMaterialPoint>());
 			return (pt ? pt->m_sbmr[0] : 0.0);
 		});
 		return true;
@@ -1340,7 +1340,7 @@ bool FEPlotSBMRefAppDensity::Save(FEDomain &dom, FEDataStream& a)
 				for (int j = 0; j<el.GaussPoints(); ++j)
 				{
 					FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-					FESolutesMaterialPoint* st = (mp.ExtractData<FESolutesMaterialPoint>());
+					FESolutesMaterialPoint* st = (mp.GetData<FESolutesMaterialPoint>());
 
 					if (st) ew += st->m_sbmr[nsid];
 				}
@@ -1383,7 +1383,7 @@ bool FEPlotEffectiveElasticity::Save(FEDomain &dom, FEDataStream& a)
             tens4ds s(0.0);
             for (int j=0; j<nint; ++j)
             {
-                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->ExtractData<FEMaterialPoint>());
+                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->GetData<FEMaterialPoint>());
                 if (pb) c = pb->Tangent(pt);
                 else if (pbs) c = pbs->Tangent(pt);
                 else if (ptp) c = ptp->Tangent(pt);
@@ -1411,7 +1411,7 @@ bool FEPlotEffectiveElasticity::Save(FEDomain &dom, FEDataStream& a)
             tens4ds s(0.0);
             for (int j=0; j<nint; ++j)
             {
-                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->ExtractData<FEMaterialPoint>());
+                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->GetData<FEMaterialPoint>());
                 if (pb) c = pb->Tangent(pt);
                 else if (pbs) c = pbs->Tangent(pt);
                 else if (ptp) c = ptp->Tangent(pt);
@@ -1458,7 +1458,7 @@ bool FEPlotOsmoticCoefficient::Save(FEDomain &dom, FEDataStream& a)
             double s = 0;
             for (int j=0; j<nint; ++j)
             {
-                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->ExtractData<FEMaterialPoint>());
+                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->GetData<FEMaterialPoint>());
                 if (pmp)
                     c = pmp->GetOsmoticCoefficient()->OsmoticCoefficient(pt);
                 else if (mfs)
@@ -1488,7 +1488,7 @@ bool FEPlotOsmoticCoefficient::Save(FEDomain &dom, FEDataStream& a)
             double s = 0;
             for (int j=0; j<nint; ++j)
             {
-                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->ExtractData<FEMaterialPoint>());
+                FEMaterialPoint& pt = (*el.GetMaterialPoint(j)->GetData<FEMaterialPoint>());
                 c = pmp->GetOsmoticCoefficient()->OsmoticCoefficient(pt);
                 
                 s += c;
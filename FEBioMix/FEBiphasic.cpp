@@ -126,8 +126,8 @@ FEMaterialPoint* FEBiphasic::CreateMaterialPointData()
 //! Porosity in current configuration
 double FEBiphasic::Porosity(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pet = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pet = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	// relative volume
 	double J = et.m_J;
@@ -150,7 +150,7 @@ double FEBiphasic::Porosity(FEMaterialPoint& pt)
 
 mat3ds FEBiphasic::Stress(FEMaterialPoint& mp)
 {
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// calculate solid material stress
 	mat3ds s = m_pSolid->Stress(mp);
@@ -170,7 +170,7 @@ mat3ds FEBiphasic::Stress(FEMaterialPoint& mp)
 
 tens4ds FEBiphasic::Tangent(FEMaterialPoint& mp)
 {
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// call solid tangent routine
 	tens4ds c = m_pSolid->Tangent(mp);
@@ -202,7 +202,7 @@ tens4ds FEBiphasic::Tangent(FEMaterialPoint& mp)
 
 double FEBiphasic::Pressure(FEMaterialPoint& pt)
 {
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	return ppt.m_p;
 }
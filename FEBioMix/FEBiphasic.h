@@ -39,6 +39,8 @@ SOFTWARE.*/
 //
 class FEBIOMIX_API FEBiphasicMaterialPoint : public FEMaterialPoint
 {
+	FEMATERIALPOINT_FLAT_ARENA_ALLOCATION(FEBiphasicMaterialPoint)
+
 public:
 	//! constructor
 	FEBiphasicMaterialPoint(FEMaterialPoint* ppt);
@@ -125,7 +125,7 @@ void FEBiphasicContactSurface::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofX];
@@ -148,8 +148,8 @@ void FEBiphasicContactSurface::GetGPLocalFLS(int nface, double* pt)
         double p = 0;
         for (int i=0; i<se->GaussPoints(); ++i) {
             FEMaterialPoint* pt = se->GetMaterialPoint(i);
-            FEElasticMaterialPoint* ep = pt->ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint* bp = pt->ExtractData<FEBiphasicMaterialPoint>();
+            FEElasticMaterialPoint* ep = pt->GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint* bp = pt->GetData<FEBiphasicMaterialPoint>();
             if (ep) s += ep->m_s;
             if (bp) p += bp->m_pa;
         }
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FECore/FESolidDomain.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEBiphasicShellDomain::FEBiphasicShellDomain(FEModel* pfem) : FESSIShellDomain(pfem), FEBiphasicDomain(pfem), m_dof(pfem)
@@ -95,8 +96,8 @@ void FEBiphasicShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             p = evaluate(el, pn, qn, j);
             
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pb = *mp.ExtractData<FEBiphasicMaterialPoint>();
+            FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pb = *mp.GetData<FEBiphasicMaterialPoint>();
             pt.m_r0 = r0;
             pt.m_rt = rt;
             
@@ -154,7 +155,7 @@ void FEBiphasicShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[8*i  ] = id[m_dofU[0]];
@@ -189,7 +190,7 @@ void FEBiphasicShellDomain::Reset()
     
     // initialize all element data
 	ForEachMaterialPoint([=](FEMaterialPoint& mp) {
-		FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+		FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
 
 		// initialize referential solid volume fraction
 		pt.m_phi0 = pmb->m_phi0(mp);
@@ -204,8 +205,9 @@ void FEBiphasicShellDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -255,8 +257,8 @@ void FEBiphasicShellDomain::ElementInternalForce(FEShellElement& el, vector<doub
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate the jacobian
         detJt = detJ(el, n);
@@ -322,8 +324,9 @@ void FEBiphasicShellDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -374,8 +377,8 @@ void FEBiphasicShellDomain::ElementInternalForceSS(FEShellElement& el, vector<do
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate the jacobian
         detJt = detJ(el, n);
@@ -438,7 +441,8 @@ void FEBiphasicShellDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = neln*8;
         ke.resize(ndof, ndof);
@@ -446,7 +450,7 @@ void FEBiphasicShellDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
         // calculate the element stiffness matrix
         ElementBiphasicStiffness(el, ke, bsymm);
         
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -467,7 +471,8 @@ void FEBiphasicShellDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = neln*8;
         ke.resize(ndof, ndof);
@@ -475,7 +480,7 @@ void FEBiphasicShellDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
         // calculate the element stiffness matrix
         ElementBiphasicStiffnessSS(el, ke, bsymm);
         
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -518,8 +523,8 @@ bool FEBiphasicShellDomain::ElementBiphasicStiffness(FEShellElement& el, matrix&
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate the jacobian
         detJt = detJ(el, n);
@@ -701,8 +706,8 @@ bool FEBiphasicShellDomain::ElementBiphasicStiffnessSS(FEShellElement& el, matri
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate the jacobian
         detJt = detJ(el, n);
@@ -914,7 +919,7 @@ void FEBiphasicShellDomain::UpdateElementStress(int iel)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
@@ -930,7 +935,7 @@ void FEBiphasicShellDomain::UpdateElementStress(int iel)
         pt.m_L = (pt.m_F - Fp)*Fi / dt;
 
         // biphasic data
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // evaluate fluid pressure at gauss-point
         ppt.m_p = evaluate(el, pn, qn, n);
@@ -961,8 +966,9 @@ void FEBiphasicShellDomain::BodyForce(FEGlobalVector& R, FEBodyForce& BF)
 #pragma omp parallel for
     for (int i=0; i<NE; ++i)
     {
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -1012,7 +1018,7 @@ void FEBiphasicShellDomain::ElementBodyForce(FEBodyForce& BF, FEShellElement& el
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+        FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
         pt.m_r0 = el.Evaluate(r0, n);
         pt.m_rt = el.Evaluate(rt, n);
         
@@ -1061,7 +1067,8 @@ void FEBiphasicShellDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce&
         FEShellElement& el = m_Elem[iel];
         
         // create the element's stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int neln = el.Nodes();
         int ndof = 8*neln;
         ke.resize(ndof, ndof);
@@ -1197,7 +1204,7 @@ void FEBiphasicShellDomain::ElementBodyForceStiffness(FEBodyForce& BF, FEShellEl
 //-----------------------------------------------------------------------------
 vec3d FEBiphasicShellDomain::FluidFlux(FEMaterialPoint& mp)
 {
-    FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+    FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
     
     // pressure gradient
     vec3d gradp = ppt.m_gradp;
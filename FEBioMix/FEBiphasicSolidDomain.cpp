@@ -35,6 +35,7 @@ SOFTWARE.*/
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
 #include "FEBioMix.h"
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEBiphasicSolidDomain::FEBiphasicSolidDomain(FEModel* pfem) : FESolidDomain(pfem), FEBiphasicDomain(pfem), m_dofU(pfem), m_dofSU(pfem), m_dofR(pfem), m_dof(pfem)
@@ -98,8 +99,8 @@ void FEBiphasicSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             p = el.Evaluate(pn, j);
             
 			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pb = *mp.ExtractData<FEBiphasicMaterialPoint>();
+			FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pb = *mp.GetData<FEBiphasicMaterialPoint>();
 			pt.m_r0 = r0;
 			pt.m_rt = rt;
 
@@ -194,7 +195,7 @@ void FEBiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
         // first the displacement dofs
         lm[4*i  ] = id[m_dofU[0]];
@@ -211,7 +212,7 @@ void FEBiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the back-face displacement dofs
             lm[4*i  ] = id[m_dofSU[0]];
@@ -232,7 +233,7 @@ void FEBiphasicSolidDomain::Reset()
 
 	// initialize all element data
 	ForEachMaterialPoint([=](FEMaterialPoint& mp) {
-		FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+		FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
 
 		// initialize referential solid volume fraction
 		pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -251,8 +252,9 @@ void FEBiphasicSolidDomain::InternalForces(FEGlobalVector& R)
 	for (int i=0; i<NE; ++i)
 	{
 		// element force vector
-		vector<double> fe;
-		vector<int> lm;
+		FEElementWorkspace& ws = ElementWorkspace();
+		vector<double>& fe = ws.ForceVector();
+		vector<int>& lm = ws.LM();
 		
 		// get the element
 		FESolidElement& el = m_Elem[i];
@@ -299,8 +301,8 @@ void FEBiphasicSolidDomain::ElementInternalForce(FESolidElement& el, vector<doub
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
 		// calculate the jacobian
 		double Jw = invjact(el, Ji, n)*gw[n];
@@ -377,8 +379,9 @@ void FEBiphasicSolidDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -424,8 +427,8 @@ void FEBiphasicSolidDomain::ElementInternalForceSS(FESolidElement& el, vector<do
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -490,15 +493,12 @@ void FEBiphasicSolidDomain::ElementInternalForceSS(FESolidElement& el, vector<do
 void FEBiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 {
 	// repeat over all solid elements
-	int NE = (int)m_Elem.size();
-    
-    #pragma omp parallel for shared(NE)
-	for (int iel=0; iel<NE; ++iel)
-	{
+	AssembleElements(LS, [&](int iel) {
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = el.Nodes()*4;
 		ke.resize(ndof, ndof);
 		
@@ -510,28 +510,25 @@ void FEBiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 		// have to create a new lm array and place the equation numbers in the right order.
 		// What we really ought to do is fix the UnpackLM function so that it returns
 		// the LM vector in the right order for poroelastic elements.
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
         // assemble element matrix in global stiffness matrix
 		LS.Assemble(ke);
-	}
+	});
 }
 
 //-----------------------------------------------------------------------------
 void FEBiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 {
 	// repeat over all solid elements
-	int NE = (int)m_Elem.size();
-
-	#pragma omp parallel for shared(NE)
-	for (int iel=0; iel<NE; ++iel)
-	{
+	AssembleElements(LS, [&](int iel) {
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int ndof = el.Nodes()*4;
 		ke.resize(ndof, ndof);
 		
@@ -543,13 +540,13 @@ void FEBiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 		// have to create a new lm array and place the equation numbers in the right order.
 		// What we really ought to do is fix the UnpackLM function so that it returns
 		// the LM vector in the right order for poroelastic elements.
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
 		// assemble element matrix in global stiffness matrix
 		LS.Assemble(ke);
-	}
+	});
 }
 
 //-----------------------------------------------------------------------------
@@ -584,8 +581,8 @@ bool FEBiphasicSolidDomain::ElementBiphasicStiffness(FESolidElement& el, matrix&
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate jacobian
         double detJ = invjact(el, Ji, n);
@@ -740,8 +737,8 @@ bool FEBiphasicSolidDomain::ElementBiphasicStiffnessSS(FESolidElement& el, matri
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+        FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
         
         // calculate jacobian
         double detJ = invjact(el, Ji, n);
@@ -945,7 +942,7 @@ void FEBiphasicSolidDomain::UpdateElementStress(int iel)
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 			
 		// material point coordinates
 		// TODO: I'm not entirly happy with this solution
@@ -961,7 +958,7 @@ void FEBiphasicSolidDomain::UpdateElementStress(int iel)
         pt.m_L = (pt.m_F - Fp)*Fi / dt;
 
 		// poroelasticity data
-		FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+		FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
 			
 		// evaluate fluid pressure at gauss-point
 		ppt.m_p = el.Evaluate(degree_p, pn, n);
@@ -1026,7 +1023,8 @@ void FEBiphasicSolidDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce&
         FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = 4*neln;
         ke.resize(ndof, ndof);
@@ -1040,7 +1038,7 @@ void FEBiphasicSolidDomain::BodyForceStiffness(FELinearSystem& LS, FEBodyForce&
         // have to create a new lm array and place the equation numbers in the right order.
         // What we really ought to do is fix the UnpackLM function so that it returns
         // the LM vector in the right order for poroelastic elements.
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -1135,7 +1133,7 @@ void FEBiphasicSolidDomain::ElementBodyForceStiffness(FEBodyForce& BF, FESolidEl
 //-----------------------------------------------------------------------------
 vec3d FEBiphasicSolidDomain::FluidFlux(FEMaterialPoint& mp)
 {
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// pressure gradient
 	vec3d gradp = ppt.m_gradp;
@@ -1204,7 +1202,7 @@ void FEBiphasicSolidDomain::UpdateNodalPressures()
 		for (int j = 0; j<nint; ++j)
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			FEBiphasicMaterialPoint* pt = (mp.ExtractData<FEBiphasicMaterialPoint>());
+			FEBiphasicMaterialPoint* pt = (mp.GetData<FEBiphasicMaterialPoint>());
 
 			if (pt) { pavg += pt->m_pa; c++; }
 		}
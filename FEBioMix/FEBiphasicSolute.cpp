@@ -106,8 +106,8 @@ void FEBiphasicSolute::Serialize(DumpStream& ar)
 //! Porosity in current configuration
 double FEBiphasicSolute::Porosity(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pet = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pet = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	// relative volume
 	double J = et.m_J;
@@ -130,7 +130,7 @@ double FEBiphasicSolute::Porosity(FEMaterialPoint& pt)
 
 mat3ds FEBiphasicSolute::Stress(FEMaterialPoint& mp)
 {
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// calculate solid material stress
 	mat3ds s = m_pSolid->Stress(mp);
@@ -150,9 +150,9 @@ mat3ds FEBiphasicSolute::Stress(FEMaterialPoint& mp)
 
 tens4ds FEBiphasicSolute::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ept = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& ept = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	// call solid tangent routine
 	tens4ds C = m_pSolid->Tangent(mp);
@@ -198,8 +198,8 @@ tens4ds FEBiphasicSolute::Tangent(FEMaterialPoint& mp)
 
 vec3d FEBiphasicSolute::FluidFlux(FEMaterialPoint& pt)
 {
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// fluid volume fraction (porosity) in current configuration
 	double phiw = Porosity(pt);
@@ -243,7 +243,7 @@ vec3d FEBiphasicSolute::FluidFlux(FEMaterialPoint& pt)
 
 vec3d FEBiphasicSolute::SoluteFlux(FEMaterialPoint& pt)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// fluid volume fraction (porosity) in current configuration
 	double phiw = Porosity(pt);
@@ -276,8 +276,8 @@ vec3d FEBiphasicSolute::SoluteFlux(FEMaterialPoint& pt)
 //! actual fluid pressure
 double FEBiphasicSolute::Pressure(FEMaterialPoint& pt)
 {
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// effective pressure
 	double p = ppt.m_p;
@@ -301,7 +301,7 @@ double FEBiphasicSolute::Pressure(FEMaterialPoint& pt)
 //! actual concentration
 double FEBiphasicSolute::Concentration(FEMaterialPoint& pt)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// solubility
 	double kappa = m_pSolute->m_pSolub->Solubility(pt);
@@ -316,7 +316,7 @@ double FEBiphasicSolute::Concentration(FEMaterialPoint& pt)
 //! referential solute concentration
 double FEBiphasicSolute::ReferentialConcentration(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
 
 	double J = ept.m_J;
 	double phiw = Porosity(pt);
@@ -34,6 +34,7 @@ SOFTWARE.*/
 #include "FECore/log.h"
 #include "FECore/DOFS.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEBiphasicSoluteShellDomain::FEBiphasicSoluteShellDomain(FEModel* pfem) : FESSIShellDomain(pfem), FEBiphasicSoluteDomain(pfem), m_dof(pfem)
@@ -134,9 +135,9 @@ void FEBiphasicSoluteShellDomain::InitMaterialPoints()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEElasticMaterialPoint& pm = *(mp.ExtractData<FEElasticMaterialPoint>());
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEElasticMaterialPoint& pm = *(mp.GetData<FEElasticMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             // initialize effective fluid pressure, its gradient, and fluid flux
             pt.m_p = evaluate(el, p0, q0, n);
@@ -174,7 +175,7 @@ void FEBiphasicSoluteShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -213,8 +214,8 @@ void FEBiphasicSoluteShellDomain::Reset()
 
 	// loop over all material points
 	ForEachMaterialPoint([=](FEMaterialPoint& mp) {
-        FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  ps = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  ps = *(mp.GetData<FESolutesMaterialPoint >());
             
         // initialize referential solid volume fraction
         pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -273,9 +274,9 @@ void FEBiphasicSoluteShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             c = evaluate(el, cn, dn, j);
             
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pb = *mp.ExtractData<FEBiphasicMaterialPoint>();
-            FESolutesMaterialPoint&  ps = *(mp.ExtractData<FESolutesMaterialPoint >());
+            FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pb = *mp.GetData<FEBiphasicMaterialPoint>();
+            FESolutesMaterialPoint&  ps = *(mp.GetData<FESolutesMaterialPoint >());
             pt.m_r0 = r0;
             pt.m_rt = rt;
             
@@ -310,8 +311,9 @@ void FEBiphasicSoluteShellDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -361,9 +363,9 @@ void FEBiphasicSoluteShellDomain::ElementInternalForce(FEShellElement& el, vecto
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -439,8 +441,9 @@ void FEBiphasicSoluteShellDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -490,9 +493,9 @@ void FEBiphasicSoluteShellDomain::ElementInternalForceSS(FEShellElement& el, vec
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -563,7 +566,8 @@ void FEBiphasicSoluteShellDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         
         // allocate stiffness matrix
         int neln = el.Nodes();
@@ -574,7 +578,7 @@ void FEBiphasicSoluteShellDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm
         ElementBiphasicSoluteStiffness(el, ke, bsymm);
 
 		// get lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -597,7 +601,8 @@ void FEBiphasicSoluteShellDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsy
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = neln*10;
         ke.resize(ndof, ndof);
@@ -606,7 +611,7 @@ void FEBiphasicSoluteShellDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsy
         ElementBiphasicSoluteStiffnessSS(el, ke, bsymm);
 
 		// get lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -651,9 +656,9 @@ bool FEBiphasicSoluteShellDomain::ElementBiphasicSoluteStiffness(FEShellElement&
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -947,9 +952,9 @@ bool FEBiphasicSoluteShellDomain::ElementBiphasicSoluteStiffnessSS(FEShellElemen
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1274,7 +1279,7 @@ void FEBiphasicSoluteShellDomain::UpdateElementStress(int iel)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
@@ -1290,8 +1295,8 @@ void FEBiphasicSoluteShellDomain::UpdateElementStress(int iel)
         pt.m_L = (pt.m_F - Fp)*Fi / dt;
 
         // biphasic-solute data
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // evaluate fluid pressure at gauss-point
         ppt.m_p = evaluate(el, pn, qn, n);
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 //-----------------------------------------------------------------------------
 FEBiphasicSoluteSolidDomain::FEBiphasicSoluteSolidDomain(FEModel* pfem) : FESolidDomain(pfem), FEBiphasicSoluteDomain(pfem), m_dofU(pfem), m_dofSU(pfem), m_dofR(pfem), m_dof(pfem)
@@ -136,9 +137,9 @@ void FEBiphasicSoluteSolidDomain::InitMaterialPoints()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEElasticMaterialPoint& pm = *(mp.ExtractData<FEElasticMaterialPoint>());
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEElasticMaterialPoint& pm = *(mp.GetData<FEElasticMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             // initialize effective fluid pressure, its gradient, and fluid flux
             pt.m_p = el.Evaluate(p0, n);
@@ -176,7 +177,7 @@ void FEBiphasicSoluteSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[5*i  ] = id[m_dofU[0]];
@@ -202,7 +203,7 @@ void FEBiphasicSoluteSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the back-face displacement dofs
             lm[5*i  ] = id[m_dofSU[0]];
@@ -229,8 +230,8 @@ void FEBiphasicSoluteSolidDomain::Reset()
 
 	// loop over all material points
 	ForEachMaterialPoint([=](FEMaterialPoint& mp) {
-        FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  ps = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  ps = *(mp.GetData<FESolutesMaterialPoint >());
             
         // initialize referential solid volume fraction
         pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -292,9 +293,9 @@ void FEBiphasicSoluteSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             c = el.Evaluate(ct, j);
             
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pb = *mp.ExtractData<FEBiphasicMaterialPoint>();
-            FESolutesMaterialPoint&  ps = *(mp.ExtractData<FESolutesMaterialPoint >());
+            FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pb = *mp.GetData<FEBiphasicMaterialPoint>();
+            FESolutesMaterialPoint&  ps = *(mp.GetData<FESolutesMaterialPoint >());
             pt.m_r0 = r0;
             pt.m_rt = rt;
             
@@ -328,8 +329,9 @@ void FEBiphasicSoluteSolidDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -375,9 +377,9 @@ void FEBiphasicSoluteSolidDomain::ElementInternalForce(FESolidElement& el, vecto
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -443,8 +445,9 @@ void FEBiphasicSoluteSolidDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -490,9 +493,9 @@ void FEBiphasicSoluteSolidDomain::ElementInternalForceSS(FESolidElement& el, vec
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -555,7 +558,8 @@ void FEBiphasicSoluteSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = neln*5;
         ke.resize(ndof, ndof);
@@ -564,7 +568,7 @@ void FEBiphasicSoluteSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm
         ElementBiphasicSoluteStiffness(el, ke, bsymm);
 
 		// get lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -587,7 +591,8 @@ void FEBiphasicSoluteSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsy
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = neln*5;
         ke.resize(ndof, ndof);
@@ -596,7 +601,7 @@ void FEBiphasicSoluteSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsy
         ElementBiphasicSoluteStiffnessSS(el, ke, bsymm);
 
 		// get lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -636,9 +641,9 @@ bool FEBiphasicSoluteSolidDomain::ElementBiphasicSoluteStiffness(FESolidElement&
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -851,9 +856,9 @@ bool FEBiphasicSoluteSolidDomain::ElementBiphasicSoluteStiffnessSS(FESolidElemen
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1095,7 +1100,7 @@ void FEBiphasicSoluteSolidDomain::UpdateElementStress(int iel)
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
@@ -1111,8 +1116,8 @@ void FEBiphasicSoluteSolidDomain::UpdateElementStress(int iel)
         pt.m_L = (pt.m_F - Fp)*Fi / dt;
 
         // solute-poroelastic data
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // evaluate fluid pressure at gauss-point
         ppt.m_p = el.Evaluate(pn, n);
@@ -81,8 +81,8 @@ FEMaterialPoint* FECarterHayes::CreateMaterialPointData()
 //-----------------------------------------------------------------------------
 double FECarterHayes::StrainEnergy(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double detF = pt.m_J;
 	double lndetF = log(detF);
@@ -105,15 +105,15 @@ double FECarterHayes::StrainEnergy(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 mat3ds FECarterHayes::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double detF = pt.m_J;
 	double detFi = 1.0/detF;
 	double lndetF = log(detF);
 
 	// evaluate the strain energy
-	FERemodelingMaterialPoint& rpt = *mp.ExtractData<FERemodelingMaterialPoint>();
+	FERemodelingMaterialPoint& rpt = *mp.GetData<FERemodelingMaterialPoint>();
 	rpt.m_sed = StrainEnergy(mp);
 	
 	// calculate left Cauchy-Green tensor
@@ -137,8 +137,8 @@ mat3ds FECarterHayes::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FECarterHayes::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	// deformation gradient
 	double detF = pt.m_J;
@@ -167,7 +167,7 @@ tens4ds FECarterHayes::Tangent(FEMaterialPoint& mp)
 //! calculate tangent of strain energy density with mass density
 double FECarterHayes::Tangent_SE_Density(FEMaterialPoint& mp)
 {
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	double rhor = spt.m_sbmr[m_lsbm];
     return StrainEnergy(mp)*m_g/rhor;
 }
@@ -176,7 +176,7 @@ double FECarterHayes::Tangent_SE_Density(FEMaterialPoint& mp)
 //! calculate tangent of stress with mass density
 mat3ds FECarterHayes::Tangent_Stress_Density(FEMaterialPoint& mp)
 {
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	double rhor = spt.m_sbmr[m_lsbm];
     return Stress(mp)*m_g/rhor;
 }
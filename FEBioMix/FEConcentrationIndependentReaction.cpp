@@ -34,7 +34,7 @@ SOFTWARE.*/
 //! molar supply at material point
 double FEConcentrationIndependentReaction::ReactionSupply(FEMaterialPoint& pt)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// get reaction rate
 	double kF = m_pFwd->ReactionRate(pt);
@@ -60,8 +60,8 @@ double FEConcentrationIndependentReaction::ReactionSupply(FEMaterialPoint& pt)
 //! tangent of molar supply with strain at material point
 mat3ds FEConcentrationIndependentReaction::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	const int nsol = m_nsol;
 	const int nsbm = (int)m_v.size() - nsol;
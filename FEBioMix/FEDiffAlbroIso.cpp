@@ -75,9 +75,9 @@ bool FEDiffAlbroIso::Init()
 //! Free diffusivity
 double FEDiffAlbroIso::Free_Diffusivity(FEMaterialPoint& mp)
 {
-	FESolutesMaterialPoint* spt = mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint* mfpt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+	FESolutesMaterialPoint* spt = mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint* mfpt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
 	
     // solute concentration
     double ca = 0;
@@ -98,9 +98,9 @@ double FEDiffAlbroIso::Free_Diffusivity(FEMaterialPoint& mp)
 //! Tangent of free diffusivity with respect to concentration
 double FEDiffAlbroIso::Tangent_Free_Diffusivity_Concentration(FEMaterialPoint& mp, const int isol)
 {
-    FESolutesMaterialPoint* spt = mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint* mfpt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint* spt = mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint* mfpt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
 	
     // solute concentration
     double ca, c, dkdc, k;
@@ -144,12 +144,12 @@ double FEDiffAlbroIso::Tangent_Free_Diffusivity_Concentration(FEMaterialPoint& m
 //! Diffusivity tensor.
 mat3ds FEDiffAlbroIso::Diffusivity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint* et = mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint* ppt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bfpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
-	FESolutesMaterialPoint* spt = mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint* mfpt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint* et = mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint* ppt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bfpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
+	FESolutesMaterialPoint* spt = mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint* mfpt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
 	
 	// relative volume
 	double J = et->m_J;
@@ -184,12 +184,12 @@ mat3ds FEDiffAlbroIso::Diffusivity(FEMaterialPoint& mp)
 //! Tangent of diffusivity with respect to strain
 tens4dmm FEDiffAlbroIso::Tangent_Diffusivity_Strain(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint* et = mp.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint* ppt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bfpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FESolutesMaterialPoint* spt = mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint* mfpt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint* et = mp.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint* ppt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bfpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint* spt = mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint* mfpt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -243,12 +243,12 @@ tens4dmm FEDiffAlbroIso::Tangent_Diffusivity_Strain(FEMaterialPoint &mp)
 //! Tangent of diffusivity with respect to concentration
 mat3ds FEDiffAlbroIso::Tangent_Diffusivity_Concentration(FEMaterialPoint &mp, const int isol)
 {
-    FEElasticMaterialPoint* et = mp.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint* ppt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bfpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FESolutesMaterialPoint* spt = mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint* fspt = mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint* mfpt = mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint* et = mp.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint* ppt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bfpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint* spt = mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint* fspt = mp.GetData<FEFluidSolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint* mfpt = mp.GetData<FEMultiphasicFSIMaterialPoint>();
 	
 	// relative volume
 	double J = et->m_J;
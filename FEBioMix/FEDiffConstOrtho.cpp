@@ -75,7 +75,7 @@ mat3ds FEDiffConstOrtho::Diffusivity(FEMaterialPoint& mp)
 	vec3d a0;				// texture direction in reference configuration
 	mat3ds d(0,0,0,0,0,0);	// diffusion tensor
 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	
 	// get the local coordinate systems
 	mat3d Q = GetLocalCS(mp);
@@ -68,9 +68,9 @@ double FEDiffRefIso::Tangent_Free_Diffusivity_Concentration(FEMaterialPoint& mp,
 //! Diffusivity tensor.
 mat3ds FEDiffRefIso::Diffusivity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint* ppt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bfpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint* ppt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bfpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -103,9 +103,9 @@ mat3ds FEDiffRefIso::Diffusivity(FEMaterialPoint& mp)
 //! Tangent of diffusivity with respect to strain
 tens4dmm FEDiffRefIso::Tangent_Diffusivity_Strain(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint* ppt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bfpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint* ppt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bfpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -74,8 +74,8 @@ bool FEFiberExpPowSBM::Init()
 //-----------------------------------------------------------------------------
 mat3ds FEFiberExpPowSBM::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     
     // initialize material constants
     double rhor = spt.m_sbmr[m_lsbm];
@@ -127,8 +127,8 @@ mat3ds FEFiberExpPowSBM::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberExpPowSBM::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     
     // initialize material constants
     double rhor = spt.m_sbmr[m_lsbm];
@@ -184,8 +184,8 @@ double FEFiberExpPowSBM::StrainEnergyDensity(FEMaterialPoint& mp)
 {
     double sed = 0.0;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     
     // initialize material constants
     double rhor = spt.m_sbmr[m_lsbm];
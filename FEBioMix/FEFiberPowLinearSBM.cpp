@@ -75,8 +75,8 @@ bool FEFiberPowLinearSBM::Init()
 //-----------------------------------------------------------------------------
 mat3ds FEFiberPowLinearSBM::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     
     // initialize material constants
     double rhor = spt.m_sbmr[m_lsbm];
@@ -133,8 +133,8 @@ mat3ds FEFiberPowLinearSBM::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEFiberPowLinearSBM::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     
     // initialize material constants
     double rhor = spt.m_sbmr[m_lsbm];
@@ -193,8 +193,8 @@ double FEFiberPowLinearSBM::StrainEnergyDensity(FEMaterialPoint& mp)
 {
     double sed = 0.0;
     
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     
     // initialize material constants
     double rhor = spt.m_sbmr[m_lsbm];
@@ -42,7 +42,7 @@ double FEMassActionForward::ReactionSupply(FEMaterialPoint& pt)
     // start with contribution from solutes
 	if (m_pMP)
 	{
-		FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 		int nsol = (int)spt.m_ca.size();
 		for (int i = 0; i < nsol; ++i) {
 			int vR = m_vR[i];
@@ -63,7 +63,7 @@ double FEMassActionForward::ReactionSupply(FEMaterialPoint& pt)
 	}
 	else if (m_pFS)
 	{
-		FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
+		FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
 		int nsol = (int)fspt.m_ca.size();
 		for (int i = 0; i < nsol; ++i) {
 			int vR = m_vR[i];
@@ -75,7 +75,7 @@ double FEMassActionForward::ReactionSupply(FEMaterialPoint& pt)
 	}
 	else if (m_pSM)
 	{
-		FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
+		FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
 		int nsol = (int)smpt.m_ca.size();
 		for (int i = 0; i < nsol; ++i) {
 			int vR = m_vR[i];
@@ -87,7 +87,7 @@ double FEMassActionForward::ReactionSupply(FEMaterialPoint& pt)
 	}
 	else if (m_pMF)
 	{
-		FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+		FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 		int nsol = (int)mfpt.m_ca.size();
 		for (int i = 0; i < nsol; ++i) {
 			int vR = m_vR[i];
@@ -110,9 +110,9 @@ mat3ds FEMassActionForward::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
     
     if (m_pMF)
     {
-		FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-		FEBiphasicFSIMaterialPoint& bfpt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
-		FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+		FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+		FEBiphasicFSIMaterialPoint& bfpt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
+		FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 
         double J = ept.m_J;
         double phi0 = bfpt.m_phi0;
@@ -136,9 +136,9 @@ mat3ds FEMassActionForward::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
     }
     else
     {
-		FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-		FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-		FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+		FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+		FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+		FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 
         double J = ept.m_J;
         double phi0 = bpt.m_phi0;
@@ -191,7 +191,7 @@ double FEMassActionForward::Tangent_ReactionSupply_Concentration(FEMaterialPoint
     double dzhatdc = 0;
 	if (m_pMP)
 	{
-		FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 		for (int isol = 0; isol < nsol; ++isol) {
 				dzhatdc += m_vR[isol]*spt.m_dkdc[isol][sol]/spt.m_k[isol];
             if ((isol == sol) && (spt.m_c[sol] > 0))
@@ -200,7 +200,7 @@ double FEMassActionForward::Tangent_ReactionSupply_Concentration(FEMaterialPoint
 	}
 	else if (m_pFS)
 	{
-		FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
+		FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
 		for (int isol = 0; isol < nsol; ++isol) {
 			dzhatdc += m_vR[isol] * fspt.m_dkdc[isol][sol] / fspt.m_k[isol];
 			if ((isol == sol) && (fspt.m_c[sol] > 0))
@@ -209,7 +209,7 @@ double FEMassActionForward::Tangent_ReactionSupply_Concentration(FEMaterialPoint
 	}
 	else if (m_pSM)
 	{
-		FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
+		FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
 		for (int isol = 0; isol < nsol; ++isol) {
 			dzhatdc += m_vR[isol] * smpt.m_dkdc[isol][sol] / smpt.m_k[isol];
 			if ((isol == sol) && (smpt.m_c[sol] > 0))
@@ -218,7 +218,7 @@ double FEMassActionForward::Tangent_ReactionSupply_Concentration(FEMaterialPoint
 	}
 	else if (m_pMF)
 	{
-		FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+		FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 		for (int isol = 0; isol < nsol; ++isol) {
 			dzhatdc += m_vR[isol]*mfpt.m_dkdc[isol][sol]/mfpt.m_k[isol];
             if ((isol == sol) && (mfpt.m_c[sol] > 0))
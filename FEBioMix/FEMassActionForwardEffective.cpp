@@ -33,10 +33,10 @@ SOFTWARE.*/
 //! molar supply at material point
 double FEMassActionForwardEffective::ReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // get reaction rate
     double kF = m_pFwd->ReactionRate(pt);
@@ -90,11 +90,11 @@ double FEMassActionForwardEffective::ReactionSupply(FEMaterialPoint& pt)
 //! tangent of molar supply with strain at material point
 mat3ds FEMassActionForwardEffective::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bfpt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bfpt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     const int nsol = m_nsol;
     const int nsbm = (int)m_v.size() - nsol;
@@ -148,10 +148,10 @@ double FEMassActionForwardEffective::Tangent_ReactionSupply_Concentration(FEMate
     // if the derivative is taken with respect to a solid-bound molecule, return 0
     if (sol >= nsol) return 0;
     
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     double zhat = ReactionSupply(pt);
     double dzhatdc = 0;
     if (m_pMP)
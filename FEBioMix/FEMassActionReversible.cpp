@@ -33,10 +33,10 @@ SOFTWARE.*/
 //! molar supply at material point
 double FEMassActionReversible::FwdReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // get forward reaction rate
     double k = m_pFwd->ReactionRate(pt);
@@ -112,10 +112,10 @@ double FEMassActionReversible::FwdReactionSupply(FEMaterialPoint& pt)
 //! molar supply at material point
 double FEMassActionReversible::RevReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // get forward reaction rate
     double k = m_pRev->ReactionRate(pt);
@@ -199,13 +199,13 @@ double FEMassActionReversible::ReactionSupply(FEMaterialPoint& pt)
 //! tangent of molar supply with strain at material point
 mat3ds FEMassActionReversible::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bfpt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bfpt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 	
 	const int nsol = m_nsol;
 	const int nsbm = (int)m_v.size() - nsol;
@@ -311,10 +311,10 @@ double FEMassActionReversible::Tangent_ReactionSupply_Concentration(FEMaterialPo
         return 0;
     }
     
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // forward reaction
     double zhatF = FwdReactionSupply(pt);
@@ -34,10 +34,10 @@ SOFTWARE.*/
 //! molar supply at material point
 double FEMassActionReversibleEffective::FwdReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // get forward reaction rate
     double k = m_pFwd->ReactionRate(pt);
@@ -113,10 +113,10 @@ double FEMassActionReversibleEffective::FwdReactionSupply(FEMaterialPoint& pt)
 //! molar supply at material point
 double FEMassActionReversibleEffective::RevReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // get forward reaction rate
     double k = m_pRev->ReactionRate(pt);
@@ -201,11 +201,11 @@ double FEMassActionReversibleEffective::ReactionSupply(FEMaterialPoint& pt)
 //! tangent of molar supply with strain at material point
 mat3ds FEMassActionReversibleEffective::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bfpt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bfpt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     const int nsol = m_nsol;
     const int nsbm = (int)m_v.size() - nsol;
@@ -273,10 +273,10 @@ double FEMassActionReversibleEffective::Tangent_ReactionSupply_Concentration(FEM
         return 0;
     }
     
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // forward reaction
     double zhatF = FwdReactionSupply(pt);
@@ -34,7 +34,7 @@ SOFTWARE.*/
 //! molar supply at material point
 double FEMembraneMassActionForward::ReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // get reaction rate
     double kF = m_pFwd->ReactionRate(pt);
@@ -143,7 +143,7 @@ double FEMembraneMassActionForward::Tangent_ReactionSupply_Concentration(FEMater
     // if the derivative is taken with respect to a solid-bound molecule, return 0
     if (sol >= nsol) return 0;
     
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     double zhat = ReactionSupply(pt);
     double dzhatdc = 0;
     if ((zhat > 0) && (spt.m_c[sol] > 0)) dzhatdc = m_vR[sol]/spt.m_c[sol]*zhat;
@@ -159,7 +159,7 @@ double FEMembraneMassActionForward::Tangent_ReactionSupply_Ci(FEMaterialPoint& p
     double kF = m_pFwd->ReactionRate(pt);
     double dkFdci = m_pFwd->Tangent_ReactionRate_Ci(pt, sol);
     double dzhatdc = 0;
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     if (kF != 0) dzhatdc = dkFdci/kF*zhat;
     if ((zhat > 0) && (spt.m_ci[sol] > 0)) dzhatdc += m_vRi[spt.m_idi[sol]]/spt.m_ci[sol]*zhat;
     
@@ -174,7 +174,7 @@ double FEMembraneMassActionForward::Tangent_ReactionSupply_Ce(FEMaterialPoint& p
     double kF = m_pFwd->ReactionRate(pt);
     double dkFdce = m_pFwd->Tangent_ReactionRate_Ce(pt, sol);
     double dzhatdc = 0;
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     if (kF != 0) dzhatdc = dkFdce/kF*zhat;
     if ((zhat > 0) && (spt.m_ce[sol] > 0)) dzhatdc += m_vRe[spt.m_ide[sol]]/spt.m_ce[sol]*zhat;
     
@@ -32,7 +32,7 @@ SOFTWARE.*/
 //! molar supply at material point
 double FEMembraneMassActionReversible::FwdReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // get forward reaction rate
     double k = m_pFwd->ReactionRate(pt);
@@ -87,7 +87,7 @@ double FEMembraneMassActionReversible::FwdReactionSupply(FEMaterialPoint& pt)
 //! molar supply at material point
 double FEMembraneMassActionReversible::RevReactionSupply(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // get forward reaction rate
     double k = m_pRev->ReactionRate(pt);
@@ -218,7 +218,7 @@ double FEMembraneMassActionReversible::Tangent_ReactionSupply_Concentration(FEMa
         return 0;
     }
     
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // forward reaction
     double zhatF = FwdReactionSupply(pt);
@@ -237,7 +237,7 @@ double FEMembraneMassActionReversible::Tangent_ReactionSupply_Concentration(FEMa
 //! tangent of molar supply with effective concentration at material point
 double FEMembraneMassActionReversible::Tangent_ReactionSupply_Ci(FEMaterialPoint& pt, const int sol)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // forward reaction
     double zhatF = FwdReactionSupply(pt);
@@ -262,7 +262,7 @@ double FEMembraneMassActionReversible::Tangent_ReactionSupply_Ci(FEMaterialPoint
 //! tangent of molar supply with effective concentration at material point
 double FEMembraneMassActionReversible::Tangent_ReactionSupply_Ce(FEMaterialPoint& pt, const int sol)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // forward reaction
     double zhatF = FwdReactionSupply(pt);
@@ -49,7 +49,7 @@ bool FEMembraneReactionRateIonChannel::Init()
 
 double FEMembraneReactionRateIonChannel::ReactionRate(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& ps = *(pt.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(pt.GetData<FESolutesMaterialPoint>());
     double ci = ps.m_ci[m_sol];
     double ce = ps.m_ce[m_sol];
     double R = GetFEModel()->GetGlobalConstant("R");
@@ -67,7 +67,7 @@ double FEMembraneReactionRateIonChannel::Tangent_ReactionRate_Ci(FEMaterialPoint
 {
     if (isol != m_sol)  return 0;
     
-    FESolutesMaterialPoint& ps = *(pt.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(pt.GetData<FESolutesMaterialPoint>());
     double ci = ps.m_ci[m_sol];
     double ce = ps.m_ce[m_sol];
     double R = GetFEModel()->GetGlobalConstant("R");
@@ -85,7 +85,7 @@ double FEMembraneReactionRateIonChannel::Tangent_ReactionRate_Ce(FEMaterialPoint
 {
     if (isol != m_sol)  return 0;
     
-    FESolutesMaterialPoint& ps = *(pt.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(pt.GetData<FESolutesMaterialPoint>());
     double ci = ps.m_ci[m_sol];
     double ce = ps.m_ce[m_sol];
     double R = GetFEModel()->GetGlobalConstant("R");
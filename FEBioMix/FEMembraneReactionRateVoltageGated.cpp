@@ -52,7 +52,7 @@ bool FEMembraneReactionRateVoltageGated::Init()
 
 double FEMembraneReactionRateVoltageGated::ReactionRate(FEMaterialPoint& pt)
 {
-    FESolutesMaterialPoint& ps = *(pt.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(pt.GetData<FESolutesMaterialPoint>());
     double ci = ps.m_ci[m_sol];
     double ce = ps.m_ce[m_sol];
     if (ce == 0) return 0;
@@ -67,7 +67,7 @@ double FEMembraneReactionRateVoltageGated::Tangent_ReactionRate_Ci(FEMaterialPoi
 {
     if (isol != m_sol)  return 0;
     
-    FESolutesMaterialPoint& ps = *(pt.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(pt.GetData<FESolutesMaterialPoint>());
     double ci = ps.m_ci[m_sol];
     double ce = ps.m_ce[m_sol];
     if ((ce == 0) || (ci == 0)) return 0;
@@ -83,7 +83,7 @@ double FEMembraneReactionRateVoltageGated::Tangent_ReactionRate_Ce(FEMaterialPoi
 {
     if (isol != m_sol)  return 0;
     
-    FESolutesMaterialPoint& ps = *(pt.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(pt.GetData<FESolutesMaterialPoint>());
     double ci = ps.m_ci[m_sol];
     double ce = ps.m_ce[m_sol];
     if (ce == 0) return 0;
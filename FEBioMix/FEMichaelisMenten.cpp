@@ -84,10 +84,10 @@ bool FEMichaelisMenten::Init()
 //! molar supply at material point
 double FEMichaelisMenten::ReactionSupply(FEMaterialPoint& pt)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 
 	// get reaction rate
 	double Vmax = m_pFwd->ReactionRate(pt);
@@ -116,13 +116,13 @@ double FEMichaelisMenten::ReactionSupply(FEMaterialPoint& pt)
 //! tangent of molar supply with strain at material point
 mat3ds FEMichaelisMenten::Tangent_ReactionSupply_Strain(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bfpt = *pt.ExtractData<FEBiphasicFSIMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bfpt = *pt.GetData<FEBiphasicFSIMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 	
 	double c = 0.0;
 	double dcdJ = 0.0;
@@ -179,10 +179,10 @@ double FEMichaelisMenten::Tangent_ReactionSupply_Pressure(FEMaterialPoint& pt)
 //! tangent of molar supply with effective concentration at material point
 double FEMichaelisMenten::Tangent_ReactionSupply_Concentration(FEMaterialPoint& pt, const int sol)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *pt.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *pt.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *pt.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *pt.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
 	
 	if (m_Rtype) {
         return 0;
@@ -386,8 +386,8 @@ void FEMultiphasic::Serialize(DumpStream& ar)
 //! Solid referential apparent density
 double FEMultiphasic::SolidReferentialApparentDensity(FEMaterialPoint& pt)
 {
-	FEBiphasicMaterialPoint& pet = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& pet = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 		
 	// evaluate referential apparent density of base solid
 	double density = m_pSolid->Density(pt);
@@ -418,8 +418,8 @@ double FEMultiphasic::SolidReferentialVolumeFraction(FEMaterialPoint& pt)
 //! Porosity in current configuration
 double FEMultiphasic::Porosity(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& bt = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& bt = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	// solid referential volume fraction
 	double phisr = bt.m_phi0;
@@ -439,9 +439,9 @@ double FEMultiphasic::Porosity(FEMaterialPoint& pt)
 //! Fixed charge density in current configuration
 double FEMultiphasic::FixedChargeDensity(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& bt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& bt = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// relative volume
 	double J = et.m_J;
@@ -471,7 +471,7 @@ double FEMultiphasic::ElectricPotential(FEMaterialPoint& pt, const bool eform)
 	int i, j;
 	
 	// if not neutral, solve electroneutrality polynomial for zeta
-	FESolutesMaterialPoint& set = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& set = *pt.GetData<FESolutesMaterialPoint>();
 	const int nsol = (int)m_pSolute.size();
 	double cF = FixedChargeDensity(pt);
 
@@ -547,9 +547,9 @@ void FEMultiphasic::PartitionCoefficientFunctions(FEMaterialPoint& mp, vector<do
 	int isol, jsol, ksol;
     int isbm;
 	
-	FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
-	FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-	FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+	FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
+	FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+	FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
 	
 	const int nsol = (int)m_pSolute.size();
     const int nsbm = (int)m_pSBM.size();
@@ -706,7 +706,7 @@ void FEMultiphasic::PartitionCoefficientFunctions(FEMaterialPoint& mp, vector<do
 //! actual concentration
 double FEMultiphasic::Concentration(FEMaterialPoint& pt, const int sol)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// effective concentration
 	double c = spt.m_c[sol];
@@ -751,9 +751,9 @@ tens4ds FEMultiphasic::Tangent(FEMaterialPoint& mp)
 {
 	int i;
 	
-	FEElasticMaterialPoint& ept = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& bpt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& ept = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& bpt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	const int nsol = (int)m_pSolute.size();
 	
 	// call solid tangent routine
@@ -836,8 +836,8 @@ vec3d FEMultiphasic::FluidFlux(FEMaterialPoint& pt)
 {
 	int i;
 	
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	const int nsol = (int)m_pSolute.size();
 	vector<double> c(nsol);
 	vector<vec3d> gradc(nsol);
@@ -905,8 +905,8 @@ vec3d FEMultiphasic::FluidFlux(FEMaterialPoint& pt)
 
 vec3d FEMultiphasic::SoluteFlux(FEMaterialPoint& pt, const int sol)
 {
-	FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// fluid volume fraction (porosity) in current configuration
 	double phiw = Porosity(pt);
@@ -945,7 +945,7 @@ double FEMultiphasic::Pressure(FEMaterialPoint& pt)
 {
 	int i;
 	
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
 	const int nsol = (int)m_pSolute.size();
 	
 	// effective pressure
@@ -132,15 +132,15 @@ public:
 	
 	//! SBM actual concentration (molar concentration in current configuration)
 	double SBMConcentration(FEMaterialPoint& pt, const int sbm) {
-		FEElasticMaterialPoint& ept = *pt.ExtractData<FEElasticMaterialPoint>();
-		FEBiphasicMaterialPoint& bpt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-		FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+		FEElasticMaterialPoint& ept = *pt.GetData<FEElasticMaterialPoint>();
+		FEBiphasicMaterialPoint& bpt = *pt.GetData<FEBiphasicMaterialPoint>();
+		FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 		return spt.m_sbmr[sbm]/(ept.m_J-bpt.m_phi0)/SBMMolarMass(sbm);
 	}
 
 	//! SBM referential volume fraction
 	double SBMReferentialVolumeFraction(FEMaterialPoint& pt, const int sbm) {
-		FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+		FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 		return spt.m_sbmr[sbm]/SBMDensity(sbm);
 	}
 
@@ -81,10 +81,10 @@ void FEMultiphasicMultigeneration::UpdateSolidBoundMolecules(FEMaterialPoint& mp
         // for chemical reactions involving solid-bound molecules,
         // update their concentration
         // multiphasic material point data
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
-        FEMultigenSBMMaterialPoint& mpt = *(mp.ExtractData<FEMultigenSBMMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
+        FEMultigenSBMMaterialPoint& mpt = *(mp.GetData<FEMultigenSBMMaterialPoint>());
         
         double phi0 = ppt.m_phi0;
         int nsbm = SBMs();
@@ -255,7 +255,7 @@ void FEMultigenSBMMaterialPoint::Init()
 	m_Ji.clear();
 	m_tgen = 0.0;
         
-	FESolutesMaterialPoint& spt = *((*this).ExtractData<FESolutesMaterialPoint>());
+	FESolutesMaterialPoint& spt = *((*this).GetData<FESolutesMaterialPoint>());
 	m_nsbm = spt.m_nsbm;
 	m_ngen = 1; // first generation starts at t=0
 	mat3d Fi(mat3dd(1.0));
@@ -281,8 +281,8 @@ void FEMultigenSBMMaterialPoint::Update(const FETimeInfo& timeInfo)
         
 	if (t>m_tgen) {
 		// new generation
-		FEElasticMaterialPoint& pt = *((*this).ExtractData<FEElasticMaterialPoint>());
-		FESolutesMaterialPoint& spt = *((*this).ExtractData<FESolutesMaterialPoint>());
+		FEElasticMaterialPoint& pt = *((*this).GetData<FEElasticMaterialPoint>());
+		FESolutesMaterialPoint& spt = *((*this).GetData<FESolutesMaterialPoint>());
             
 		// push back F and J to define relative deformation gradient of this generation
 		mat3d F = pt.m_F;
@@ -35,6 +35,7 @@ SOFTWARE.*/
 #include "FECore/DOFS.h"
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
@@ -85,7 +86,7 @@ void FEMultiphasicShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -117,7 +118,7 @@ void FEMultiphasicShellDomain::UnpackMembraneLM(FEShellElement& el, vector<int>&
     
     // get the first material point
     FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-    FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+    FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
 
     int nse = (int)ps.m_ide.size();
     int nsi = (int)ps.m_idi.size();
@@ -133,7 +134,7 @@ void FEMultiphasicShellDomain::UnpackMembraneLM(FEShellElement& el, vector<int>&
         int n = el.m_node[i];
         
         FENode& node = mesh.Node(n);
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -209,8 +210,8 @@ bool FEMultiphasicShellDomain::Init()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEBiphasicMaterialPoint& pb = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEBiphasicMaterialPoint& pb = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             ps.m_sbmr = sbmr;
             ps.m_sbmrp = sbmr;
@@ -226,7 +227,7 @@ bool FEMultiphasicShellDomain::Init()
                 // for chemical reactions involving solid-bound molecules,
                 // update their concentration
                 // multiphasic material point data
-                FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+                FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
                 
                 double phi0 = pb.m_phi0;
                 for (int isbm=0; isbm<nsbm; ++isbm) {
@@ -245,7 +246,7 @@ bool FEMultiphasicShellDomain::Init()
                 // for membrane reactions involving solid-bound molecules,
                 // update their concentration
                 // multiphasic material point data
-                FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+                FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
                 
                 double phi0 = pb.m_phi0;
                 for (int isbm=0; isbm<nsbm; ++isbm) {
@@ -348,9 +349,9 @@ void FEMultiphasicShellDomain::InitMaterialPoints()
         {
 
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEElasticMaterialPoint& pm = *(mp.ExtractData<FEElasticMaterialPoint>());
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEElasticMaterialPoint& pm = *(mp.GetData<FEElasticMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             // initialize effective fluid pressure, its gradient, and fluid flux
             pt.m_p = evaluate(el, p0, q0, n);
@@ -413,8 +414,8 @@ void FEMultiphasicShellDomain::Reset()
         for (int n=0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
 
             // initialize referential solid volume fraction
             pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -482,10 +483,10 @@ void FEMultiphasicShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             rt = el.Evaluate(xt, j);
             
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEElasticMaterialPoint& pe = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
-            FEMultigenSBMMaterialPoint* pmg = mp.ExtractData<FEMultigenSBMMaterialPoint>();
+            FEElasticMaterialPoint& pe = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
+            FEMultigenSBMMaterialPoint* pmg = mp.GetData<FEMultigenSBMMaterialPoint>();
             
             pe.m_r0 = r0;
             pe.m_rt = rt;
@@ -545,8 +546,9 @@ void FEMultiphasicShellDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -604,9 +606,9 @@ void FEMultiphasicShellDomain::ElementInternalForce(FEShellElement& el, vector<d
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -718,8 +720,9 @@ void FEMultiphasicShellDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -775,9 +778,9 @@ void FEMultiphasicShellDomain::ElementInternalForceSS(FEShellElement& el, vector
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -884,7 +887,8 @@ void FEMultiphasicShellDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 		int neln = el.Nodes();
         int ndof = neln*ndpn;
         ke.resize(ndof, ndof);
@@ -893,7 +897,7 @@ void FEMultiphasicShellDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
         ElementMultiphasicStiffness(el, ke, bsymm);
 
 		// get lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -919,7 +923,8 @@ void FEMultiphasicShellDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
         int neln = el.Nodes();
         int ndof = neln*ndpn;
         ke.resize(ndof, ndof);
@@ -927,7 +932,7 @@ void FEMultiphasicShellDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
         // calculate the element stiffness matrix
         ElementMultiphasicStiffnessSS(el, ke, bsymm);
 
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -979,9 +984,9 @@ bool FEMultiphasicShellDomain::ElementMultiphasicStiffness(FEShellElement& el, m
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1528,9 +1533,9 @@ bool FEMultiphasicShellDomain::ElementMultiphasicStiffnessSS(FEShellElement& el,
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1930,7 +1935,8 @@ void FEMultiphasicShellDomain::MembraneReactionFluxes(FEGlobalVector& R)
     {
         // element force vector
         vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FEShellElement& el = m_Elem[i];
@@ -1953,7 +1959,7 @@ void FEMultiphasicShellDomain::ElementMembraneReactionFlux(FEShellElement& el, v
 
     // get the first material point
     FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-    FESolutesMaterialPoint& ps = *mp.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& ps = *mp.GetData<FESolutesMaterialPoint>();
     int nse = (int)ps.m_ce.size();
     int nsi = (int)ps.m_ci.size();
     int ndpn = 8 + nse + nsi;
@@ -1986,7 +1992,7 @@ void FEMultiphasicShellDomain::ElementMembraneReactionFlux(FEShellElement& el, v
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FESolutesMaterialPoint& ps = *mp.ExtractData<FESolutesMaterialPoint>();
+        FESolutesMaterialPoint& ps = *mp.GetData<FESolutesMaterialPoint>();
         
         M  = el.H(n);
         Mr = el.Hr(n);
@@ -2056,9 +2062,10 @@ void FEMultiphasicShellDomain::MembraneReactionStiffnessMatrix(FELinearSystem& L
 		FEShellElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
 
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
         UnpackMembraneLM(el, lm);
 		ke.SetIndices(lm);
         
@@ -2078,7 +2085,7 @@ bool FEMultiphasicShellDomain::ElementMembraneFluxStiffness(FEShellElement& el,
 
     // get the first material point
     FEMaterialPoint& mp = *el.GetMaterialPoint(0);
-    FESolutesMaterialPoint& ps = *mp.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& ps = *mp.GetData<FESolutesMaterialPoint>();
     int nse = (int)ps.m_ce.size();
     int nsi = (int)ps.m_ci.size();
     int ndpn = 8 + nse + nsi;
@@ -2113,7 +2120,7 @@ bool FEMultiphasicShellDomain::ElementMembraneFluxStiffness(FEShellElement& el,
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FESolutesMaterialPoint& ps = *mp.ExtractData<FESolutesMaterialPoint>();
+        FESolutesMaterialPoint& ps = *mp.GetData<FESolutesMaterialPoint>();
 
         M  = el.H(n);
         Mr = el.Hr(n);
@@ -2317,7 +2324,7 @@ void FEMultiphasicShellDomain::UpdateElementStress(int iel, const FETimeInfo& tp
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
@@ -2333,8 +2340,8 @@ void FEMultiphasicShellDomain::UpdateElementStress(int iel, const FETimeInfo& tp
         pt.m_L = (pt.m_F - Fp)*Fi / dt;
 
         // multiphasic material point data
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // update membrane reaction data if needed
         if (m_pMat->MembraneReactions()) {
@@ -2454,7 +2461,7 @@ void FEMultiphasicShellDomain::UpdateShellMPData(int iel)
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             ps.m_ide = ide;
             ps.m_idi = idi;
@@ -35,6 +35,7 @@ SOFTWARE.*/
 #include "FECore/DOFS.h"
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
@@ -80,7 +81,7 @@ void FEMultiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        int* id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -107,7 +108,7 @@ void FEMultiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(sel.m_node[i]);
-            vector<int>& id = node.m_ID;
+            int* id = node.m_ID;
             
             // first the back-face displacement dofs
             lm[ndpn*i  ] = id[m_dofSU[0]];
@@ -152,8 +153,8 @@ bool FEMultiphasicSolidDomain::Init()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEBiphasicMaterialPoint& pb = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEBiphasicMaterialPoint& pb = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             ps.m_sbmr = sbmr;
             ps.m_sbmrp.assign(nsbm, 0);
@@ -169,7 +170,7 @@ bool FEMultiphasicSolidDomain::Init()
                 // for chemical reactions involving solid-bound molecules,
                 // update their concentration
                 // multiphasic material point data
-                FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+                FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
                 
                 double phi0 = pb.m_phi0;
                 for (int isbm=0; isbm<nsbm; ++isbm) {
@@ -319,9 +320,9 @@ void FEMultiphasicSolidDomain::InitMaterialPoints()
         for (int n = 0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEElasticMaterialPoint& pm = *(mp.ExtractData<FEElasticMaterialPoint>());
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEElasticMaterialPoint& pm = *(mp.GetData<FEElasticMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             // initialize effective fluid pressure, its gradient, and fluid flux
             pt.m_p = el.Evaluate(p0, n);
@@ -384,8 +385,8 @@ void FEMultiphasicSolidDomain::Reset()
         for (int n=0; n<nint; ++n)
         {
             FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             // initialize referential solid volume fraction
             pt.m_phi0 = m_pMat->m_phi0(mp);
@@ -440,10 +441,10 @@ void FEMultiphasicSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             rt = el.Evaluate(xt, j);
             
             FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-            FEElasticMaterialPoint& pe = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
-            FEMultigenSBMMaterialPoint* pmg = mp.ExtractData<FEMultigenSBMMaterialPoint>();
+            FEElasticMaterialPoint& pe = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
+            FEMultigenSBMMaterialPoint* pmg = mp.GetData<FEMultigenSBMMaterialPoint>();
             
             pe.m_r0 = r0;
             pe.m_rt = rt;
@@ -496,8 +497,9 @@ void FEMultiphasicSolidDomain::InternalForces(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -548,9 +550,9 @@ void FEMultiphasicSolidDomain::ElementInternalForce(FESolidElement& el, vector<d
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -642,8 +644,9 @@ void FEMultiphasicSolidDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -694,9 +697,9 @@ void FEMultiphasicSolidDomain::ElementInternalForceSS(FESolidElement& el, vector
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -775,15 +778,12 @@ void FEMultiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
     int ndpn = 4+nsol;
     
     // repeat over all solid elements
-    int NE = (int)m_Elem.size();
-    
-#pragma omp parallel for
-    for (int iel=0; iel<NE; ++iel)
-    {
+    AssembleElements(LS, [&](int iel) {
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
 
         // allocate stiffness matrix
         int neln = el.Nodes();
@@ -794,13 +794,13 @@ void FEMultiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
         ElementMultiphasicStiffness(el, ke, bsymm);
 
 		// get the lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
         // assemble element matrix in global stiffness matrix
 		LS.Assemble(ke);
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -810,15 +810,12 @@ void FEMultiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
     int ndpn = 4+nsol;
     
     // repeat over all solid elements
-    int NE = (int)m_Elem.size();
-    
-#pragma omp parallel for
-    for (int iel=0; iel<NE; ++iel)
-    {
+    AssembleElements(LS, [&](int iel) {
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
-        FEElementMatrix ke(el);
+        FEElementWorkspace& ws = ElementWorkspace();
+        FEElementMatrix& ke = ws.ElementMatrix(el);
 
         // allocate stiffness matrix
         int neln = el.Nodes();
@@ -829,13 +826,13 @@ void FEMultiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
         ElementMultiphasicStiffnessSS(el, ke, bsymm);
 
 		// get the lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
         // assemble element matrix in global stiffness matrix
 		LS.Assemble(ke);
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -872,9 +869,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
     for (int n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1274,9 +1271,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1646,7 +1643,7 @@ void FEMultiphasicSolidDomain::UpdateElementStress(int iel, double dt)
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
         
         // material point coordinates
         // TODO: I'm not entirly happy with this solution
@@ -1662,8 +1659,8 @@ void FEMultiphasicSolidDomain::UpdateElementStress(int iel, double dt)
         pt.m_L = (pt.m_F - Fp)*Fi / dt;
 
         // multiphasic material point data
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         // update SBM referential densities
         pmb->UpdateSolidBoundMolecules(mp);
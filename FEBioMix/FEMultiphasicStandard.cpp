@@ -54,9 +54,9 @@ void FEMultiphasicStandard::UpdateSolidBoundMolecules(FEMaterialPoint& mp)
         // for chemical reactions involving solid-bound molecules,
         // update their concentration
 		// multiphasic material point data
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-		FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-		FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+		FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+		FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
         
         double phi0 = ppt.m_phi0;
         int nsbm = SBMs();
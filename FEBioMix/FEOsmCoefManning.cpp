@@ -127,10 +127,10 @@ double FEOsmCoefManning::Tangent_OsmoticCoefficient_Concentration(FEMaterialPoin
 //! Osmotic coefficient
 double FEOsmCoefManning::OsmoticCoefficient_Manning(FEMaterialPoint& mp)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // evaluate X = FCD/co-ion actual concentration
     double ca = 0;
@@ -172,13 +172,13 @@ double FEOsmCoefManning::OsmoticCoefficient_Manning(FEMaterialPoint& mp)
 //! Tangent of osmotic coefficient with respect to strain
 double FEOsmCoefManning::Tangent_OsmoticCoefficient_Strain_Manning(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint& bpt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bfpt = *mp.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint& bpt = *mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bfpt = *mp.GetData<FEBiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     
     // evaluate X = FCD/co-ion actual concentration
@@ -238,10 +238,10 @@ double FEOsmCoefManning::Tangent_OsmoticCoefficient_Strain_Manning(FEMaterialPoi
 //! Tangent of osmotic coefficient with respect to concentration
 double FEOsmCoefManning::Tangent_OsmoticCoefficient_Concentration_Manning(FEMaterialPoint &mp, const int isol)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // evaluate X = FCD/co-ion actual concentration
     double ca = 0;
@@ -300,10 +300,10 @@ double FEOsmCoefManning::Tangent_OsmoticCoefficient_Concentration_Manning(FEMate
 //! Osmotic coefficient
 double FEOsmCoefManning::OsmoticCoefficient_Wells(FEMaterialPoint& mp)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double ca = 0;
     if (m_pMP)
@@ -333,10 +333,10 @@ double FEOsmCoefManning::OsmoticCoefficient_Wells(FEMaterialPoint& mp)
 //! Tangent of osmotic coefficient with respect to strain
 double FEOsmCoefManning::Tangent_OsmoticCoefficient_Strain_Wells(FEMaterialPoint &mp)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double f = 0;
     double ca = 0;
@@ -370,10 +370,10 @@ double FEOsmCoefManning::Tangent_OsmoticCoefficient_Strain_Wells(FEMaterialPoint
 //! Tangent of osmotic coefficient with respect to concentration
 double FEOsmCoefManning::Tangent_OsmoticCoefficient_Concentration_Wells(FEMaterialPoint &mp, const int isol)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double ca = 0;
     double f = 0;
@@ -47,9 +47,9 @@ FEPermExpIso::FEPermExpIso(FEModel* pfem) : FEHydraulicPermeability(pfem)
 //! Permeability tensor.
 mat3ds FEPermExpIso::Permeability(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint* pt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint* pt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
     
     // relative volume
     double J = et.m_J;
@@ -70,9 +70,9 @@ mat3ds FEPermExpIso::Permeability(FEMaterialPoint& mp)
 //! Tangent of permeability
 tens4dmm FEPermExpIso::Tangent_Permeability_Strain(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint* pt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint* pt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
     
     // relative volume
     double J = et.m_J;
@@ -48,9 +48,9 @@ FEPermHolmesMow::FEPermHolmesMow(FEModel* pfem) : FEHydraulicPermeability(pfem)
 //! Permeability tensor.
 mat3ds FEPermHolmesMow::Permeability(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint* pt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint* pt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
     
 	// relative volume
 	double J = et.m_J;
@@ -70,9 +70,9 @@ mat3ds FEPermHolmesMow::Permeability(FEMaterialPoint& mp)
 //! Tangent of permeability
 tens4dmm FEPermHolmesMow::Tangent_Permeability_Strain(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint* pt = mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint* bpt = mp.ExtractData<FEBiphasicFSIMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint* pt = mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint* bpt = mp.GetData<FEBiphasicFSIMaterialPoint>();
 	
 	// relative volume
 	double J = et.m_J;
@@ -67,8 +67,8 @@ bool FEPermRefIso::Validate()
 //! Permeability tensor.
 mat3ds FEPermRefIso::Permeability(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -96,8 +96,8 @@ mat3ds FEPermRefIso::Permeability(FEMaterialPoint& mp)
 //! Tangent of permeability
 tens4dmm FEPermRefIso::Tangent_Permeability_Strain(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
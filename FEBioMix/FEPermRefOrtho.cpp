@@ -64,8 +64,8 @@ mat3ds FEPermRefOrtho::Permeability(FEMaterialPoint& mp)
 	vec3d V;			// orthonormal material directions in reference configuration
 	mat3ds m[3];		// texture tensor in current configuration
 	
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -120,8 +120,8 @@ tens4dmm FEPermRefOrtho::Tangent_Permeability_Strain(FEMaterialPoint &mp)
 	vec3d V;			// orthonormal material directions in reference configuration
 	mat3ds m[3];		// texture tensor in current configuration
 	
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -63,8 +63,8 @@ mat3ds FEPermRefTransIso::Permeability(FEMaterialPoint& mp)
 	vec3d V;			// axial material directions in reference configuration
 	mat3ds m;			// axial texture tensor in current configuration
 	
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
@@ -112,8 +112,8 @@ tens4dmm FEPermRefTransIso::Tangent_Permeability_Strain(FEMaterialPoint &mp)
 	vec3d V;			// axial material directions in reference configuration
 	mat3ds m;			// axial texture tensor in current configuration
 	
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
 	
 	// Identity
 	mat3dd I(1);
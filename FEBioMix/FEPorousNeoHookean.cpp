@@ -42,7 +42,7 @@ END_FECORE_CLASS();
 //-----------------------------------------------------------------------------
 mat3ds FEPorousNeoHookean::Stress(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     double phisr = ReferentialSolidVolumeFraction(mp);
     double phiwr = 1 - phisr;
@@ -69,7 +69,7 @@ mat3ds FEPorousNeoHookean::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FEPorousNeoHookean::Tangent(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     double phisr = ReferentialSolidVolumeFraction(mp);
     double phiwr = 1 - phisr;
@@ -104,7 +104,7 @@ tens4ds FEPorousNeoHookean::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FEPorousNeoHookean::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
     
     double phisr = ReferentialSolidVolumeFraction(mp);
     double phiwr = 1 - phisr;
@@ -127,6 +127,6 @@ double FEPorousNeoHookean::ReferentialSolidVolumeFraction(FEMaterialPoint& mp)
 {
     if (m_phisr < 1) return m_phisr;
     
-    FEBiphasicMaterialPoint& pt = *mp.ExtractData<FEBiphasicMaterialPoint>();
+    FEBiphasicMaterialPoint& pt = *mp.GetData<FEBiphasicMaterialPoint>();
     return pt.m_phi0;
 }
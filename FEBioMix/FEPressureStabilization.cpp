@@ -118,7 +118,7 @@ double FEPressureStabilization::TimeConstant(FESurfaceElement& el, FESurface& s)
             
             // get a material point
             FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-            FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+            FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
             
             // setup the material point
             ept.m_F = mat3dd(1.0);
@@ -130,7 +130,7 @@ double FEPressureStabilization::TimeConstant(FESurfaceElement& el, FESurface& s)
             double Ha = n*(vdotTdotv(n, C, n)*n);
             
             // if this is a poroelastic element, then get the permeability tensor
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
             pt.m_p = 0;
             pt.m_w = vec3d(0,0,0);
             
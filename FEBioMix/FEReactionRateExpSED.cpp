@@ -46,8 +46,8 @@ double FEReactionRateExpSED::ReactionRate(FEMaterialPoint& pt)
     else if (m_pReact->m_pMF)
         phir = m_pReact->m_pMF->SolidReferentialVolumeFraction(pt);
     
-    FERemodelingMaterialPoint& rpt = *(pt.ExtractData<FERemodelingMaterialPoint>());
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
+    FERemodelingMaterialPoint& rpt = *(pt.GetData<FERemodelingMaterialPoint>());
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
     double J = et.m_J;
     double sed = rpt.m_sed;
     double zhat = m_B*exp(sed/m_Psi0)/(J-phir);
@@ -58,10 +58,10 @@ double FEReactionRateExpSED::ReactionRate(FEMaterialPoint& pt)
 //! tangent of reaction rate with strain at material point
 mat3ds FEReactionRateExpSED::Tangent_ReactionRate_Strain(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint& bt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-    FEFluidMaterialPoint& ft = *pt.ExtractData<FEFluidMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint& mt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint& bt = *pt.GetData<FEBiphasicMaterialPoint>();
+    FEFluidMaterialPoint& ft = *pt.GetData<FEFluidMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& mt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double phir = 0;
     double p = 0;
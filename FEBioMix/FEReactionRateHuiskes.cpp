@@ -53,8 +53,8 @@ double FEReactionRateHuiskes::ReactionRate(FEMaterialPoint& pt)
         phir = m_pReact->m_pMF->SolidReferentialVolumeFraction(pt);
     }
 	
-    FERemodelingMaterialPoint& rpt = *(pt.ExtractData<FERemodelingMaterialPoint>());
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
+    FERemodelingMaterialPoint& rpt = *(pt.GetData<FERemodelingMaterialPoint>());
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
     double J = et.m_J;
 	double sed = rpt.m_sed;
 	double zhat = m_B*(sed/rhor - m_psi0)/(J-phir);
@@ -65,10 +65,10 @@ double FEReactionRateHuiskes::ReactionRate(FEMaterialPoint& pt)
 //! tangent of reaction rate with strain at material point
 mat3ds FEReactionRateHuiskes::Tangent_ReactionRate_Strain(FEMaterialPoint& pt)
 {
-    FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint& bt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-    FEFluidMaterialPoint& ft = *pt.ExtractData<FEFluidMaterialPoint>();
-    FEMultiphasicFSIMaterialPoint& mt = *pt.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint& bt = *pt.GetData<FEBiphasicMaterialPoint>();
+    FEFluidMaterialPoint& ft = *pt.GetData<FEFluidMaterialPoint>();
+    FEMultiphasicFSIMaterialPoint& mt = *pt.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double rhor = 0;
     double phir = 0;
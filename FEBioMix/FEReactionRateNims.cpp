@@ -83,7 +83,7 @@ double FEReactionRateNims::ReactionRate(FEMaterialPoint& pt)
     // get the time
 	double t = GetFEModel()->GetTime().currentTime;
     
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     double c = spt.m_ca[m_lid];
     double cmax = max(c,spt.m_crd[m_cmax]);
     
@@ -124,14 +124,14 @@ void FEReactionRateNims::ResetElementData(FEMaterialPoint& mp)
 {
     // store the solute maximum concentration in the optional
     // chemical reaction data vector m_crd in the solutes material point
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
     spt.m_crd.push_back(0);
     m_cmax = (int)spt.m_crd.size() - 1;
 }
 
 void FEReactionRateNims::InitializeElementData(FEMaterialPoint& mp)
 {
-    FESolutesMaterialPoint& pt = *mp.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& pt = *mp.GetData<FESolutesMaterialPoint>();
     double c = pt.m_ca[m_lid];
     double cmax = pt.m_crd[m_cmax];
     if (c > cmax) pt.m_crd[m_cmax] = c;
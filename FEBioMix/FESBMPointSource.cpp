@@ -135,7 +135,7 @@ void FESBMPointSource::Update()
 			for (int i = 0; i < nint; ++i)
 			{
 				FEMaterialPoint& mp = *m_el->GetMaterialPoint(i);
-				FESolutesMaterialPoint& pd = *(mp.ExtractData<FESolutesMaterialPoint>());
+				FESolutesMaterialPoint& pd = *(mp.GetData<FESolutesMaterialPoint>());
 				pd.m_sbmr[sbmid] = std::max(0.0, nint * H[i] * val + pd.m_sbmrp[sbmid]);
 				pd.m_sbmrp[sbmid] = pd.m_sbmr[sbmid];
 			}
@@ -149,7 +149,7 @@ void FESBMPointSource::Update()
 			for (auto iter = possible_ints.begin(); iter != possible_ints.end(); ++iter)
 			{
 				FEMaterialPoint& mp = **iter;
-				FESolutesMaterialPoint& pd = *(mp.ExtractData<FESolutesMaterialPoint>());
+				FESolutesMaterialPoint& pd = *(mp.GetData<FESolutesMaterialPoint>());
 				pd.m_sbmr[sbmid] = std::max(0.0, nint * val / nint_in + pd.m_sbmrp[sbmid]);
 				pd.m_sbmrp[sbmid] = pd.m_sbmr[sbmid];
 			}
@@ -248,7 +248,7 @@ void FESBMPointSource::ResetSBM()
 					for (int k = 0; k < nint; ++k)
 					{
 						FEMaterialPoint* mp = el.GetMaterialPoint(k);
-						FESolutesMaterialPoint& pd = *(mp->ExtractData<FESolutesMaterialPoint>());
+						FESolutesMaterialPoint& pd = *(mp->GetData<FESolutesMaterialPoint>());
 						pd.m_sbmr[sbmid] = 0.0;
 						pd.m_sbmrp[sbmid] = 0.0;
 					}
@@ -85,8 +85,8 @@ bool FESFDSBM::Init()
 //-----------------------------------------------------------------------------
 mat3ds FESFDSBM::Stress(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -212,8 +212,8 @@ mat3ds FESFDSBM::Stress(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 tens4ds FESFDSBM::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
@@ -357,8 +357,8 @@ tens4ds FESFDSBM::Tangent(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FESFDSBM::StrainEnergyDensity(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	// deformation gradient
 	mat3d &F = pt.m_F;
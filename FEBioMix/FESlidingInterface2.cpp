@@ -50,6 +50,7 @@ BEGIN_FECORE_CLASS(FESlidingInterface2, FEContactInterface)
 	ADD_PARAMETER(m_epsp     , "pressure_penalty"   );
 	ADD_PARAMETER(m_bsymm    , "symmetric_stiffness");
 	ADD_PARAMETER(m_srad     , "search_radius"      );
+	ADD_PARAMETER(m_skin     , "search_skin"        );
 	ADD_PARAMETER(m_nsegup   , "seg_up"             );
 	ADD_PARAMETER(m_naugmin  , "minaug"             );
 	ADD_PARAMETER(m_naugmax  , "maxaug"             );
@@ -241,7 +242,7 @@ vec3d FESlidingSurface2::GetContactForceFromElementStress()
         for (int j=0; j<pe->GaussPoints(); ++j) {
             // get a material point
             FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-            FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+            FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
             s += pt.m_s;
         }
         s /= pe->GaussPoints();
@@ -370,7 +371,7 @@ vec3d FESlidingSurface2::GetFluidForceFromElementPressure()
         for (int j=0; j<pe->GaussPoints(); ++j) {
             // get a material point
             FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
             p += pt.m_p;
         }
         p /= pe->GaussPoints();
@@ -480,6 +481,7 @@ FESlidingInterface2::FESlidingInterface2(FEModel* pfem) : FEContactInterface(pfe
 	m_stol = 0.01;
 	m_bsymm = true;
 	m_srad = 1.0;
+	m_skin = 0.0;
 	m_gtol = 0;
 	m_ptol = 0;
 	m_nsegup = 0;
@@ -558,7 +560,7 @@ void FESlidingInterface2::BuildMatrixProfile(FEGlobalMatrix& K)
 
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						int* id = mesh.Node(sn[l]).m_ID;
 						lm[7*l  ] = id[dof_X];
 						lm[7*l+1] = id[dof_Y];
 						lm[7*l+2] = id[dof_Z];
@@ -570,7 +572,7 @@ void FESlidingInterface2::BuildMatrixProfile(FEGlobalMatrix& K)
 
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						int* id = mesh.Node(mn[l]).m_ID;
 						lm[7*(l+nseln)  ] = id[dof_X];
 						lm[7*(l+nseln)+1] = id[dof_Y];
 						lm[7*(l+nseln)+2] = id[dof_Z];
@@ -682,7 +684,7 @@ double FESlidingInterface2::AutoPressurePenalty(FESurfaceElement& el, FESlidingS
 
 	// get a material point
 	FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-	FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+	FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
 
 	// setup the material point
 	ept.m_F = mat3dd(1.0);
@@ -690,7 +692,7 @@ double FESlidingInterface2::AutoPressurePenalty(FESurfaceElement& el, FESlidingS
 	ept.m_s.zero();
 
 	// if this is a poroelastic element, then get the permeability tensor
-	FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+	FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
 	pt.m_p = 0;
 	pt.m_w = vec3d(0,0,0);
 					
@@ -780,6 +782,11 @@ void FESlidingInterface2::ProjectSurface(FESlidingSurface2& ss, FESlidingSurface
 		}
 	}
 
+	// update the contact candidate lists
+	FEContactCandidateList& cl = m_cand[&ss == &m_ss ? 0 : 1];
+	cl.SetSkin(m_skin);
+	cl.Update(ss, ms, m_srad);
+
 	// loop over all integration points
  //   #pragma omp parallel for shared(R, bupseg)
 	for (int i=0; i<ss.Elements(); ++i)
@@ -829,7 +836,7 @@ void FESlidingInterface2::ProjectSurface(FESlidingSurface2& ss, FESlidingSurface
 			}
 
 			// find the intersection point with the secondary surface
-			if (pme == 0 && bupseg) pme = np.Project(r, nu, rs);
+			if (pme == 0 && bupseg) pme = np.Project(r, nu, rs, cl, i, j);
 
 			pt.m_pme = pme;
 			pt.m_nu = nu;
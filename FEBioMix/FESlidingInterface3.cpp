@@ -54,6 +54,7 @@ BEGIN_FECORE_CLASS(FESlidingInterface3, FEContactInterface)
 	ADD_PARAMETER(m_epsc     , "concentration_penalty");
 	ADD_PARAMETER(m_bsymm    , "symmetric_stiffness"  );
 	ADD_PARAMETER(m_srad     , "search_radius"        );
+	ADD_PARAMETER(m_skin     , "search_skin"          );
 	ADD_PARAMETER(m_nsegup   , "seg_up"               );
 	ADD_PARAMETER(m_naugmin  , "minaug"               );
 	ADD_PARAMETER(m_naugmax  , "maxaug"               );
@@ -135,7 +136,7 @@ void FESlidingSurface3::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofX];
@@ -439,6 +440,7 @@ FESlidingInterface3::FESlidingInterface3(FEModel* pfem) : FEContactInterface(pfe
 	m_stol = 0.01;
 	m_bsymm = true;
 	m_srad = 1.0;
+	m_skin = 0.0;
 	m_gtol = 0;
 	m_ptol = 0;
 	m_ctol = 0;
@@ -533,7 +535,7 @@ void FESlidingInterface3::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						int* id = mesh.Node(sn[l]).m_ID;
 						lm[8*l  ] = id[dof_X];
 						lm[8*l+1] = id[dof_Y];
 						lm[8*l+2] = id[dof_Z];
@@ -546,7 +548,7 @@ void FESlidingInterface3::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						int* id = mesh.Node(mn[l]).m_ID;
 						lm[8*(l+nseln)  ] = id[dof_X];
 						lm[8*(l+nseln)+1] = id[dof_Y];
 						lm[8*(l+nseln)+2] = id[dof_Z];
@@ -663,7 +665,7 @@ double FESlidingInterface3::AutoPressurePenalty(FESurfaceElement& el, FESlidingS
 	{
 		// get a material point
 		FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-		FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
 			
 		// setup the material point
 		ept.m_F = mat3dd(1.0);
@@ -671,7 +673,7 @@ double FESlidingInterface3::AutoPressurePenalty(FESurfaceElement& el, FESlidingS
 		ept.m_s.zero();
 			
 		// if this is a poroelastic element, then get the permeability tensor
-		FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+		FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
 		pt.m_p = 0;
 		pt.m_w = vec3d(0,0,0);
 			
@@ -686,7 +688,7 @@ double FESlidingInterface3::AutoPressurePenalty(FESurfaceElement& el, FESlidingS
 	{
 		// get a material point
 		FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-		FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
 			
 		// setup the material point
 		ept.m_F = mat3dd(1.0);
@@ -694,8 +696,8 @@ double FESlidingInterface3::AutoPressurePenalty(FESurfaceElement& el, FESlidingS
 		ept.m_s.zero();
 			
 		// if this is a biphasic-solute element, then get the permeability tensor
-		FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-		FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+		FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+		FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
 		ppt.m_p = 0;
 		ppt.m_w = vec3d(0,0,0);
 		spt.m_c[0] = 0;
@@ -762,7 +764,7 @@ double FESlidingInterface3::AutoConcentrationPenalty(FESurfaceElement& el, FESli
 
 	// get a material point
 	FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-	FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+	FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
 			
 	// setup the material point
 	ept.m_F = mat3dd(1.0);
@@ -770,8 +772,8 @@ double FESlidingInterface3::AutoConcentrationPenalty(FESurfaceElement& el, FESli
 	ept.m_s.zero();
 			
 	// if this is a biphasic-solute element, then get the diffusivity tensor
-	FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-	FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+	FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+	FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
 	ppt.m_p = 0;
 	ppt.m_w = vec3d(0,0,0);
 	spt.m_c[0] = 0;
@@ -865,6 +867,11 @@ void FESlidingInterface3::ProjectSurface(FESlidingSurface3& ss, FESlidingSurface
         }
     }
     
+	// update the contact candidate lists
+	FEContactCandidateList& cl = m_cand[&ss == &m_ss ? 0 : 1];
+	cl.SetSkin(m_skin);
+	cl.Update(ss, ms, m_srad);
+
 	// loop over all integration points
 //    #pragma omp parallel for shared(R, bupseg)
 	for (int i=0; i<ss.Elements(); ++i)
@@ -925,7 +932,7 @@ void FESlidingInterface3::ProjectSurface(FESlidingSurface3& ss, FESlidingSurface
 			}
 			
 			// find the intersection point with the secondary surface
-			if (pme == 0 && bupseg) pme = np.Project(r, nu, rs);
+			if (pme == 0 && bupseg) pme = np.Project(r, nu, rs, cl, i, j);
 			
 			pt.m_pme = pme;
 			pt.m_nu = nu;
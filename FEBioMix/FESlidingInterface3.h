@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "FEBioMech/FEContactInterface.h"
 #include "FEBiphasicContactSurface.h"
+#include <FECore/FEContactCandidateList.h>
 
 //-----------------------------------------------------------------------------
 class FEBIOMIX_API FESlidingSurface3 : public FEBiphasicContactSurface
@@ -179,6 +180,7 @@ protected:
 public:
 	FESlidingSurface3	m_ss;	//!< primary surface
 	FESlidingSurface3	m_ms;	//!< secondary surface
+	FEContactCandidateList	m_cand[2];	//!< contact candidates for both projection directions
 	
 	int				m_knmult;		//!< higher order stiffness multiplier
 	bool			m_btwo_pass;	//!< two-pass flag
@@ -189,6 +191,7 @@ public:
 	double			m_stol;			//!< search tolerance
 	bool			m_bsymm;		//!< use symmetric stiffness components only
 	double			m_srad;			//!< contact search radius
+	double			m_skin;			//!< skin distance of the contact candidate lists (0 = off)
 	int				m_naugmax;		//!< maximum nr of augmentations
 	int				m_naugmin;		//!< minimum nr of augmentations
 	int				m_nsegup;		//!< segment update parameter
@@ -628,7 +628,7 @@ void FESlidingInterfaceBiphasic::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        int* id = mesh.Node(sn[l]).m_ID;
                         lm[7*l  ] = id[dof_X];
                         lm[7*l+1] = id[dof_Y];
                         lm[7*l+2] = id[dof_Z];
@@ -640,7 +640,7 @@ void FESlidingInterfaceBiphasic::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        int* id = mesh.Node(mn[l]).m_ID;
                         lm[7*(l+nseln)  ] = id[dof_X];
                         lm[7*(l+nseln)+1] = id[dof_Y];
                         lm[7*(l+nseln)+2] = id[dof_Z];
@@ -753,7 +753,7 @@ double FESlidingInterfaceBiphasic::AutoPressurePenalty(FESurfaceElement& el, FES
 
     // get a material point
     FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-    FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+    FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
             
     // setup the material point
     ept.m_F = mat3dd(1.0);
@@ -761,7 +761,7 @@ double FESlidingInterfaceBiphasic::AutoPressurePenalty(FESurfaceElement& el, FES
     ept.m_s.zero();
             
     // if this is a poroelastic element, then get the permeability tensor
-    FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+    FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
     pt.m_p = 0;
     pt.m_w = vec3d(0,0,0);
             
@@ -550,7 +550,7 @@ void FESlidingSurfaceBiphasicMixed::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i    ] = id[m_dofX];
@@ -673,7 +673,7 @@ void FESlidingInterfaceBiphasicMixed::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        int* id = mesh.Node(sn[l]).m_ID;
                         lm[7*l  ] = id[dof_X];
                         lm[7*l+1] = id[dof_Y];
                         lm[7*l+2] = id[dof_Z];
@@ -685,7 +685,7 @@ void FESlidingInterfaceBiphasicMixed::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        int* id = mesh.Node(mn[l]).m_ID;
                         lm[7*(l+nseln)  ] = id[dof_X];
                         lm[7*(l+nseln)+1] = id[dof_Y];
                         lm[7*(l+nseln)+2] = id[dof_Z];
@@ -798,7 +798,7 @@ double FESlidingInterfaceBiphasicMixed::AutoPressurePenalty(FESurfaceElement& el
 
     // get a material point
     FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-    FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+    FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
             
     // setup the material point
     ept.m_F = mat3dd(1.0);
@@ -806,7 +806,7 @@ double FESlidingInterfaceBiphasicMixed::AutoPressurePenalty(FESurfaceElement& el
     ept.m_s.zero();
             
     // if this is a poroelastic element, then get the permeability tensor
-    FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+    FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
     pt.m_p = 0;
     pt.m_w = vec3d(0,0,0);
             
@@ -56,6 +56,7 @@ BEGIN_FECORE_CLASS(FESlidingInterfaceMP, FEContactInterface)
 	ADD_PARAMETER(m_epsc     , "concentration_penalty");
 	ADD_PARAMETER(m_bsymm    , "symmetric_stiffness"  );
 	ADD_PARAMETER(m_srad     , "search_radius"        );
+	ADD_PARAMETER(m_skin     , "search_skin"          );
 	ADD_PARAMETER(m_nsegup   , "seg_up"               );
 	ADD_PARAMETER(m_breloc   , "node_reloc"         );
 	ADD_PARAMETER(m_bsmaug   , "smooth_aug"         );
@@ -133,7 +134,7 @@ void FESlidingSurfaceMP::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofX];
@@ -472,6 +473,7 @@ FESlidingInterfaceMP::FESlidingInterfaceMP(FEModel* pfem) : FEContactInterface(p
 	m_stol = 0.01;
 	m_bsymm = true;
 	m_srad = 1.0;
+	m_skin = 0.0;
 	m_gtol = 0;
 	m_ptol = 0;
 	m_ctol = 0;
@@ -606,7 +608,7 @@ void FESlidingInterfaceMP::BuildMatrixProfile(FEGlobalMatrix& K)
                     
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						int* id = mesh.Node(sn[l]).m_ID;
 						lm[ndpn*l  ] = id[dof_X];
 						lm[ndpn*l+1] = id[dof_Y];
 						lm[ndpn*l+2] = id[dof_Z];
@@ -618,7 +620,7 @@ void FESlidingInterfaceMP::BuildMatrixProfile(FEGlobalMatrix& K)
                     
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						int* id = mesh.Node(mn[l]).m_ID;
 						lm[ndpn*(l+nseln)  ] = id[dof_X];
 						lm[ndpn*(l+nseln)+1] = id[dof_Y];
 						lm[ndpn*(l+nseln)+2] = id[dof_Z];
@@ -982,6 +984,11 @@ void FESlidingInterfaceMP::ProjectSurface(FESlidingSurfaceMP& ss, FESlidingSurfa
         }
     }
     
+	// update the contact candidate lists
+	FEContactCandidateList& cl = m_cand[&ss == &m_ss ? 0 : 1];
+	cl.SetSkin(m_skin);
+	cl.Update(ss, ms, m_srad);
+
 	// loop over all integration points
 //    #pragma omp parallel for shared(R, bupseg)
 	for (int i=0; i<ss.Elements(); ++i)
@@ -1040,7 +1047,7 @@ void FESlidingInterfaceMP::ProjectSurface(FESlidingSurfaceMP& ss, FESlidingSurfa
 			}
 			
 			// find the intersection point with the secondary surface
-			if (pme == 0 && bupseg) pme = np.Project(r, nu, rs);
+			if (pme == 0 && bupseg) pme = np.Project(r, nu, rs, cl, i, j);
 			
 			pt.m_pme = pme;
 			pt.m_nu = nu;
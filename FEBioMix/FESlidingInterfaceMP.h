@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEBiphasicContactSurface.h"
 #include "FESolute.h"
 #include <map>
+#include <FECore/FEContactCandidateList.h>
 
 //-----------------------------------------------------------------------------
 class FEBIOMIX_API FESlidingSurfaceMP : public FEBiphasicContactSurface
@@ -192,6 +193,7 @@ protected:
 public:
 	FESlidingSurfaceMP	m_ss;	//!< primary surface
 	FESlidingSurfaceMP	m_ms;	//!< secondary surface
+	FEContactCandidateList	m_cand[2];	//!< contact candidates for both projection directions
 	
 	int				m_knmult;		//!< higher order stiffness multiplier
 	bool			m_btwo_pass;	//!< two-pass flag
@@ -202,6 +204,7 @@ public:
 	double			m_stol;			//!< search tolerance
 	bool			m_bsymm;		//!< use symmetric stiffness components only
 	double			m_srad;			//!< contact search radius
+	double			m_skin;			//!< skin distance of the contact candidate lists (0 = off)
 	int				m_naugmax;		//!< maximum nr of augmentations
 	int				m_naugmin;		//!< minimum nr of augmentations
 	int				m_nsegup;		//!< segment update parameter
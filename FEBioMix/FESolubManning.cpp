@@ -169,10 +169,10 @@ double FESolubManning::Tangent_Solubility_Concentration_Concentration(FEMaterial
 //! Solubility
 double FESolubManning::Solubility_Manning(FEMaterialPoint& mp)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // evaluate X = FCD/co-ion actual concentration
     double ca = 0;
@@ -221,13 +221,13 @@ double FESolubManning::Solubility_Manning(FEMaterialPoint& mp)
 //! Tangent of solubility with respect to strain
 double FESolubManning::Tangent_Solubility_Strain_Manning(FEMaterialPoint &mp)
 {
-    FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-    FEBiphasicMaterialPoint& bpt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-    FEBiphasicFSIMaterialPoint& bfpt = *mp.ExtractData<FEBiphasicFSIMaterialPoint>();
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+    FEBiphasicMaterialPoint& bpt = *mp.GetData<FEBiphasicMaterialPoint>();
+    FEBiphasicFSIMaterialPoint& bfpt = *mp.GetData<FEBiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // evaluate X = FCD/co-ion actual concentration
     double ca = 0.0;
@@ -296,10 +296,10 @@ double FESolubManning::Tangent_Solubility_Strain_Manning(FEMaterialPoint &mp)
 //! Tangent of solubility with respect to concentration
 double FESolubManning::Tangent_Solubility_Concentration_Manning(FEMaterialPoint &mp, const int isol)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     // evaluate X = FCD/co-ion actual concentration
     double ca = 0;
@@ -367,10 +367,10 @@ double FESolubManning::Tangent_Solubility_Concentration_Manning(FEMaterialPoint
 //-----------------------------------------------------------------------------
 double FESolubManning::Solubility_Wells(FEMaterialPoint& mp)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double ca = 0;
     if (m_pMP)
@@ -400,10 +400,10 @@ double FESolubManning::Solubility_Wells(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FESolubManning::Tangent_Solubility_Strain_Wells(FEMaterialPoint& mp)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double f = 0;
     double ca = 0;
@@ -438,10 +438,10 @@ double FESolubManning::Tangent_Solubility_Strain_Wells(FEMaterialPoint& mp)
 //-----------------------------------------------------------------------------
 double FESolubManning::Tangent_Solubility_Concentration_Wells(FEMaterialPoint& mp, const int isol)
 {
-    FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
-    FEFluidSolutesMaterialPoint& fspt = *mp.ExtractData<FEFluidSolutesMaterialPoint>();
-    FESolutesMaterial::Point& smpt = *mp.ExtractData<FESolutesMaterial::Point>();
-    FEMultiphasicFSIMaterialPoint& mfpt = *mp.ExtractData<FEMultiphasicFSIMaterialPoint>();
+    FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
+    FEFluidSolutesMaterialPoint& fspt = *mp.GetData<FEFluidSolutesMaterialPoint>();
+    FESolutesMaterial::Point& smpt = *mp.GetData<FESolutesMaterial::Point>();
+    FEMultiphasicFSIMaterialPoint& mfpt = *mp.GetData<FEMultiphasicFSIMaterialPoint>();
     
     double ca = 0;
     double f = 0;
@@ -189,7 +189,7 @@ void FESolutePointSource::Update()
 	//	for (int i = 0; i < nint; ++i)
 	//	{
 	//		FEMaterialPoint* mp = m_el->GetMaterialPoint(i);
-	//		FESolutesMaterialPoint& pd = *(mp->ExtractData<FESolutesMaterialPoint>());
+	//		FESolutesMaterialPoint& pd = *(mp->GetData<FESolutesMaterialPoint>());
 	//		// if this point source has not yet been added to the integration points do it then turn off the flag
 	//		if (m_accumulate_ca) {
 	//			pd.m_ca[solid] = std::max(0.0, pd.m_crp[solid] + val); // prevent negative concentrations
@@ -35,6 +35,8 @@ SOFTWARE.*/
 
 class FEBIOMIX_API FESolutesMaterialPoint : public FEMaterialPoint
 {
+	FEMATERIALPOINT_ARENA_ALLOCATION
+
 public:
 	//! Constructor
 	FESolutesMaterialPoint(FEMaterialPoint* ppt) : FEMaterialPoint(ppt) {}
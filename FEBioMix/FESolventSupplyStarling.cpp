@@ -93,8 +93,8 @@ bool FESolventSupplyStarling::SetParameterAttribute(FEParam& p, const char* szat
 //! Solvent supply
 double FESolventSupplyStarling::Supply(FEMaterialPoint& mp)
 {
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint* mpt = mp.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint* mpt = mp.GetData<FESolutesMaterialPoint>();
 
 	// evaluate solvent supply from pressure drop
 	double phiwhat = m_kp*(m_pv - ppt.m_p);
@@ -130,7 +130,7 @@ double FESolventSupplyStarling::Tangent_Supply_Pressure(FEMaterialPoint &mp)
 //! Tangent of solvent supply with respect to concentration
 double FESolventSupplyStarling::Tangent_Supply_Concentration(FEMaterialPoint &mp, const int isol)
 {
-	FESolutesMaterialPoint& mpt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& mpt = *mp.GetData<FESolutesMaterialPoint>();
 	if (isol < mpt.m_nsol) {
 		return -m_qc[isol];
 	}
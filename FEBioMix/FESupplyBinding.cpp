@@ -62,7 +62,7 @@ double FESupplyBinding::Tangent_Supply_Strain(FEMaterialPoint &mp)
 //! Tangent of solute supply with respect to referential concentration
 double FESupplyBinding::Tangent_Supply_Concentration(FEMaterialPoint &mp)
 {
-	FESolutesMaterialPoint& pt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& pt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double crc = pt.m_sbmr[0];
 	double dcrhatdcr = -m_kf*(m_crt - crc);
@@ -74,9 +74,9 @@ double FESupplyBinding::Tangent_Supply_Concentration(FEMaterialPoint &mp)
 //! Receptor-ligand complex supply
 double FESupplyBinding::ReceptorLigandSupply(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double J = et.m_J;
 	double ca = spt.m_ca[0];
@@ -98,9 +98,9 @@ double FESupplyBinding::SupplySS(FEMaterialPoint& mp)
 //! Receptor-ligand concentration at steady-state
 double FESupplyBinding::ReceptorLigandConcentrationSS(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double J = et.m_J;
 	double ca = spt.m_ca[0];
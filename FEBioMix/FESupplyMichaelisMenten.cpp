@@ -50,9 +50,9 @@ FESupplyMichaelisMenten::FESupplyMichaelisMenten(FEModel* pfem) : FESoluteSupply
 //! Solute supply
 double FESupplyMichaelisMenten::Supply(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double J = et.m_J;
 	double ca = spt.m_ca[0];
@@ -74,9 +74,9 @@ double FESupplyMichaelisMenten::Tangent_Supply_Strain(FEMaterialPoint &mp)
 //! Tangent of solute supply with respect to referential concentration
 double FESupplyMichaelisMenten::Tangent_Supply_Concentration(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double J = et.m_J;
 	double ca = spt.m_ca[0];
@@ -63,7 +63,7 @@ double FESupplySynthesisBinding::Tangent_Supply_Strain(FEMaterialPoint &mp)
 //! Tangent of solute supply with respect to referential concentration
 double FESupplySynthesisBinding::Tangent_Supply_Concentration(FEMaterialPoint &mp)
 {
-	FESolutesMaterialPoint& pt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& pt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double crc = pt.m_sbmr[0];
 	double dcrhatdcr = -m_kf*(m_crt - crc);
@@ -75,9 +75,9 @@ double FESupplySynthesisBinding::Tangent_Supply_Concentration(FEMaterialPoint &m
 //! Receptor-ligand complex supply
 double FESupplySynthesisBinding::ReceptorLigandSupply(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double J = et.m_J;
 	double ca = spt.m_ca[0];
@@ -99,9 +99,9 @@ double FESupplySynthesisBinding::SupplySS(FEMaterialPoint& mp)
 //! Receptor-ligand concentration at steady-state
 double FESupplySynthesisBinding::ReceptorLigandConcentrationSS(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& et = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& et = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	double J = et.m_J;
 	double ca = spt.m_ca[0];
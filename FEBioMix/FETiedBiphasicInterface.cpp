@@ -304,7 +304,7 @@ void FETiedBiphasicInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						int* id = mesh.Node(sn[l]).m_ID;
 						lm[7*l  ] = id[dof_X];
 						lm[7*l+1] = id[dof_Y];
 						lm[7*l+2] = id[dof_Z];
@@ -316,7 +316,7 @@ void FETiedBiphasicInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						int* id = mesh.Node(mn[l]).m_ID;
 						lm[7*(l+nseln)  ] = id[dof_X];
 						lm[7*(l+nseln)+1] = id[dof_Y];
 						lm[7*(l+nseln)+2] = id[dof_Z];
@@ -431,7 +431,7 @@ double FETiedBiphasicInterface::AutoPressurePenalty(FESurfaceElement& el, FETied
 
 	// get a material point
 	FEMaterialPoint& mp = *pe->GetMaterialPoint(0);
-	FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
+	FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
 			
 	// setup the material point
 	ept.m_F = mat3dd(1.0);
@@ -439,7 +439,7 @@ double FETiedBiphasicInterface::AutoPressurePenalty(FESurfaceElement& el, FETied
 	ept.m_s.zero();
 			
 	// if this is a poroelastic element, then get the permeability tensor
-	FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
+	FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
 	pt.m_p = 0;
 	pt.m_w = vec3d(0,0,0);
 			
@@ -127,8 +127,8 @@ void FETriphasic::Serialize(DumpStream& ar)
 //! Porosity in current configuration
 double FETriphasic::Porosity(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pet = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pet = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	// relative volume
 	double J = et.m_J;
@@ -147,8 +147,8 @@ double FETriphasic::Porosity(FEMaterialPoint& pt)
 //! Fixed charge density in current configuration
 double FETriphasic::FixedChargeDensity(FEMaterialPoint& pt)
 {
-	FEElasticMaterialPoint& et = *pt.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& pet = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEElasticMaterialPoint& et = *pt.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& pet = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	// relative volume
 	double J = et.m_J;
@@ -165,7 +165,7 @@ double FETriphasic::ElectricPotential(FEMaterialPoint& pt, const bool eform)
 	int i, j;
 	
 	// Solve electroneutrality polynomial for zeta
-	FESolutesMaterialPoint& set = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& set = *pt.GetData<FESolutesMaterialPoint>();
 	const int nsol = 2;
 	double cF = FixedChargeDensity(pt);
 	double c[2];		// effective concentration
@@ -207,7 +207,7 @@ double FETriphasic::ElectricPotential(FEMaterialPoint& pt, const bool eform)
 //! actual concentration
 double FETriphasic::Concentration(FEMaterialPoint& pt, const int ion)
 {
-    FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+    FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
     
     // effective concentration
     double c = spt.m_c[ion];
@@ -250,9 +250,9 @@ mat3ds FETriphasic::Stress(FEMaterialPoint& mp)
 
 tens4ds FETriphasic::Tangent(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& ept = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEBiphasicMaterialPoint& ppt = *mp.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	FEElasticMaterialPoint& ept = *mp.GetData<FEElasticMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *mp.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *mp.GetData<FESolutesMaterialPoint>();
 	
 	// call solid tangent routine
 	tens4ds C = m_pSolid->Tangent(mp);
@@ -325,8 +325,8 @@ tens4ds FETriphasic::Tangent(FEMaterialPoint& mp)
 
 vec3d FETriphasic::FluidFlux(FEMaterialPoint& pt)
 {
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// fluid volume fraction (porosity) in current configuration
 	double phiw = Porosity(pt);
@@ -386,7 +386,7 @@ vec3d FETriphasic::FluidFlux(FEMaterialPoint& pt)
 
 vec3d FETriphasic::SoluteFlux(FEMaterialPoint& pt, const int ion)
 {
-	FESolutesMaterialPoint& spt = *pt.ExtractData<FESolutesMaterialPoint>();
+	FESolutesMaterialPoint& spt = *pt.GetData<FESolutesMaterialPoint>();
 	
 	// fluid volume fraction (porosity) in current configuration
 	double phiw = Porosity(pt);
@@ -423,7 +423,7 @@ vec3d FETriphasic::SoluteFlux(FEMaterialPoint& pt, const int ion)
 //! actual fluid pressure
 double FETriphasic::Pressure(FEMaterialPoint& pt)
 {
-	FEBiphasicMaterialPoint& ppt = *pt.ExtractData<FEBiphasicMaterialPoint>();
+	FEBiphasicMaterialPoint& ppt = *pt.GetData<FEBiphasicMaterialPoint>();
 	
 	// effective pressure
 	double p = ppt.m_p;
@@ -480,9 +480,9 @@ void FETriphasic::PartitionCoefficientFunctions(FEMaterialPoint& mp, vector<doub
 {
     int isol, jsol, ksol;
     
-    FEElasticMaterialPoint& ept = *(mp.ExtractData<FEElasticMaterialPoint>());
-    FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-    FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+    FEElasticMaterialPoint& ept = *(mp.GetData<FEElasticMaterialPoint>());
+    FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+    FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
     
     const int nsol = (int)m_pSolute.size();
     
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include "FECore/DOFS.h"
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEElementWorkspace.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
@@ -84,7 +85,7 @@ void FETriphasicDomain::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 		FENode& node = m_pMesh->Node(n);
 
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 
 		// first the displacement dofs
 		lm[6*i  ] = id[m_dofU[0]];
@@ -164,9 +165,9 @@ void FETriphasicDomain::Activate()
 		for (int n = 0; n<nint; ++n)
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-			FEElasticMaterialPoint& pm = *(mp.ExtractData<FEElasticMaterialPoint>());
-			FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-			FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+			FEElasticMaterialPoint& pm = *(mp.GetData<FEElasticMaterialPoint>());
+			FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+			FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
 
 			// initialize referential solid volume fraction
 			pt.m_phi0 = pmb->m_phi0(mp);
@@ -217,8 +218,8 @@ void FETriphasicDomain::Reset()
 	// loop over all material points
 	ForEachMaterialPoint([=](FEMaterialPoint& mp) 
 	{
-		FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-		FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+		FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+		FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
 			
 		// initialize referential solid volume fraction
 		pt.m_phi0 = pmb->m_phi0(mp);
@@ -265,9 +266,9 @@ void FETriphasicDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
             p = el.Evaluate(pn, j);
 
 			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			FEElasticMaterialPoint& pe = *mp.ExtractData<FEElasticMaterialPoint>();
-            FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-            FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+			FEElasticMaterialPoint& pe = *mp.GetData<FEElasticMaterialPoint>();
+            FEBiphasicMaterialPoint& pt = *(mp.GetData<FEBiphasicMaterialPoint>());
+            FESolutesMaterialPoint& ps = *(mp.GetData<FESolutesMaterialPoint>());
             
             pe.m_r0 = r0;
 			pe.m_rt = rt;
@@ -300,8 +301,9 @@ void FETriphasicDomain::InternalForces(FEGlobalVector& R)
 	for (int i=0; i<NE; ++i)
 	{
 		// element force vector
-		vector<double> fe;
-		vector<int> lm;
+		FEElementWorkspace& ws = ElementWorkspace();
+		vector<double>& fe = ws.ForceVector();
+		vector<int>& lm = ws.LM();
 		
 		// get the element
 		FESolidElement& el = m_Elem[i];
@@ -347,9 +349,9 @@ void FETriphasicDomain::ElementInternalForce(FESolidElement& el, vector<double>&
 	for (n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(el.GetMaterialPoint(n)->ExtractData<FESolutesMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(el.GetMaterialPoint(n)->GetData<FESolutesMaterialPoint>());
         
 		// calculate the jacobian
 		detJt = invjact(el, Ji, n);
@@ -420,8 +422,9 @@ void FETriphasicDomain::InternalForcesSS(FEGlobalVector& R)
     for (int i=0; i<NE; ++i)
     {
         // element force vector
-        vector<double> fe;
-        vector<int> lm;
+        FEElementWorkspace& ws = ElementWorkspace();
+        vector<double>& fe = ws.ForceVector();
+        vector<int>& lm = ws.LM();
         
         // get the element
         FESolidElement& el = m_Elem[i];
@@ -467,9 +470,9 @@ void FETriphasicDomain::ElementInternalForceSS(FESolidElement& el, vector<double
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-        FEBiphasicMaterialPoint& bpt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint& spt = *(el.GetMaterialPoint(n)->ExtractData<FESolutesMaterialPoint>());
+        FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+        FEBiphasicMaterialPoint& bpt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint& spt = *(el.GetMaterialPoint(n)->GetData<FESolutesMaterialPoint>());
         
         // calculate the jacobian
         detJt = invjact(el, Ji, n);
@@ -530,10 +533,11 @@ void FETriphasicDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 
 		// get the lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 		
@@ -563,7 +567,8 @@ void FETriphasicDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
-		FEElementMatrix ke(el);
+		FEElementWorkspace& ws = ElementWorkspace();
+		FEElementMatrix& ke = ws.ElementMatrix(el);
 
 		// allocate stiffness matrix
 		int neln = el.Nodes();
@@ -575,7 +580,7 @@ void FETriphasicDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 		ElementTriphasicStiffnessSS(el, ke, bsymm);
 
 		//  get the lm vector
-		vector<int> lm;
+		vector<int>& lm = ws.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -619,9 +624,9 @@ bool FETriphasicDomain::ElementTriphasicStiffness(FESolidElement& el, matrix& ke
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -923,9 +928,9 @@ bool FETriphasicDomain::ElementTriphasicStiffnessSS(FESolidElement& el, matrix&
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-        FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
-        FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-        FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
+        FEElasticMaterialPoint&  ept = *(mp.GetData<FEElasticMaterialPoint >());
+        FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+        FESolutesMaterialPoint&  spt = *(mp.GetData<FESolutesMaterialPoint >());
         
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
@@ -1247,7 +1252,7 @@ void FETriphasicDomain::UpdateElementStress(int iel)
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 			
 		// material point coordinates
 		// TODO: I'm not entirly happy with this solution
@@ -1259,8 +1264,8 @@ void FETriphasicDomain::UpdateElementStress(int iel)
 		pt.m_J = defgrad(el, pt.m_F, n);
 			
 		// solute-poroelastic data
-		FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
-		FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
+		FEBiphasicMaterialPoint& ppt = *(mp.GetData<FEBiphasicMaterialPoint>());
+		FESolutesMaterialPoint& spt = *(mp.GetData<FESolutesMaterialPoint>());
 			
 		// evaluate fluid pressure at gauss-point
 		ppt.m_p = el.Evaluate(pn, n);
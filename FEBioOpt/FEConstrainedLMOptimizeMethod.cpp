@@ -204,25 +204,27 @@ void FEConstrainedLMOptimizeMethod::ObjFun(vector<double>& x, vector<double>& a,
 		}
 	}
 	
-	// evaluate at a
-	if (opt.FESolve(a) == false) throw FEErrorTermination();
-	opt.GetObjective().Evaluate(y);
+	// evaluate at a and at the perturbed parameters (these solves can run concurrently)
+	vector< vector<double> > A(ma + 1, a);
+	for (int i=0; i<ma; ++i)
+	{
+		double b = opt.GetInputParameter(i)->ScaleFactor();
+		A[i + 1][i] = a[i] + dir[i]*m_fdiff*(b + fabs(a[i]));
+	}
+
+	vector< vector<double> > Y;
+	vector<double> fobj;
+	if (opt.FESolve(A, Y, fobj) == false) throw FEErrorTermination();
+	y = Y[0];
 	m_yopt = y;
 
 	// now calculate the derivatives using forward differences
 	int ndata = (int)x.size();
-	vector<double> a1(a);
-	vector<double> y1(ndata);
 	for (int i=0; i<ma; ++i)
 	{
-		double b = opt.GetInputParameter(i)->ScaleFactor();
-
-		a1[i] = a1[i] + dir[i]*m_fdiff*(b + fabs(a[i]));
-
-		if (opt.FESolve(a1) == false) throw FEErrorTermination();
-		opt.GetObjective().Evaluate(y1);
-		for (int j=0; j<ndata; ++j) dyda[j][i] = (y1[j] - y[j])/(a1[i] - a[i]);
-		a1[i] = a[i];
+		vector<double>& y1 = Y[i + 1];
+		double da = A[i + 1][i] - a[i];
+		for (int j=0; j<ndata; ++j) dyda[j][i] = (y1[j] - y[j])/da;
 	}
 }
 
@@ -196,30 +196,36 @@ void FELMOptimizeMethod::ObjFun(vector<double>& x, vector<double>& a, vector<dou
 		}
 	}
 	
-	// evaluate at a
-	if (opt.FESolve(a) == false) throw FEErrorTermination();
-	
-	opt.GetObjective().Evaluate(y);
-	m_yopt = y;
-
-	// now calculate the derivatives using forward differences
-	int ndata = (int)x.size();
-	vector<double> a1(a);
-	vector<double> y1(ndata);
+	// We need to evaluate at a, and at a perturbed in each of the parameters
+	// for the forward differences. These solves are independent, so we 
+	// pass them all at once, which allows them to run concurrently.
 	int ma = (int)a.size();
+	vector< vector<double> > A(ma + 1, a);
 	for (int i=0; i<ma; ++i)
 	{
 		FEInputParameter& var = *opt.GetInputParameter(i);
 
 		double b = var.ScaleFactor();
 
-		a1[i] = a1[i] + dir*m_fdiff*(fabs(b) + fabs(a[i]));
-		assert(a1[i] != a[i]);
+		A[i + 1][i] = a[i] + dir*m_fdiff*(fabs(b) + fabs(a[i]));
+		assert(A[i + 1][i] != a[i]);
+	}
+
+	vector< vector<double> > Y;
+	vector<double> fobj;
+	if (opt.FESolve(A, Y, fobj) == false) throw FEErrorTermination();
 
-		if (opt.FESolve(a1) == false) throw FEErrorTermination();
-		opt.GetObjective().Evaluate(y1);
-		for (int j=0; j<ndata; ++j) dyda[j][i] = (y1[j] - y[j])/(a1[i] - a[i]);
-		a1[i] = a[i];
+	// the function value at a
+	y = Y[0];
+	m_yopt = y;
+
+	// now calculate the derivatives using forward differences
+	int ndata = (int)x.size();
+	for (int i=0; i<ma; ++i)
+	{
+		vector<double>& y1 = Y[i + 1];
+		double da = A[i + 1][i] - a[i];
+		for (int j=0; j<ndata; ++j) dyda[j][i] = (y1[j] - y[j])/da;
 	}
 }
 
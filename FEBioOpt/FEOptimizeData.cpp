@@ -34,6 +34,12 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FECore/FEAnalysis.h>
 #include <FECore/log.h>
+#include <omp.h>
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#include <errno.h>
+#endif
 //=============================================================================
 
 //-----------------------------------------------------------------------------
@@ -109,6 +115,7 @@ FEOptimizeData::FEOptimizeData(FEModel* fem) : m_fem(fem)
 	m_pTask = 0;
 	m_niter = 0;
 	m_obj = 0;
+	m_bworker = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -213,6 +220,24 @@ bool FEOptimizeData::FESolve(const vector<double>& a)
 	// increase iterator counter
 	m_niter++;
 
+	int nvar = InputParameters();
+	if (nvar != (int)a.size()) return false;
+
+	// report the new values
+	feLog("\n----- Iteration: %d -----\n", m_niter);
+	for (int i = 0; i<nvar; ++i)
+	{
+		FEInputParameter& var = *GetInputParameter(i);
+		string name = var.GetName();
+		feLog("%-15s = %lg\n", name.c_str(), a[i]);
+	}
+
+	return RunModel(a);
+}
+
+//-----------------------------------------------------------------------------
+bool FEOptimizeData::RunModel(const vector<double>& a)
+{
 	// reset objective function data
 	FEObjectiveFunction& obj = GetObjective();
 	obj.Reset();
@@ -226,25 +251,190 @@ bool FEOptimizeData::FESolve(const vector<double>& a)
 		var.SetValue(a[i]);
 	}
 
-	// report the new values
-	feLog("\n----- Iteration: %d -----\n", m_niter);
-	for (int i = 0; i<nvar; ++i)
-	{
-		FEInputParameter& var = *GetInputParameter(i);
-		string name = var.GetName();
-		feLog("%-15s = %lg\n", name.c_str(), var.GetValue());
-	}
-
 	// reset the FEM data
+	// (a worker keeps the log blocked until it exits)
 	FEModel& fem = *GetFEModel();
 	fem.BlockLog();
 	fem.Reset();
-	fem.UnBlockLog();
+	if (m_bworker == false) fem.UnBlockLog();
 
 	// solve the FE problem
 	fem.BlockLog();
 	bool bret = RunTask();
-	fem.UnBlockLog();
+	if (m_bworker == false) fem.UnBlockLog();
 
 	return bret;
 }
+
+//-----------------------------------------------------------------------------
+bool FEOptimizeData::FESolve(const vector< vector<double> >& a, vector< vector<double> >& y, vector<double>& fobj)
+{
+	int N = (int)a.size();
+	y.resize(N);
+	fobj.assign(N, 0.0);
+
+	int nworkers = (m_pSolver ? m_pSolver->m_nworkers : 1);
+#ifndef WIN32
+	if ((nworkers > 1) && (N > 1)) return FESolveForked(a, y, fobj, nworkers);
+#endif
+
+	FEObjectiveFunction& obj = GetObjective();
+	for (int i = 0; i < N; ++i)
+	{
+		if (FESolve(a[i]) == false) return false;
+		fobj[i] = obj.Evaluate(y[i]);
+	}
+	return true;
+}
+
+#ifndef WIN32
+//-----------------------------------------------------------------------------
+static bool write_all(int fd, const void* pd, size_t n)
+{
+	const char* pc = (const char*)pd;
+	while (n > 0)
+	{
+		ssize_t m = write(fd, pc, n);
+		if (m < 0) { if (errno == EINTR) continue; return false; }
+		pc += m; n -= m;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+static bool read_all(int fd, void* pd, size_t n)
+{
+	char* pc = (char*)pd;
+	while (n > 0)
+	{
+		ssize_t m = read(fd, pc, n);
+		if (m < 0) { if (errno == EINTR) continue; return false; }
+		if (m == 0) return false;
+		pc += m; n -= m;
+	}
+	return true;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Each FE solve runs in a child process, which works on its own (copy-on-write) 
+// copy of the model, so the solves are completely independent. The child sends 
+// the objective value and measurement vector back through a pipe. Since the FE 
+// code uses global and static data, this is much safer than running several 
+// models in threads of the same process.
+// The children inherit the open log and data record files of the parent, so they
+// must not write to them. A child blocks the log before it does anything else and
+// drops the data records (the objective function has its own data sources). Plot
+// output is already turned off in Init. Restart dumps, if requested, are written 
+// by every run, so they should not be combined with workers.
+// The parent's model is not updated by the workers. After each batch, the input
+// parameters are set to the last parameter set of the batch, as they would be 
+// after solving the batch serially, but the model's solution state is not. This
+// is fine for the optimizers, since every solve starts with a reset of the model.
+bool FEOptimizeData::FESolveForked(const vector< vector<double> >& a, vector< vector<double> >& y, vector<double>& fobj, int nworkers)
+{
+#ifdef WIN32
+	return false;
+#else
+	FEModel& fem = *GetFEModel();
+	FEObjectiveFunction& obj = GetObjective();
+	int ndata = obj.Measurements();
+	int nvar = InputParameters();
+
+	int N = (int)a.size();
+	for (int n0 = 0; n0 < N; n0 += nworkers)
+	{
+		int n1 = (n0 + nworkers < N ? n0 + nworkers : N);
+
+		// make sure pending output is not written again by the child processes
+		fflush(nullptr);
+
+		// start the workers
+		vector<pid_t> pid(n1 - n0, -1);
+		vector<int> fd(n1 - n0, -1);
+		for (int i = n0; i < n1; ++i)
+		{
+			int p[2];
+			if (pipe(p) != 0) continue;
+
+			pid_t id = fork();
+			if (id == 0)
+			{
+				// this is the worker
+				close(p[0]);
+				m_bworker = true;
+				fem.BlockLog();
+				fem.GetDataStore().Clear();
+
+				// The OpenMP thread pool of the parent does not exist in the child, so
+				// the worker has to run serially. (The workers are the parallelism here.)
+				omp_set_num_threads(1);
+				int ok = 0;
+				double f = 0.0;
+				vector<double> yi(ndata, 0.0);
+				try {
+					if (RunModel(a[i]))
+					{
+						f = obj.Evaluate(yi);
+						ok = 1;
+					}
+				}
+				catch (...) { ok = 0; }
+				yi.resize(ndata, 0.0);
+				write_all(p[1], &ok, sizeof(int));
+				write_all(p[1], &f, sizeof(double));
+				if (ndata > 0) write_all(p[1], &yi[0], ndata * sizeof(double));
+				close(p[1]);
+				_exit(0);
+			}
+
+			close(p[1]);
+			if (id < 0) { close(p[0]); continue; }
+			pid[i - n0] = id;
+			fd[i - n0] = p[0];
+		}
+
+		// collect the results
+		bool bok = true;
+		for (int i = n0; i < n1; ++i)
+		{
+			int ok = 0;
+			y[i].assign(ndata, 0.0);
+			if (fd[i - n0] >= 0)
+			{
+				int f = fd[i - n0];
+				if (read_all(f, &ok, sizeof(int)) == false) ok = 0;
+				if (ok && (read_all(f, &fobj[i], sizeof(double)) == false)) ok = 0;
+				if (ok && (ndata > 0) && (read_all(f, &y[i][0], ndata * sizeof(double)) == false)) ok = 0;
+				close(f);
+				waitpid(pid[i - n0], nullptr, 0);
+			}
+
+			// report the results
+			m_niter++;
+			feLog("\n----- Iteration: %d -----\n", m_niter);
+			for (int j = 0; j < nvar; ++j)
+			{
+				string name = GetInputParameter(j)->GetName();
+				feLog("%-15s = %lg\n", name.c_str(), a[i][j]);
+			}
+
+			// if we could not start a worker, we solve this one here
+			if (fd[i - n0] < 0)
+			{
+				ok = (RunModel(a[i]) ? 1 : 0);
+				if (ok) fobj[i] = obj.Evaluate(y[i]);
+			}
+			else if (ok) feLog("objective value: %lg\n", fobj[i]);
+
+			if (ok == 0) bok = false;
+		}
+		if (bok == false) return false;
+
+		// set the input parameters to the last parameter set of this batch
+		for (int j = 0; j < nvar; ++j) GetInputParameter(j)->SetValue(a[n1 - 1][j]);
+	}
+
+	return true;
+#endif
+}
@@ -144,6 +144,11 @@ public:
 	//! solve the FE problem with a new set of parameters
 	bool FESolve(const vector<double>& a);
 
+	//! Solve the FE problem for several sets of parameters and evaluate the objective
+	//! function for each. The measurement vectors are returned in y and the objective
+	//! values in fobj. Up to the solver's nr of workers solves are run concurrently.
+	bool FESolve(const vector< vector<double> >& a, vector< vector<double> >& y, vector<double>& fobj);
+
 public:
 	// return the number of input parameters
 	int InputParameters() { return (int)m_Var.size(); }
@@ -174,6 +179,13 @@ public:
 
 	bool RunTask();
 
+private:
+	//! set the parameters and solve the FE problem (no output)
+	bool RunModel(const vector<double>& a);
+
+	//! solve a batch of parameter sets in forked worker processes
+	bool FESolveForked(const vector< vector<double> >& a, vector< vector<double> >& y, vector<double>& fobj, int nworkers);
+
 public:
 	int	m_niter;	// nr of minor iterations (i.e. FE solves)
 
@@ -184,6 +196,8 @@ protected:
 
 	FEObjectiveFunction*	m_obj;		//!< the objective function
 
+	bool	m_bworker;	//!< set in forked worker processes, which must not write output
+
 	FEOptimizeMethod*	m_pSolver;
 
 	std::vector<FEInputParameter*>	    m_Var;
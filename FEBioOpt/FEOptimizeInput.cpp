@@ -137,6 +137,13 @@ void FEOptionsSection::Parse(XMLTag& tag)
 						else throw XMLReader::InvalidValue(tag);
 					}
 				}
+				else if (tag == "workers")
+				{
+					int nworkers = 1;
+					tag.value(nworkers);
+					if (nworkers < 1) throw XMLReader::InvalidValue(tag);
+					popt->m_nworkers = nworkers;
+				}
 				else throw XMLReader::InvalidTag(tag);
 			}
 			++tag;
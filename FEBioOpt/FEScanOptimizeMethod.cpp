@@ -54,25 +54,12 @@ bool FEScanOptimizeMethod::Solve(FEOptimizeData* pOpt, vector<double>& amin, vec
 		a[i] = var->MinValue();
 	}
 
-	// loop until done
-	vector<double> y(ma, 0.0);
+	// collect all the points of the scan
+	vector< vector<double> > A;
 	bool bdone = false;
-	double fmin = 0.0;
 	do
 	{
-		// solve the problem with the new input parameters
-		if (opt.FESolve(a) == false) return false;
-
-		// calculate objective function
-		double fobj = obj.Evaluate(y);
-
-		// update minimum
-		if ((fmin == 0.0) || (fobj < fmin))
-		{
-			fmin = fobj;
-			amin = a;
-			ymin = y;
-		}
+		A.push_back(a);
 
 		// update indices
 		for (int i=0; i<ma; ++i)
@@ -86,6 +73,23 @@ bool FEScanOptimizeMethod::Solve(FEOptimizeData* pOpt, vector<double>& amin, vec
 	}
 	while (!bdone);
 
+	// solve the problem for all the points (these solves can run concurrently)
+	vector< vector<double> > Y;
+	vector<double> fobj;
+	if (opt.FESolve(A, Y, fobj) == false) return false;
+
+	// find the minimum
+	double fmin = 0.0;
+	for (size_t n=0; n<A.size(); ++n)
+	{
+		if ((fmin == 0.0) || (fobj[n] < fmin))
+		{
+			fmin = fobj[n];
+			amin = A[n];
+			ymin = Y[n];
+		}
+	}
+
 	// store the optimum data
 	if (minObj) *minObj = fmin;
 
@@ -712,6 +712,12 @@ void FEBioPlotFile::Close()
 	m_ar.Close();
 }
 
+//-----------------------------------------------------------------------------
+void FEBioPlotFile::Flush()
+{
+	m_ar.Wait();
+}
+
 //-----------------------------------------------------------------------------
 bool FEBioPlotFile::Open(const char *szfile)
 {
@@ -724,6 +730,9 @@ bool FEBioPlotFile::Open(const char *szfile)
 	FEPlotDataStore& pltData = fem->GetPlotDataStore();
 	SetCompression(pltData.GetPlotCompression());
 
+	// write states in the background?
+	m_ar.SetAsync(pltData.GetPlotAsync());
+
 	// add plot variables
 	for (int n = 0; n < pltData.PlotVariables(); ++n)
 	{
@@ -786,7 +795,7 @@ bool FEBioPlotFile::WriteRoot(FEModel& fem)
 bool FEBioPlotFile::WriteHeader(FEModel& fem)
 {
 	// setup the header
-	unsigned int nversion = PLT_VERSION;
+	unsigned int nversion = (m_ncompress == PLT_COMPRESS_VARIABLES ? PLT_VERSION_INDEXED : PLT_VERSION);
 
 	// output header
 	m_ar.WriteChunk(PLT_HDR_VERSION, nversion);
@@ -1416,12 +1425,18 @@ void FEBioPlotFile::WriteObject(PlotObject* po)
 }
 
 //-----------------------------------------------------------------------------
+//! Writes a state. The plot data is always evaluated here, on the calling thread,
+//! since the FEPlotData classes are not thread safe (several of them cache data or
+//! do nodal projections). With asynchronous output only the compression and the 
+//! file output of the state are done in the background (see PltArchive::SetAsync).
 bool FEBioPlotFile::Write(float ftime, int flag)
 {
 	FEModel& fem = *GetFEModel();
 
 	// compress these sections if requested
-	m_ar.SetCompression(m_ncompress);
+	// (when the variables are compressed separately, the state itself is not compressed)
+	bool compressVars = (m_ncompress == PLT_COMPRESS_VARIABLES);
+	m_ar.SetCompression(compressVars ? PLT_COMPRESS_NONE : m_ncompress);
 	m_ar.BeginChunk(PLT_STATE);
 	{
 		// state header
@@ -1432,6 +1447,11 @@ bool FEBioPlotFile::Write(float ftime, int flag)
 		}
 		m_ar.EndChunk();
 
+		// the index of the compressed variables
+		// For each variable it stores the section ID, the variable ID, and the offset
+		// (from the start of the state chunk's data) and size of its PLT_STATE_VAR_DATA chunk.
+		if (compressVars) m_ar.WriteIndexChunk(PLT_STATE_INDEX);
+
 		// write the state flags of the mesh
 		m_ar.BeginChunk(PLT_MESH_STATE);
 		{
@@ -1503,6 +1523,16 @@ void FEBioPlotFile::WriteGlobalData(FEModel& fem)
 
 }
 
+//-----------------------------------------------------------------------------
+// start the data chunk of a state variable
+void FEBioPlotFile::BeginVariableData(unsigned int section, unsigned int nid)
+{
+	if (m_ncompress == PLT_COMPRESS_VARIABLES)
+		m_ar.BeginCompressedChunk(PLT_STATE_VAR_DATA, section, nid);
+	else
+		m_ar.BeginChunk(PLT_STATE_VAR_DATA);
+}
+
 //-----------------------------------------------------------------------------
 void FEBioPlotFile::WriteNodeData(FEModel& fem)
 {
@@ -1513,7 +1543,7 @@ void FEBioPlotFile::WriteNodeData(FEModel& fem)
 		{
 			unsigned int nid = i+1;
 			m_ar.WriteChunk(PLT_STATE_VAR_ID, nid);
-			m_ar.BeginChunk(PLT_STATE_VAR_DATA);
+			BeginVariableData(PLT_NODE_DATA, nid);
 			{
 				if (it->m_psave) WriteNodeDataField(fem, it->m_psave);
 			}
@@ -1533,7 +1563,7 @@ void FEBioPlotFile::WriteDomainData(FEModel& fem)
 		{
 			unsigned int nid = i+1;
 			m_ar.WriteChunk(PLT_STATE_VAR_ID, nid);
-			m_ar.BeginChunk(PLT_STATE_VAR_DATA);
+			BeginVariableData(PLT_ELEMENT_DATA, nid);
 			{
 				if (it->m_psave) WriteDomainDataField(fem, it->m_psave);
 			}
@@ -1553,7 +1583,7 @@ void FEBioPlotFile::WriteSurfaceData(FEModel& fem)
 		{
 			unsigned int nid = i+1;
 			m_ar.WriteChunk(PLT_STATE_VAR_ID, nid);
-			m_ar.BeginChunk(PLT_STATE_VAR_DATA);
+			BeginVariableData(PLT_FACE_DATA, nid);
 			{
 				if (it->m_psave) WriteSurfaceDataField(fem, it->m_psave);
 			}
@@ -1724,6 +1754,7 @@ bool FEBioPlotFile::Append(const char *szfile)
 	FEModel* fem = GetFEModel();
 	FEPlotDataStore& pltData = fem->GetPlotDataStore();
 	SetCompression(pltData.GetPlotCompression());
+	m_ar.SetAsync(pltData.GetPlotAsync());
 
 	// add plot variables
 	for (int n = 0; n < pltData.PlotVariables(); ++n)
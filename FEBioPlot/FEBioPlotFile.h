@@ -45,7 +45,20 @@ class FEBioPlotFile : public PlotFile
 {
 public:
 	// file version
-	enum { PLT_VERSION = 0x0031 };
+	// Files that use per-variable compression (PLT_COMPRESS_VARIABLES) have version 
+	// 0x0032, since they contain state index tables and independently compressed
+	// variable data. All other files keep version 0x0031.
+	enum { 
+		PLT_VERSION            = 0x0031,
+		PLT_VERSION_INDEXED    = 0x0032
+	};
+
+	// compression modes
+	enum {
+		PLT_COMPRESS_NONE      = 0,	// no compression
+		PLT_COMPRESS_STATE     = 1,	// each state is compressed as a single stream
+		PLT_COMPRESS_VARIABLES = 2	// each state variable is compressed separately and each state has an index
+	};
 
 	// file tags
 	enum { 
@@ -129,6 +142,7 @@ public:
 				PLT_STATE_HDR_ID		= 0x02010001,
 				PLT_STATE_HDR_TIME		= 0x02010002,
 				PLT_STATE_STATUS        = 0x02010003,	// new in 3.1
+			PLT_STATE_INDEX				= 0x02050000,	// index of the variables (compression mode 2)
 			PLT_STATE_DATA				= 0x02020000,
 				PLT_STATE_VARIABLE		= 0x02020001,
 				PLT_STATE_VAR_ID		= 0x02020002,
@@ -286,6 +300,9 @@ public:
 	//! see if the plot file is valid
 	bool IsValid() const override;
 
+	//! wait until all states are written to file (only needed for asynchronous output)
+	void Flush();
+
 public:
 	//! Add a variable to the dictionary
 	bool AddVariable(FEPlotData* ps, const char* szname);
@@ -348,6 +365,8 @@ protected:
 
 	void WriteMeshState(FEMesh& mesh);
 
+	void BeginVariableData(unsigned int section, unsigned int nid);
+
 protected:
 	bool ReadDictionary();
 	bool ReadDicList();
@@ -29,6 +29,11 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "PltArchive.h"
 #include <assert.h>
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 #ifdef HAVE_ZLIB
 #include "zlib.h"
@@ -45,6 +50,8 @@ FileStream::FileStream()
 	m_buf  = new unsigned char[m_bufsize];
 	m_pout = new unsigned char[m_bufsize];
 	m_ncompress = 0;
+	m_pmem = 0;
+	m_memPos = 0;
 }
 
 FileStream::~FileStream()
@@ -181,21 +188,92 @@ void FileStream::Flush()
 	m_current = 0;
 }
 
+// Flushes the file and asks the OS to commit it to disk.
+void FileStream::Sync()
+{
+	if (m_fp == 0) return;
+	fflush(m_fp);
+#ifdef WIN32
+	_commit(_fileno(m_fp));
+#else
+	fsync(fileno(m_fp));
+#endif
+}
+
 size_t FileStream::read(void* pd, size_t Size, size_t Count)
 {
-	return fread(pd, Size, Count, m_fp);
+	if (m_pmem == 0) return fread(pd, Size, Count, m_fp);
+
+	// read from the memory buffer
+	if (Size == 0) return 0;
+	size_t navail = (m_memPos < m_pmem->size() ? m_pmem->size() - m_memPos : 0);
+	size_t n = (Size*Count <= navail ? Count : navail / Size);
+	if (n > 0) memcpy(pd, &(*m_pmem)[m_memPos], Size*n);
+	m_memPos += Size*n;
+	return n;
 }
 
 long FileStream::tell()
 {
+	if (m_pmem) return (long)m_memPos;
 	return ftell(m_fp);
 }
 
 void FileStream::seek(long noff, int norigin)
 {
-	fseek(m_fp, noff, norigin);
+	if (m_pmem == 0) { fseek(m_fp, noff, norigin); return; }
+
+	long pos = noff;
+	if (norigin == SEEK_CUR) pos += (long)m_memPos;
+	else if (norigin == SEEK_END) pos += (long)m_pmem->size();
+	m_memPos = (pos < 0 ? 0 : (size_t)pos);
 }
 
+void FileStream::BeginMemoryRead(std::vector<unsigned char>& buf)
+{
+	m_pmem = &buf;
+	m_memPos = 0;
+}
+
+void FileStream::EndMemoryRead()
+{
+	m_pmem = 0;
+	m_memPos = 0;
+}
+
+
+//=============================================================================
+// OCompressedBranch
+//=============================================================================
+// Note that this does not use the FileStream's z_stream, so that chunks can be
+// compressed in parallel.
+void OCompressedBranch::Compress()
+{
+	// serialize the children to memory
+	MemStream mem;
+	WriteChildren(&mem);
+	std::vector<unsigned char>& src = mem.Buffer();
+	unsigned int nsize = (unsigned int)src.size();
+
+	// we no longer need the children
+	list<OChunk*>::iterator pc;
+	for (pc = m_child.begin(); pc != m_child.end(); ++pc) delete (*pc);
+	m_child.clear();
+
+	const size_t l = sizeof(unsigned int);
+#ifdef HAVE_ZLIB
+	uLongf nout = compressBound(nsize);
+	m_buf.resize(l + nout);
+	memcpy(&m_buf[0], &nsize, l);
+	int ret = compress(&m_buf[l], &nout, (nsize > 0 ? &src[0] : Z_NULL), nsize);
+	assert(ret == Z_OK);
+	m_buf.resize(l + nout);
+#else
+	m_buf.resize(l + nsize);
+	memcpy(&m_buf[0], &nsize, l);
+	if (nsize > 0) memcpy(&m_buf[l], &src[0], nsize);
+#endif
+}
 
 //=============================================================================
 // PltArchive
@@ -206,7 +284,10 @@ PltArchive::PltArchive()
 	m_fp = 0;
 	m_pRoot = 0;
 	m_pChunk = 0;
+	m_pIndex = 0;
 	m_bSaving = true;
+	m_ncompress = 0;
+	m_bAsync = false;
 }
 
 PltArchive::~PltArchive()
@@ -226,6 +307,9 @@ void PltArchive::Close()
 		m_bend = true;
 	}
 
+	// make sure all data was written
+	Wait();
+
 	// close the file
 	if (m_fp)
 	{
@@ -235,22 +319,73 @@ void PltArchive::Close()
 	}
 }
 
+// The compression level is passed on to the file stream when the tree is written
+// since the file stream may still be in use by the background writer.
 void PltArchive::SetCompression(int n)
 {
-	if (m_fp) m_fp->SetCompression(n);
+	m_ncompress = n;
 }
 
 void PltArchive::Flush()
 {
-	if (m_fp && m_pRoot)
-	{
-		m_fp->BeginStreaming();
-		m_pRoot->Write(m_fp);
-		m_fp->EndStreaming();
-	}
-	delete m_pRoot;
+	// wait for the previous tree to be written, so that we never 
+	// keep more than one completed tree in memory
+	Wait();
+
+	OBranch* root = m_pRoot;
+	OChunkIndex* index = m_pIndex;
 	m_pRoot = 0;
 	m_pChunk = 0;
+	m_pIndex = 0;
+	if (root == 0) return;
+
+	if (m_fp == 0) { delete root; return; }
+
+	if (m_bAsync)
+		m_writer = std::thread(&PltArchive::WriteTree, this, root, index, m_ncompress);
+	else
+		WriteTree(root, index, m_ncompress);
+}
+
+void PltArchive::WriteTree(OBranch* root, OChunkIndex* index, int ncompress)
+{
+	if (index)
+	{
+		// Compress all the independently compressed chunks. On the caller's thread
+		// this is done in parallel. The background writer runs next to the solver's 
+		// OpenMP threads, so it compresses serially instead of starting another team.
+		std::vector<OCompressedBranch*>& chunks = index->Chunks();
+		int N = (int)chunks.size();
+		if (m_bAsync)
+		{
+			for (int i = 0; i < N; ++i) chunks[i]->Compress();
+		}
+		else
+		{
+#pragma omp parallel for schedule(dynamic)
+			for (int i = 0; i < N; ++i) chunks[i]->Compress();
+		}
+
+		// now that the sizes are known, we can find the chunk offsets
+		// (the offsets are measured from the start of the data of the index's parent)
+		index->GetParent()->LocateChildren(0);
+	}
+
+	m_fp->SetCompression(ncompress);
+	m_fp->BeginStreaming();
+	root->Write(m_fp);
+	m_fp->EndStreaming();
+	delete root;
+
+	// EndStreaming flushed the state to the file. In the background, we can afford 
+	// to also commit it to disk, so that a crash of the solver does not leave a 
+	// partially written last state behind.
+	if (m_bAsync) m_fp->Sync();
+}
+
+void PltArchive::Wait()
+{
+	if (m_writer.joinable()) m_writer.join();
 }
 
 bool PltArchive::Create(const char* szfile)
@@ -289,6 +424,23 @@ void PltArchive::BeginChunk(unsigned int id)
 	}
 }
 
+void PltArchive::BeginCompressedChunk(unsigned int id, unsigned int section, unsigned int var)
+{
+	// compressed chunks cannot be the root, and need an index
+	assert(m_pChunk && m_pIndex);
+	OCompressedBranch* pbranch = new OCompressedBranch(id, section, var);
+	m_pChunk->AddChild(pbranch);
+	if (m_pIndex) m_pIndex->Add(pbranch);
+	m_pChunk = pbranch;
+}
+
+void PltArchive::WriteIndexChunk(unsigned int id)
+{
+	assert(m_pChunk && (m_pIndex == 0));
+	m_pIndex = new OChunkIndex(id);
+	m_pChunk->AddChild(m_pIndex);
+}
+
 void PltArchive::EndChunk()
 {
 	if (m_pChunk != m_pRoot)
@@ -345,7 +497,8 @@ int PltArchive::OpenChunk()
 	CHUNK* pc = new CHUNK;
 
 	// read the chunk ID
-	read(pc->id);
+	// (this fails at the end of the file)
+	if (read(pc->id) != IO_OK) { delete pc; return IO_END; }
 
 	// read the chunk size
 	read(pc->nsize);
@@ -397,9 +550,94 @@ void PltArchive::CloseChunk()
 	}
 }
 
+bool PltArchive::ReadIndex(std::vector<INDEX_ENTRY>& index)
+{
+	index.clear();
+	CHUNK* pc = m_Chunk.top();
+	assert(pc);
+	int N = pc->nsize / sizeof(INDEX_ENTRY);
+	if (N*sizeof(INDEX_ENTRY) != pc->nsize) return false;
+	index.resize(N);
+	for (int i = 0; i < N; ++i)
+	{
+		INDEX_ENTRY& e = index[i];
+		if (read(e.section) != IO_OK) return false;
+		if (read(e.var    ) != IO_OK) return false;
+		if (read(e.offset ) != IO_OK) return false;
+		if (read(e.nsize  ) != IO_OK) return false;
+	}
+	return true;
+}
+
+bool PltArchive::SeekChunk(unsigned int offset)
+{
+	if (m_Chunk.empty()) return false;
+	CHUNK* pc = m_Chunk.top();
+	if (offset + 2*sizeof(unsigned int) > pc->nsize) return false;
+	m_fp->seek(pc->lpos + offset, SEEK_SET);
+	m_bend = false;
+	return true;
+}
+
+bool PltArchive::OpenCompressedChunk()
+{
+	CHUNK* pc = m_Chunk.top();
+	assert(pc);
+	const unsigned int l = sizeof(unsigned int);
+	if (pc->nsize < l) return false;
+
+	// read the uncompressed size, followed by the compressed data
+	unsigned int nsize = 0;
+	if (read(nsize) != IO_OK) return false;
+	std::vector<unsigned char> buf(pc->nsize - l);
+	if (!buf.empty() && (m_fp->read(&buf[0], 1, buf.size()) != buf.size())) return false;
+
+	m_mem.resize(nsize);
+#ifdef HAVE_ZLIB
+	uLongf nout = nsize;
+	if (nsize > 0)
+	{
+		int ret = uncompress(&m_mem[0], &nout, (buf.empty() ? Z_NULL : &buf[0]), (uLong)buf.size());
+		if ((ret != Z_OK) || (nout != nsize)) return false;
+	}
+#else
+	if (buf.size() != nsize) return false;
+	if (nsize > 0) memcpy(&m_mem[0], &buf[0], nsize);
+#endif
+
+	// The children are read from memory. A chunk that spans the buffer is added,
+	// so that the end of the children is detected as usual.
+	m_fp->BeginMemoryRead(m_mem);
+	CHUNK* pm = new CHUNK;
+	pm->id = pc->id;
+	pm->lpos = 0;
+	pm->nsize = nsize;
+	m_Chunk.push(pm);
+	m_bend = (nsize == 0);
+
+	return true;
+}
+
+void PltArchive::CloseCompressedChunk()
+{
+	// remove the chunk that spans the buffer, and continue reading from file
+	CHUNK* pm = m_Chunk.top(); m_Chunk.pop();
+	delete pm;
+	m_fp->EndMemoryRead();
+	m_mem.clear();
+	m_bend = false;
+}
+
 unsigned int PltArchive::GetChunkID()
 {
 	CHUNK* pc = m_Chunk.top();
 	assert(pc);
 	return pc->id;
 }
+
+unsigned int PltArchive::GetChunkSize()
+{
+	CHUNK* pc = m_Chunk.top();
+	assert(pc);
+	return pc->nsize;
+}
@@ -35,11 +35,38 @@ SOFTWARE.*/
 #include <list>
 #include <vector>
 #include <stack>
+#include <thread>
 using namespace std;
 
+//-----------------------------------------------------------------------------
+//! base class for the streams the chunks are written to
+class OStream
+{
+public:
+	virtual ~OStream() {}
+	virtual void Write(void* pd, size_t Size, size_t Count) = 0;
+};
+
+//-----------------------------------------------------------------------------
+//! helper class for writing chunks to a memory buffer
+class MemStream : public OStream
+{
+public:
+	void Write(void* pd, size_t Size, size_t Count) override
+	{
+		unsigned char* pc = (unsigned char*)pd;
+		m_buf.insert(m_buf.end(), pc, pc + Size*Count);
+	}
+
+	std::vector<unsigned char>& Buffer() { return m_buf; }
+
+private:
+	std::vector<unsigned char>	m_buf;
+};
+
 //-----------------------------------------------------------------------------
 //! helper class for writing buffered data to file
-class FileStream
+class FileStream : public OStream
 {
 public:
 	FileStream();
@@ -50,15 +77,23 @@ public:
 	bool Append(const char* szfile);
 	void Close();
 
-	void Write(void* pd, size_t Size, size_t Count);
+	void Write(void* pd, size_t Size, size_t Count) override;
 
 	void Flush();
 
+	// flush and commit the file to disk
+	void Sync();
+
 	// \todo temporary reading functions. Needs to be replaced with buffered functions
 	size_t read(void* pd, size_t Size, size_t Count);
 	long tell();
 	void seek(long noff, int norigin);
 
+	// Read from a memory buffer instead of the file, until EndMemoryRead is called.
+	// (This is used for reading chunks that are compressed independently.)
+	void BeginMemoryRead(std::vector<unsigned char>& buf);
+	void EndMemoryRead();
+
 	void BeginStreaming();
 	void EndStreaming();
 
@@ -71,6 +106,9 @@ private:
 	unsigned char*	m_buf;	//!< buffer
 	unsigned char*	m_pout;	//!< temp buffer when writing
 	int		m_ncompress;	//!< compression level
+
+	std::vector<unsigned char>*	m_pmem;	//!< memory buffer that is read from (or null)
+	size_t						m_memPos;	//!< read position in memory buffer
 };
 
 class OBranch;
@@ -78,20 +116,25 @@ class OBranch;
 class OChunk
 {
 public:
-	OChunk(unsigned int nid) { m_nID = nid; m_pParent = 0; }
+	OChunk(unsigned int nid) { m_nID = nid; m_pParent = 0; m_offset = 0; }
 	virtual ~OChunk(){}
 
 	unsigned int GetID() { return m_nID; }
 
-	virtual void Write(FileStream* fp) = 0;
+	virtual void Write(OStream* fp) = 0;
 	virtual int Size() = 0;
 
 	void SetParent(OBranch* pparent) { m_pParent = pparent; }
 	OBranch* GetParent() { return m_pParent; }
 
+	// set the offset of this chunk (and its children) from the start of the data of an ancestor
+	virtual void Locate(unsigned int offset) { m_offset = offset; }
+	unsigned int Offset() const { return m_offset; }
+
 protected:
-	int			m_nID;
-	OBranch*	m_pParent;
+	int				m_nID;
+	OBranch*		m_pParent;
+	unsigned int	m_offset;
 };
 
 class OBranch : public OChunk
@@ -113,23 +156,112 @@ public:
 		return nsize;
 	}
 
-	void Write(FileStream* fp)
+	void Write(OStream* fp)
 	{
 		fp->Write(&m_nID  , sizeof(unsigned int), 1);
 
 		unsigned int nsize = Size();
 		fp->Write(&nsize, sizeof(unsigned int), 1);
 
+		WriteChildren(fp);
+	}
+
+	void Locate(unsigned int offset)
+	{
+		m_offset = offset;
+		LocateChildren(offset + 2*sizeof(unsigned int));
+	}
+
+	// set the offsets of the children, where offset is the position of this chunk's data
+	void LocateChildren(unsigned int offset)
+	{
 		list<OChunk*>::iterator pc;
-		for (pc = m_child.begin(); pc != m_child.end(); ++pc) (*pc)->Write(fp);
+		for (pc = m_child.begin(); pc != m_child.end(); ++pc)
+		{
+			(*pc)->Locate(offset);
+			offset += (*pc)->Size() + 2*sizeof(unsigned int);
+		}
 	}
 
 	void AddChild(OChunk* pc) { m_child.push_back(pc); pc->SetParent(this); }
 
+protected:
+	void WriteChildren(OStream* fp)
+	{
+		list<OChunk*>::iterator pc;
+		for (pc = m_child.begin(); pc != m_child.end(); ++pc) (*pc)->Write(fp);
+	}
+
 protected:
 	list<OChunk*>	m_child;
 };
 
+//-----------------------------------------------------------------------------
+//! A branch whose children are stored as a single, independently compressed block.
+//! The data of the chunk is the uncompressed size (unsigned int) followed by the 
+//! zlib stream of the children. Compress must be called before the chunk is written.
+class OCompressedBranch : public OBranch
+{
+public:
+	OCompressedBranch(unsigned int nid, unsigned int section, unsigned int var) : OBranch(nid), m_section(section), m_var(var) {}
+
+	void Compress();
+
+	int Size() { return (int)m_buf.size(); }
+
+	void Write(OStream* fp)
+	{
+		fp->Write(&m_nID, sizeof(unsigned int), 1);
+		unsigned int nsize = Size();
+		fp->Write(&nsize, sizeof(unsigned int), 1);
+		if (nsize > 0) fp->Write(&m_buf[0], 1, nsize);
+	}
+
+	// the children are not located, since they are not directly accessible in the file
+	void Locate(unsigned int offset) { m_offset = offset; }
+
+	unsigned int Section() const { return m_section; }
+	unsigned int Variable() const { return m_var; }
+
+private:
+	unsigned int	m_section;	// user defined keys that identify this chunk in the index
+	unsigned int	m_var;
+	std::vector<unsigned char>	m_buf;
+};
+
+//-----------------------------------------------------------------------------
+//! Index table of the compressed chunks of a tree. For each compressed chunk it 
+//! stores the section and variable keys, and the offset and size of the chunk, 
+//! where the offset of the chunk's header is measured from the start of the data of 
+//! the chunk that contains the index.
+class OChunkIndex : public OChunk
+{
+public:
+	OChunkIndex(unsigned int nid) : OChunk(nid) {}
+
+	void Add(OCompressedBranch* pc) { m_chunk.push_back(pc); }
+
+	int Size() { return (int)(4 * sizeof(unsigned int) * m_chunk.size()); }
+
+	void Write(OStream* fp)
+	{
+		fp->Write(&m_nID, sizeof(unsigned int), 1);
+		unsigned int nsize = Size();
+		fp->Write(&nsize, sizeof(unsigned int), 1);
+		for (size_t i = 0; i < m_chunk.size(); ++i)
+		{
+			OCompressedBranch* pc = m_chunk[i];
+			unsigned int d[4] = { pc->Section(), pc->Variable(), pc->Offset(), (unsigned int) pc->Size() };
+			fp->Write(d, sizeof(unsigned int), 4);
+		}
+	}
+
+	std::vector<OCompressedBranch*>& Chunks() { return m_chunk; }
+
+private:
+	std::vector<OCompressedBranch*>	m_chunk;
+};
+
 template <typename T>
 class OLeaf : public OChunk
 {
@@ -138,7 +270,7 @@ public:
 
 	int Size() { return sizeof(T); }
 
-	void Write(FileStream* fp)
+	void Write(OStream* fp)
 	{
 		fp->Write(&m_nID  , sizeof(unsigned int), 1);
 		unsigned int nsize = sizeof(T);
@@ -164,7 +296,7 @@ public:
 	~OLeaf() { delete m_pd; }
 
 	int Size() { return sizeof(T)*m_nsize; }
-	void Write(FileStream* fp)
+	void Write(OStream* fp)
 	{
 		fp->Write(&m_nID , sizeof(unsigned int), 1);
 		unsigned int nsize = Size();
@@ -190,7 +322,7 @@ public:
 	~OLeaf() { delete m_psz; }
 
 	int Size() { return (int)strlen(m_psz)+sizeof(int); }
-	void Write(FileStream* fp)
+	void Write(OStream* fp)
 	{
 		fp->Write(&m_nID , sizeof(unsigned int), 1);
 		unsigned int nsize = Size();
@@ -218,7 +350,7 @@ public:
 	~OLeaf() { delete m_pd; }
 
 	int Size() { return sizeof(T)*m_nsize; }
-	void Write(FileStream* fp)
+	void Write(OStream* fp)
 	{
 		fp->Write(&m_nID , sizeof(unsigned int), 1);
 		unsigned int nsize = Size();
@@ -257,6 +389,17 @@ public:
 	// flush data to file
 	void Flush();
 
+	// Turn on asynchronous writing. When a root chunk is completed, its chunk tree
+	// is compressed and written to file by a background thread, so the caller can 
+	// continue. At most one tree is being written while the next one is built.
+	// Note that this is an asynchronous write only: the data itself is still 
+	// evaluated by the caller (see FEBioPlotFile::Write). Each state is flushed and
+	// committed to disk by the writer when it is done.
+	void SetAsync(bool b) { m_bAsync = b; }
+
+	// wait until the background writer has finished
+	void Wait();
+
 public:
 	// --- Writing ---
 
@@ -266,6 +409,14 @@ public:
 	// begin a chunk
 	void BeginChunk(unsigned int id);
 
+	// begin a chunk whose data is compressed independently of the rest of the file.
+	// The section and var keys identify the chunk in the index table.
+	void BeginCompressedChunk(unsigned int id, unsigned int section, unsigned int var);
+
+	// Add an index table of the compressed chunks that follow to the current chunk.
+	// (Only one index per root chunk is supported.)
+	void WriteIndexChunk(unsigned int id);
+
 	// end a chunck
 	void EndChunk();
 
@@ -314,9 +465,34 @@ public:
 	// Get the current chunk ID
 	unsigned int GetChunkID();
 
+	// Get the size of the current chunk's data
+	unsigned int GetChunkSize();
+
 	// Close a chunk
 	void CloseChunk();
 
+	// An entry of a chunk index table (see WriteIndexChunk)
+	struct INDEX_ENTRY
+	{
+		unsigned int	section;	// section key
+		unsigned int	var;		// variable key
+		unsigned int	offset;		// offset of the chunk from the start of the data of the chunk containing the index
+		unsigned int	nsize;		// size of the chunk's data
+	};
+
+	// read the entries of the current chunk, which must be an index table
+	bool ReadIndex(std::vector<INDEX_ENTRY>& index);
+
+	// Move to the chunk at the offset of an index entry. The current chunk must be the
+	// one that contains the index. The chunk can then be opened with OpenChunk.
+	bool SeekChunk(unsigned int offset);
+
+	// Decompress the current chunk, which must have been written with BeginCompressedChunk.
+	// Its child chunks can then be read with OpenChunk/CloseChunk as usual, until
+	// CloseCompressedChunk is called. The chunk itself is then closed with CloseChunk.
+	bool OpenCompressedChunk();
+	void CloseCompressedChunk();
+
 	// input functions
 	IOResult read(char&   c) { size_t nr = m_fp->read(&c, sizeof(char  ), 1); if (nr != 1) return IO_ERROR; return IO_OK; }
 	IOResult read(int&    n) { size_t nr = m_fp->read(&n, sizeof(int   ), 1); if (nr != 1) return IO_ERROR; return IO_OK; }
@@ -346,15 +522,24 @@ public:
 
 	bool IsValid() const { return (m_fp != 0); }
 
+protected:
+	// write a chunk tree to file and delete it
+	void WriteTree(OBranch* root, OChunkIndex* index, int ncompress);
+
 protected:
 	FileStream*	m_fp;		// pointer to file stream
 	bool		m_bSaving;	// read or write mode?
+	int			m_ncompress;	// compression level for the next tree
+	bool		m_bAsync;	// write trees in a background thread
+	std::thread	m_writer;	// the background writer
 
 	// write data
 	OBranch*	m_pRoot;	// chunk tree root
 	OBranch*	m_pChunk;	// current chunk
+	OChunkIndex*	m_pIndex;	// index of compressed chunks of current tree
 
 	// read data
 	bool			m_bend;		// chunk end flag
 	stack<CHUNK*>	m_Chunk;
+	std::vector<unsigned char>	m_mem;	// decompressed data of the current compressed chunk
 };
@@ -37,7 +37,7 @@ class FEMicro2OG
 public:
 	tens3drs operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint2O& pt2O = *(mp.ExtractData<FEElasticMaterialPoint2O>());
+		const FEElasticMaterialPoint2O& pt2O = *(mp.GetData<FEElasticMaterialPoint2O>());
 		return pt2O.m_G;
 	}
 };
@@ -62,7 +62,7 @@ public:
 	mat3d operator()(const FEMaterialPoint& mp)
 	{
 		FEMaterialPoint& mp_noconst = const_cast<FEMaterialPoint&>(mp);
-		FEMicroMaterialPoint* mmppt = mp_noconst.ExtractData<FEMicroMaterialPoint>();
+		FEMicroMaterialPoint* mmppt = mp_noconst.GetData<FEMicroMaterialPoint>();
 		return m_mat->AveragedStressPK1(mmppt->m_rve, mp_noconst);
 	}
 
@@ -76,7 +76,7 @@ public:
 	mat3d operator()(const FEMaterialPoint& mp)
 	{
 		FEMaterialPoint& mp_noconst = const_cast<FEMaterialPoint&>(mp);
-		FEMicroMaterialPoint2O* mmppt = mp_noconst.ExtractData<FEMicroMaterialPoint2O>();
+		FEMicroMaterialPoint2O* mmppt = mp_noconst.GetData<FEMicroMaterialPoint2O>();
 		return mmppt->m_rve.AveragedStressPK1(mp_noconst);
 	}
 };
@@ -109,7 +109,7 @@ class FEMicro2OQK1
 public:
 	tens3drs operator()(const FEMaterialPoint& mp)
 	{
-		const FEElasticMaterialPoint2O& pt2O = *(mp.ExtractData<FEElasticMaterialPoint2O>());
+		const FEElasticMaterialPoint2O& pt2O = *(mp.GetData<FEElasticMaterialPoint2O>());
 		return pt2O.m_Q;
 	}
 };
@@ -133,7 +133,7 @@ bool FEPlotElementMicroEnergy::Save(FEDomain& dom, FEDataStream& a)
 	if (pm1O)
 	{
 		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
-			const FEMicroMaterialPoint& mmpt = *(mp.ExtractData<FEMicroMaterialPoint>());
+			const FEMicroMaterialPoint& mmpt = *(mp.GetData<FEMicroMaterialPoint>());
 			return mmpt.m_micro_energy;
 			});
 		return true;
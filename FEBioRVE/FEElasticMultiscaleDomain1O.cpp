@@ -61,8 +61,8 @@ bool FEElasticMultiscaleDomain1O::Init()
 		for (int j=0; j<nint; ++j) 
 		{
 			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-			FEMicroMaterialPoint& mmpt = *mp.ExtractData<FEMicroMaterialPoint>();
+			FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+			FEMicroMaterialPoint& mmpt = *mp.GetData<FEMicroMaterialPoint>();
 
 			// create the material point RVEs
 			mmpt.m_F_prev = pt.m_F;	// TODO: I think I can remove this line
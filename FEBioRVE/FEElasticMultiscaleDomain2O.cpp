@@ -75,8 +75,8 @@ bool FEElasticMultiscaleDomain2O::Init()
 			rt = el.Evaluate(xt, j);
 
 			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-			FEMicroMaterialPoint2O& mmpt2O = *mp.ExtractData<FEMicroMaterialPoint2O>();
+			FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+			FEMicroMaterialPoint2O& mmpt2O = *mp.GetData<FEMicroMaterialPoint2O>();
 			mmpt2O.m_elem_id = el.GetID();
 			mmpt2O.m_gpt_id = j;
 
@@ -98,7 +98,7 @@ bool FEElasticMultiscaleDomain2O::Init()
 			for (int k=0; k<2; ++k)
 			{
 				FEMaterialPoint& mp = *m_surf.GetData(nnf).m_pt[k];
-				FEMicroMaterialPoint2O& mmpt2O = *mp.ExtractData<FEMicroMaterialPoint2O>();
+				FEMicroMaterialPoint2O& mmpt2O = *mp.GetData<FEMicroMaterialPoint2O>();
 				mmpt2O.m_elem_id = -i-1;
 				mmpt2O.m_gpt_id = n + k*nint;
 
@@ -125,7 +125,7 @@ bool FEElasticMultiscaleDomain2O::Init()
 			if ((ngp>=0)&&(ngp<nint))
 			{
 				FEMaterialPoint& mp = *pel->GetMaterialPoint(ngp);
-				FEMicroMaterialPoint2O& mmpt = *mp.ExtractData<FEMicroMaterialPoint2O>();
+				FEMicroMaterialPoint2O& mmpt = *mp.GetData<FEMicroMaterialPoint2O>();
 				FERVEProbe* prve = new FERVEProbe(fem, mmpt.m_rve, p.m_szfile.c_str());
 				p.m_probe = prve;
 				prve->SetDebugFlag(p.m_bdebug);
@@ -159,7 +159,7 @@ bool FEElasticMultiscaleDomain2O::Init()
 			nnf += gpt;
 
 			FEMaterialPoint& mp = *m_surf.GetData(nnf).m_pt[k];
-			FEMicroMaterialPoint2O& mmpt2O = *mp.ExtractData<FEMicroMaterialPoint2O>();
+			FEMicroMaterialPoint2O& mmpt2O = *mp.GetData<FEMicroMaterialPoint2O>();
 			if (mmpt2O.m_elem_id != p.m_neid ) return false;
 			if (mmpt2O.m_gpt_id  != p.m_ngp-1) return false;
 
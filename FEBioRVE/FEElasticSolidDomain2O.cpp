@@ -325,14 +325,14 @@ void FEElasticSolidDomain2O::BuildMatrixProfile(FEGlobalMatrix& M)
 		lm.resize(ndof);
 		for (int i=0; i<nelna; ++i)
 		{
-			vector<int>& id = mesh.Node(ela.m_node[i]).m_ID;
+			int* id = mesh.Node(ela.m_node[i]).m_ID;
 			lm[3*i  ] = id[0];
 			lm[3*i+1] = id[1];
 			lm[3*i+2] = id[2];
 		}
 		for (int i=0; i<nelnb; ++i)
 		{
-			vector<int>& id = mesh.Node(elb.m_node[i]).m_ID;
+			int* id = mesh.Node(elb.m_node[i]).m_ID;
 			lm[3*(nelna+i)  ] = id[0];
 			lm[3*(nelna+i)+1] = id[1];
 			lm[3*(nelna+i)+2] = id[2];
@@ -463,8 +463,8 @@ void FEElasticSolidDomain2O::UpdateInternalSurfaceStresses()
 			for (int k=0; k<2; ++k)
 			{
 				FEMaterialPoint& mp = *data.m_pt[k];
-				FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-				FEElasticMaterialPoint2O& pt2O = *mp.ExtractData<FEElasticMaterialPoint2O>();
+				FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint2O& pt2O = *mp.GetData<FEElasticMaterialPoint2O>();
 
 				vec3d& ksi = data.ksi[k];
 
@@ -537,8 +537,8 @@ void FEElasticSolidDomain2O::UpdateElementStress(int iel, const FETimeInfo& tp)
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
-		FEElasticMaterialPoint2O& pt2O = *(mp.ExtractData<FEElasticMaterialPoint2O>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint2O& pt2O = *(mp.GetData<FEElasticMaterialPoint2O>());
 		
 		// material point coordinates
 		// TODO: I'm not entirly happy with this solution
@@ -929,7 +929,7 @@ void FEElasticSolidDomain2O::ElementInternalForce_PF(FESolidElement& el, vector<
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint& pt = *(mp.ExtractData<FEElasticMaterialPoint>());
+		FEElasticMaterialPoint& pt = *(mp.GetData<FEElasticMaterialPoint>());
 
 		// calculate the jacobian and its derivative
 		// (and multiply by integration weight)
@@ -978,7 +978,7 @@ void FEElasticSolidDomain2O::ElementInternalForce_QG(FESolidElement& el, vector<
 	for (int n=0; n<nint; ++n)
 	{
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-		FEElasticMaterialPoint2O& pt2O = *(mp.ExtractData<FEElasticMaterialPoint2O>());
+		FEElasticMaterialPoint2O& pt2O = *(mp.GetData<FEElasticMaterialPoint2O>());
 
 		// get the higher-order stress
 		const tens3drs& Q = pt2O.m_Q;
@@ -1092,14 +1092,14 @@ void FEElasticSolidDomain2O::StiffnessMatrixDG(FELinearSystem& LS)
 		lm.resize(ndof);
 		for (int i=0; i<nelna; ++i)
 		{
-			vector<int>& id = mesh.Node(ela.m_node[i]).m_ID;
+			int* id = mesh.Node(ela.m_node[i]).m_ID;
 			lm[3*i  ] = id[0];
 			lm[3*i+1] = id[1];
 			lm[3*i+2] = id[2];
 		}
 		for (int i=0; i<nelnb; ++i)
 		{
-			vector<int>& id = mesh.Node(elb.m_node[i]).m_ID;
+			int* id = mesh.Node(elb.m_node[i]).m_ID;
 			lm[3*(nelna+i)  ] = id[0];
 			lm[3*(nelna+i)+1] = id[1];
 			lm[3*(nelna+i)+2] = id[2];
@@ -1756,7 +1756,7 @@ void FEElasticSolidDomain2O::ElementStiffness(const FETimeInfo& tp, int iel, mat
 		// get the material point data
 		// NOTE: deformation gradient and determinant have already been evaluated in the stress routine
 		FEMaterialPoint& mp = *el.GetMaterialPoint(ni);
-		FEElasticMaterialPoint2O& pt2O = *(mp.ExtractData<FEElasticMaterialPoint2O>());
+		FEElasticMaterialPoint2O& pt2O = *(mp.GetData<FEElasticMaterialPoint2O>());
 
 		// get the material tangents
 		tens4d C;
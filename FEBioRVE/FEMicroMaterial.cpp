@@ -60,7 +60,7 @@ void FEMicroMaterialPoint::Init()
 void FEMicroMaterialPoint::Update(const FETimeInfo& timeInfo)
 {
 	FEMaterialPoint::Update(timeInfo);
-	FEElasticMaterialPoint& pt = *ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *GetData<FEElasticMaterialPoint>();
 	m_F_prev = pt.m_F;
 
 	// clear rewind stack so the next rewind won't overwrite current state
@@ -164,8 +164,8 @@ bool FEMicroMaterial::Init()
 mat3ds FEMicroMaterial::Stress(FEMaterialPoint &mp)
 {
 	// get the deformation gradient
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEMicroMaterialPoint& mmpt = *mp.ExtractData<FEMicroMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEMicroMaterialPoint& mmpt = *mp.GetData<FEMicroMaterialPoint>();
 	mat3d F = pt.m_F;
 
 	// calculate the averaged Cauchy stress
@@ -183,7 +183,7 @@ mat3ds FEMicroMaterial::Stress(FEMaterialPoint &mp)
 // is always called prior to the tangent function.
 tens4ds FEMicroMaterial::Tangent(FEMaterialPoint &mp)
 {
-	FEMicroMaterialPoint& mmpt = *mp.ExtractData<FEMicroMaterialPoint>();
+	FEMicroMaterialPoint& mmpt = *mp.GetData<FEMicroMaterialPoint>();
 	return mmpt.m_rve.StiffnessAverage(mp);
 }
 
@@ -206,7 +206,7 @@ double FEMicroMaterial::micro_energy(FEModel& rve)
 			for (int n=0; n<nint; ++n)
 			{
 				FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-				FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 				mat3d& F = pt.m_F;
 				double J = F.det();
@@ -232,7 +232,7 @@ double FEMicroMaterial::micro_energy(FEModel& rve)
 //! Calculate the average stress from the RVE solution.
 mat3d FEMicroMaterial::AveragedStressPK1(FEModel& rve, FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
 	
@@ -296,7 +296,7 @@ mat3d FEMicroMaterial::AveragedStressPK1(FEModel& rve, FEMaterialPoint &mp)
 //! Calculate the average stress from the RVE solution.
 mat3ds FEMicroMaterial::AveragedStressPK2(FEModel& rve, FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
 	mat3d Finv = F.inverse();
@@ -126,9 +126,9 @@ bool FEMicroMaterial2O::Init()
 void FEMicroMaterial2O::Stress(FEMaterialPoint &mp, mat3d& P, tens3drs& Q)
 {
 	// get the deformation gradient and its gradient
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEElasticMaterialPoint2O& pt2 = *mp.ExtractData<FEElasticMaterialPoint2O>();
-	FEMicroMaterialPoint2O& mmpt2O = *mp.ExtractData<FEMicroMaterialPoint2O>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint2O& pt2 = *mp.GetData<FEElasticMaterialPoint2O>();
+	FEMicroMaterialPoint2O& mmpt2O = *mp.GetData<FEMicroMaterialPoint2O>();
 
 	// get the deformation gradient and its gradient
 	const mat3d& F = pt.m_F;
@@ -147,7 +147,7 @@ void FEMicroMaterial2O::Stress(FEMaterialPoint &mp, mat3d& P, tens3drs& Q)
 //-----------------------------------------------------------------------------
 void FEMicroMaterial2O::Tangent(FEMaterialPoint& mp, tens4d& C, tens5d& L, tens5d& H, tens6d& J)
 {
-	FEMicroMaterialPoint2O& mmpt2O = *mp.ExtractData<FEMicroMaterialPoint2O>();
+	FEMicroMaterialPoint2O& mmpt2O = *mp.GetData<FEMicroMaterialPoint2O>();
 	
 	// calculate the averaged stiffness here
 	mmpt2O.m_rve.AveragedStiffness(mp, C, L, H, J);
@@ -53,8 +53,8 @@ FEMindlinElastic2O::FEMindlinElastic2O(FEModel* pfem) : FEElasticMaterial2O(pfem
 //! Calculate PK1 stress and higher order stress Q
 void FEMindlinElastic2O::Stress(FEMaterialPoint& mp, mat3d& P, tens3drs& Q)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEElasticMaterialPoint2O& pt2O = *mp.ExtractData<FEElasticMaterialPoint2O>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint2O& pt2O = *mp.GetData<FEElasticMaterialPoint2O>();
 
 	// deformation gradient and transpose
 	const mat3d& F = pt.m_F;
@@ -99,8 +99,8 @@ void FEMindlinElastic2O::Stress(FEMaterialPoint& mp, mat3d& P, tens3drs& Q)
 //! J = dQ/dG
 void FEMindlinElastic2O::Tangent(FEMaterialPoint& mp, tens4d& C, tens5d& L, tens5d& H, tens6d& J)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-	FEElasticMaterialPoint2O& pt2O = *mp.ExtractData<FEElasticMaterialPoint2O>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint2O& pt2O = *mp.GetData<FEElasticMaterialPoint2O>();
 
 	// deformation gradient and transpose
 	const mat3d& F = pt.m_F;
@@ -220,7 +220,7 @@ void FERVEModel::EvalInitialVolume()
 			double ve = 0;
 			for (int n=0; n<nint; ++n)
 			{
-				FEElasticMaterialPoint& pt = *el.GetMaterialPoint(n)->ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& pt = *el.GetMaterialPoint(n)->GetData<FEElasticMaterialPoint>();
 				double J = dom.detJt(el, n);
 				ve += J*w[n];
 			}
@@ -448,7 +448,7 @@ double FERVEModel::CurrentVolume()
 			for (int n = 0; n<ni; ++n)
 			{
 				FEMaterialPoint& pt = *el.GetMaterialPoint(n);
-				FEElasticMaterialPoint& ep = *pt.ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& ep = *pt.GetData<FEElasticMaterialPoint>();
 
 				// calculate Jacobian
 				double Jn = dom.detJt(el, n);
@@ -511,7 +511,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 			for (int n=0; n<ni; ++n)
 			{
 				FEMaterialPoint& pt = *el.GetMaterialPoint(n);
-				FEElasticMaterialPoint& ep = *pt.ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& ep = *pt.GetData<FEElasticMaterialPoint>();
 
 				// calculate Jacobian
 				double Jn = dom.detJt(el, n);
@@ -522,7 +522,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 		}
 	}
 
-/*	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+/*	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	double J = pt.m_J;
 	double V0 = InitialVolume();
 	return T / (J*V0);
@@ -535,7 +535,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 //! Calculate the stress average
 mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	double J = pt.m_J;
 
 	// get the RVE mesh
@@ -620,7 +620,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 //! Calculate the average stiffness from the RVE solution.
 tens4ds FERVEModel::StiffnessAverage(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the mesh
 	FEMesh& m = GetMesh();
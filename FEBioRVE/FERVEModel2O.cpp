@@ -155,7 +155,7 @@ void FERVEModel2O::EvalInitialVolume()
 			double ve = 0;
 			for (int n=0; n<nint; ++n)
 			{
-				FEElasticMaterialPoint& pt = *el.GetMaterialPoint(n)->ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& pt = *el.GetMaterialPoint(n)->GetData<FEElasticMaterialPoint>();
 				double J = dom.detJ0(el, n);
 				ve += J*w[n];
 			}
@@ -490,7 +490,7 @@ void FEMicroModel2O::UpdateBC(const mat3d& F, const tens3drs& G)
 //! Calculate the average stress from the RVE solution.
 mat3d FEMicroModel2O::AveragedStressPK1(FEMaterialPoint &mp)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
 	
@@ -573,7 +573,7 @@ void FEMicroModel2O::AveragedStress2O(mat3d& Pa, tens3drs& Qa)
 			for (int n = 0; n<ni; ++n)
 			{
 				FEMaterialPoint& pt = *el.GetMaterialPoint(n);
-				FEElasticMaterialPoint& ep = *pt.ExtractData<FEElasticMaterialPoint>();
+				FEElasticMaterialPoint& ep = *pt.GetData<FEElasticMaterialPoint>();
 
 				// calculate Jacobian
 				double Jn = dom.detJt(el, n);
@@ -681,7 +681,7 @@ void FEMicroModel2O::AveragedStress2O(mat3d& Pa, tens3drs& Qa)
 //! Calculate the average stress from the RVE solution.
 void FEMicroModel2O::AveragedStress2OPK1(FEMaterialPoint &mp, mat3d &PK1a, tens3drs &QK1a)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
 
@@ -755,7 +755,7 @@ void FEMicroModel2O::AveragedStress2OPK1(FEMaterialPoint &mp, mat3d &PK1a, tens3
 //! Calculate the average stress from the RVE solution.
 void FEMicroModel2O::AveragedStress2OPK2(FEMaterialPoint &mp, mat3ds &Sa, tens3ds &Ta)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 	mat3d F = pt.m_F;
 	double J = pt.m_J;
 	mat3d Finv = F.inverse();
@@ -836,7 +836,7 @@ void FEMicroModel2O::AveragedStress2OPK2(FEMaterialPoint &mp, mat3ds &Sa, tens3d
 //! Calculate the average stiffness from the RVE solution.
 void FEMicroModel2O::AveragedStiffness(FEMaterialPoint &mp, tens4d& C, tens5d& L, tens5d& H, tens6d& J)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	FEElasticMaterialPoint& pt = *mp.GetData<FEElasticMaterialPoint>();
 
 	// get the mesh
 	FEMesh& m = GetMesh();
@@ -143,7 +143,7 @@ bool FEMicroProbe::Init()
 	if ((m_ngp >= 0) && (m_ngp < nint))
 	{
 		FEMaterialPoint* mp = pel->GetMaterialPoint(m_ngp);
-		FEMicroMaterialPoint* mmp = mp->ExtractData<FEMicroMaterialPoint>();
+		FEMicroMaterialPoint* mmp = mp->GetData<FEMicroMaterialPoint>();
 		if (mmp == nullptr) return false;
 		SetRVEModel(&mmp->m_rve);
 	}
@@ -0,0 +1,207 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "FEPlotFileTest.h"
+#include <FEBioLib/FEBioModel.h>
+#include <FEBioPlot/FEBioPlotFile.h>
+#include <FEBioPlot/PltArchive.h>
+#include <FECore/FEPlotDataStore.h>
+#include <FECore/log.h>
+#include <map>
+
+//-----------------------------------------------------------------------------
+// Read the data of a compressed variable chunk. The ID and size of each region
+// chunk are stored with its data, so the result can be compared word by word.
+static bool ReadVariableData(PltArchive& ar, std::vector<int>& data)
+{
+	data.clear();
+	if (ar.OpenCompressedChunk() == false) return false;
+	while (ar.OpenChunk() == IO_OK)
+	{
+		int nid = (int)ar.GetChunkID();
+		int nsize = (int)ar.GetChunkSize();
+		int n = nsize / sizeof(int);
+		data.push_back(nid);
+		data.push_back(nsize);
+		if (n > 0)
+		{
+			data.resize(data.size() + n);
+			if (ar.read(&data[data.size() - n], n) != IO_OK) { ar.CloseChunk(); ar.CloseCompressedChunk(); return false; }
+		}
+		ar.CloseChunk();
+	}
+	ar.CloseCompressedChunk();
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+FEPlotFileTest::FEPlotFileTest(FEModel* pfem) : FECoreTask(pfem)
+{
+}
+
+//-----------------------------------------------------------------------------
+// initialize the diagnostic
+bool FEPlotFileTest::Init(const char* sz)
+{
+	FEBioModel& fem = dynamic_cast<FEBioModel&>(*GetFEModel());
+
+	// compress each variable separately, so that the states get an index
+	fem.GetPlotDataStore().SetPlotCompression(FEBioPlotFile::PLT_COMPRESS_VARIABLES);
+
+	// do the FE initialization
+	return fem.Init();
+}
+
+//-----------------------------------------------------------------------------
+// run the diagnostic
+bool FEPlotFileTest::Run()
+{
+	FEBioModel* fem = dynamic_cast<FEBioModel*>(GetFEModel());
+
+	// try to run the model
+	if (fem->Solve() == false)
+	{
+		feLogEx(fem, "Failed to run model.\n");
+		return false;
+	}
+
+	// read the plot file back
+	const std::string& splt = fem->GetPlotFileName();
+	PltArchive ar;
+	if (ar.Open(splt.c_str()) == false)
+	{
+		feLogEx(fem, "Failed to open plot file %s.\n", splt.c_str());
+		return false;
+	}
+
+	// loop over the root chunks
+	// (after a root chunk is closed, OpenChunk first returns IO_END once)
+	int nstates = 0;
+	int nret = ar.OpenChunk();
+	if (nret == IO_END) nret = ar.OpenChunk();
+	while (nret == IO_OK)
+	{
+		if (ar.GetChunkID() == FEBioPlotFile::PLT_STATE)
+		{
+			if (CheckState(ar) == false)
+			{
+				feLogEx(fem, "Plot file test failed in state %d.\n", nstates + 1);
+				ar.Close();
+				return false;
+			}
+			nstates++;
+		}
+		ar.CloseChunk();
+
+		nret = ar.OpenChunk();
+		if (nret == IO_END) nret = ar.OpenChunk();
+	}
+	ar.Close();
+
+	if (nstates == 0)
+	{
+		feLogEx(fem, "No states found in plot file.\n");
+		return false;
+	}
+
+	feLogEx(fem, "Plot file test passed: %d states were read through their index.\n", nstates);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Read the variables of the current state in order, and then again by seeking to
+// the offsets in the state's index. The state chunk is left open.
+bool FEPlotFileTest::CheckState(PltArchive& ar)
+{
+	typedef std::pair<unsigned int, unsigned int> VarKey;
+	std::map<VarKey, std::vector<int> > vars;
+	std::vector<PltArchive::INDEX_ENTRY> index;
+	bool bindex = false;
+
+	// read the state in order
+	while (ar.OpenChunk() == IO_OK)
+	{
+		unsigned int nid = ar.GetChunkID();
+		if (nid == FEBioPlotFile::PLT_STATE_INDEX)
+		{
+			if (ar.ReadIndex(index) == false) return false;
+			bindex = true;
+		}
+		else if (nid == FEBioPlotFile::PLT_STATE_DATA)
+		{
+			// loop over the sections (global, node, element, face data)
+			while (ar.OpenChunk() == IO_OK)
+			{
+				unsigned int section = ar.GetChunkID();
+				while (ar.OpenChunk() == IO_OK)
+				{
+					if (ar.GetChunkID() != FEBioPlotFile::PLT_STATE_VARIABLE) return false;
+
+					unsigned int var = 0;
+					while (ar.OpenChunk() == IO_OK)
+					{
+						switch (ar.GetChunkID())
+						{
+						case FEBioPlotFile::PLT_STATE_VAR_ID: ar.read(var); break;
+						case FEBioPlotFile::PLT_STATE_VAR_DATA:
+							if (ReadVariableData(ar, vars[VarKey(section, var)]) == false) return false;
+							break;
+						}
+						ar.CloseChunk();
+					}
+					ar.CloseChunk();
+				}
+				ar.CloseChunk();
+			}
+		}
+		ar.CloseChunk();
+	}
+
+	// every variable must be in the index
+	if ((bindex == false) || (index.size() != vars.size())) return false;
+
+	// read the variables again through the index
+	std::vector<int> data;
+	for (size_t i = 0; i < index.size(); ++i)
+	{
+		PltArchive::INDEX_ENTRY& e = index[i];
+		std::map<VarKey, std::vector<int> >::iterator it = vars.find(VarKey(e.section, e.var));
+		if (it == vars.end()) return false;
+
+		if (ar.SeekChunk(e.offset) == false) return false;
+		if (ar.OpenChunk() != IO_OK) return false;
+		bool bok = (ar.GetChunkID() == FEBioPlotFile::PLT_STATE_VAR_DATA) && (ar.GetChunkSize() == e.nsize);
+		if (bok) bok = ReadVariableData(ar, data);
+		ar.CloseChunk();
+		if ((bok == false) || (data != it->second)) return false;
+	}
+
+	return true;
+}
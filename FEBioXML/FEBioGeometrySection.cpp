@@ -288,7 +288,7 @@ void set_element_fiber(FEElement& el, const vec3d& v, int ncomp)
 	{
 		FEMaterialPoint* mp = (ncomp == -1) ? el.GetMaterialPoint(i) : el.GetMaterialPoint(i)->GetPointData(ncomp);
 
-		FEElasticMaterialPoint& pt = *mp->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp->GetData<FEElasticMaterialPoint>();
 /*		mat3d& m = pt.m_Q;
 		m.zero();
 		m[0][0] = a.x; m[0][1] = b.x; m[0][2] = c.x;
@@ -317,7 +317,7 @@ void set_element_mat_axis(FEElement& el, const vec3d& v1, const vec3d& v2, int n
 	{
         FEMaterialPoint* mp = (ncomp == -1) ? el.GetMaterialPoint(i) : el.GetMaterialPoint(i)->GetPointData(ncomp);
 
-		FEElasticMaterialPoint& pt = *mp->ExtractData<FEElasticMaterialPoint>();
+		FEElasticMaterialPoint& pt = *mp->GetData<FEElasticMaterialPoint>();
 //		pt.m_Q = mat3d(a, b, c);
 	}
 }
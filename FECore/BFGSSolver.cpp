@@ -87,6 +87,7 @@ bool BFGSSolver::Update(double s, vector<double>& ui, vector<double>& R0, vector
 {
 	// calculate the BFGS update vectors
 	int neq = m_neq;
+	#pragma omp parallel for
 	for (int i = 0; i<neq; ++i)
 	{
 		m_D[i] = s*ui[i];
@@ -121,6 +122,7 @@ bool BFGSSolver::Update(double s, vector<double>& ui, vector<double>& R0, vector
 		double* vn = m_V[n];
 		double* wn = m_W[n];
 
+		#pragma omp parallel for
 		for (int i=0; i<neq; ++i)	
 		{
 			vn[i] = -m_H[i]*c - m_G[i];
@@ -165,10 +167,8 @@ void BFGSSolver::SolveEquations(vector<double>& x, vector<double>& b)
 		double* vi = m_V[n];
 		double* wi = m_W[n];
 
-		double wr = 0;
-		for (int j = 0; j<m_neq; j++) wr += wi[j] * tmp[j];
-
-		for (int j = 0; j<m_neq; j++) tmp[j] += vi[j] * wr;
+		double wr = vdot(m_neq, wi, &tmp[0]);
+		vaxpy(m_neq, wr, vi, &tmp[0]);
 	}
 
 	// perform a backsubstitution
@@ -185,9 +185,7 @@ void BFGSSolver::SolveEquations(vector<double>& x, vector<double>& b)
 		double* vi = m_V[n];
 		double* wi = m_W[n];
 
-		double vr = 0;
-		for (int j = 0; j<m_neq; ++j) vr += vi[j] * x[j];
-
-		for (int j = 0; j<m_neq; ++j) x[j] += wi[j] * vr;
+		double vr = vdot(m_neq, vi, &x[0]);
+		vaxpy(m_neq, vr, wi, &x[0]);
 	}
 }
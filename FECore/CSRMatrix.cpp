@@ -46,7 +46,7 @@ void CSRMatrix::create(int nr, int nc, int noffset)
 	m_nr = nr;
 	m_nc = nc;
 	m_offset = noffset;
-	m_rowIndex.resize(nr+1, noffset);
+	m_rowIndex.assign(nr+1, noffset);
 	m_columns.clear();
 	m_values.clear();
 }
@@ -169,26 +169,36 @@ bool CSRMatrix::isAlloc(int i, int j) const
 	return false;
 }
 
-void CSRMatrix::multv(const std::vector<double>& x, std::vector<double>& r)
+void CSRMatrix::multv(const std::vector<double>& x, std::vector<double>& r) const
 {
 	multv(&x[0], &r[0]);
 }
 
-void CSRMatrix::multv(const double* x, double* r)
+void CSRMatrix::multv(const double* x, double* r) const
 {
 	const int nr = rows();
-	const int nc = cols();
+	if (m_values.empty())
+	{
+		for (int i = 0; i < nr; ++i) r[i] = 0.0;
+		return;
+	}
+
+	const int* rowIndex = &m_rowIndex[0];
+	const int* columns = &m_columns[0];
+	const double* values = &m_values[0];
+	const int offset = m_offset;
 
 	// loop over all rows
+	#pragma omp parallel for schedule(static)
 	for (int i = 0; i<nr; ++i)
 	{
-		int col = m_rowIndex[i] - m_offset;
-		int count = m_rowIndex[i + 1] - m_rowIndex[i];
+		int col = rowIndex[i] - offset;
+		int count = rowIndex[i + 1] - rowIndex[i];
 
-		double* pv = &m_values[col];
-		int* pi = &m_columns[col];
+		const double* pv = values + col;
+		const int* pi = columns + col;
 		double ri = 0.0;
-		for (int j = 0; j<count; ++j) ri += pv[j] * x[pi[j] - m_offset];
+		for (int j = 0; j<count; ++j) ri += pv[j] * x[pi[j] - offset];
 		r[i] = ri;
 	}
 }
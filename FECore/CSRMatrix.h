@@ -69,14 +69,21 @@ public:
 
 public:
 	// matrix-vector multiplication: A.x = r
-	void multv(const std::vector<double>& x, std::vector<double>& r);
-	void multv(const double* x, double* r);
+	void multv(const std::vector<double>& x, std::vector<double>& r) const;
+	void multv(const double* x, double* r) const;
 
 public:
 	std::vector<double>& values() { return m_values; }
 	std::vector<int>& indices() { return m_columns; }
 	std::vector<int>& pointers() { return m_rowIndex; }
 
+	const std::vector<double>& values() const { return m_values; }
+	const std::vector<int>& indices() const { return m_columns; }
+	const std::vector<int>& pointers() const { return m_rowIndex; }
+
+	// return the offset
+	int offset() const { return m_offset; }
+
 private:
 	int		m_nr;		// number of rows
 	int		m_nc;		// number of columns
@@ -29,6 +29,11 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "CompactMatrix.h"
 #include <assert.h>
+#include <algorithm>
+#include <omp.h>
+
+// matrices with fewer nonzeroes are multiplied serially
+#define MIN_PARALLEL_NONZEROES	50000
 
 //=============================================================================
 // CompactMatrix
@@ -55,7 +60,9 @@ CompactMatrix::~CompactMatrix()
 //-----------------------------------------------------------------------------
 void CompactMatrix::Zero()
 {
-	memset(m_pd, 0, m_nsize*sizeof(double)); 
+	// This is done in parallel, since the first call after the matrix is allocated 
+	// decides on which NUMA node the memory pages are placed.
+	vfill(m_nsize, m_pd, 0.0);
 }
 
 //-----------------------------------------------------------------------------
@@ -128,3 +135,173 @@ int CompactMatrix::bandWidth()
 
 	return kmax;
 }
+
+//-----------------------------------------------------------------------------
+// This assumes that the indices are ordered.
+int CompactMatrix::find(int p, int i) const
+{
+	const int* pi = m_pindices + (m_ppointers[p] - m_offset);
+	const int* pl = m_pindices + (m_ppointers[p + 1] - m_offset);
+	const int* pn = std::lower_bound(pi, pl, i + m_offset);
+	if ((pn == pl) || (*pn != i + m_offset)) return -1;
+	return (int)(pn - m_pindices);
+}
+
+//-----------------------------------------------------------------------------
+void CompactMatrix::AssembleScatter(const matrix& ke, const std::vector<int>& offsets)
+{
+	const int N = ke.rows();
+	const int M = ke.columns();
+	assert((int)offsets.size() == N*M);
+
+	const int* off = &offsets[0];
+	for (int i = 0; i < N; ++i, off += M)
+	{
+		const double* ki = ke[i];
+		for (int j = 0; j < M; ++j)
+		{
+			int k = off[j];
+			if (k >= 0)
+			{
+				if (m_batomic)
+				{
+					#pragma omp atomic
+					m_pd[k] += ki[j];
+				}
+				else m_pd[k] += ki[j];
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// The offsets only cover the upper triangle of ke (see SparseMatrix). An offset of
+// -k-2 means that entry (i,j) is added twice to entry k, since the lower triangle of
+// ke is not defined.
+void CompactMatrix::AssembleScatterSymmetric(const matrix& ke, const std::vector<int>& offsets)
+{
+	const int N = ke.rows();
+	assert(ke.columns() == N);
+	assert((int)offsets.size() == N*(N + 1) / 2);
+
+	const int* off = &offsets[0];
+	for (int i = 0; i < N; ++i)
+	{
+		const double* ki = ke[i];
+		for (int j = i; j < N; ++j, ++off)
+		{
+			int k = *off;
+			if (k == -1) continue;
+			double v = ki[j];
+			if (k < -1) { k = -k - 2; v += v; }
+			if (m_batomic)
+			{
+				#pragma omp atomic
+				m_pd[k] += v;
+			}
+			else m_pd[k] += v;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// In column-based storage, each column scatters its values to the rows of the
+// result vector, so the threads can't write to the result directly. Instead, the 
+// columns are divided into ranges with roughly the same number of nonzeroes and
+// each thread accumulates into a private buffer that only spans the rows that its
+// columns touch. The buffers are summed afterwards. For the (usually bandwidth
+// reduced) matrices in FE problems, these buffers are much shorter than the matrix.
+bool CompactMatrix::ColumnProduct(const double* x, double* r, bool bsymm)
+{
+	const int N = Rows();
+	const int M = Columns();
+	const int nt = omp_get_max_threads();
+	if ((nt < 2) || (m_nsize < MIN_PARALLEL_NONZEROES)) return false;
+
+	const int off = m_offset;
+	const int* pp = m_ppointers;
+	const int* pi = m_pindices;
+	const double* pv = m_pd;
+
+	// thread ranges and buffers
+	vector<int> col(nt + 1), rmin(nt), rmax(nt), buf(nt + 1);
+
+	// balance the column ranges by nonzeroes
+	const int nnz = pp[M] - pp[0];
+	col[0] = 0; col[nt] = M;
+	for (int t = 1; t < nt; ++t)
+	{
+		long long target = pp[0] + ((long long)nnz * t) / nt;
+		col[t] = (int)(std::lower_bound(pp, pp + M, (int)target) - pp);
+		if (col[t] < col[t - 1]) col[t] = col[t - 1];
+	}
+
+	#pragma omp parallel num_threads(nt)
+	{
+		const int t = omp_get_thread_num();
+		const int c0 = col[t], c1 = col[t + 1];
+
+		// find the range of rows this thread writes to
+		int r0 = (c0 < c1 ? c0 : N), r1 = (c0 < c1 ? c1 - 1 : -1);
+		for (int j = c0; j < c1; ++j)
+		{
+			int n0 = pp[j] - off, n1 = pp[j + 1] - off;
+			if (n1 > n0)
+			{
+				if (pi[n0] - off < r0) r0 = pi[n0] - off;
+				if (pi[n1 - 1] - off > r1) r1 = pi[n1 - 1] - off;
+			}
+		}
+		rmin[t] = r0;
+		rmax[t] = r1;
+
+		#pragma omp barrier
+		#pragma omp single
+		{
+			buf[0] = 0;
+			for (int i = 0; i < nt; ++i) buf[i + 1] = buf[i] + (rmax[i] >= rmin[i] ? rmax[i] - rmin[i] + 1 : 0);
+			if ((int)m_colBuf.size() < buf[nt]) m_colBuf.resize(buf[nt]);
+		}
+
+		// the columns of this thread
+		double* y = (buf[t + 1] > buf[t] ? &m_colBuf[buf[t]] - r0 : nullptr);
+		for (int i = r0; i <= r1; ++i) y[i] = 0.0;
+		for (int j = c0; j < c1; ++j)
+		{
+			const int n0 = pp[j] - off, n1 = pp[j + 1] - off;
+			const double xj = x[j];
+			if (bsymm && (n1 > n0))
+			{
+				// diagonal, lower triangle and (transposed) upper triangle
+				double yj = pv[n0] * xj;
+				for (int k = n0 + 1; k < n1; ++k)
+				{
+					const int i = pi[k] - off;
+					y[i] += pv[k] * xj;
+					yj += pv[k] * x[i];
+				}
+				y[j] += yj;
+			}
+			else
+			{
+				for (int k = n0; k < n1; ++k) y[pi[k] - off] += pv[k] * xj;
+			}
+		}
+
+		#pragma omp barrier
+
+		// sum the buffers
+		#pragma omp for
+		for (int i = 0; i < N; ++i)
+		{
+			double ri = 0.0;
+			for (int s = 0; s < nt; ++s)
+			{
+				if ((i >= rmin[s]) && (i <= rmax[s])) ri += m_colBuf[buf[s] + i - rmin[s]];
+			}
+			r[i] = ri;
+		}
+	}
+
+	return true;
+}
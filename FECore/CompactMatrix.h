@@ -63,6 +63,10 @@ public:
 	//! return the index offset (is 0 or 1)
 	int     Offset() const override { return m_offset; }
 
+	//! assemble a matrix using precomputed value offsets
+	void AssembleScatter(const matrix& ke, const std::vector<int>& offsets) override;
+	void AssembleScatterSymmetric(const matrix& ke, const std::vector<int>& offsets) override;
+
 public:
 	//! Create the matrix
 	void alloc(int nr, int nc, int nz, double* pv, int *pi, int* pp, bool bdel = true);
@@ -83,6 +87,17 @@ public:
 	//! calculate bandwidth of matrix
 	int bandWidth();
 
+protected:
+	//! find the offset into the value array of index i in the row (or column) p. 
+	//! Returns -1 if the entry is not allocated. Indices are zero-based.
+	int find(int p, int i) const;
+
+	//! Multithreaded product r = A*x for column-based storage. If bsymm is true, only
+	//! the lower triangle is stored (with the diagonal first in each column) and the
+	//! upper triangle is added as well. Returns false if the product should be done
+	//! serially (e.g. when only one thread is available).
+	bool ColumnProduct(const double* x, double* r, bool bsymm);
+
 protected:
 	double*	m_pd;			//!< matrix values
 	int*	m_pindices;		//!< indices
@@ -92,4 +107,7 @@ protected:
 
 protected:
 	std::vector<int>	P;
+
+private:
+	std::vector<double>	m_colBuf;	//!< per-thread accumulation buffers for ColumnProduct
 };
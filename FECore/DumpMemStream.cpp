@@ -43,7 +43,21 @@ DumpMemStream::DumpMemStream(FEModel& fem) : DumpStream(fem)
 }
 
 //-----------------------------------------------------------------------------
+// Resets the stream, but keeps the buffer. Streams that are written repeatedly
+// (e.g. the state that is stored before each time step) then don't have to 
+// grow (and copy) their buffer again each time they are filled.
 void DumpMemStream::clear()
+{
+	m_pd = m_pb;
+	m_nsize = 0;
+
+	// Since we can't read from an empty stream
+	// we restore write mode.
+	Open(true, true);
+}
+
+//-----------------------------------------------------------------------------
+void DumpMemStream::release()
 {
 	delete [] m_pb;
 	m_pb = 0;
@@ -51,8 +65,6 @@ void DumpMemStream::clear()
 	m_nsize = 0;
 	m_nreserved = 0;
 
-	// Since we can't read from an empty stream
-	// we restore write mode.
 	Open(true, true);
 }
 
@@ -72,7 +84,7 @@ bool DumpMemStream::EndOfStream() const
 //-----------------------------------------------------------------------------
 DumpMemStream::~DumpMemStream()
 {
-	clear();
+	release();
 }
 
 //-----------------------------------------------------------------------------
@@ -45,6 +45,9 @@ public: // overloaded from base class
 	void clear();
 	void Open(bool bsave, bool bshallow);
 
+	//! free the buffer (clear only resets the stream so the buffer can be reused)
+	void release();
+
 	size_t size() const { return m_nsize; }
 	size_t reserved() const { return m_nreserved; }
 	bool EndOfStream() const;
@@ -197,6 +197,7 @@ public: // output operators
 	template <typename T> DumpStream& operator << (std::vector<T*>& o);
 
 	template <typename T> DumpStream& write_raw(const T& o);
+	template <typename T> DumpStream& write_raw(const T* po, size_t n);
 
 public: // input operators
 	DumpStream& operator >> (char* sz);
@@ -211,6 +212,7 @@ public: // input operators
 	template <typename T> DumpStream& operator >> (std::vector<T*>& o);
 
 	template <typename T> DumpStream& read_raw(T& o);
+	template <typename T> DumpStream& read_raw(T* po, size_t n);
 
 private:
 	int FindPointer(void* p);
@@ -281,6 +283,22 @@ template <typename T> DumpStream& DumpStream::read_raw(T& o)
 	return *this;
 }
 
+// write a contiguous array of n items as a single block
+template <typename T> DumpStream& DumpStream::write_raw(const T* po, size_t n)
+{
+	if (m_btypeInfo) writeType(typeInfo<T>::typeId());
+	if (n > 0) m_bytes_serialized += write(po, sizeof(T), n);
+	return *this;
+}
+
+// read a contiguous array of n items as a single block
+template <typename T> DumpStream& DumpStream::read_raw(T* po, size_t n)
+{
+	if (m_btypeInfo) readType(typeInfo<T>::typeId());
+	if (n > 0) m_bytes_serialized += read(po, sizeof(T), n);
+	return *this;
+}
+
 template <typename T> inline DumpStream& DumpStream::operator & (T& o)
 {
 	if (IsSaving()) (*this) << o; else (*this) >> o;
@@ -37,6 +37,7 @@ SOFTWARE.*/
 #include "DumpMemStream.h"
 #include "FELinearConstraintManager.h"
 #include "FEShellDomain.h"
+#include "FESolidDomain.h"
 #include "FEMeshAdaptor.h"
 
 REGISTER_SUPER_CLASS(FEAnalysis, FEANALYSIS_ID);
@@ -309,6 +310,14 @@ bool FEAnalysis::Activate()
             dom.Activate();
     }
 
+	// Some model components (e.g. contact interfaces) can move nodes in the reference
+	// configuration when they are activated, so we need to update the shape caches.
+	for (int i = 0; i < mesh.Domains(); ++i)
+	{
+		FESolidDomain* dom = dynamic_cast<FESolidDomain*>(&mesh.Domain(i));
+		if (dom && dom->HasShapeCache()) dom->UpdateShapeCache();
+	}
+
 	return true;
 }
 
@@ -392,13 +401,16 @@ bool FEAnalysis::Solve()
 		if (m_timeController && (m_timeController->m_maxretries > 0))
 		{ 
 			dmp.clear();
-			fem.Serialize(dmp); 
+			SerializeRetryState(dmp);
 		}
 
 		// Inform that the time is about to change. (Plugins can use 
 		// this callback to modify time step)
 		fem.DoCallback(CB_UPDATE_TIME);
 
+		// the solver may need to limit the time step size
+		m_dt = GetFESolver()->TimeStepSize(m_dt);
+
 		// update time
 		FETimeInfo& tp = fem.GetTime();
 		double newTime = tp.currentTime + m_dt;
@@ -475,7 +487,7 @@ bool FEAnalysis::Solve()
 			{
 				// restore the previous state
 				dmp.Open(false, true);
-				fem.Serialize(dmp);
+				SerializeRetryState(dmp);
 				
 				// let's try again
 				m_timeController->Retry();
@@ -610,6 +622,43 @@ int FEAnalysis::SolveTimeStep()
 	return nerr;
 }
 
+//-----------------------------------------------------------------------------
+//! Stores (or restores) the state that a time step can change, so that the step
+//! can be retried. This is the nodal state and the material point state (through the
+//! model's geometry, which includes the rigid bodies), the contact and nonlinear 
+//! constraint state, and the state of this step and its solver. The other analysis 
+//! steps are not touched by this time step, so unlike a (shallow) model snapshot, 
+//! their data and solvers are not stored. The nodal state, and the material point 
+//! data of domains whose points are all flat (see FEDomain), are copied as memory blocks.
+void FEAnalysis::SerializeRetryState(DumpStream& ar)
+{
+	FEModel& fem = *GetFEModel();
+
+	ar & fem.GetTime();
+
+	// nodal and material point state
+	fem.SerializeGeometry(ar);
+
+	// contact state
+	for (int i = 0; i < fem.SurfacePairConstraints(); ++i)
+	{
+		FESurfacePairConstraint* pci = fem.SurfacePairConstraint(i);
+		ar & pci;
+	}
+
+	// nonlinear constraint state
+	for (int i = 0; i < fem.NonlinearConstraints(); ++i)
+	{
+		FENLConstraint* pnlc = fem.NonlinearConstraint(i);
+		ar & pnlc;
+	}
+
+	// step and solver data
+	ar & m_dt;
+	ar & m_ntotrhs & m_ntotref & m_ntotiter & m_ntimesteps;
+	ar & m_psolver;
+}
+
 //-----------------------------------------------------------------------------
 void FEAnalysis::Serialize(DumpStream& ar)
 {
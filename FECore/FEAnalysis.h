@@ -142,6 +142,9 @@ public:
 	// 2 = abort
 	int SolveTimeStep();
 
+	// store (or restore) the state needed to retry a time step
+	void SerializeRetryState(DumpStream& ar);
+
 public:
 	// --- Control Data ---
 	//{
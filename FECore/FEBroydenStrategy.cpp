@@ -96,15 +96,16 @@ bool FEBroydenStrategy::Update(double s, vector<double>& ui, vector<double>& R0,
 		{
 			int n = (n0 + j) % m_max_buf_size;
 
-			double w = 0.0;
-			for (int i = 0; i<m_neq; ++i) w += (m_D[n][i] * m_q[i]);
+			double w = vdot(m_neq, &m_D[n][0], &m_q[0]);
 
 			double g = m_rho[n] * w;
-			for (int i = 0; i<m_neq; ++i) m_q[i] += g*(m_D[n][i] - m_R[n][i]);
+			vaxpy(m_neq,  g, &m_D[n][0], &m_q[0]);
+			vaxpy(m_neq, -g, &m_R[n][0], &m_q[0]);
 		}
 
 		// form and store the next update vector
 		double rhoi = 0.0;
+		#pragma omp parallel for reduction(+:rhoi)
 		for (int i = 0; i<m_neq; ++i)
 		{
 			double ri = m_q[i] - ui[i];
@@ -158,21 +159,21 @@ void FEBroydenStrategy::SolveEquations(vector<double>& x, vector<double>& b)
 			{
 				int n = (n0 + j) % m_max_buf_size;
 
-				double w = 0.0;
-				for (int i = 0; i<m_neq; ++i) w += (m_D[n][i] * m_q[i]);
+				double w = vdot(m_neq, &m_D[n][0], &m_q[0]);
 
 				double g = m_rho[n] * w;
-				for (int i = 0; i<m_neq; ++i) m_q[i] += g*(m_D[n][i] - m_R[n][i]);
+				vaxpy(m_neq,  g, &m_D[n][0], &m_q[0]);
+				vaxpy(m_neq, -g, &m_R[n][0], &m_q[0]);
 			}
 
 			m_bnewStep = false;
 		}
 
 		// calculate solution
-		double rho = 0.0;
-		for (int i = 0; i<m_neq; ++i) rho += m_D[n1][i] * m_q[i];
+		double rho = vdot(m_neq, &m_D[n1][0], &m_q[0]);
 		rho *= m_rho[n1];
 
+		#pragma omp parallel for
 		for (int i = 0; i<m_neq; ++i)
 		{
 			x[i] = m_q[i] + rho*(m_D[n1][i] - m_R[n1][i]);
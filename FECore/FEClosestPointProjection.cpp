@@ -40,6 +40,7 @@ FEClosestPointProjection::FEClosestPointProjection(FESurface& s) : m_surf(s)
 	m_rad = 0.0;	// 0 means don't use search radius
 	m_bspecial = false;
 	m_projectBoundary = false;
+	m_bvh = nullptr;
 
 	// calculate node-element list
 	m_NEL.Create(m_surf);
@@ -51,8 +52,7 @@ FEClosestPointProjection::FEClosestPointProjection(FESurface& s) : m_surf(s)
 bool FEClosestPointProjection::Init()
 {
 	// initialize the nearest neighbor search
-	m_SNQ.Attach(&m_surf);
-	m_SNQ.Init();
+	m_bvh = m_surf.SearchTree();
 
 	return true;
 }
@@ -169,7 +169,7 @@ FESurfaceElement* FEClosestPointProjection::Project(const vec3d& x, vec3d& q, ve
 	FEMesh& mesh = *m_surf.GetMesh();
 
 	// let's find the closest node
-	int mn = m_SNQ.Find(x);
+	int mn = m_bvh->FindClosestNode(x);
 	if (mn < 0) return nullptr;
 
 	// make sure it is within the search radius
@@ -0,0 +1,141 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "FEContactCandidateList.h"
+#include "FESurface.h"
+#include "FESurfaceBVH.h"
+#include "FEMesh.h"
+#include <algorithm>
+using namespace std;
+
+//-----------------------------------------------------------------------------
+FEContactCandidateList::FEContactCandidateList()
+{
+	m_skin = 0.0;
+	m_cutoff = 0.0;
+	m_nbuild = 0;
+	m_ss = m_ms = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void FEContactCandidateList::Clear()
+{
+	m_r0.clear();
+	m_eoff.clear();
+	m_off.clear();
+	m_list.clear();
+	m_ss = m_ms = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+bool FEContactCandidateList::Update(FESurface& ss, FESurface& ms, double cutoff)
+{
+	// the lists track the current nodal positions, which is not the
+	// configuration that is used for shell bottom surfaces.
+	if ((m_skin <= 0.0) || ss.IsShellBottom() || ms.IsShellBottom())
+	{
+		Clear();
+		return false;
+	}
+
+	if (NeedsRebuild(ss, ms, cutoff) == false) return false;
+
+	Build(ss, ms, cutoff);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool FEContactCandidateList::NeedsRebuild(FESurface& ss, FESurface& ms, double cutoff) const
+{
+	if (m_off.empty() || (m_ss != &ss) || (m_ms != &ms) || (cutoff != m_cutoff)) return true;
+
+	int NS = ss.Nodes();
+	int NM = ms.Nodes();
+	if ((int)m_r0.size() != NS + NM) return true;
+	if ((int)m_eoff.size() != ss.Elements() + 1) return true;
+
+	// Since both the integration points and the facets can move, the relative 
+	// displacement can be up to twice the max nodal displacement.
+	double dmax2 = 0.25*m_skin*m_skin;
+	for (int i = 0; i < NS; ++i)
+	{
+		vec3d d = ss.Node(i).m_rt - m_r0[i];
+		if (d*d > dmax2) return true;
+	}
+	for (int i = 0; i < NM; ++i)
+	{
+		vec3d d = ms.Node(i).m_rt - m_r0[NS + i];
+		if (d*d > dmax2) return true;
+	}
+
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+void FEContactCandidateList::Build(FESurface& ss, FESurface& ms, double cutoff)
+{
+	m_ss = &ss;
+	m_ms = &ms;
+	m_cutoff = cutoff;
+	m_nbuild++;
+
+	// store the current nodal positions
+	int NS = ss.Nodes();
+	int NM = ms.Nodes();
+	m_r0.resize(NS + NM);
+	for (int i = 0; i < NS; ++i) m_r0[i] = ss.Node(i).m_rt;
+	for (int i = 0; i < NM; ++i) m_r0[NS + i] = ms.Node(i).m_rt;
+
+	// integration point offsets
+	int NE = ss.Elements();
+	m_eoff.resize(NE + 1);
+	m_eoff[0] = 0;
+	for (int i = 0; i < NE; ++i) m_eoff[i + 1] = m_eoff[i] + ss.Element(i).GaussPoints();
+
+	// collect the facets within the cutoff plus skin of each integration point
+	FESurfaceBVH* bvh = ms.SearchTree();
+	double R = cutoff + m_skin;
+	m_off.resize(m_eoff[NE] + 1);
+	m_off[0] = 0;
+	m_list.clear();
+	for (int i = 0; i < NE; ++i)
+	{
+		FESurfaceElement& el = ss.Element(i);
+		int nint = el.GaussPoints();
+		for (int j = 0; j < nint; ++j)
+		{
+			vec3d r = ss.Local2Global(el, j);
+			size_t n0 = m_list.size();
+			bvh->FindFacetsInRange(r, R, m_list);
+			sort(m_list.begin() + n0, m_list.end());
+
+			int k = m_eoff[i] + j;
+			m_off[k + 1] = (int)m_list.size();
+		}
+	}
+}
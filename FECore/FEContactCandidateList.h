@@ -0,0 +1,90 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "vec3d.h"
+#include <vector>
+#include "fecore_api.h"
+
+class FESurface;
+
+//-----------------------------------------------------------------------------
+//! Verlet-style candidate lists for contact searches between two surfaces.
+//! For each integration point of the secondary surface the list stores the facets
+//! of the primary surface that lie within the cutoff distance plus a skin. The
+//! lists are only rebuilt once a node of either surface has moved more than half
+//! the skin since the last rebuild. Until then, every facet within the cutoff 
+//! distance of an integration point is guaranteed to be in its list.
+class FECORE_API FEContactCandidateList
+{
+public:
+	FEContactCandidateList();
+
+	//! set the skin distance (zero disables the lists)
+	void SetSkin(double skin) { m_skin = skin; }
+
+	//! clear all lists
+	void Clear();
+
+	//! Update the lists for the integration points of ss against the facets of ms.
+	//! Returns true if the lists were rebuilt.
+	bool Update(FESurface& ss, FESurface& ms, double cutoff);
+
+	//! are the lists valid
+	bool IsValid() const { return !m_off.empty(); }
+
+	//! the cutoff distance up to which the lists are complete
+	double Cutoff() const { return m_cutoff; }
+
+	//! number of rebuilds so far
+	int Rebuilds() const { return m_nbuild; }
+
+	//! get the candidate facets of integration point n of element iel
+	const int* Candidates(int iel, int n, int& nsize) const
+	{
+		int k = m_eoff[iel] + n;
+		nsize = m_off[k + 1] - m_off[k];
+		return (nsize > 0 ? &m_list[m_off[k]] : nullptr);
+	}
+
+private:
+	bool NeedsRebuild(FESurface& ss, FESurface& ms, double cutoff) const;
+	void Build(FESurface& ss, FESurface& ms, double cutoff);
+
+private:
+	double	m_skin;		//!< skin distance
+	double	m_cutoff;	//!< cutoff distance of last build
+	int		m_nbuild;	//!< number of builds
+
+	FESurface*	m_ss;	//!< secondary surface of last build
+	FESurface*	m_ms;	//!< primary surface of last build
+
+	std::vector<vec3d>	m_r0;	//!< nodal positions (ss then ms) at last build
+	std::vector<int>	m_eoff;	//!< offset of first integration point of each element
+	std::vector<int>	m_off;	//!< offset into candidate list for each integration point
+	std::vector<int>	m_list;	//!< candidate facets
+};
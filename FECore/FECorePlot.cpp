@@ -283,7 +283,7 @@ bool FEPlotParameter::Save(FEDomain& dom, FEDataStream& a)
 		if (m_param.type() == FE_PARAM_DOUBLE_MAPPED)
 		{
 			FEParamDouble& mapDouble = dynamic_cast<FEParamDouble&>(map);
-			writeNodalProjectedElementValues<double>(sd, a, mapDouble);
+			writeNodalProjectedElementValues(sd, a, mapDouble);
 		}
 		else if (m_param.type() == FE_PARAM_VEC3D_MAPPED)
 		{
@@ -381,7 +381,7 @@ bool FEPlotParameter::Save(FESurface& dom, FEDataStream& a)
 	if (m_param.type() == FE_PARAM_DOUBLE_MAPPED)
 	{
 		FEParamDouble& map = m_param.value<FEParamDouble>();
-		writeNodalProjectedElementValues<double>(dom, a, map);
+		writeNodalProjectedElementValues(dom, a, map);
 	}
 	else if (m_param.type() == FE_PARAM_VEC3D_MAPPED)
 	{
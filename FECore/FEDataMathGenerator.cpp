@@ -79,14 +79,14 @@ bool FEDataMathGenerator::Init()
 
 void FEDataMathGenerator::value(const vec3d& r, double& data)
 {
-	vector<double> p{r.x, r.y, r.z};
+	double p[3] = { r.x, r.y, r.z };
 	assert(m_val.size() == 1);
 	data = m_val[0].value_s(p);
 }
 
 void FEDataMathGenerator::value(const vec3d& r, vec3d& data)
 {
-	vector<double> p{ r.x, r.y, r.z };
+	double p[3] = { r.x, r.y, r.z };
 	assert(m_val.size() <= 3);
 	data.x = m_val[0].value_s(p);
 	data.y = m_val[1].value_s(p);
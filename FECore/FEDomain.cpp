@@ -29,11 +29,15 @@ SOFTWARE.*/
 #include "DumpStream.h"
 #include "FEMesh.h"
 #include "FEGlobalMatrix.h"
+#include "FELinearSystem.h"
+#include "FENodeElemList.h"
+#include "FEElementWorkspace.h"
 
 //-----------------------------------------------------------------------------
 FEDomain::FEDomain(int nclass, FEModel* fem) : FEMeshPartition(nclass, fem)
 {
-
+	m_coloredElems = 0;
+	m_maxElemDofs = -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -57,7 +61,12 @@ void FEDomain::CreateMaterialPointData()
 {
 	FEMaterial* pmat = GetMaterial();
 	FEMesh* mesh = GetMesh();
-	if (pmat) ForEachElement([=](FEElement& el) {
+	if (pmat == nullptr) return;
+
+	// allocate the material point data from the domain's arena
+	FEMaterialPointArenaScope arenaScope(&m_arena);
+
+	ForEachElement([=](FEElement& el) {
 
 		vec3d r[FEElement::MAX_NODES];
 		int ne = el.Nodes();
@@ -73,6 +82,54 @@ void FEDomain::CreateMaterialPointData()
 	});
 }
 
+//-----------------------------------------------------------------------------
+// The material point data can be stored as a copy of the arena's memory, if all the
+// material points (including the points they link to) are flat and were allocated
+// from the arena, and there are no other objects in the arena.
+bool FEDomain::FlatMaterialPointData()
+{
+	int nobjs = 0;
+	int NEL = Elements();
+	for (int i = 0; i < NEL; ++i)
+	{
+		FEElement& el = ElementRef(i);
+		int nint = el.GaussPoints();
+		for (int j = 0; j < nint; ++j)
+		{
+			for (FEMaterialPoint* mp = el.GetMaterialPoint(j); mp; mp = mp->Next())
+			{
+				if ((mp->IsFlat() == false) || (m_arena.Owns(mp) == false)) return false;
+				nobjs++;
+			}
+		}
+	}
+	return ((nobjs > 0) && (nobjs == m_arena.Objects()));
+}
+
+//-----------------------------------------------------------------------------
+// Shallow archives are read back into the same model, so the material points are 
+// still at the same location in the arena's memory, and can be restored by copying
+// the memory back. If the arena changed in the meantime, the archive can't be read.
+void FEDomain::SerializeArena(DumpStream& ar)
+{
+	int nblocks = m_arena.Blocks();
+	ar & nblocks;
+	if (nblocks != m_arena.Blocks()) throw DumpStream::ReadError();
+
+	for (int i = 0; i < nblocks; ++i)
+	{
+		// the used size is a multiple of the arena's alignment (16 bytes)
+		size_t used = m_arena.BlockUsed(i);
+		int n = (int)(used / sizeof(double));
+		ar & n;
+		if (n != (int)(used / sizeof(double))) throw DumpStream::ReadError();
+
+		double* pd = (double*)m_arena.BlockData(i);
+		if (ar.IsSaving()) ar.write_raw(pd, n);
+		else ar.read_raw(pd, n);
+	}
+}
+
 //-----------------------------------------------------------------------------
 // serialization
 void FEDomain::Serialize(DumpStream& ar)
@@ -81,14 +138,22 @@ void FEDomain::Serialize(DumpStream& ar)
 
 	if (ar.IsShallow())
 	{
+		int flat = (ar.IsSaving() ? (FlatMaterialPointData() ? 1 : 0) : 0);
+		ar & flat;
+
 		int NEL = Elements();
 		for (int i = 0; i < NEL; ++i)
 		{
 			FEElement& el = ElementRef(i);
 			el.Serialize(ar);
-			int nint = el.GaussPoints();
-			for (int j = 0; j < nint; ++j) el.GetMaterialPoint(j)->Serialize(ar);
+			if (flat == 0)
+			{
+				int nint = el.GaussPoints();
+				for (int j = 0; j < nint; ++j) el.GetMaterialPoint(j)->Serialize(ar);
+			}
 		}
+
+		if (flat) SerializeArena(ar);
 	}
 	else
 	{
@@ -118,6 +183,7 @@ void FEDomain::Serialize(DumpStream& ar)
 			int NEL = 0;
 			ar >> NEL;
 			Create(NEL, espec);
+			FEMaterialPointArenaScope arenaScope(&m_arena);
 			for (int i = 0; i < NEL; ++i)
 			{
 				FEElement& el = ElementRef(i);
@@ -161,7 +227,7 @@ void FEDomain::UnpackLM(FEElement& el, const FEDofList& dof, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = mesh->Node(n);
-		vector<int>& id = node.m_ID;
+		int* id = node.m_ID;
 		for (int j = 0; j<ndofs; ++j) lm[i*ndofs + j] = id[dof[j]];
 	}
 }
@@ -169,6 +235,11 @@ void FEDomain::UnpackLM(FEElement& el, const FEDofList& dof, vector<int>& lm)
 //-----------------------------------------------------------------------------
 void FEDomain::BuildMatrixProfile(FEGlobalMatrix& M)
 {
+	// The matrix profile is rebuilt when the mesh changes, so
+	// we need to rebuild the element coloring as well.
+	ResetElementColors();
+	m_maxElemDofs = -1;
+
 	vector<int> elm;
 	const int NE = Elements();
 	for (int j = 0; j<NE; ++j)
@@ -196,3 +267,102 @@ void FEDomain::Activate(const FEDofList& dof)
 		}
 	}
 }
+
+//-----------------------------------------------------------------------------
+// The LM vector of the element with the most nodes is the largest one, but the
+// buffers are also used for vectors that have a value for each dof in the dof list.
+int FEDomain::MaxElementDofs()
+{
+	int ndof;
+	#pragma omp atomic read
+	ndof = m_maxElemDofs;
+	if (ndof >= 0) return ndof;
+
+	const int NE = Elements();
+	int imax = -1, nmax = 0;
+	for (int i = 0; i < NE; ++i)
+	{
+		int ne = ElementRef(i).Nodes();
+		if (ne > nmax) { nmax = ne; imax = i; }
+	}
+
+	ndof = nmax * GetDOFList().Size();
+	if (imax >= 0)
+	{
+		vector<int> lm;
+		UnpackLM(ElementRef(imax), lm);
+		if ((int)lm.size() > ndof) ndof = (int)lm.size();
+	}
+
+	#pragma omp atomic write
+	m_maxElemDofs = ndof;
+
+	return ndof;
+}
+
+//-----------------------------------------------------------------------------
+FEElementWorkspace& FEDomain::ElementWorkspace()
+{
+	FEElementWorkspace& ws = FEElementWorkspace::Get();
+	ws.Reserve(MaxElementDofs());
+	return ws;
+}
+
+//-----------------------------------------------------------------------------
+void FEDomain::ResetElementColors()
+{
+	m_elemColors.clear();
+	m_coloredElems = 0;
+}
+
+//-----------------------------------------------------------------------------
+const std::vector< std::vector<int> >& FEDomain::ElementColors()
+{
+	if (m_elemColors.empty() || (m_coloredElems != Elements())) BuildElementColors();
+	return m_elemColors;
+}
+
+//-----------------------------------------------------------------------------
+// Greedy coloring of the elements. Each element gets the lowest color that is not
+// used by any element that shares a node with it.
+void FEDomain::BuildElementColors()
+{
+	m_elemColors.clear();
+	const int NE = Elements();
+	m_coloredElems = NE;
+	if (NE == 0) return;
+
+	FENodeElemList NEL;
+	NEL.Create(*this);
+
+	vector<int> color(NE, -1);
+	vector<int> tag;	// tag[c] == i if color c is used by a neighbor of element i
+	for (int i = 0; i < NE; ++i)
+	{
+		FEElement& el = ElementRef(i);
+		int neln = el.Nodes();
+		for (int j = 0; j < neln; ++j)
+		{
+			int nj = el.m_node[j];
+			int nval = NEL.Valence(nj);
+			int* eli = NEL.ElementIndexList(nj);
+			for (int k = 0; k < nval; ++k)
+			{
+				int ck = color[eli[k]];
+				if (ck >= 0) tag[ck] = i;
+			}
+		}
+
+		int c = 0;
+		while ((c < (int)tag.size()) && (tag[c] == i)) c++;
+		if (c == (int)tag.size())
+		{
+			tag.push_back(-1);
+			m_elemColors.push_back(vector<int>());
+		}
+
+		color[i] = c;
+		m_elemColors[c].push_back(i);
+	}
+}
+
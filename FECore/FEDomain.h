@@ -28,9 +28,12 @@ SOFTWARE.*/
 
 #pragma once
 #include "FEMeshPartition.h"
+#include "FEMaterialPointArena.h"
+#include "FELinearSystem.h"
 
 // forward declaration of material class
 class FEMaterial;
+class FEElementWorkspace;
 
 // Base class for solid and shell parts. Domains can also have materials assigned.
 class FECORE_API FEDomain : public FEMeshPartition
@@ -77,10 +80,75 @@ public:
 	//! Activate the domain
 	virtual void Activate();
 
+public:
+	//! Get the element coloring of this domain. Elements of the same color don't 
+	//! share any nodes and can therefore be assembled concurrently without
+	//! synchronization. The coloring is built on first use and then cached.
+	const std::vector< std::vector<int> >& ElementColors();
+
+	//! Clear the cached element coloring (e.g. when the mesh has changed).
+	void ResetElementColors();
+
+	//! Evaluate f for all elements in parallel. If the linear system uses colored 
+	//! assembly, the elements are processed one color at a time. 
+	//! This must be called outside a parallel region. (This is a template on the 
+	//! callable, so that f can be inlined in the element loop.)
+	template <class F> void AssembleElements(FELinearSystem& LS, F f);
+
+	//! Get the element scratch buffers of the calling thread, reserved for the
+	//! largest element of this domain.
+	FEElementWorkspace& ElementWorkspace();
+
+	//! The size of the largest element LM vector of this domain. This is evaluated 
+	//! on first use and cached until the matrix profile is rebuilt.
+	int MaxElementDofs();
+
 protected:
 	// helper function for activating dof lists
 	void Activate(const FEDofList& dof);
 
 	// helper function for unpacking element dofs
 	void UnpackLM(FEElement& el, const FEDofList& dof, vector<int>& lm);
+
+private:
+	// build the element coloring
+	void BuildElementColors();
+
+	// see if the material point data can be stored as a copy of the arena's memory
+	bool FlatMaterialPointData();
+
+	// store or restore the arena's memory
+	void SerializeArena(DumpStream& ar);
+
+private:
+	std::vector< std::vector<int> >	m_elemColors;	//!< element indices for each color
+	int	m_coloredElems;		//!< number of elements when coloring was built
+	int	m_maxElemDofs;		//!< size of the largest element LM vector (or -1 if not evaluated)
+
+	FEMaterialPointArena	m_arena;	//!< memory pool for the material point data
 };
+
+//-----------------------------------------------------------------------------
+template <class F> void FEDomain::AssembleElements(FELinearSystem& LS, F f)
+{
+	if (LS.AssemblyMode() == COLORED_ASSEMBLY)
+	{
+		const std::vector< std::vector<int> >& colors = ElementColors();
+		for (size_t c = 0; c < colors.size(); ++c)
+		{
+			const std::vector<int>& elems = colors[c];
+			int NE = (int)elems.size();
+
+			LS.BeginColor();
+			#pragma omp parallel for shared(NE)
+			for (int i = 0; i < NE; ++i) f(elems[i]);
+			LS.EndColor();
+		}
+	}
+	else
+	{
+		int NE = Elements();
+		#pragma omp parallel for shared(NE)
+		for (int i = 0; i < NE; ++i) f(i);
+	}
+}
@@ -0,0 +1,66 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "FEElementWorkspace.h"
+#include "FEElement.h"
+
+//-----------------------------------------------------------------------------
+FEElementWorkspace::FEElementWorkspace()
+{
+	// The buffers are reserved by the domains (see FEDomain::ElementWorkspace).
+}
+
+//-----------------------------------------------------------------------------
+FEElementWorkspace& FEElementWorkspace::Get()
+{
+	static thread_local FEElementWorkspace ws;
+	return ws;
+}
+
+//-----------------------------------------------------------------------------
+void FEElementWorkspace::Reserve(int ndof)
+{
+	if ((int)m_fe.capacity() < ndof) m_fe.reserve(ndof);
+	if ((int)m_lm.capacity() < ndof) m_lm.reserve(ndof);
+}
+
+//-----------------------------------------------------------------------------
+FEElementMatrix& FEElementWorkspace::ElementMatrix(const FEElement& el)
+{
+	m_ke.SetElement(el);
+	return m_ke;
+}
+
+//-----------------------------------------------------------------------------
+FEElementMatrix& FEElementWorkspace::ElementMatrix(const FEElement& el, const std::vector<int>& lm)
+{
+	m_ke.SetElement(el);
+	m_ke.SetIndices(lm);
+	return m_ke;
+}
@@ -0,0 +1,73 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "FEGlobalMatrix.h"
+#include <vector>
+
+class FEElement;
+
+//-----------------------------------------------------------------------------
+//! This class provides scratch buffers for the element loops of the domains 
+//! (e.g. for the internal force vector and the stiffness matrix). Each thread has
+//! its own workspace that is reused from element to element, so that the buffers
+//! only need to be allocated once, instead of for each element in each iteration.
+//! NOTE: The buffers are shared by all the code that runs on the same thread, so
+//! they should only be used at the top level of an element loop and must not be 
+//! held on to across calls that may use the workspace as well.
+class FECORE_API FEElementWorkspace
+{
+public:
+	FEElementWorkspace();
+
+	//! get the workspace of the calling thread
+	static FEElementWorkspace& Get();
+
+	//! make sure the buffers can hold the data of an element with ndof dofs
+	void Reserve(int ndof);
+
+	//! return the element force vector buffer (the contents are undefined)
+	std::vector<double>& ForceVector() { return m_fe; }
+
+	//! return the element LM vector buffer (the contents are undefined)
+	std::vector<int>& LM() { return m_lm; }
+
+	//! return the element matrix buffer, assigned to element el (without indices).
+	//! The size and contents of the matrix are undefined.
+	FEElementMatrix& ElementMatrix(const FEElement& el);
+
+	//! same as above, but also sets the row and column indices
+	FEElementMatrix& ElementMatrix(const FEElement& el, const std::vector<int>& lm);
+
+private:
+	std::vector<double>	m_fe;	//!< element force vector
+	std::vector<int>	m_lm;	//!< element LM vector
+	FEElementMatrix		m_ke;	//!< element matrix
+
+	FEElementWorkspace(const FEElementWorkspace&) {}
+	void operator = (const FEElementWorkspace&) {}
+};
@@ -39,6 +39,11 @@ FEFunction1D::FEFunction1D(FEModel* fem) : FECoreBase(fem)
 {
 }
 
+void FEFunction1D::values(int n, const double* x, double* val) const
+{
+	for (int i = 0; i < n; ++i) val[i] = value(x[i]);
+}
+
 double FEFunction1D::derive(double x) const
 {
 	const double eps = 1e-6;
@@ -210,9 +215,8 @@ FEFunction1D* FEMathFunction::copy()
 	return m;
 }
 
-void FEMathFunction::evalParams(std::vector<double>& val, double t) const
+void FEMathFunction::evalParams(double* val, double t) const
 {
-	val.resize(m_var.size());
 	for (int i = 0; i < m_var.size(); ++i)
 	{
 		if (i == m_ix) val[i] = t;
@@ -220,23 +224,66 @@ void FEMathFunction::evalParams(std::vector<double>& val, double t) const
 	}
 }
 
+// These functions are called a lot, so for the typical case of a few
+// variables, the variables values are stored on the stack.
+const int MAX_MATH_VARS = 16;
+
 double FEMathFunction::value(double t) const
 {
-	vector<double> v;
+	double buf[MAX_MATH_VARS];
+	vector<double> tmp;
+	double* v = buf;
+	if (m_var.size() > MAX_MATH_VARS) { tmp.resize(m_var.size()); v = tmp.data(); }
 	evalParams(v, t);
 	return m_exp.value_s(v);
 }
 
+// The model parameters are the same for all points, so only the independent 
+// variable differs. All points are evaluated with one call to the expression.
+void FEMathFunction::values(int n, const double* x, double* val) const
+{
+	if (n <= 0) return;
+	if (m_ix == -1)
+	{
+		double v = value(0.0);
+		for (int i = 0; i < n; ++i) val[i] = v;
+		return;
+	}
+
+	int nvar = (int)m_var.size();
+	vector<double> buf(nvar*n);
+	vector<const double*> var(nvar);
+	for (int j = 0; j < nvar; ++j)
+	{
+		if (j == m_ix) var[j] = x;
+		else
+		{
+			double v = m_var[j].value<double>();
+			double* p = &buf[j*n];
+			for (int i = 0; i < n; ++i) p[i] = v;
+			var[j] = p;
+		}
+	}
+
+	m_exp.value_s(n, var.data(), val);
+}
+
 double FEMathFunction::derive(double t) const
 {
-	vector<double> v;
+	double buf[MAX_MATH_VARS];
+	vector<double> tmp;
+	double* v = buf;
+	if (m_var.size() > MAX_MATH_VARS) { tmp.resize(m_var.size()); v = tmp.data(); }
 	evalParams(v, t);
 	return m_dexp.value_s(v);
 }
 
 double FEMathFunction::deriv2(double t) const
 {
-	vector<double> v;
+	double buf[MAX_MATH_VARS];
+	vector<double> tmp;
+	double* v = buf;
+	if (m_var.size() > MAX_MATH_VARS) { tmp.resize(m_var.size()); v = tmp.data(); }
 	evalParams(v, t);
 	return m_d2exp.value_s(v);
 }
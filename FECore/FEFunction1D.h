@@ -59,6 +59,10 @@ public:
 	// must be defined by derived classes
 	virtual double value(double x) const = 0;
 
+	// evaluate the function at n points
+	// can be overridden by derived classes that can evaluate many points at once.
+	virtual void values(int n, const double* x, double* val) const;
+
 	// value of first derivative of function at x
 	// can be overridden by derived classes.
 	// default implementation is a forward-difference
@@ -157,6 +161,8 @@ public:
 
 	double value(double t) const override;
 
+	void values(int n, const double* x, double* val) const override;
+
 	double derive(double t) const override;
 
     double deriv2(double t) const override;
@@ -164,7 +170,7 @@ public:
 	void SetMathString(const std::string& s);
 
 private:
-	void evalParams(std::vector<double>& val, double t) const;
+	void evalParams(double* val, double t) const;
 
 private:
 	std::string			m_s;
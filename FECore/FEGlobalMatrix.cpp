@@ -31,16 +31,22 @@ SOFTWARE.*/
 #include "FEModel.h"
 #include "FEDomain.h"
 #include "FESurface.h"
+#include "log.h"
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 FEElementMatrix::FEElementMatrix(const FEElement& el)
 {
+	m_pel = &el;
+	m_bsymm = false;
 	m_node = el.m_node;
 }
 
 //-----------------------------------------------------------------------------
 FEElementMatrix::FEElementMatrix(const FEElementMatrix& ke) : matrix(ke)
 {
+	m_pel = ke.m_pel;
+	m_bsymm = ke.m_bsymm;
 	m_node = ke.m_node;
 	m_lmi = ke.m_lmi;
 	m_lmj = ke.m_lmj;
@@ -49,6 +55,8 @@ FEElementMatrix::FEElementMatrix(const FEElementMatrix& ke) : matrix(ke)
 //-----------------------------------------------------------------------------
 FEElementMatrix::FEElementMatrix(const FEElementMatrix& ke, double scale)
 {
+	m_pel = ke.m_pel;
+	m_bsymm = ke.m_bsymm;
 	m_node = ke.m_node;
 	m_lmi = ke.m_lmi;
 	m_lmj = ke.m_lmj;
@@ -60,6 +68,8 @@ FEElementMatrix::FEElementMatrix(const FEElementMatrix& ke, double scale)
 //-----------------------------------------------------------------------------
 FEElementMatrix::FEElementMatrix(const FEElement& el, const vector<int>& lmi) : matrix((int)lmi.size(), (int)lmi.size())
 {
+	m_pel = &el;
+	m_bsymm = false;
 	m_node = el.m_node;
 	m_lmi = lmi;
 	m_lmj = lmi;
@@ -68,11 +78,35 @@ FEElementMatrix::FEElementMatrix(const FEElement& el, const vector<int>& lmi) :
 //-----------------------------------------------------------------------------
 FEElementMatrix::FEElementMatrix(const FEElement& el, vector<int>& lmi, vector<int>& lmj) : matrix((int)lmi.size(), (int)lmj.size())
 {
+	m_pel = &el;
+	m_bsymm = false;
 	m_node = el.m_node;
 	m_lmi = lmi;
 	m_lmj = lmj;
 };
 
+//-----------------------------------------------------------------------------
+void FEElementMatrix::SetElement(const FEElement& el)
+{
+	m_pel = &el;
+	m_bsymm = false;
+	m_node.assign(el.m_node.begin(), el.m_node.end());
+	m_lmi.clear();
+	m_lmj.clear();
+}
+
+//-----------------------------------------------------------------------------
+void FEElementMatrix::CompleteSymmetric()
+{
+	if (m_bsymm == false) return;
+	assert(rows() == columns());
+	matrix& K = *this;
+	const int N = rows();
+	for (int i = 1; i < N; ++i)
+		for (int j = 0; j < i; ++j) K[i][j] = K[j][i];
+	m_bsymm = false;
+}
+
 //-----------------------------------------------------------------------------
 // assignment operator
 void FEElementMatrix::operator = (const matrix& ke)
@@ -89,7 +123,11 @@ FEGlobalMatrix::FEGlobalMatrix(SparseMatrix* pK, bool del)
 	m_LM.resize(MAX_LM_SIZE);
 	m_pMP = 0;
 	m_nlm = 0;
+	m_nblocks = 0;
 	m_delA = del;
+	m_scatterBudget = 512.0;
+	m_scatterOverBudget = false;
+	m_scatterTag = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -107,19 +145,38 @@ void FEGlobalMatrix::Clear()
 	if (m_pA) m_pA->Clear(); 
 }
 
+//-----------------------------------------------------------------------------
+// The budget is checked when the matrix is created (see InitScatterMaps).
+void FEGlobalMatrix::SetScatterMapBudget(double mb)
+{
+	m_scatterBudget = mb;
+	if (mb == 0.0)
+	{
+		m_scatterDom.clear();
+		m_scatterMap.clear();
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! Start building the profile. That is delete the old profile (if there was one)
 //! and create a new one. 
 void FEGlobalMatrix::build_begin(int neq)
 {
+	// block formats are profiled in block space (see SetNodalStructure)
+	if ((int)m_eqblock.size() != neq) m_eqblock.clear();
+	int nr = (m_eqblock.empty() ? neq : m_nblocks);
+
 	if (m_pMP) delete m_pMP;
-	m_pMP = new SparseMatrixProfile(neq, neq);
+	m_pMP = new SparseMatrixProfile(nr, nr);
 
 	// initialize it to a diagonal matrix
 	// TODO: Is this necessary?
 	m_pMP->CreateDiagonal();
 
 	m_nlm = 0;
+
+	// the scatter maps will need to be rebuilt
+	m_scatterDom.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -158,6 +215,30 @@ void FEGlobalMatrix::build_flush()
 		}
 	}
 
+	// For block formats, replace the equations by the (unique) blocks they belong to.
+	// The nodal dofs of an element usually collapse to one block per node, so this
+	// profile is much smaller than the scalar one.
+	if (m_eqblock.empty() == false)
+	{
+		int nlm = 0;
+		for (i=0; i<m_nlm; ++i)
+		{
+			vector<int>& LM = m_LM[i];
+			n = 0;
+			for (j=0; j<(int)LM.size(); ++j)
+			{
+				if (LM[j] >= 0) LM[n++] = m_eqblock[LM[j]];
+			}
+			if (n == 0) continue;
+			LM.resize(n);
+			std::sort(LM.begin(), LM.end());
+			LM.erase(std::unique(LM.begin(), LM.end()), LM.end());
+			if (nlm != i) m_LM[nlm].swap(LM);
+			nlm++;
+		}
+		m_nlm = nlm;
+	}
+
 	m_pMP->UpdateProfile(m_LM, m_nlm);
 	m_nlm = 0;
 }
@@ -168,7 +249,45 @@ void FEGlobalMatrix::build_flush()
 void FEGlobalMatrix::build_end()
 {
 	if (m_nlm > 0) build_flush();
-	m_pA->Create(*m_pMP);
+	if (m_eqblock.empty()) m_pA->Create(*m_pMP);
+	else m_pA->CreateBlocks(*m_pMP);
+
+	// store the fingerprint of the profile so that the linear solver 
+	// can see if the structure of the matrix has changed.
+	m_pA->SetFingerprint(m_pMP->Fingerprint());
+
+	// invalidate all scatter maps
+	m_scatterTag++;
+}
+
+//-----------------------------------------------------------------------------
+//! Block matrix formats need to know which equations belong to the same node.
+//! Prescribed dofs are included since they are also stored in the matrix profile.
+void FEGlobalMatrix::SetNodalStructure(FEMesh& mesh, int neq)
+{
+	m_eqblock.clear();
+	m_nblocks = 0;
+	if (m_pA->UsesNodalStructure() == false) return;
+
+	vector<int> eqnode(neq, -1);
+	for (int i = 0; i < mesh.Nodes(); ++i)
+	{
+		FENode& node = mesh.Node(i);
+		for (int j = 0; j < node.dofs(); ++j)
+		{
+			int n = node.m_ID[j];
+			if (n < -1) n = -n - 2;
+			if ((n >= 0) && (n < neq)) eqnode[n] = i;
+		}
+	}
+	m_pA->SetNodalStructure(eqnode);
+
+	// get the blocks, so we can build the profile in block space
+	if (m_pA->EquationBlocks(m_eqblock) && ((int)m_eqblock.size() == neq))
+	{
+		for (int i = 0; i < neq; ++i) if (m_eqblock[i] >= m_nblocks) m_nblocks = m_eqblock[i] + 1;
+	}
+	else m_eqblock.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -182,6 +301,9 @@ bool FEGlobalMatrix::Create(FEModel* pfem, int neq, bool breset)
 	// reconstructing it every time we come here saves us a lot of time. The 
 	// static profile is stored in the variable m_MPs.
 
+	// block formats need the nodal structure before the profile is built
+	SetNodalStructure(pfem->GetMesh(), neq);
+
 	// begin building the profile
 	build_begin(neq);
 	{
@@ -217,6 +339,9 @@ bool FEGlobalMatrix::Create(FEModel* pfem, int neq, bool breset)
 	// the actual sparse matrix. This is done in the following function
 	build_end();
 
+	// prepare the element scatter maps
+	InitScatterMaps(pfem->GetMesh());
+
 	return true;
 }
 
@@ -224,6 +349,9 @@ bool FEGlobalMatrix::Create(FEModel* pfem, int neq, bool breset)
 //! Constructs the stiffness matrix from a FEMesh object. 
 bool FEGlobalMatrix::Create(FEMesh& mesh, int neq)
 {
+	// block formats need the nodal structure before the profile is built
+	SetNodalStructure(mesh, neq);
+
 	// begin building the profile
 	build_begin(neq);
 	{
@@ -239,6 +367,9 @@ bool FEGlobalMatrix::Create(FEMesh& mesh, int neq)
 	// the actual sparse matrix. This is done in the following function
 	build_end();
 
+	// prepare the element scatter maps
+	InitScatterMaps(mesh);
+
 	return true;
 }
 
@@ -250,6 +381,7 @@ bool FEGlobalMatrix::Create(FEMesh& mesh, int nstart, int nend)
 	int neq = nend - nstart + 1;
 
 	// begin building the profile
+	m_eqblock.clear();
 	build_begin(neq);
 	{
 		// Add all elements to the profile
@@ -301,6 +433,7 @@ bool FEGlobalMatrix::Create(const FESurface& surf, const std::vector<int>& equat
 	if (neq == 0) return false;
 
 	// build the matrix, assuming one degree of freedom per node
+	m_eqblock.clear();
 	build_begin(neq);
 	for (int i = 0; i<surf.Elements(); ++i) {
 		const FESurfaceElement& el = surf.Element(i);
@@ -314,7 +447,180 @@ bool FEGlobalMatrix::Create(const FESurface& surf, const std::vector<int>& equat
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Allocate the scatter maps for all the domain elements. The maps themselves are
+// calculated the first time an element is assembled. The memory they will need is 
+// estimated from the LM of the first element of each domain.
+void FEGlobalMatrix::InitScatterMaps(FEMesh& mesh)
+{
+	m_scatterDom.clear();
+	if (m_scatterBudget == 0.0) return;
+
+	// see if the matrix format supports scatter maps at all
+	vector<int> lm0, off0;
+	if (m_pA->ScatterMap(lm0, lm0, off0) == false) return;
+
+	const int ND = mesh.Domains();
+	double mb = 0.0;
+	vector<int> lm;
+	for (int i = 0; i < ND; ++i)
+	{
+		FEDomain& dom = mesh.Domain(i);
+		if (dom.Elements() == 0) continue;
+		dom.UnpackLM(dom.ElementRef(0), lm);
+		double n = (double)lm.size();
+		double nint = (m_pA->isSymmetric() ? n*(n + 1.0) / 2.0 : n*n);
+		mb += dom.Elements()*(nint*sizeof(int) + sizeof(ElementScatterMap)) / (1024.0*1024.0);
+	}
+
+	if ((m_scatterBudget > 0) && (mb > m_scatterBudget))
+	{
+		// only warn the first time, since the matrix is usually recreated many times
+		if (m_scatterOverBudget == false)
+		{
+			FEModel* fem = mesh.GetFEModel();
+			if (fem) feLogWarningEx(fem, "The element scatter maps need %lg MB, which exceeds the budget of %lg MB.\nScatter maps will not be used.", mb, m_scatterBudget);
+		}
+		m_scatterOverBudget = true;
+		m_scatterMap.clear();
+		return;
+	}
+	m_scatterOverBudget = false;
+
+	m_scatterDom.resize(ND);
+	m_scatterMap.resize(ND);
+	for (int i = 0; i < ND; ++i)
+	{
+		FEDomain& dom = mesh.Domain(i);
+		m_scatterDom[i] = &dom;
+
+		// Resizing keeps the storage of existing maps. These are invalidated
+		// through the tag, so they can be rebuilt in place.
+		vector<ElementScatterMap>& map = m_scatterMap[i];
+		if ((int)map.size() != dom.Elements())
+		{
+			map.resize(dom.Elements());
+			for (size_t j = 0; j < map.size(); ++j) map[j].tag = -1;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+FEGlobalMatrix::ElementScatterMap* FEGlobalMatrix::FindScatterMap(const FEElementMatrix& ke)
+{
+	const FEElement* pe = ke.Element();
+	if (pe == nullptr) return nullptr;
+
+	const FEMeshPartition* dom = pe->GetMeshPartition();
+	for (size_t i = 0; i < m_scatterDom.size(); ++i)
+	{
+		if (m_scatterDom[i] == dom)
+		{
+			int lid = pe->GetLocalID();
+			vector<ElementScatterMap>& map = m_scatterMap[i];
+			if ((lid >= 0) && (lid < (int)map.size())) return &map[lid];
+			return nullptr;
+		}
+	}
+	return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Calculate the scatter map of an element. For symmetric element matrices (which are
+// only assembled directly into symmetric storage), only the upper triangle is kept.
+// In symmetric storage, usually only one of the offsets of (i,j) and (j,i) is valid.
+// If both are, the two dofs map to the same equation and the entry is added twice.
+bool FEGlobalMatrix::BuildScatterMap(const vector<int>& lmi, const vector<int>& lmj, bool bsymm, vector<int>& offsets)
+{
+	if (bsymm == false) return m_pA->ScatterMap(lmi, lmj, offsets);
+
+	vector<int> full;
+	if (m_pA->ScatterMap(lmi, lmj, full) == false) return false;
+
+	const int N = (int)lmi.size();
+	if ((int)lmj.size() != N) return false;
+	offsets.resize(N*(N + 1) / 2);
+	int n = 0;
+	for (int i = 0; i < N; ++i)
+		for (int j = i; j < N; ++j, ++n)
+		{
+			int kij = full[i*N + j];
+			int kji = full[j*N + i];
+			if (kij < 0) offsets[n] = kji;
+			else if ((j != i) && (kji >= 0)) offsets[n] = -kij - 2;
+			else offsets[n] = kij;
+		}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// FNV-1a hash of the element's row and column indices. This is stored instead of 
+// copies of the indices to detect that an element's LM changed.
+static unsigned long long scatter_map_hash(const vector<int>& lmi, const vector<int>& lmj, bool bsymm)
+{
+	unsigned long long h = 14695981039346656037ULL;
+	auto add = [&h](unsigned long long v) { h ^= v; h *= 1099511628211ULL; };
+	add(bsymm ? 1 : 0);
+	add(lmi.size());
+	for (size_t i = 0; i < lmi.size(); ++i) add((unsigned int)lmi[i]);
+	add(lmj.size());
+	for (size_t i = 0; i < lmj.size(); ++i) add((unsigned int)lmj[i]);
+	return h;
+}
+
+//-----------------------------------------------------------------------------
 void FEGlobalMatrix::Assemble(const FEElementMatrix& ke)
 {
-	m_pA->Assemble(ke, ke.RowIndices(), ke.ColumnsIndices());
+	const vector<int>& lmi = ke.RowIndices();
+	const vector<int>& lmj = ke.ColumnsIndices();
+
+	// A symmetric element matrix only defines its upper triangular part. This can
+	// be assembled directly into a symmetric sparse matrix using its scatter map.
+	// In all other cases, we need the full element matrix.
+	bool bsymm = ke.IsSymmetric();
+	if (bsymm && (m_pA->isSymmetric() == false))
+	{
+		FEElementMatrix kf(ke);
+		kf.CompleteSymmetric();
+		Assemble(kf);
+		return;
+	}
+
+	// See if we have a scatter map for this element. 
+	// NOTE: An element is never assembled by more than one thread at a time, 
+	// so we can safely update its map here.
+	ElementScatterMap* sm = FindScatterMap(ke);
+	if (sm)
+	{
+		// (re)build the map if the matrix was recreated or the element's LM changed
+		unsigned long long hash = scatter_map_hash(lmi, lmj, bsymm);
+		if ((sm->tag != m_scatterTag) || (sm->hash != hash))
+		{
+			if (BuildScatterMap(lmi, lmj, bsymm, sm->offsets))
+			{
+				sm->hash = hash;
+				sm->tag = m_scatterTag;
+			}
+			else sm = nullptr;
+		}
+	}
+
+	const int N = ke.rows();
+	int nsize = (bsymm ? N*(N + 1) / 2 : N*ke.columns());
+	if (sm && ((int)sm->offsets.size() != nsize)) sm = nullptr;
+
+	if (bsymm)
+	{
+		if (sm == nullptr)
+		{
+			FEElementMatrix kf(ke);
+			kf.CompleteSymmetric();
+			m_pA->Assemble(kf, lmi, lmj);
+			return;
+		}
+
+		m_pA->AssembleScatterSymmetric(ke, sm->offsets);
+	}
+	else if (sm) m_pA->AssembleScatter(ke, sm->offsets);
+	else m_pA->Assemble(ke, lmi, lmj);
 }
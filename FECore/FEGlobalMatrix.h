@@ -37,6 +37,7 @@ class FEModel;
 class FEMesh;
 class FESurface;
 class FEElement;
+class FEMeshPartition;
 
 //-----------------------------------------------------------------------------
 //! This class represents an element matrix, i.e. a matrix of values and the row and
@@ -45,8 +46,8 @@ class FECORE_API FEElementMatrix : public matrix
 {
 public:
 	// default constructor
-	FEElementMatrix(){}
-	FEElementMatrix(int nr, int nc) : matrix(nr, nc) {}
+	FEElementMatrix() : m_pel(nullptr), m_bsymm(false) {}
+	FEElementMatrix(int nr, int nc) : matrix(nr, nc), m_pel(nullptr), m_bsymm(false) {}
 	FEElementMatrix(const FEElement& el);
 
 	// constructor for symmetric matrices
@@ -79,10 +80,33 @@ public:
 	// Set the node indices
 	void SetNodes(const std::vector<int>& en) { m_node = en; }
 
+	// Set the element this matrix is for. This clears the indices, but reuses 
+	// the storage of the index arrays, so that element matrices can be recycled.
+	void SetElement(const FEElement& el);
+
 	// get the nodes
 	const std::vector<int>& Nodes() const { return m_node; }
 
+	// get the element this matrix was created for (can be null)
+	const FEElement* Element() const { return m_pel; }
+
+	// Mark the matrix as symmetric. For a symmetric matrix only the upper triangular
+	// part (j >= i) needs to be set. The lower part is implied by symmetry.
+	void SetSymmetric(bool b) { m_bsymm = b; }
+
+	// see if this is a symmetric (upper triangular) matrix
+	bool IsSymmetric() const { return m_bsymm; }
+
+	// return the (i,j) entry, taking symmetry into account
+	double value(int i, int j) const { return (m_bsymm && (i > j) ? (*this)(j, i) : (*this)(i, j)); }
+
+	// copy the upper triangular part of a symmetric matrix into the lower part.
+	// After this, the full matrix is defined and it is no longer marked as symmetric.
+	void CompleteSymmetric();
+
 private:
+	const FEElement*	m_pel;	//!< the element
+	bool				m_bsymm;	//!< only upper triangular part is defined
 	std::vector<int>	m_node;	//!< node indices
 	std::vector<int>	m_lmi;	//!< row indices
 	std::vector<int>	m_lmj;	//!< column indices
@@ -135,6 +159,13 @@ public:
 	//! return the nonzeroes in the sparse matrix
 	int NonZeroes() { return m_pA->NonZeroes(); }
 
+	//! Set the max memory (in MB) of the element scatter maps (0 = no maps, < 0 = no limit)
+	void SetScatterMapBudget(double mb);
+
+	//! Are the element scatter maps used? (This is false if they are turned off, exceed
+	//! the budget, or if the matrix format does not support them.)
+	bool HasScatterMaps() const { return (m_scatterDom.empty() == false); }
+
 	//! return the number of rows
 	int Rows() { return m_pA->Rows(); }
 
@@ -150,7 +181,7 @@ public:
 	//! zero the sparse matrix
 	void Zero() { m_pA->Zero(); }
 
-	//! get the sparse matrix profile
+	//! get the sparse matrix profile (this is a block profile for block matrix formats)
 	SparseMatrixProfile* GetSparseMatrixProfile() { return m_pMP; }
 
 public:
@@ -159,6 +190,21 @@ public:
 	void build_end();
 	void build_flush();
 
+protected:
+	// pass the equation-to-node map to the sparse matrix if it needs it. This must be
+	// called before build_begin, since block formats are profiled in block space.
+	void SetNodalStructure(FEMesh& mesh, int neq);
+
+	// setup the element scatter maps for the domains of this mesh
+	void InitScatterMaps(FEMesh& mesh);
+
+	// find the scatter map of an element matrix
+	struct ElementScatterMap;
+	ElementScatterMap* FindScatterMap(const FEElementMatrix& ke);
+
+	// calculate the scatter map of an element matrix
+	bool BuildScatterMap(const std::vector<int>& lmi, const std::vector<int>& lmj, bool bsymm, std::vector<int>& offsets);
+
 protected:
 	SparseMatrix*	m_pA;	//!< the actual global stiffness matrix
 	bool			m_delA;	//!< delete A in destructor
@@ -170,4 +216,27 @@ protected:
 	SparseMatrixProfile		m_MPs;		//!< the "static" part of the matrix profile
 	vector< vector<int> >	m_LM;		//!< used for building the stiffness matrix
 	int	m_nlm;				//!< nr of elements in m_LM array
+
+	// For block matrix formats, the profile is built from the block connectivity
+	// instead of the equations. This stores the block of each equation (empty otherwise).
+	vector<int>	m_eqblock;
+	int			m_nblocks;	//!< nr of blocks (rows and columns of the block profile)
+
+	// Cached scatter maps. For each element, this stores the offsets of the element
+	// matrix entries in the value array of the sparse matrix, so that repeated assembly
+	// does not need to search the sparsity pattern. A map is rebuilt when the matrix
+	// was recreated (tracked by m_scatterTag) or when the element's LM changes (detected
+	// through a hash of the LM). For symmetric element matrices that are assembled into
+	// symmetric storage, only the upper triangle is stored (see AssembleScatterSymmetric).
+	struct ElementScatterMap
+	{
+		int					tag;		//!< value of m_scatterTag when map was built
+		unsigned long long	hash;		//!< hash of the row and column indices the map was built for
+		std::vector<int>	offsets;	//!< offsets into the sparse matrix' values
+	};
+	double	m_scatterBudget;		//!< max memory (in MB) of the scatter maps
+	bool	m_scatterOverBudget;	//!< the maps of the current mesh exceed the budget
+	int		m_scatterTag;			//!< incremented each time the sparse matrix is created
+	vector<FEMeshPartition*>				m_scatterDom;	//!< domains that have scatter maps
+	vector< vector<ElementScatterMap> >		m_scatterMap;	//!< scatter maps for each domain
 };
@@ -35,6 +35,8 @@ SOFTWARE.*/
 FELinearSystem::FELinearSystem(FESolver* solver, FEGlobalMatrix& K, vector<double>& F, vector<double>& u, bool bsymm) : m_K(K), m_F(F), m_u(u), m_solver(solver)
 {
 	m_bsymm = bsymm;
+	m_assemblyMode = (solver ? solver->m_assembly_mode : ATOMIC_ASSEMBLY);
+	m_batomic = true;
 }
 
 //-----------------------------------------------------------------------------
@@ -50,6 +52,25 @@ bool FELinearSystem::IsSymmetric() const
 	return m_bsymm;
 }
 
+//-----------------------------------------------------------------------------
+// Symmetric element matrices can be assembled directly into a symmetric sparse
+// matrix through the element scatter maps. Without them, they would have to be 
+// completed before assembly, so it's cheaper to build the full element matrix.
+// Linear constraints also require the full element matrix.
+bool FELinearSystem::SymmetricElementMatrices()
+{
+	if (m_bsymm == false) return false;
+
+	SparseMatrix* A = m_K.GetSparseMatrixPtr();
+	if ((A == nullptr) || (A->isSymmetric() == false)) return false;
+	if (m_K.HasScatterMaps() == false) return false;
+
+	FEModel* fem = m_solver->GetFEModel();
+	if (fem->GetLinearConstraintManager().LinearConstraints() > 0) return false;
+
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 // Get the solver that is using this linear system
 FESolver* FELinearSystem::GetSolver()
@@ -57,12 +78,58 @@ FESolver* FELinearSystem::GetSolver()
 	return m_solver;
 }
 
+//-----------------------------------------------------------------------------
+// get the assembly mode
+int FELinearSystem::AssemblyMode() const
+{
+	return m_assemblyMode;
+}
+
+//-----------------------------------------------------------------------------
+// set the assembly mode
+void FELinearSystem::SetAssemblyMode(int mode)
+{
+	m_assemblyMode = mode;
+}
+
+//-----------------------------------------------------------------------------
+// This must be called outside a parallel region
+void FELinearSystem::BeginColor()
+{
+	// Linear constraints can couple the dofs of elements of the same color,
+	// so in that case we still need the atomic updates.
+	FEModel* fem = m_solver->GetFEModel();
+	if (fem->GetLinearConstraintManager().LinearConstraints() > 0) return;
+
+	m_batomic = false;
+	m_K.GetSparseMatrixPtr()->SetAtomicAssembly(false);
+}
+
+//-----------------------------------------------------------------------------
+// This must be called outside a parallel region
+void FELinearSystem::EndColor()
+{
+	m_batomic = true;
+	m_K.GetSparseMatrixPtr()->SetAtomicAssembly(true);
+}
+
 //-----------------------------------------------------------------------------
 //! assemble global stiffness matrix
 void FELinearSystem::Assemble(const FEElementMatrix& ke)
 {
 	if ((ke.rows() == 0) || (ke.columns() == 0)) return;
 
+	// linear constraints need the full element matrix
+	FEModel* fem = m_solver->GetFEModel();
+	FELinearConstraintManager& LCM = fem->GetLinearConstraintManager();
+	if (ke.IsSymmetric() && LCM.LinearConstraints())
+	{
+		FEElementMatrix kf(ke);
+		kf.CompleteSymmetric();
+		Assemble(kf);
+		return;
+	}
+
 	// assemble into the global stiffness
 	m_K.Assemble(ke);
 
@@ -88,8 +155,12 @@ void FELinearSystem::Assemble(const FEElementMatrix& ke)
 				if (I >= 0)
 				{
 					// dof i is not a prescribed degree of freedom
+					if (m_batomic)
+					{
 #pragma omp atomic
-					m_F[I] -= ke[i][j] * m_u[J];
+						m_F[I] -= ke.value(i, j) * m_u[J];
+					}
+					else m_F[I] -= ke.value(i, j) * m_u[J];
 				}
 			}
 
@@ -98,16 +169,16 @@ void FELinearSystem::Assemble(const FEElementMatrix& ke)
 		}
 	}
 
-#pragma omp critical
-	{
-	FEModel* fem = m_solver->GetFEModel();
-	FELinearConstraintManager& LCM = fem->GetLinearConstraintManager();
+	// linear constraints can couple dofs of different elements, so this
+	// always needs to be synchronized
 	if (LCM.LinearConstraints())
 	{
+#pragma omp critical
+		{
 		const vector<int>& en = ke.Nodes();
 		LCM.AssembleStiffness(m_K, m_F, m_u, en, lmi, lmj, ke);
+		} // omp critical
 	}
-	} // omp critical
 }
 
 //-----------------------------------------------------------------------------
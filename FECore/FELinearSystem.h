@@ -53,9 +53,26 @@ public:
 	// get symmetry flag
 	bool IsSymmetric() const;
 
+	// Returns true if symmetric element matrices (i.e. of which only the upper 
+	// triangular part is evaluated, see FEElementMatrix::SetSymmetric) can be 
+	// assembled efficiently into this linear system.
+	virtual bool SymmetricElementMatrices();
+
 	// Get the solver that is using this linear system
 	FESolver* GetSolver();
 
+	// get the assembly mode (see ASSEMBLY_MODE)
+	int AssemblyMode() const;
+
+	// set the assembly mode
+	void SetAssemblyMode(int mode);
+
+	// Begin and end the assembly of one element color. In between these calls
+	// the elements that are assembled concurrently may not share any dofs, so
+	// the global matrix and RHS are updated without atomic operations.
+	void BeginColor();
+	void EndColor();
+
 public:
 	// Assembly routine
 	// This assembles the element stiffness matrix ke into the global matrix.
@@ -71,6 +88,8 @@ public:
 
 protected:
 	bool			m_bsymm;	//!< symmetry flag
+	int				m_assemblyMode;	//!< assembly mode
+	bool			m_batomic;	//!< use atomic updates during assembly
 	FESolver*		m_solver;
 	FEGlobalMatrix& m_K;	//!< The global stiffness matrix
 	vector<double>&	m_F;	//!< Contributions from prescribed degrees of freedom
@@ -29,16 +29,142 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FEMaterialPoint.h"
 #include "DumpStream.h"
+#include "FEElement.h"
+#include "FEMeshPartition.h"
+#include "log.h"
 #include <string.h>
+#include <map>
+#include <typeinfo>
+#include <typeindex>
+#include <string>
+
+//-----------------------------------------------------------------------------
+FEMaterialPointLayout::FEMaterialPointLayout()
+{
+	for (int i = 0; i < MAX_SLOTS; ++i) m_entry[i] = 0;
+}
+
+//-----------------------------------------------------------------------------
+// The slots are keyed on the type name, since the type_info objects of the same
+// type need not be unique across shared library boundaries.
+int FEMaterialPointLayout::SlotId(const std::type_info& type, const FEMaterialPoint* pt)
+{
+	static std::map<std::string, int> slots;
+	static bool bfull = false;
+
+	int n = NO_SLOT;
+	bool bwarn = false;
+	#pragma omp critical (FEMaterialPointLayout_slot)
+	{
+		std::map<std::string, int>::iterator it = slots.find(type.name());
+		if (it != slots.end()) n = it->second;
+		else if ((int)slots.size() < MAX_SLOTS)
+		{
+			n = (int)slots.size();
+			slots[type.name()] = n;
+		}
+		else if (bfull == false)
+		{
+			bfull = bwarn = true;
+		}
+	}
+
+	// Data types without a slot still work (GetData falls back to ExtractData),
+	// but they do not benefit from the cached layout.
+	if (bwarn)
+	{
+		FEMeshPartition* dom = (pt && pt->m_elem ? pt->m_elem->GetMeshPartition() : nullptr);
+		FEModel* fem = (dom ? dom->GetFEModel() : nullptr);
+		if (fem) feLogWarningEx(fem, "Too many material point data types (max = %d).\nData of type \"%s\" and any further types will not be cached.", (int)MAX_SLOTS, type.name());
+	}
+
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+// The layout is determined by the types of the links that are searched, in the
+// order that they are searched: this point, all the next points, and then all the
+// previous points.
+FEMaterialPointLayout* FEMaterialPointLayout::Find(FEMaterialPoint* pt)
+{
+	static std::map<std::vector<std::type_index>, FEMaterialPointLayout> layouts;
+
+	std::vector<std::type_index> key;
+	key.push_back(typeid(*pt));
+	for (FEMaterialPoint* p = pt->Next(); p; p = p->Next()) key.push_back(typeid(*p));
+	key.push_back(typeid(void));
+	for (FEMaterialPoint* p = pt->Prev(); p; p = p->Prev()) key.push_back(typeid(*p));
+
+	FEMaterialPointLayout* layout = 0;
+	#pragma omp critical (FEMaterialPointLayout_find)
+	{
+		layout = &layouts[key];
+	}
+	return layout;
+}
+
+//-----------------------------------------------------------------------------
+// An entry is packed as: bit 0 = resolved flag, bits 1-16 = steps, bits 32-63 = offset.
+bool FEMaterialPointLayout::GetEntry(int slot, int& steps, std::ptrdiff_t& offset) const
+{
+	long long v;
+	#pragma omp atomic read
+	v = m_entry[slot];
+	if ((v & 1) == 0) return false;
+
+	steps = (int)((v >> 1) & 0xFFFF) - 0x8000;
+	offset = (std::ptrdiff_t)(v >> 32);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FEMaterialPointLayout::SetEntry(int slot, int steps, std::ptrdiff_t offset)
+{
+	long long v = 1 | ((long long)((steps + 0x8000) & 0xFFFF) << 1) | ((long long)offset << 32);
+	#pragma omp atomic write
+	m_entry[slot] = v;
+}
+
+//=============================================================================
 
 FEMaterialPoint::FEMaterialPoint(FEMaterialPoint* ppt)
 {
 	m_pPrev = 0;
 	m_pNext = ppt;
 	m_elem = 0;
+	m_layout = 0;
 	if (ppt) ppt->m_pPrev = this;
 }
 
+FEMaterialPoint::FEMaterialPoint(const FEMaterialPoint& mp)
+{
+	m_r0 = mp.m_r0;
+	m_rt = mp.m_rt;
+	m_J0 = mp.m_J0;
+	m_Jt = mp.m_Jt;
+	m_elem = mp.m_elem;
+	m_index = mp.m_index;
+	m_shape = mp.m_shape;
+	m_pNext = mp.m_pNext;
+	m_pPrev = mp.m_pPrev;
+	m_layout = 0;
+}
+
+FEMaterialPoint& FEMaterialPoint::operator = (const FEMaterialPoint& mp)
+{
+	m_r0 = mp.m_r0;
+	m_rt = mp.m_rt;
+	m_J0 = mp.m_J0;
+	m_Jt = mp.m_Jt;
+	m_elem = mp.m_elem;
+	m_index = mp.m_index;
+	m_shape = mp.m_shape;
+	m_pNext = mp.m_pNext;
+	m_pPrev = mp.m_pPrev;
+	m_layout = 0;
+	return *this;
+}
+
 FEMaterialPoint::~FEMaterialPoint()
 { 
 	if (m_pNext) delete m_pNext;
@@ -48,12 +174,55 @@ FEMaterialPoint::~FEMaterialPoint()
 void FEMaterialPoint::SetPrev(FEMaterialPoint* pt)
 {
 	m_pPrev = pt;
+	ClearDataLayout();
 }
 
 void FEMaterialPoint::SetNext(FEMaterialPoint* pt)
 {
 	m_pNext = pt;
 	pt->m_pPrev = this;
+	ClearDataLayout();
+}
+
+//-----------------------------------------------------------------------------
+// The chain has changed, so the layout of all the points in the chain are invalid.
+void FEMaterialPoint::ClearDataLayout()
+{
+	m_layout = 0;
+	FEMaterialPoint* root = this;
+	while (root->m_pPrev) root = root->m_pPrev;
+	for (FEMaterialPoint* pt = root; pt; pt = pt->m_pNext) pt->m_layout = 0;
+}
+
+//-----------------------------------------------------------------------------
+void FEMaterialPoint::InitDataLayout()
+{
+	m_layout = FEMaterialPointLayout::Find(this);
+
+	// child points of material point arrays
+	int n = Components();
+	for (int i = 0; i < n; ++i)
+	{
+		FEMaterialPoint* pi = GetPointData(i);
+		if (pi && (pi != this)) pi->InitDataLayout();
+	}
+
+	if (m_pNext) m_pNext->InitDataLayout();
+}
+
+//-----------------------------------------------------------------------------
+bool FEMaterialPoint::FindData(int slot, FEMaterialPoint*& pt, std::ptrdiff_t& offset)
+{
+	if (m_layout == 0) m_layout = FEMaterialPointLayout::Find(this);
+
+	int steps = 0;
+	if (m_layout->GetEntry(slot, steps, offset) == false) return false;
+	if (steps == FEMaterialPointLayout::NOT_FOUND) { pt = 0; return true; }
+
+	pt = this;
+	for (; steps > 0; --steps) pt = pt->m_pNext;
+	for (; steps < 0; ++steps) pt = pt->m_pPrev;
+	return true;
 }
 
 void FEMaterialPoint::Append(FEMaterialPoint* pt)
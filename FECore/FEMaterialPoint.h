@@ -30,10 +30,14 @@ SOFTWARE.*/
 
 #include "mat3d.h"
 #include "FETimeInfo.h"
+#include "FEMaterialPointArena.h"
 #include <vector>
+#include <cstddef>
+#include <typeinfo>
 using namespace std;
 
 class FEElement;
+class FEMaterialPointLayout;
 
 //-----------------------------------------------------------------------------
 //! Material point class
@@ -48,8 +52,12 @@ class FECORE_API FEMaterialPoint
 {
 public:
 	FEMaterialPoint(FEMaterialPoint* ppt = 0);
+	FEMaterialPoint(const FEMaterialPoint& mp);
 	virtual ~FEMaterialPoint();
 
+	// NOTE: the data layout is not copied.
+	FEMaterialPoint& operator = (const FEMaterialPoint& mp);
+
 public:
 	//! The init function is used to intialize data
 	virtual void Init();
@@ -74,9 +82,22 @@ public:
 	FEMaterialPoint* Prev() { return m_pPrev; }
     
 	//! Extract data (\todo Is it safe for a plugin to use this function?)
+	//! NOTE: This searches the material point chain with dynamic_cast, which is slow. 
+	//! Use GetData instead in performance critical code.
 	template <class T> T* ExtractData();
 	template <class T> const T* ExtractData() const;
 
+	//! Get the material point data of type T. This returns the same as ExtractData
+	//! but the location of the data in the chain is looked up in the point's layout,
+	//! so that the dynamic_cast search only happens once per layout and data type.
+	template <class T> T* GetData();
+	template <class T> const T* GetData() const;
+
+	//! Resolve the data layout of this point and all its child points. 
+	//! This is done automatically on first use, but should be called after the 
+	//! material point chain is complete (i.e. at initialization).
+	void InitDataLayout();
+
 	// assign the previous pointer
 	void SetPrev(FEMaterialPoint* pt);
 
@@ -91,6 +112,10 @@ public:
 	// serialization
 	virtual void Serialize(DumpStream& ar);
 
+	//! Return true if the data of this point (not including the points it links to)
+	//! can be copied as plain memory. See FEMATERIALPOINT_FLAT_ARENA_ALLOCATION.
+	virtual bool IsFlat() const { return false; }
+
 public:
 	vec3d		m_r0;		//!< material point position
 	vec3d		m_rt;		//!< current point position
@@ -102,9 +127,75 @@ public:
 	// pointer to element's shape function values
 	double*		m_shape;
 
+private:
+	bool FindData(int slot, FEMaterialPoint*& pt, std::ptrdiff_t& offset);
+	void ClearDataLayout();
+
 protected:
 	FEMaterialPoint*	m_pNext;    //!< next data in the list
 	FEMaterialPoint*	m_pPrev;    //!< previous data in the list
+
+private:
+	FEMaterialPointLayout*	m_layout;	//!< data layout of this point's chain (shared between points)
+};
+
+//-----------------------------------------------------------------------------
+//! Use this instead of FEMATERIALPOINT_ARENA_ALLOCATION for material point classes
+//! that don't own any heap memory (e.g. no std::vector members). The shallow state
+//! of a domain whose points are all flat is stored as a copy of its arena's memory.
+//! Derived classes are not flat, unless they opt in as well.
+#define FEMATERIALPOINT_FLAT_ARENA_ALLOCATION(theClass) \
+	FEMATERIALPOINT_ARENA_ALLOCATION \
+	bool IsFlat() const override { return (typeid(*this) == typeid(theClass)); }
+
+//-----------------------------------------------------------------------------
+//! This class caches where the data types are found in a material point chain.
+//! Material points with the same chain (i.e. the same types in the same order)
+//! share a layout. For each data type (identified by its slot), the layout stores
+//! the number of links to walk in the chain (positive for next, negative for prev)
+//! and the pointer offset of the data type in that link.
+class FECORE_API FEMaterialPointLayout
+{
+public:
+	enum { MAX_SLOTS = 256 };
+
+public:
+	FEMaterialPointLayout();
+
+	//! Get the slot of a material point data type, allocating it on first use. The
+	//! registry lives in FECore, so all modules and plugins agree on the slots.
+	//! Returns NO_SLOT when all slots are taken. The data can then still be found, 
+	//! just without the cached layout. This is reported once as a warning to the
+	//! model that pt belongs to.
+	static int SlotId(const std::type_info& type, const FEMaterialPoint* pt);
+
+	//! find (or create) the layout for this material point
+	static FEMaterialPointLayout* Find(FEMaterialPoint* pt);
+
+	//! get an entry. Returns false if the entry was not yet resolved
+	bool GetEntry(int slot, int& steps, std::ptrdiff_t& offset) const;
+
+	//! set an entry. Use steps = NOT_FOUND if the data type is not in the chain
+	void SetEntry(int slot, int steps, std::ptrdiff_t offset);
+
+	enum { NOT_FOUND = 0x7FFF };
+
+	enum { NO_SLOT = -1 };
+
+private:
+	long long	m_entry[MAX_SLOTS];	//!< packed (resolved, steps, offset) values
+};
+
+//-----------------------------------------------------------------------------
+//! Assigns a unique layout slot to each material point data type. 
+template <class T> class FEMaterialPointSlot
+{
+public:
+	static int Id(const FEMaterialPoint* pt)
+	{
+		static int slot = FEMaterialPointLayout::SlotId(typeid(T), pt);
+		return slot;
+	}
 };
 
 //-----------------------------------------------------------------------------
@@ -165,6 +256,54 @@ template <class T> inline const T* FEMaterialPoint::ExtractData() const
 	return 0;
 }
 
+//-----------------------------------------------------------------------------
+template <class T> inline T* FEMaterialPoint::GetData()
+{
+	int slot = FEMaterialPointSlot<T>::Id(this);
+	if (slot == FEMaterialPointLayout::NO_SLOT) return ExtractData<T>();
+
+	// try the layout first
+	FEMaterialPoint* pt = 0;
+	std::ptrdiff_t offset = 0;
+	if (FindData(slot, pt, offset))
+	{
+		return (pt ? (T*)((char*)pt + offset) : 0);
+	}
+
+	// resolve the entry (i.e. find the link, the same way as ExtractData does)
+	pt = this;
+	int steps = 0;
+	T* p = dynamic_cast<T*>(pt);
+	while ((p == 0) && pt->m_pNext)
+	{
+		pt = pt->m_pNext; steps++;
+		p = dynamic_cast<T*>(pt);
+	}
+	if (p == 0)
+	{
+		pt = this;
+		steps = 0;
+		while ((p == 0) && pt->m_pPrev)
+		{
+			pt = pt->m_pPrev; steps--;
+			p = dynamic_cast<T*>(pt);
+		}
+	}
+
+	if (m_layout)
+	{
+		if (p) m_layout->SetEntry(slot, steps, (char*)p - (char*)pt);
+		else m_layout->SetEntry(slot, FEMaterialPointLayout::NOT_FOUND, 0);
+	}
+
+	return p;
+}
+
+//-----------------------------------------------------------------------------
+template <class T> inline const T* FEMaterialPoint::GetData() const
+{
+	return const_cast<FEMaterialPoint*>(this)->GetData<T>();
+}
 
 //-----------------------------------------------------------------------------
 // Material point base class for materials that define vector properties
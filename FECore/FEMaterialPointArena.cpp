@@ -0,0 +1,234 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "FEMaterialPointArena.h"
+#include <stdlib.h>
+#include <new>
+#include <atomic>
+
+// Each allocation is preceded by a header that stores the pool the object was
+// allocated from (or null for the heap). The header size keeps the object 16-byte aligned.
+namespace {
+	const size_t HEADER_SIZE = 16;
+	const size_t ALIGNMENT = 16;
+
+	size_t align_size(size_t n) { return (n + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+	thread_local FEMaterialPointArena* active_arena = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+struct FEMaterialPointArena::Pool
+{
+	std::atomic<int>	refs;		//!< arena reference + number of live objects
+	std::vector<char*>	block;		//!< allocated blocks
+	std::vector<size_t>	blockCap;	//!< capacity of each block
+	std::vector<size_t>	blockUsed;	//!< used bytes in each block
+
+	Pool() : refs(1) {}
+	~Pool() { for (size_t i = 0; i < block.size(); ++i) free(block[i]); }
+};
+
+//-----------------------------------------------------------------------------
+void FEMaterialPointArena::Release(Pool* pool)
+{
+	if (--pool->refs == 0) delete pool;
+}
+
+//-----------------------------------------------------------------------------
+FEMaterialPointArena::FEMaterialPointArena(size_t blockSize)
+{
+	m_blockSize = blockSize;
+	m_pool = new Pool;
+	m_current = -1;
+	m_used = 0;
+	m_size = 0;
+}
+
+//-----------------------------------------------------------------------------
+FEMaterialPointArena::~FEMaterialPointArena()
+{
+	// If there are still objects alive, the memory is released when the last one
+	// is deleted.
+	Release(m_pool);
+}
+
+//-----------------------------------------------------------------------------
+int FEMaterialPointArena::Objects() const
+{
+	return m_pool->refs - 1;
+}
+
+//-----------------------------------------------------------------------------
+void FEMaterialPointArena::Clear()
+{
+	// If objects are still alive, we start a new pool and leave the old one to them.
+	if (m_pool->refs == 1)
+	{
+		for (size_t i = 0; i < m_pool->block.size(); ++i) free(m_pool->block[i]);
+		m_pool->block.clear();
+		m_pool->blockCap.clear();
+		m_pool->blockUsed.clear();
+	}
+	else
+	{
+		Release(m_pool);
+		m_pool = new Pool;
+	}
+	m_current = -1;
+	m_used = 0;
+	m_size = 0;
+}
+
+//-----------------------------------------------------------------------------
+// start allocating from the first block again
+void FEMaterialPointArena::Reset()
+{
+	m_current = (m_pool->block.empty() ? -1 : 0);
+	m_used = 0;
+	m_size = 0;
+	m_pool->blockUsed.assign(m_pool->block.size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+void* FEMaterialPointArena::Alloc(size_t size)
+{
+	size = align_size(size);
+
+	// find a block that has enough room
+	std::vector<char*>& blocks = m_pool->block;
+	std::vector<size_t>& blockCap = m_pool->blockCap;
+	std::vector<size_t>& blockUsed = m_pool->blockUsed;
+	while ((m_current < 0) || (m_used + size > blockCap[m_current]))
+	{
+		if (m_current + 1 < (int)blocks.size())
+		{
+			m_current++;
+		}
+		else
+		{
+			size_t cap = (size > m_blockSize ? size : m_blockSize);
+			char* block = (char*)malloc(cap);
+			if (block == nullptr) throw std::bad_alloc();
+			blocks.push_back(block);
+			blockCap.push_back(cap);
+			blockUsed.push_back(0);
+			m_current = (int)blocks.size() - 1;
+		}
+		m_used = 0;
+	}
+
+	void* p = blocks[m_current] + m_used;
+	m_used += size;
+	m_size += size;
+	blockUsed[m_current] = m_used;
+	return p;
+}
+
+//-----------------------------------------------------------------------------
+bool FEMaterialPointArena::Owns(const void* p) const
+{
+	if (p == nullptr) return false;
+	const char* pb = (const char*)p - HEADER_SIZE;
+	return (*((Pool* const*)pb) == m_pool);
+}
+
+//-----------------------------------------------------------------------------
+int FEMaterialPointArena::Blocks() const
+{
+	return (int)m_pool->block.size();
+}
+
+//-----------------------------------------------------------------------------
+char* FEMaterialPointArena::BlockData(int i)
+{
+	return m_pool->block[i];
+}
+
+//-----------------------------------------------------------------------------
+size_t FEMaterialPointArena::BlockUsed(int i) const
+{
+	return m_pool->blockUsed[i];
+}
+
+//-----------------------------------------------------------------------------
+FEMaterialPointArena* FEMaterialPointArena::SetActive(FEMaterialPointArena* arena)
+{
+	FEMaterialPointArena* prev = active_arena;
+	active_arena = arena;
+
+	// we can reuse the memory if all previous objects were deleted
+	if (arena && (arena->Objects() == 0)) arena->Reset();
+
+	return prev;
+}
+
+//-----------------------------------------------------------------------------
+FEMaterialPointArena* FEMaterialPointArena::Active()
+{
+	return active_arena;
+}
+
+//-----------------------------------------------------------------------------
+void* FEMaterialPointArena::Allocate(size_t size)
+{
+	FEMaterialPointArena* arena = active_arena;
+
+	char* p = nullptr;
+	Pool* pool = nullptr;
+	if (arena)
+	{
+		p = (char*)arena->Alloc(HEADER_SIZE + size);
+		pool = arena->m_pool;
+		pool->refs++;
+	}
+	else
+	{
+		p = (char*)malloc(HEADER_SIZE + size);
+		if (p == nullptr) throw std::bad_alloc();
+	}
+
+	*((Pool**)p) = pool;
+	return p + HEADER_SIZE;
+}
+
+//-----------------------------------------------------------------------------
+void FEMaterialPointArena::Deallocate(void* p)
+{
+	if (p == nullptr) return;
+
+	char* pb = (char*)p - HEADER_SIZE;
+	Pool* pool = *((Pool**)pb);
+	if (pool)
+	{
+		// the memory is released with the pool
+		Release(pool);
+	}
+	else free(pb);
+}
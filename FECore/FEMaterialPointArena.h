@@ -0,0 +1,127 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "fecore_api.h"
+#include <vector>
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+//! This class implements a simple arena (or bump) allocator for material point
+//! data. Memory is taken from large blocks in the order it is requested, so when 
+//! the material points are created element by element, the data of an element's
+//! integration points ends up contiguous in memory. Individual allocations are
+//! not returned to the arena, but the blocks are reused once all the objects that
+//! were allocated from the arena have been deleted. If the arena is destroyed while
+//! objects are still alive, its memory is released when the last one is deleted.
+//!
+//! Material point classes opt in with the FEMATERIALPOINT_ARENA_ALLOCATION macro. 
+//! Objects of those classes are allocated from the active arena (see SetActive),
+//! or from the heap when no arena is active.
+class FECORE_API FEMaterialPointArena
+{
+public:
+	FEMaterialPointArena(size_t blockSize = 1048576);
+	~FEMaterialPointArena();
+
+	//! release all memory. This should only be called when no objects are alive.
+	void Clear();
+
+	//! total number of bytes handed out
+	size_t Size() const { return m_size; }
+
+	//! number of objects in the arena that have not been deleted yet
+	int Objects() const;
+
+	//! see if an object was allocated from this arena
+	bool Owns(const void* p) const;
+
+	//! number of memory blocks
+	int Blocks() const;
+
+	//! get a memory block
+	char* BlockData(int i);
+
+	//! number of bytes in use in a block
+	size_t BlockUsed(int i) const;
+
+public:
+	//! set the active arena (or null to use the heap). Returns the previous arena.
+	static FEMaterialPointArena* SetActive(FEMaterialPointArena* arena);
+
+	//! return the active arena for the calling thread
+	static FEMaterialPointArena* Active();
+
+	//! allocate an object, from the active arena if there is one
+	static void* Allocate(size_t size);
+
+	//! deallocate an object that was allocated with Allocate
+	static void Deallocate(void* p);
+
+private:
+	void* Alloc(size_t size);
+	void Reset();
+
+	// The blocks are owned by a reference counted pool. The arena holds one 
+	// reference and each live object holds another.
+	struct Pool;
+	static void Release(Pool* pool);
+
+private:
+	size_t	m_blockSize;	//!< size of new blocks
+	Pool*	m_pool;			//!< allocated blocks
+	int		m_current;		//!< index of block we're allocating from
+	size_t	m_used;			//!< used bytes in current block
+	size_t	m_size;			//!< total number of bytes handed out
+
+	FEMaterialPointArena(const FEMaterialPointArena&) {}
+	void operator = (const FEMaterialPointArena&) {}
+};
+
+//-----------------------------------------------------------------------------
+//! Makes an arena the active arena for the lifetime of this object, and restores
+//! the previously active arena afterwards (also when an exception is thrown).
+class FEMaterialPointArenaScope
+{
+public:
+	explicit FEMaterialPointArenaScope(FEMaterialPointArena* arena) { m_prev = FEMaterialPointArena::SetActive(arena); }
+	~FEMaterialPointArenaScope() { FEMaterialPointArena::SetActive(m_prev); }
+
+private:
+	FEMaterialPointArena*	m_prev;
+
+	FEMaterialPointArenaScope(const FEMaterialPointArenaScope&);
+	void operator = (const FEMaterialPointArenaScope&);
+};
+
+//-----------------------------------------------------------------------------
+//! Add this to the declaration of a material point class to allocate its objects
+//! (and those of derived classes) from the active material point arena.
+#define FEMATERIALPOINT_ARENA_ALLOCATION \
+public: \
+	static void* operator new(size_t size) { return FEMaterialPointArena::Allocate(size); } \
+	static void operator delete(void* p) { FEMaterialPointArena::Deallocate(p); }
@@ -63,13 +63,13 @@ public:
 	FEMaterialPointProperty_T() : FEMaterialPointProperty(fecoreType<A>::type()) {}
 	void set(FEMaterialPoint& mp, const A& Q)
 	{
-		T& pt = *mp.ExtractData<T>();
+		T& pt = *mp.GetData<T>();
 		data(pt) = Q;
 	}
 
 	void get(FEMaterialPoint& mp, A& Q)
 	{
-		T& pt = *mp.ExtractData<T>();
+		T& pt = *mp.GetData<T>();
 		Q = data(pt);
 	}
 
@@ -64,7 +64,14 @@ bool FEMathController::Init()
 
 double FEMathController::GetValue(double time)
 {
-	vector<double> p(1 + m_param.size());
+	// use a stack buffer for the variables, unless there are many
+	const int MAX_VARS = 16;
+	int nvar = 1 + (int)m_param.size();
+	double buf[MAX_VARS];
+	vector<double> tmp;
+	double* p = buf;
+	if (nvar > MAX_VARS) { tmp.resize(nvar); p = tmp.data(); }
+
 	p[0] = time;
 	for (int i = 0; i < m_param.size(); ++i) p[1 + i] = m_param[i].value<double>();
 	return m_val.value_s(p);
@@ -92,8 +92,27 @@ void FEMesh::Serialize(DumpStream& ar)
 	// mostly for efficiency, so we tell the archive not to store the pointers
 	ar.LockPointerTable();
 	{
+		// the nodes need to be connected to their dof data before they are read
+		if (ar.IsShallow() == false)
+		{
+			if (ar.IsSaving())
+			{
+				int nodes = Nodes();
+				int ndofs = m_dofData.DOFS();
+				ar << nodes << ndofs;
+			}
+			else
+			{
+				int nodes, ndofs;
+				ar >> nodes >> ndofs;
+				if (nodes > 0) CreateNodes(nodes);
+				SetDOFS(ndofs);
+			}
+		}
+
 		// store the node list
-		ar & m_Node;
+		if (ar.IsShallow()) SerializeNodalState(ar);
+		else ar & m_Node;
 	}
 	ar.UnlockPointerTable();
 
@@ -206,6 +225,52 @@ FEMesh* FEMesh::LoadClass(DumpStream& ar, FEMesh* p)
 	return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+// In a shallow archive only the state of the nodes is stored. Since the mesh 
+// structure does not change, the dof data is streamed directly as blocks from 
+// the node data store and the kinematic data of each node as a single block. 
+// This is much cheaper than serializing the nodes one item at a time, which
+// matters since the state is stored before each time step when retries are enabled.
+void FEMesh::SerializeNodalState(DumpStream& ar)
+{
+	int NN = Nodes();
+	size_t nd = (size_t) NN * m_dofData.DOFS();
+	assert(m_dofData.Nodes() == NN);
+
+	const int NK = 7;
+	vec3d v[NK];
+	if (ar.IsSaving())
+	{
+		ar.write_raw(m_dofData.Values(), nd);
+		ar.write_raw(m_dofData.PrevValues(), nd);
+		ar.write_raw(m_dofData.Loads(), nd);
+
+		for (int i = 0; i < NN; ++i)
+		{
+			FENode& node = m_Node[i];
+			v[0] = node.m_rt; v[1] = node.m_at;
+			v[2] = node.m_rp; v[3] = node.m_vp; v[4] = node.m_ap;
+			v[5] = node.m_dt; v[6] = node.m_dp;
+			ar.write_raw(v, NK);
+		}
+	}
+	else
+	{
+		ar.read_raw(m_dofData.Values(), nd);
+		ar.read_raw(m_dofData.PrevValues(), nd);
+		ar.read_raw(m_dofData.Loads(), nd);
+
+		for (int i = 0; i < NN; ++i)
+		{
+			ar.read_raw(v, NK);
+			FENode& node = m_Node[i];
+			node.m_rt = v[0]; node.m_at = v[1];
+			node.m_rp = v[2]; node.m_vp = v[3]; node.m_ap = v[4];
+			node.m_dt = v[5]; node.m_dp = v[6];
+		}
+	}
+}
+
 //-----------------------------------------------------------------------------
 //  Allocates storage for mesh data.
 //
@@ -213,6 +278,8 @@ void FEMesh::CreateNodes(int nodes)
 {
 	assert(nodes);
 	m_Node.resize(nodes);
+	m_dofData.Resize(nodes);
+	AttachNodeData();
 
 	// set the default node IDs
 	for (int i=0; i<nodes; ++i) Node(i).SetID(i+1);
@@ -234,14 +301,33 @@ void FEMesh::AddNodes(int nodes)
 	if (N0 > 0) n0 = m_Node[N0-1].GetID() + 1;
 
 	m_Node.resize(N0 + nodes);
+	m_dofData.Resize(N0 + nodes);
+	AttachNodeData();
 	for (int i=0; i<nodes; ++i) m_Node[i+N0].SetID(n0+i);
 }
 
 //-----------------------------------------------------------------------------
 void FEMesh::SetDOFS(int n)
+{
+	// this resets all the dof data
+	m_dofData.SetDOFS(n);
+	AttachNodeData();
+}
+
+//-----------------------------------------------------------------------------
+// (re-)connect the nodes to their data in the dof store. This must be called
+// each time the node array or the dof store is reallocated.
+void FEMesh::AttachNodeData()
 {
 	int NN = Nodes();
-	for (int i=0; i<NN; ++i) m_Node[i].SetDOFS(n);
+	for (int i=0; i<NN; ++i) m_dofData.Attach(m_Node[i], i);
+}
+
+//-----------------------------------------------------------------------------
+//! copy the current nodal dof values to the previous values for all nodes
+void FEMesh::UpdateNodalValues()
+{
+	m_dofData.UpdateValues();
 }
 
 //-----------------------------------------------------------------------------
@@ -334,6 +420,17 @@ void FEMesh::InitMaterialPoints()
     {
         FEDomain& dom = Domain(i);
         dom.InitMaterialPoints();
+
+		// resolve the data layout of the material points
+		for (int j = 0; j < dom.Elements(); ++j)
+		{
+			FEElement& el = dom.ElementRef(j);
+			for (int n = 0; n < el.GaussPoints(); ++n)
+			{
+				FEMaterialPoint* mp = el.GetMaterialPoint(n);
+				if (mp) mp->InitDataLayout();
+			}
+		}
     }
 }
 
@@ -341,6 +438,7 @@ void FEMesh::InitMaterialPoints()
 void FEMesh::Clear()
 {
 	m_Node.clear();
+	m_dofData.Clear();
 	for (size_t i=0; i<m_Domain.size (); ++i) delete m_Domain [i];
 
 	// TODO: Surfaces are currently managed by the classes that use them so don't delete them
@@ -1032,6 +1130,7 @@ void FEMesh::CopyFrom(FEMesh& mesh)
 
 	int N0 = mesh.Nodes();
 	CreateNodes(N0);
+	SetDOFS(mesh.m_dofData.DOFS());
 	for (int i = 0; i < N0; ++i)
 	{
 		Node(i) = mesh.Node(i);
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #pragma once
 #include "FENode.h"
+#include "FENodeDataStore.h"
 #include "FENodeElemList.h"
 #include "FENodeSet.h"
 #include "FEFacetSet.h"
@@ -103,6 +104,12 @@ public:
 	//! Set the number of degrees of freedom on this mesh
 	void SetDOFS(int n);
 
+	//! return the dof data of all nodes
+	FENodeDataStore& NodeDataStore() { return m_dofData; }
+
+	//! copy current nodal values to previous values
+	void UpdateNodalValues();
+
 	//! update bounding box
 	void UpdateBox();
 
@@ -228,6 +235,10 @@ public:
 	// create a copy of this mesh
 	void CopyFrom(FEMesh& mesh);
 
+private:
+	//! stream the nodal state (shallow archives only)
+	void SerializeNodalState(DumpStream& ar);
+
 public:
 	//! Calculate the surface representing the element boundaries
 	//! boutside : include all exterior facets
@@ -262,6 +273,7 @@ public: // data maps
 
 private:
 	vector<FENode>		m_Node;		//!< nodes
+	FENodeDataStore		m_dofData;	//!< dof data of all nodes
 	vector<FEDomain*>	m_Domain;	//!< list of domains
 	vector<FESurface*>	m_Surf;		//!< surfaces
 	vector<FEEdge*>		m_Edge;		//!< Edges
@@ -281,6 +293,9 @@ private:
 	FEElementLUT*	m_LUT;
 
 	FEModel*	m_fem;
+private:
+	void AttachNodeData();
+
 private:
 	//! hide the copy constructor
 	FEMesh(FEMesh& m){}
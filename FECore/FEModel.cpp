@@ -100,6 +100,7 @@ public:
 		m_ftime0 = 0;
 
 		m_nupdates = 0;
+		m_nparamEvals = 0;
 
 		m_bsolved = false;
 
@@ -150,6 +151,7 @@ public: // TODO: Find a better place for these parameters
 	bool	m_block_log;
 
 	int		m_nupdates;	//!< number of calls to FEModel::Update
+	int		m_nparamEvals;	//!< number of calls to FEModel::EvaluateLoadParameters
 
 public:
 	std::vector<FEMaterial*>				m_MAT;		//!< array of materials
@@ -599,6 +601,13 @@ void FEModel::IncrementUpdateCounter()
 	m_imp->m_nupdates++;
 }
 
+//-----------------------------------------------------------------------------
+// get the number of calls to EvaluateLoadParameters()
+int FEModel::LoadParameterCounter() const
+{
+	return m_imp->m_nparamEvals;
+}
+
 //-----------------------------------------------------------------------------
 void FEModel::Update()
 {
@@ -1118,7 +1127,7 @@ bool FEModel::RCI_Rewind()
 bool FEModel::RCI_ClearRewindStack()
 {
 	if (m_imp->m_dmp.size() == 0) return false;
-	m_imp->m_dmp.clear();
+	m_imp->m_dmp.release();
 	return true;
 }
 
@@ -1198,6 +1207,9 @@ bool FEModel::RCI_Advance()
 	// this callback to modify time step)
 	DoCallback(CB_UPDATE_TIME);
 
+	// the solver may need to limit the time step size
+	step->m_dt = step->GetFESolver()->TimeStepSize(step->m_dt);
+
 	// update time
 	FETimeInfo& tp = GetTime();
 	double newTime = tp.currentTime + step->m_dt;
@@ -1630,6 +1642,9 @@ void FEModel::SetPrintParametersFlag(bool b)
 //-----------------------------------------------------------------------------
 bool FEModel::EvaluateLoadParameters()
 {
+	// this tells cached parameter values that they need to be re-evaluated
+	m_imp->m_nparamEvals++;
+
 	feLog("\n");
 	int NLC = LoadControllers();
 	for (int i = 0; i<(int)m_imp->m_Param.size(); ++i)
@@ -1939,6 +1954,7 @@ void FEModel::CopyFrom(FEModel& fem)
 	FEMesh& mesh = GetMesh();
 	int N = sourceMesh.Nodes();
 	mesh.CreateNodes(N);
+	mesh.SetDOFS(sourceMesh.NodeDataStore().DOFS());
 	for (int i=0; i<N; ++i)
 	{
 		mesh.Node(i) = sourceMesh.Node(i);
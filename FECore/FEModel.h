@@ -442,6 +442,9 @@ public:
 	// this can be used to change the update counter
 	void IncrementUpdateCounter();
 
+	// get the number of calls to EvaluateLoadParameters()
+	int LoadParameterCounter() const;
+
 protected:
 	FEParamValue GetMeshParameter(const ParamString& paramString);
 
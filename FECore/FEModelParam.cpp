@@ -54,6 +54,7 @@ void FEModelParam::Serialize(DumpStream& ar)
 FEParamDouble::FEParamDouble()
 {
 	m_val = fecore_new<FEScalarValuator>("const", nullptr);
+	m_pconst = (m_val ? m_val->constValue() : nullptr);
 }
 
 FEParamDouble::~FEParamDouble()
@@ -64,6 +65,7 @@ FEParamDouble::~FEParamDouble()
 FEParamDouble::FEParamDouble(const FEParamDouble& p)
 {
 	m_val = p.m_val->copy();
+	m_pconst = m_val->constValue();
 	m_scl = p.m_scl;
 	m_dom = p.m_dom;
 }
@@ -81,6 +83,7 @@ void FEParamDouble::setValuator(FEScalarValuator* val)
 {
 	if (m_val) delete m_val;
 	m_val = val;
+	m_pconst = (val ? val->constValue() : nullptr);
 	if (val) val->SetModelParam(this);
 }
 
@@ -97,15 +100,33 @@ bool FEParamDouble::isConst() const { return m_val->isConst(); };
 double& FEParamDouble::constValue() { assert(isConst());  return *m_val->constValue(); }
 double FEParamDouble::constValue() const { assert(isConst()); return *m_val->constValue(); }
 
+int FEParamDouble::dependency() const { return m_val->dependency(); }
+
+void FEParamDouble::values(int n, const FEMaterialPoint* const* pt, double* val)
+{
+	if (m_pconst)
+	{
+		double v = m_scl*(*m_pconst);
+		for (int i = 0; i < n; ++i) val[i] = v;
+		return;
+	}
+
+	m_val->values(n, pt, val);
+	for (int i = 0; i < n; ++i) val[i] *= m_scl;
+}
+
 void FEParamDouble::Serialize(DumpStream& ar)
 {
 	FEModelParam::Serialize(ar);
 	ar & m_val;
+	if (ar.IsLoading()) m_pconst = (m_val ? m_val->constValue() : nullptr);
 }
 
 bool FEParamDouble::Init()
 {
-	return (m_val ? m_val->Init() : true);
+	if (m_val && (m_val->Init() == false)) return false;
+	m_pconst = (m_val ? m_val->constValue() : nullptr);
+	return true;
 }
 
 //---------------------------------------------------------------------------------------
@@ -80,7 +80,11 @@ public:
 	FEScalarValuator* valuator();
 
 	// evaluate the parameter at a material point
-	double operator () (const FEMaterialPoint& pt) { return m_scl*(*m_val)(pt); }
+	// (constant values are read directly, without going through the valuator)
+	double operator () (const FEMaterialPoint& pt) { return m_scl*(m_pconst ? *m_pconst : (*m_val)(pt)); }
+
+	// evaluate the parameter at n material points (e.g. all integration points of an element)
+	void values(int n, const FEMaterialPoint* const* pt, double* val);
 
 	// is this a const value
 	bool isConst() const;
@@ -89,12 +93,16 @@ public:
 	double& constValue();
 	double constValue() const;
 
+	// return how the parameter depends on time and position (see FEScalarValuator::Dependency)
+	int dependency() const;
+
 	void Serialize(DumpStream& ar) override;
 
 	bool Init();
 
 private:
 	FEScalarValuator*	m_val;
+	double*				m_pconst;	//!< points to the value of const valuators
 };
 
 //=======================================================================================
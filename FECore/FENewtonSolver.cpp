@@ -58,6 +58,7 @@ BEGIN_FECORE_CLASS(FENewtonSolver, FESolver)
 	ADD_PARAMETER(m_Rtol                , "rtol"        );
 	ADD_PARAMETER(m_Rmin, FE_RANGE_GREATER_OR_EQUAL(0.0), "min_residual");
 	ADD_PARAMETER(m_Rmax, FE_RANGE_GREATER_OR_EQUAL(0.0), "max_residual");
+	ADD_PARAMETER(m_scatterMapBudget    , "scatter_map_budget");
 
 	// obsolete parameters (Should be set via the qn_method)
 	ADD_PARAMETER(m_qndefault           , "qnmethod", 0, "BFGS\0BROYDEN\0JFNK\0");
@@ -108,6 +109,8 @@ FENewtonSolver::FENewtonSolver(FEModel* pfem) : FESolver(pfem)
 	m_force_partition = 0;
 	m_breformtimestep = true;
 	m_breformAugment = false;
+
+	m_scatterMapBudget = 512.0;
 }
 
 //-----------------------------------------------------------------------------
@@ -394,6 +397,7 @@ bool FENewtonSolver::AllocateLinearSystem()
 		feLogError("Failed allocating stiffness matrix.");
 		return false;
 	}
+	m_pK->SetScatterMapBudget(m_scatterMapBudget);
 
 	return true;
 }
@@ -632,7 +636,7 @@ bool FENewtonSolver::Quasin()
 		double ls = QNSolve();
 
 		// update solution vector
-		for (int i = 0; i<m_neq; ++i) m_Ui[i] += ls*m_ui[i];
+		vaxpy(m_neq, ls, &m_ui[0], &m_Ui[0]);
 
 		feLog(" Nonlinear solution status: time= %lg\n", tp.currentTime);
 		feLog("\tstiffness updates             = %d\n", m_qnstrategy->m_nups);
@@ -1183,7 +1187,7 @@ void FENewtonSolver::Update2(const vector<double>& ui)
 		if (node.m_rid == -1)
 		{
 			vec3d dv(0, 0, 0);
-			for (int j = 0; j < node.m_ID.size(); ++j)
+			for (int j = 0; j < node.dofs(); ++j)
 			{
 				int nj = -node.m_ID[j] - 2; if (nj >= 0) node.set(j, node.get(j) + ui[nj]);
 			}
@@ -242,6 +242,7 @@ public:
 	FEGlobalMatrix*		m_pK;			//!< global stiffness matrix
     bool				m_breshape;		//!< Matrix reshape flag
 	bool				m_persistMatrix;//!< Don't delete stiffness matrix until necessary (if true, K is deleted at end of time step)
+	double				m_scatterMapBudget;	//!< max memory (in MB) of the element scatter maps (0 = no maps, < 0 = no limit)
 
 	// data used by Quasin
 	vector<double> m_R0;	//!< residual at iteration i-1
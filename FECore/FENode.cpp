@@ -29,6 +29,7 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FENode.h"
 #include "DumpStream.h"
+#include <assert.h>
 
 //=============================================================================
 // FENode
@@ -43,20 +44,34 @@ FENode::FENode()
 
 	// default ID
 	m_nID = -1;
+
+	// dof data is assigned by the FENodeDataStore
+	m_ndofs = 0;
+	m_ID = nullptr;
+	m_BC = nullptr;
+	m_val_t = nullptr;
+	m_val_p = nullptr;
+	m_Fr = nullptr;
 }
 
 //-----------------------------------------------------------------------------
 void FENode::SetDOFS(int n)
 {
+	assert(n == m_ndofs);
+
 	// initialize dof stuff
-	m_ID.assign(n, -1);
-	m_BC.assign(n, 0);
-	m_val_t.assign(n, 0.0);
-	m_val_p.assign(n, 0.0);
-	m_Fr.assign(n, 0.0);
+	for (int i = 0; i < m_ndofs; ++i)
+	{
+		m_ID[i] = -1;
+		m_BC[i] = 0;
+		m_val_t[i] = 0.0;
+		m_val_p[i] = 0.0;
+		m_Fr[i] = 0.0;
+	}
 }
 
 //-----------------------------------------------------------------------------
+// NOTE: The copy refers to the same dof data as n.
 FENode::FENode(const FENode& n)
 {
 	m_r0 = n.m_r0;
@@ -73,6 +88,7 @@ FENode::FENode(const FENode& n)
 	m_rid = n.m_rid;
 	m_nstate = n.m_nstate;
 
+	m_ndofs = n.m_ndofs;
 	m_ID = n.m_ID;
 	m_BC = n.m_BC;
 	m_val_t = n.m_val_t;
@@ -81,6 +97,7 @@ FENode::FENode(const FENode& n)
 }
 
 //-----------------------------------------------------------------------------
+// NOTE: This copies the dof data of n to this node's dof data.
 FENode& FENode::operator = (const FENode& n)
 {
 	m_r0 = n.m_r0;
@@ -97,30 +114,40 @@ FENode& FENode::operator = (const FENode& n)
 	m_rid = n.m_rid;
 	m_nstate = n.m_nstate;
 
-	m_ID = n.m_ID;
-	m_BC = n.m_BC;
-	m_val_t = n.m_val_t;
-	m_val_p = n.m_val_p;
-	m_Fr = n.m_Fr;
+	if (this != &n)
+	{
+		assert(m_ndofs == n.m_ndofs);
+		int ndofs = (m_ndofs < n.m_ndofs ? m_ndofs : n.m_ndofs);
+		for (int i = 0; i < ndofs; ++i)
+		{
+			m_ID[i] = n.m_ID[i];
+			m_BC[i] = n.m_BC[i];
+			m_val_t[i] = n.m_val_t[i];
+			m_val_p[i] = n.m_val_p[i];
+			m_Fr[i] = n.m_Fr[i];
+		}
+	}
 
 	return (*this);
 }
 
 //-----------------------------------------------------------------------------
 // Serialize
+// NOTE: When loading, the node must already be attached to its dof data.
 void FENode::Serialize(DumpStream& ar)
 {
 	ar & m_nID;
 	ar & m_rt & m_at;
 	ar & m_rp & m_vp & m_ap;
-	ar & m_Fr;
-	ar & m_val_t & m_val_p;
+	for (int i = 0; i < m_ndofs; ++i) ar & m_Fr[i];
+	for (int i = 0; i < m_ndofs; ++i) ar & m_val_t[i];
+	for (int i = 0; i < m_ndofs; ++i) ar & m_val_p[i];
     ar & m_dt & m_dp;
 	if (ar.IsShallow() == false)
 	{
 		ar & m_nstate;
-		ar & m_ID;
-		ar & m_BC;
+		for (int i = 0; i < m_ndofs; ++i) ar & m_ID[i];
+		for (int i = 0; i < m_ndofs; ++i) ar & m_BC[i];
 		ar & m_r0;
 		ar & m_rid;
 		ar & m_d0;
@@ -131,5 +158,5 @@ void FENode::Serialize(DumpStream& ar)
 //! Update nodal values, which copies the current values to the previous array
 void FENode::UpdateValues()
 {
-	m_val_p = m_val_t;
+	for (int i = 0; i < m_ndofs; ++i) m_val_p[i] = m_val_t[i];
 }
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include <vector>
 
 class DumpStream;
+class FENodeDataStore;
 
 //-----------------------------------------------------------------------------
 //! This class defines a finite element node
@@ -44,6 +45,11 @@ class DumpStream;
 //! gives the equation number in the linear system of equations, (b) -1 if the
 //! dof is fixed, and (c) < -1 if the dof corresponds to a prescribed dof. In
 //! that case the corresponding equation number is given by -ID-2.
+//!
+//! The degree of freedom data (m_ID and the value, load and bc arrays) is not
+//! owned by the node, but stored in the FENodeDataStore of the mesh. Copies of a
+//! node therefore refer to the same dof data. The assignment operator copies the
+//! dof data into the storage of the target node.
 
 class FECORE_API FENode
 {
@@ -66,7 +72,8 @@ public:
 	//! assignment operator
 	FENode& operator = (const FENode& n);
 
-	//! Set the number of DOFS
+	//! Reset the dof data to the default values. 
+	//! The node must be attached to a FENodeDataStore with n dofs.
 	void SetDOFS(int n);
 
 	//! Get the nodal ID
@@ -146,7 +153,7 @@ public:
 	int get_bc(int ndof) const { return (m_BC[ndof] & 0x0F); }
 	bool is_active(int ndof) const { return ((m_BC[ndof] & 0xF0) != 0); }
 
-	int dofs() const { return (int) m_ID.size(); }
+	int dofs() const { return m_ndofs; }
     
 public:
     vec3d   m_s0() { return m_r0 - m_d0; }
@@ -154,11 +161,15 @@ public:
     vec3d   m_sp() { return m_rp - m_dp; }
 
 private:
-	std::vector<int>		m_BC;		//!< boundary condition array
-	std::vector<double>		m_val_t;	//!< current nodal DOF values
-	std::vector<double>		m_val_p;	//!< previous nodal DOF values
-	std::vector<double>		m_Fr;		//!< equivalent nodal forces
+	// The following point into the mesh' FENodeDataStore
+	int			m_ndofs;	//!< number of dofs
+	int*		m_BC;		//!< boundary condition array
+	double*		m_val_t;	//!< current nodal DOF values
+	double*		m_val_p;	//!< previous nodal DOF values
+	double*		m_Fr;		//!< equivalent nodal forces
 
 public:
-	std::vector<int>		m_ID;	//!< nodal equation numbers
+	int*		m_ID;	//!< nodal equation numbers
+
+	friend class FENodeDataStore;
 };
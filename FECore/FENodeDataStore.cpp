@@ -0,0 +1,104 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "FENodeDataStore.h"
+#include "FENode.h"
+
+//-----------------------------------------------------------------------------
+FENodeDataStore::FENodeDataStore()
+{
+	m_nodes = 0;
+	m_ndofs = 0;
+}
+
+//-----------------------------------------------------------------------------
+void FENodeDataStore::SetDOFS(int ndofs)
+{
+	m_ndofs = ndofs;
+	int N = m_nodes*m_ndofs;
+	m_ID.assign(N, -1);
+	m_BC.assign(N, 0);
+	m_val_t.assign(N, 0.0);
+	m_val_p.assign(N, 0.0);
+	m_Fr.assign(N, 0.0);
+}
+
+//-----------------------------------------------------------------------------
+void FENodeDataStore::Resize(int nodes)
+{
+	m_nodes = nodes;
+	int N = m_nodes*m_ndofs;
+	m_ID.resize(N, -1);
+	m_BC.resize(N, 0);
+	m_val_t.resize(N, 0.0);
+	m_val_p.resize(N, 0.0);
+	m_Fr.resize(N, 0.0);
+}
+
+//-----------------------------------------------------------------------------
+void FENodeDataStore::Clear()
+{
+	m_nodes = 0;
+	m_ndofs = 0;
+	m_ID.clear();
+	m_BC.clear();
+	m_val_t.clear();
+	m_val_p.clear();
+	m_Fr.clear();
+}
+
+//-----------------------------------------------------------------------------
+void FENodeDataStore::Attach(FENode& node, int n)
+{
+	if (m_ndofs == 0)
+	{
+		node.m_ndofs = 0;
+		node.m_ID = nullptr;
+		node.m_BC = nullptr;
+		node.m_val_t = nullptr;
+		node.m_val_p = nullptr;
+		node.m_Fr = nullptr;
+	}
+	else
+	{
+		int m = n*m_ndofs;
+		node.m_ndofs = m_ndofs;
+		node.m_ID = &m_ID[m];
+		node.m_BC = &m_BC[m];
+		node.m_val_t = &m_val_t[m];
+		node.m_val_p = &m_val_p[m];
+		node.m_Fr = &m_Fr[m];
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FENodeDataStore::UpdateValues()
+{
+	m_val_p = m_val_t;
+}
@@ -0,0 +1,85 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "fecore_api.h"
+#include <vector>
+
+class FENode;
+class DumpStream;
+
+//-----------------------------------------------------------------------------
+//! This class stores the degree of freedom data of all the nodes of a mesh
+//! in contiguous arrays (equation numbers, boundary flags, current and previous
+//! values and nodal loads). The data of node i, dof j is stored at i*DOFS() + j.
+//! The FENode class accesses its data through pointers into these arrays, so
+//! loops over the nodes stream linearly through memory.
+class FECORE_API FENodeDataStore
+{
+public:
+	FENodeDataStore();
+
+	//! Set the number of dofs per node. This resets all the data.
+	void SetDOFS(int ndofs);
+
+	//! Resize the store for a new number of nodes. Data of existing nodes is 
+	//! preserved and new nodes are initialized to their default values.
+	void Resize(int nodes);
+
+	//! clear all data
+	void Clear();
+
+	//! number of nodes
+	int Nodes() const { return m_nodes; }
+
+	//! number of dofs per node
+	int DOFS() const { return m_ndofs; }
+
+	//! Connect a node to the data of slot n
+	void Attach(FENode& node, int n);
+
+	//! copy all the current values to the previous values
+	void UpdateValues();
+
+public:
+	// direct access to the flat arrays
+	int*    ID() { return (m_ID.empty() ? nullptr : &m_ID[0]); }
+	int*    BC() { return (m_BC.empty() ? nullptr : &m_BC[0]); }
+	double* Values() { return (m_val_t.empty() ? nullptr : &m_val_t[0]); }
+	double* PrevValues() { return (m_val_p.empty() ? nullptr : &m_val_p[0]); }
+	double* Loads() { return (m_Fr.empty() ? nullptr : &m_Fr[0]); }
+
+private:
+	int		m_nodes;	//!< number of nodes
+	int		m_ndofs;	//!< number of dofs per node
+
+	std::vector<int>	m_ID;		//!< nodal equation numbers
+	std::vector<int>	m_BC;		//!< boundary condition flags
+	std::vector<double>	m_val_t;	//!< current nodal dof values
+	std::vector<double>	m_val_p;	//!< previous nodal dof values
+	std::vector<double>	m_Fr;		//!< equivalent nodal forces
+};
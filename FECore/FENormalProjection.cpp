@@ -35,13 +35,13 @@ FENormalProjection::FENormalProjection(FESurface& s) : m_surf(s)
 {
 	m_tol = 0.0;
 	m_rad = 0.0;
+	m_bvh = nullptr;
 }
 
 //-----------------------------------------------------------------------------
 void FENormalProjection::Init()
 {
-	m_OT.Attach(&m_surf);
-	m_OT.Init(m_tol);
+	m_bvh = m_surf.SearchTree(m_tol);
 }
 
 //-----------------------------------------------------------------------------
@@ -53,18 +53,50 @@ void FENormalProjection::Init()
 FESurfaceElement* FENormalProjection::Project(vec3d r, vec3d n, double rs[2])
 {
 	// let's find all the candidate surface elements
-	set<int>selist;
-	m_OT.FindCandidateSurfaceElements(r, n, selist);
-	
+	vector<int> selist;
+	m_bvh->FindRayCandidates(r, n, selist);
+	if (selist.empty()) return 0;
+
+	double g;
+	return ProjectCandidates(r, n, rs, &selist[0], (int)selist.size(), g);
+}
+
+//-----------------------------------------------------------------------------
+FESurfaceElement* FENormalProjection::Project(const vec3d& r, const vec3d& n, double rs[2], const FEContactCandidateList& cl, int iel, int nint)
+{
+	if (cl.IsValid())
+	{
+		int nsel = 0;
+		const int* sel = cl.Candidates(iel, nint, nsel);
+
+		// The list contains all facets within the cutoff distance. If the closest 
+		// intersection lies within that distance, no facet outside the list can do better.
+		double g = 0, rsl[2];
+		FESurfaceElement* pe = (nsel > 0 ? ProjectCandidates(r, n, rsl, sel, nsel, g) : 0);
+		if (pe && (fabs(g) <= cl.Cutoff()) && (m_rad <= cl.Cutoff()))
+		{
+			rs[0] = rsl[0];
+			rs[1] = rsl[1];
+			return pe;
+		}
+	}
+
+	return Project(r, n, rs);
+}
+
+//-----------------------------------------------------------------------------
+//! Find the intersection with the smallest gap among the facets in sel.
+FESurfaceElement* FENormalProjection::ProjectCandidates(const vec3d& r, const vec3d& n, double rs[2], const int* sel, int nsel, double& g)
+{
 	// now that we found candidate surface elements, lets see if we can find 
 	// those that intersect the ray, then pick the closest intersection
-	set<int>::iterator it;
 	bool found = false;
-	double rsl[2], gl, g = 0;
+	double rsl[2], gl;
 	FESurfaceElement* pei = 0;
-	for (it=selist.begin(); it!=selist.end(); ++it) {
+	g = 0;
+	for (int i=0; i<nsel; ++i) {
 		// get the surface element
-		int j = *it;
+		int j = sel[i];
 		// project the node on the element
 		FESurfaceElement* pe = &m_surf.Element(j);
 		if (m_surf.Intersect(*pe, r, n, rsl, gl, m_tol)) {
@@ -97,12 +129,12 @@ FESurfaceElement* FENormalProjection::Project(vec3d r, vec3d n, double rs[2])
 FESurfaceElement* FENormalProjection::Project2(vec3d r, vec3d n, double rs[2])
 {
 	// let's find all the candidate surface elements
-	set<int>selist;
-	m_OT.FindCandidateSurfaceElements(r, n, selist);
+	vector<int> selist;
+	m_bvh->FindRayCandidates(r, n, selist);
 	
 	// now that we found candidate surface elements, lets see if we can find 
 	// those that intersect the ray, then pick the closest intersection
-	set<int>::iterator it;
+	vector<int>::iterator it;
 	bool found = false;
 	double rsl[2], gl, g;
 	FESurfaceElement* pei = 0;
@@ -140,15 +172,15 @@ FESurfaceElement* FENormalProjection::Project2(vec3d r, vec3d n, double rs[2])
 FESurfaceElement* FENormalProjection::Project3(const vec3d& r, const vec3d& n, double rs[2], int* pei)
 {
 	// let's find all the candidate surface elements
-	set<int>selist;
-	m_OT.FindCandidateSurfaceElements(r, n, selist);
+	vector<int> selist;
+	m_bvh->FindRayCandidates(r, n, selist);
 
 	double g, gmax = -1e99, r2[2] = {rs[0], rs[1]};
 	int imin = -1;
 	FESurfaceElement* pme = 0;
 
 	// loop over all surface element
-	set<int>::iterator it;
+	vector<int>::iterator it;
 	for (it = selist.begin(); it != selist.end(); ++it)
 	{
 		FESurfaceElement& el = m_surf.Element(*it);
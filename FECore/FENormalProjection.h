@@ -28,7 +28,8 @@ SOFTWARE.*/
 
 #pragma once
 #include "FESurface.h"
-#include "FEOctree.h"
+#include "FESurfaceBVH.h"
+#include "FEContactCandidateList.h"
 
 //-----------------------------------------------------------------------------
 //! This class calculates the normal projection on to a surface.
@@ -48,17 +49,24 @@ public:
 public:
 	//! find the intersection of a ray with the surface
 	FESurfaceElement* Project(vec3d r, vec3d n, double rs[2]);
+
+	//! Same as Project, but only searches the candidate facets of integration point n of element iel.
+	//! The full surface is searched if the list is not valid or no intersection within its cutoff is found.
+	FESurfaceElement* Project(const vec3d& r, const vec3d& n, double rs[2], const FEContactCandidateList& cl, int iel, int nint);
 	FESurfaceElement* Project2(vec3d r, vec3d n, double rs[2]);
 	FESurfaceElement* Project3(const vec3d& r, const vec3d& n, double rs[2], int* pei = 0);
 
 	vec3d Project(const vec3d& r, const vec3d& N);
 	vec3d Project2(const vec3d& r, const vec3d& N);
 
+private:
+	FESurfaceElement* ProjectCandidates(const vec3d& r, const vec3d& n, double rs[2], const int* sel, int nsel, double& g);
+
 private:
 	double	m_tol;	//!< projection tolerance
 	double	m_rad;	//!< search radius
 
 private:
 	FESurface&	m_surf;	//!< the target surface
-	FEOctree	m_OT;	//!< used to optimize ray-surface intersections
+	FESurfaceBVH*	m_bvh;	//!< used to optimize ray-surface intersections
 };
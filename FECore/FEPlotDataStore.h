@@ -62,6 +62,9 @@ public:
 	int GetPlotCompression() const;
 	void SetPlotCompression(int n);
 
+	bool GetPlotAsync() const;
+	void SetPlotAsync(bool b);
+
 	void SetPlotFileType(const std::string& fileType);
 
 	void Serialize(DumpStream& ar);
@@ -73,4 +76,5 @@ private:
 	std::string					m_splot_type;
 	std::vector<FEPlotVariable>	m_plot;
 	int							m_nplot_compression;
+	bool						m_bplot_async;	//!< async write: plot states are compressed and written in a background thread (the data is still evaluated on the solver thread)
 };
@@ -31,6 +31,8 @@ SOFTWARE.*/
 #include "FEMaterialPoint.h"
 #include "FEModelParam.h"
 #include "FEModel.h"
+#include "FEMesh.h"
+#include "FEDomain.h"
 #include "DumpStream.h"
 #include "log.h"
 
@@ -47,6 +49,15 @@ BEGIN_FECORE_CLASS(FEMathValue, FEScalarValuator)
 	ADD_PARAMETER(m_expr, "math");
 END_FECORE_CLASS();
 
+FEMathValue::FEMathValue(FEModel* fem) : FEScalarValuator(fem)
+{
+	m_dep = DYNAMIC;
+	m_val = 0.0;
+	m_time = 0.0;
+	m_tag = -1;
+	m_seq = 0;
+}
+
 void FEMathValue::setMathString(const std::string& s)
 {
 	m_expr = s;
@@ -54,14 +65,19 @@ void FEMathValue::setMathString(const std::string& s)
 
 bool FEMathValue::Init()
 {
-	return create();
+	if (create() == false) return false;
+	classify();
+	return true;
 }
 
 void FEMathValue::Serialize(DumpStream& ar)
 {
 	FEScalarValuator::Serialize(ar);
 	if (ar.IsShallow()) return;
-	if (ar.IsLoading()) create();
+	if (ar.IsLoading())
+	{
+		if (create()) classify();
+	}
 }
 
 bool FEMathValue::create(FECoreBase* pc)
@@ -163,41 +179,299 @@ FEScalarValuator* FEMathValue::copy()
 	newExpr->m_expr = m_expr;
 	newExpr->m_math = m_math;
 	newExpr->m_vars = m_vars;
+	newExpr->classify();
 	return newExpr;
 }
 
+// Figure out whether the expression depends on position and/or time, so that its
+// value can be cached. Model parameters can be modified by load controllers, so
+// expressions that depend on them are treated as time dependent. Data maps are 
+// assumed to remain constant during the analysis.
+void FEMathValue::classify()
+{
+	m_dep = DYNAMIC;
+	m_tag = -1;
+	m_cache.clear();
+
+	FEModel* fem = GetFEModel();
+	if ((fem == nullptr) || (m_math.Variables() != 4 + (int)m_vars.size())) return;
+
+	const MITEM& e = m_math.GetExpression();
+	bool spatial = false;
+	bool time = false;
+	for (int i = 0; i < 3; ++i)
+	{
+		if (is_dependent(e, *m_math.Variable(i))) spatial = true;
+	}
+	if (is_dependent(e, *m_math.Variable(3))) time = true;
+
+	for (int i = 0; i < (int)m_vars.size(); ++i)
+	{
+		if (is_dependent(e, *m_math.Variable(4 + i)) == false) continue;
+
+		MathParam& mp = m_vars[i];
+		if (mp.type == 1) spatial = true;
+		else if ((mp.pp->type() == FE_PARAM_DOUBLE_MAPPED) && (mp.pp->value<FEParamDouble>().isConst() == false))
+		{
+			spatial = true;
+			time = true;
+		}
+		else time = true;
+	}
+
+	if (spatial && time) m_dep = DYNAMIC;
+	else if (spatial)
+	{
+		m_dep = SPATIAL_STATIC;
+
+		// setup the caches. The values are evaluated when they are first needed.
+		FEMesh& mesh = fem->GetMesh();
+		m_cache.resize(mesh.Domains());
+		for (int i = 0; i < mesh.Domains(); ++i)
+		{
+			PointCache& pc = m_cache[i];
+			pc.dom = &mesh.Domain(i);
+			pc.nint = 0;
+			pc.ready = 0;
+		}
+	}
+	else if (time) m_dep = TIME_DEPENDENT;
+	else
+	{
+		m_dep = CONST_VALUE;
+		std::vector<double> var(m_math.Variables(), 0.0);
+		m_val = m_math.value_s(var);
+	}
+}
+
+double FEMathValue::paramValue(int i, const FEMaterialPoint& pt)
+{
+	MathParam& mp = m_vars[i];
+	if (mp.type == 0)
+	{
+		FEParam* pi = mp.pp;
+		switch (pi->type())
+		{
+		case FE_PARAM_INT: return (double)pi->value<int>();
+		case FE_PARAM_DOUBLE: return pi->value<double>();
+		case FE_PARAM_DOUBLE_MAPPED: return pi->value<FEParamDouble>()(pt);
+		}
+		return 0.0;
+	}
+	else
+	{
+		FEDataMap& map = *mp.map;
+		return map.value(pt);
+	}
+}
+
 double FEMathValue::operator()(const FEMaterialPoint& pt)
 {
-	std::vector<double> var(4 + m_vars.size());
-	var[0] = pt.m_r0.x;
-	var[1] = pt.m_r0.y;
-	var[2] = pt.m_r0.z;
-	var[3] = GetFEModel()->GetTime().currentTime;
-	if (m_vars.empty() == false)
+	switch (m_dep)
 	{
-		for (int i = 0; i < (int)m_vars.size(); ++i)
+	case CONST_VALUE   : return m_val;
+	case TIME_DEPENDENT: return timeValue(pt);
+	case SPATIAL_STATIC: return pointValue(pt);
+	}
+	return evaluate(pt);
+}
+
+// The value is re-evaluated when the time changes or when the load parameters
+// were re-evaluated (which happens at the start of each time step).
+double FEMathValue::timeValue(const FEMaterialPoint& pt)
+{
+	FEModel* fem = GetFEModel();
+	double t = fem->GetTime().currentTime;
+	int tag = fem->LoadParameterCounter();
+
+	// The cached value is published with a sequence counter, which is odd while the
+	// value is updated. A reader uses the value only if the counter is even and did
+	// not change while the value, time and tag were read, so they are consistent.
+	int seq0, seq1, tag0;
+	double t0, v;
+	#pragma omp atomic read
+	seq0 = m_seq;
+	#pragma omp flush
+	#pragma omp atomic read
+	tag0 = m_tag;
+	#pragma omp atomic read
+	t0 = m_time;
+	#pragma omp atomic read
+	v = m_val;
+	#pragma omp flush
+	#pragma omp atomic read
+	seq1 = m_seq;
+	if (((seq0 & 1) == 0) && (seq0 == seq1) && (tag0 == tag) && (t0 == t)) return v;
+
+	#pragma omp critical (FEMathValue_cache)
+	{
+		if ((m_tag != tag) || (m_time != t))
 		{
-			MathParam& mp = m_vars[i];
-			if (mp.type == 0)
+			double val = evaluate(pt);
+			#pragma omp atomic update
+			m_seq++;
+			#pragma omp flush
+			#pragma omp atomic write
+			m_val = val;
+			#pragma omp atomic write
+			m_time = t;
+			#pragma omp atomic write
+			m_tag = tag;
+			#pragma omp flush
+			#pragma omp atomic update
+			m_seq++;
+		}
+		v = m_val;
+	}
+	return v;
+}
+
+FEMathValue::PointCache* FEMathValue::findCache(FEMeshPartition* dom)
+{
+	for (size_t i = 0; i < m_cache.size(); ++i)
+	{
+		PointCache& pc = m_cache[i];
+		if (pc.dom != dom) continue;
+
+		int ready;
+		#pragma omp atomic read
+		ready = pc.ready;
+		if (ready == 0)
+		{
+			#pragma omp critical (FEMathValue_cache)
 			{
-				FEParam* pi = mp.pp;
-				switch (pi->type())
+				if (pc.ready == 0)
 				{
-				case FE_PARAM_INT: var[4 + i] = (double)pi->value<int>(); break;
-				case FE_PARAM_DOUBLE: var[4 + i] = pi->value<double>(); break;
-				case FE_PARAM_DOUBLE_MAPPED: var[4 + i] = pi->value<FEParamDouble>()(pt); break;
+					int NE = dom->Elements();
+					int nint = 0;
+					for (int j = 0; j < NE; ++j) nint = std::max(nint, dom->ElementRef(j).GaussPoints());
+					pc.nint = nint;
+					pc.val.assign(NE*nint, 0.0);
+					pc.r0.assign(NE*nint, vec3d(0, 0, 0));
+					pc.tag.assign(NE*nint, 0);
+					#pragma omp flush
+					#pragma omp atomic write
+					pc.ready = 1;
 				}
 			}
-			else
+		}
+		return &pc;
+	}
+	return nullptr;
+}
+
+// The values of all integration points of an element are evaluated in one batch 
+// and stored the first time one of them is needed. Material points that are not
+// one of the domain's integration points (e.g. temporary points created at nodes)
+// are recognized by their position and are evaluated directly.
+double FEMathValue::pointValue(const FEMaterialPoint& pt)
+{
+	FEElement* pe = pt.m_elem;
+	PointCache* pc = (pe ? findCache(pe->GetMeshPartition()) : nullptr);
+	if (pc && (pt.m_index >= 0) && (pt.m_index < pc->nint))
+	{
+		int n0 = pe->GetLocalID()*pc->nint;
+		int n = n0 + pt.m_index;
+		if ((n >= 0) && (n < (int)pc->val.size()))
+		{
+			int tag;
+			#pragma omp atomic read
+			tag = pc->tag[n];
+			if (tag == 0)
 			{
-				FEDataMap& map = *mp.map;
-				var[4+i] = map.value(pt);
+				const int MAX_INT = FEElement::MAX_INTPOINTS;
+				int nint = pe->GaussPoints();
+				if ((nint > MAX_INT) || (nint > pc->nint)) return evaluate(pt);
+
+				const FEMaterialPoint* mp[MAX_INT];
+				double v[MAX_INT];
+				for (int i = 0; i < nint; ++i) mp[i] = pe->GetMaterialPoint(i);
+				evaluate(nint, mp, v);
+
+				#pragma omp critical (FEMathValue_cache)
+				{
+					for (int i = 0; i < nint; ++i)
+					{
+						if (pc->tag[n0 + i] != 0) continue;
+						pc->val[n0 + i] = v[i];
+						pc->r0[n0 + i] = mp[i]->m_r0;
+						#pragma omp flush
+						#pragma omp atomic write
+						pc->tag[n0 + i] = 1;
+					}
+				}
 			}
+
+			const vec3d& r0 = pc->r0[n];
+			if ((r0.x == pt.m_r0.x) && (r0.y == pt.m_r0.y) && (r0.z == pt.m_r0.z)) return pc->val[n];
 		}
 	}
+	return evaluate(pt);
+}
+
+double FEMathValue::evaluate(const FEMaterialPoint& pt)
+{
+	// use a stack buffer for the variables, unless there are many
+	const int MAX_VARS = 16;
+	int nvar = 4 + (int)m_vars.size();
+	double buf[MAX_VARS];
+	std::vector<double> tmp;
+	double* var = buf;
+	if (nvar > MAX_VARS) { tmp.resize(nvar); var = tmp.data(); }
+
+	var[0] = pt.m_r0.x;
+	var[1] = pt.m_r0.y;
+	var[2] = pt.m_r0.z;
+	var[3] = GetFEModel()->GetTime().currentTime;
+	for (int i = 0; i < (int)m_vars.size(); ++i) var[4 + i] = paramValue(i, pt);
+
 	return m_math.value_s(var);
 }
 
+// The variables are gathered in one array per variable (X, Y, Z, t and the 
+// model parameters), and the expression is then evaluated for all points at once.
+void FEMathValue::evaluate(int n, const FEMaterialPoint* const* pt, double* val)
+{
+	if (n <= 0) return;
+
+	int nvar = 4 + (int)m_vars.size();
+	std::vector<double> buf(nvar*n);
+	std::vector<const double*> var(nvar);
+	for (int j = 0; j < nvar; ++j) var[j] = &buf[j*n];
+
+	double* X = &buf[0];
+	double* Y = &buf[n];
+	double* Z = &buf[2*n];
+	double* T = &buf[3*n];
+	double t = GetFEModel()->GetTime().currentTime;
+	for (int i = 0; i < n; ++i)
+	{
+		const FEMaterialPoint& mp = *pt[i];
+		X[i] = mp.m_r0.x;
+		Y[i] = mp.m_r0.y;
+		Z[i] = mp.m_r0.z;
+		T[i] = t;
+	}
+
+	for (int j = 0; j < (int)m_vars.size(); ++j)
+	{
+		double* p = &buf[(4 + j)*n];
+		for (int i = 0; i < n; ++i) p[i] = paramValue(j, *pt[i]);
+	}
+
+	m_math.value_s(n, var.data(), val);
+}
+
+// cached values are looked up one by one, all others are evaluated in one batch
+void FEMathValue::values(int n, const FEMaterialPoint* const* pt, double* val)
+{
+	if (m_dep != DYNAMIC)
+	{
+		for (int i = 0; i < n; ++i) val[i] = (*this)(*pt[i]);
+	}
+	else evaluate(n, pt, val);
+}
+
 //---------------------------------------------------------------------------------------
 
 FEMappedValue::FEMappedValue(FEModel* fem) : FEScalarValuator(fem), m_val(nullptr)
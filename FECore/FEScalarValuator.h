@@ -32,22 +32,42 @@ SOFTWARE.*/
 #include "FEDataMap.h"
 #include "FENodeDataMap.h"
 
+class FEMeshPartition;
+
 //---------------------------------------------------------------------------------------
 // Base class for evaluating scalar parameters
 class FECORE_API FEScalarValuator : public FEValuator
 {
 	FECORE_SUPER_CLASS
 
+public:
+	// Classifies how the value of a valuator can change during the analysis
+	enum Dependency {
+		CONST_VALUE,		// the value never changes
+		TIME_DEPENDENT,		// the value only depends on time and model parameters
+		SPATIAL_STATIC,		// the value only depends on the material point's reference position
+		DYNAMIC				// the value can depend on anything
+	};
+
 public:
 	FEScalarValuator(FEModel* fem) : FEValuator(fem) {};
 
 	virtual double operator()(const FEMaterialPoint& pt) = 0;
 
+	// evaluate the value at n material points (e.g. all integration points of a block of elements)
+	virtual void values(int n, const FEMaterialPoint* const* pt, double* val)
+	{
+		for (int i = 0; i < n; ++i) val[i] = (*this)(*pt[i]);
+	}
+
 	virtual FEScalarValuator* copy() = 0;
 
 	virtual bool isConst() { return false; }
 
 	virtual double* constValue() { return nullptr; }
+
+	// return how this value depends on time and position
+	virtual int dependency() const { return DYNAMIC; }
 };
 
 //---------------------------------------------------------------------------------------
@@ -61,6 +81,8 @@ public:
 
 	double* constValue() override { return &m_val; }
 
+	int dependency() const override { return CONST_VALUE; }
+
 	FEScalarValuator* copy() override
 	{ 
 		FEConstValue* val = new FEConstValue(GetFEModel()); 
@@ -84,11 +106,26 @@ class FECORE_API FEMathValue : public FEScalarValuator
 		FEDataMap*	map;
 	};
 
+	// values of a spatial-static expression at the integration points of a domain
+	struct PointCache
+	{
+		FEMeshPartition*	dom;
+		int					nint;	// max nr of integration points per element
+		int					ready;	// set when the arrays are allocated
+		std::vector<double>	val;	// value at each integration point
+		std::vector<vec3d>	r0;		// reference position of each integration point
+		std::vector<int>	tag;	// set when the value of an integration point is evaluated
+	};
+
 public:
-	FEMathValue(FEModel* fem) : FEScalarValuator(fem) {}
+	FEMathValue(FEModel* fem);
 	~FEMathValue();
 	double operator()(const FEMaterialPoint& pt) override;
 
+	void values(int n, const FEMaterialPoint* const* pt, double* val) override;
+
+	int dependency() const override { return m_dep; }
+
 	bool Init() override;
 
 	FEScalarValuator* copy() override;
@@ -99,11 +136,40 @@ public:
 
 	void Serialize(DumpStream& ar) override;
 
+private:
+	// evaluate the model parameters and data maps that are used in the expression
+	double paramValue(int i, const FEMaterialPoint& pt);
+
+	// evaluate the expression (without using the cached values)
+	double evaluate(const FEMaterialPoint& pt);
+
+	// evaluate the expression at n material points (without using the cached values)
+	void evaluate(int n, const FEMaterialPoint* const* pt, double* val);
+
+	// figure out what the expression depends on
+	void classify();
+
+	// get the cached value of a time dependent expression
+	double timeValue(const FEMaterialPoint& pt);
+
+	// get the cached value of a spatial-static expression
+	double pointValue(const FEMaterialPoint& pt);
+
+	// find the cache for a domain (returns nullptr if the domain is not cached)
+	PointCache* findCache(FEMeshPartition* dom);
+
 private:
 	std::string			m_expr;
 	MSimpleExpression	m_math;
 	std::vector<MathParam>	m_vars;
 
+	int		m_dep;		//!< dependency of expression (see FEScalarValuator::Dependency)
+	double	m_val;		//!< cached value for const and time dependent expressions
+	double	m_time;		//!< time at which m_val was evaluated
+	int		m_tag;		//!< load parameter counter at which m_val was evaluated
+	int		m_seq;		//!< sequence counter of m_val, m_time, m_tag (odd while they are updated)
+	std::vector<PointCache>	m_cache;	//!< cached values of spatial-static expressions
+
 	DECLARE_FECORE_CLASS();
 };
 
@@ -31,10 +31,19 @@ SOFTWARE.*/
 #include "FEMaterial.h"
 #include "tools.h"
 #include "log.h"
+#include "DumpStream.h"
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(FESolidDomain, FEDomain)
+	ADD_PARAMETER(m_shapeCacheBudget, "shape_cache_budget");
+END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
 FESolidDomain::FESolidDomain(FEModel* pfem) : FEDomain(FE_DOMAIN_SOLID, pfem), m_dofU(pfem), m_dofSU(pfem)
 {
+	m_kernel = FE_KERNEL_GENERIC;
+	m_shapeCacheBudget = 512.0;
+
 	if (pfem)
 	{
 		m_dofU.AddDof(pfem->GetDOFIndex("x"));
@@ -49,6 +58,9 @@ FESolidDomain::FESolidDomain(FEModel* pfem) : FEDomain(FE_DOMAIN_SOLID, pfem), m
 //-----------------------------------------------------------------------------
 bool FESolidDomain::Create(int nsize, FE_Element_Spec espec)
 {
+	// the shape cache is no longer valid
+	ClearShapeCache();
+
 	// allocate elements
     m_Elem.resize(nsize);
 	for (int i = 0; i < nsize; ++i)
@@ -64,6 +76,9 @@ bool FESolidDomain::Create(int nsize, FE_Element_Spec espec)
 
 	m_elemSpec = espec;
 
+	// see if we can use a specialized element kernel
+	FindElementKernel();
+
 	return true;
 }
 
@@ -95,6 +110,131 @@ void FESolidDomain::CopyFrom(FEMeshPartition* pd)
 	FESolidDomain* psd = dynamic_cast<FESolidDomain*>(pd);
     m_Elem = psd->m_Elem;
 	ForEachElement([=](FEElement& el) { el.SetMeshPartition(this); });
+	ClearShapeCache();
+	FindElementKernel();
+}
+
+//-----------------------------------------------------------------------------
+// The specialized kernels can only be used if all elements are of the same type.
+void FESolidDomain::FindElementKernel()
+{
+	m_kernel = FE_KERNEL_GENERIC;
+	int NE = Elements();
+	if ((NE == 0) || (m_Elem[0].GetTraits() == nullptr)) return;
+
+	int ntype = m_Elem[0].Type();
+	for (int i = 1; i < NE; ++i)
+	{
+		if ((m_Elem[i].GetTraits() == nullptr) || (m_Elem[i].Type() != ntype)) return;
+	}
+
+	switch (ntype)
+	{
+	case FE_HEX8G8    : m_kernel = FE_KERNEL_HEX8G8; break;
+	case FE_TET4G1    : m_kernel = FE_KERNEL_TET4G1; break;
+	case FE_TET4G4    : m_kernel = FE_KERNEL_TET4G4; break;
+	case FE_TET10G4   : m_kernel = FE_KERNEL_TET10G4; break;
+	case FE_TET10G8   : m_kernel = FE_KERNEL_TET10G8; break;
+	case FE_TET10GL11 : m_kernel = FE_KERNEL_TET10GL11; break;
+	case FE_HEX20G8   : m_kernel = FE_KERNEL_HEX20G8; break;
+	case FE_HEX20G27  : m_kernel = FE_KERNEL_HEX20G27; break;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FESolidDomain::Serialize(DumpStream& ar)
+{
+	FEDomain::Serialize(ar);
+
+	// The shape cache is not stored, but rebuilt from the reference configuration.
+	// (The cache budget is a parameter, so it was already restored.)
+	if ((ar.IsShallow() == false) && ar.IsLoading())
+	{
+		FindElementKernel();
+		UpdateShapeCache();
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FESolidDomain::ClearShapeCache()
+{
+	m_detJ0Offset.clear();
+	m_gradOffset.clear();
+	m_detJ0.clear();
+	m_J0inv.clear();
+	m_GradN0.clear();
+}
+
+//-----------------------------------------------------------------------------
+// The reference Jacobians and shape function gradients are evaluated at all
+// integration points, unless this would need more memory than the budget allows.
+void FESolidDomain::UpdateShapeCache()
+{
+	ClearShapeCache();
+	if (m_shapeCacheBudget == 0.0) return;
+
+	// figure out how much memory we need
+	int NE = Elements();
+	vector<int> detJ0Offset(NE), gradOffset(NE);
+	size_t npts = 0, ngrad = 0;
+	for (int i = 0; i < NE; ++i)
+	{
+		FESolidElement& el = m_Elem[i];
+		detJ0Offset[i] = (int) npts;
+		gradOffset[i] = (int) ngrad;
+		npts += el.GaussPoints();
+		ngrad += el.GaussPoints()*el.Nodes();
+	}
+
+	double mb = (npts*(sizeof(double) + sizeof(mat3d)) + ngrad*sizeof(vec3d) + 2*NE*sizeof(int)) / (1024.0*1024.0);
+	if ((m_shapeCacheBudget > 0) && (mb > m_shapeCacheBudget))
+	{
+		feLogWarning("Shape cache of domain %s needs %lg MB, which exceeds the budget of %lg MB.\nShape gradients will not be cached.", GetName().c_str(), mb, m_shapeCacheBudget);
+		return;
+	}
+
+	// evaluate the reference Jacobians and shape gradients
+	vector<double> detJ0(npts);
+	vector<mat3d> J0inv(npts);
+	vector<vec3d> GradN0(ngrad);
+	for (int i = 0; i < NE; ++i)
+	{
+		FESolidElement& el = m_Elem[i];
+		int nint = el.GaussPoints();
+		int neln = el.Nodes();
+		for (int n = 0; n < nint; ++n)
+		{
+			// Inverted elements are not cached. Instead, the error is reported
+			// when their Jacobian is evaluated.
+			double Ji[3][3];
+			int k = detJ0Offset[i] + n;
+			try {
+				detJ0[k] = invjac0(el, Ji, n);
+			}
+			catch (NegativeJacobian)
+			{
+				return;
+			}
+			J0inv[k] = mat3d(Ji);
+
+			vec3d* G = &GradN0[gradOffset[i] + n*neln];
+			for (int j = 0; j < neln; ++j)
+			{
+				double Gr = el.Gr(n)[j];
+				double Gs = el.Gs(n)[j];
+				double Gt = el.Gt(n)[j];
+				G[j].x = Ji[0][0] * Gr + Ji[1][0] * Gs + Ji[2][0] * Gt;
+				G[j].y = Ji[0][1] * Gr + Ji[1][1] * Gs + Ji[2][1] * Gt;
+				G[j].z = Ji[0][2] * Gr + Ji[1][2] * Gs + Ji[2][2] * Gt;
+			}
+		}
+	}
+
+	m_detJ0Offset.swap(detJ0Offset);
+	m_gradOffset.swap(gradOffset);
+	m_detJ0.swap(detJ0);
+	m_J0inv.swap(J0inv);
+	m_GradN0.swap(GradN0);
 }
 
 //-----------------------------------------------------------------------------
@@ -104,6 +244,12 @@ bool FESolidDomain::Init()
 	// base class first
 	if (FEDomain::Init() == false) return false;
 
+	// the reference configuration may have changed (e.g. after remeshing)
+	ClearShapeCache();
+
+	// see if we can use a specialized element kernel
+	FindElementKernel();
+
 	// init solid element data
 	// TODO: In principle I could parallelize this, but right now this cannot be done
 	//       because of the try block. 
@@ -137,6 +283,9 @@ bool FESolidDomain::Init()
 				mp.m_r0 = el.Evaluate(r0, n);
 			}
 		});
+
+		// cache the reference shape gradients
+		UpdateShapeCache();
 	}
 	catch (NegativeJacobian e)
 	{
@@ -886,11 +1035,14 @@ tens3dls FESolidDomain::Gradbp(FESolidElement &el, int n)
 //! value of the function
 double FESolidDomain::defgrad(FESolidElement &el, mat3d &F, int n, vec3d* r)
 {
-	// calculate inverse jacobian
-	//    double Ji[3][3];
-	//    invjac0(el, Ji, n);
-	mat3d& Ji = el.m_J0i[n];
+	return defgrad(el, F, n, r, el.m_J0i[n]);
+}
 
+//-----------------------------------------------------------------------------
+//! Calculate the deformation gradient of element el at integration point n, 
+//! using the inverse reference Jacobian Ji.
+double FESolidDomain::defgrad(FESolidElement &el, mat3d &F, int n, const vec3d* r, const mat3d& Ji)
+{
 	// shape function derivatives
 	double *Grn = el.Gr(n);
 	double *Gsn = el.Gs(n);
@@ -1037,6 +1189,16 @@ double FESolidDomain::defgradp(FESolidElement &el, mat3d &F, int n)
 //! The return value is the determinant of the Jacobian (not the inverse!)
 double FESolidDomain::invjac0(const FESolidElement& el, double Ji[3][3], int n)
 {
+	// use the cached values if we can
+	if (HasShapeCache() && (el.GetMeshPartition() == this))
+	{
+		int k = m_detJ0Offset[el.GetLocalID()] + n;
+		const mat3d& J0i = m_J0inv[k];
+		for (int i = 0; i < 3; ++i)
+			for (int j = 0; j < 3; ++j) Ji[i][j] = J0i(i, j);
+		return m_detJ0[k];
+	}
+
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
 	GetReferenceNodalCoordinates(el, r0);
@@ -1858,6 +2020,12 @@ double FESolidDomain::detJt(FESolidElement &el, int n, const double alpha)
 //! Calculate jacobian with respect to reference frame
 double FESolidDomain::detJ0(FESolidElement &el, int n)
 {
+	// use the cached value if we can
+	if (HasShapeCache() && (el.GetMeshPartition() == this))
+	{
+		return m_detJ0[m_detJ0Offset[el.GetLocalID()] + n];
+	}
+
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
 	GetReferenceNodalCoordinates(el, r0);
@@ -2346,6 +2514,15 @@ double FESolidDomain::ShapeGradient(FESolidElement& el, int n, vec3d* GradH, con
 //-----------------------------------------------------------------------------
 double FESolidDomain::ShapeGradient0(FESolidElement& el, int n, vec3d* GradH)
 {
+	// use the cached values if we can
+	if (HasShapeCache() && (el.GetMeshPartition() == this))
+	{
+		int neln = el.Nodes();
+		const vec3d* G0 = &m_GradN0[m_gradOffset[el.GetLocalID()] + n*neln];
+		for (int i = 0; i < neln; ++i) GradH[i] = G0[i];
+		return m_detJ0[m_detJ0Offset[el.GetLocalID()] + n];
+	}
+
     // calculate jacobian
     double Ji[3][3];
     double detJ0 = invjac0(el, Ji, n);
@@ -2583,7 +2760,7 @@ void FESolidDomain::LoadVector(
 			for (int j = 0; j < neln; ++j)
 			{
 				FENode& node = mesh.Node(el.m_node[j]);
-				vector<int>& ID = node.m_ID;
+				int* ID = node.m_ID;
 				for (int k = 0; k < dofPerNode; ++k)
 				{
 					lm[dofPerNode*j + k] = ID[dofList[k]];
@@ -2658,7 +2835,7 @@ void FESolidDomain::LoadStiffness(FELinearSystem& LS, const FEDofList& dofList_a
 		for (int j = 0; j < neln; ++j)
 		{
 			FENode& node = mesh.Node(el.m_node[j]);
-			std::vector<int>& ID = node.m_ID;
+			int* ID = node.m_ID;
 
 			for (int k = 0; k < dofPerNode_a; ++k)
 				lma[dofPerNode_a*j + k] = ID[dofList_a[k]];
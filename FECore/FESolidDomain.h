@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEModel.h"
 #include "FEDofList.h"
 #include "FELinearSystem.h"
+#include "FESolidKernel.h"
 
 //-----------------------------------------------------------------------------
 // This typedef defines a surface integrand. 
@@ -65,6 +66,9 @@ public:
     //! copy data from another domain (overridden from FEDomain)
     void CopyFrom(FEMeshPartition* pd) override;
 
+	//! serialization
+	void Serialize(DumpStream& ar) override;
+
     //! element access
 	FESolidElement& Element(int n);
     FEElement& ElementRef(int n) override { return m_Elem[n]; }
@@ -93,6 +97,10 @@ public:
     double defgrad(FESolidElement& el, mat3d& F, int n);
 	double defgrad(FESolidElement& el, mat3d& F, int n, vec3d* r);
 
+	//! Calculate deformation gradient at integration point n from the nodal coordinates r
+	//! and the inverse reference Jacobian Ji
+	double defgrad(FESolidElement& el, mat3d& F, int n, const vec3d* r, const mat3d& Ji);
+
     //! Calculate deformation gradient at integration point n
     double defgrad(FESolidElement& el, mat3d& F, double r, double s, double t);
     
@@ -258,6 +266,25 @@ public:
 	//! get the nodal coordinates at previous state
 	void GetPreviousNodalCoordinates(const FESolidElement& el, vec3d* rp);
 
+public:
+	//! (re)build the cache of reference shape gradients and Jacobians.
+	//! This must be called when the reference configuration of the domain changes.
+	void UpdateShapeCache();
+
+	//! clear the cache of reference shape gradients and Jacobians
+	void ClearShapeCache();
+
+	//! see if the reference shape gradients are cached
+	bool HasShapeCache() const { return (m_detJ0.empty() == false); }
+
+	//! return the specialized element kernel that can be used for this domain (see FESolidKernel.h)
+	int ElementKernel() const { return m_kernel; }
+
+protected:
+	//! find the element kernel that can be used for all elements of this domain.
+	//! Derived classes can override this to select their kernel functions.
+	virtual void FindElementKernel();
+
 public:
 	//! loop over elements
 	void ForEachSolidElement(std::function<void(FESolidElement& el)> f);
@@ -287,4 +314,18 @@ protected:
 
 	FEDofList	m_dofU;
 	FEDofList	m_dofSU;
+
+protected:
+	int		m_kernel;			//!< element kernel (see FESolidKernelType)
+	double	m_shapeCacheBudget;	//!< max memory (in MB) of the shape cache (0 = no cache, < 0 = no limit)
+
+	// The shape cache stores the reference Jacobian and shape function 
+	// gradients at all integration points of the domain.
+	vector<int>		m_detJ0Offset;	//!< index of the first integration point of each element in m_detJ0
+	vector<int>		m_gradOffset;	//!< index of the first shape gradient of each element in m_GradN0
+	vector<double>	m_detJ0;		//!< reference Jacobian at integration points
+	vector<mat3d>	m_J0inv;		//!< inverse of reference Jacobian matrix at integration points
+	vector<vec3d>	m_GradN0;		//!< reference shape function gradients at integration points
+
+	DECLARE_FECORE_CLASS();
 };
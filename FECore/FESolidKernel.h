@@ -0,0 +1,131 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#pragma once
+#include "FESolidElement.h"
+#include "FEException.h"
+
+//-----------------------------------------------------------------------------
+// The element types for which specialized kernels are available.
+// FE_KERNEL_GENERIC is used when a domain contains other (or mixed) element types.
+enum FESolidKernelType {
+	FE_KERNEL_GENERIC,
+	FE_KERNEL_HEX8G8,
+	FE_KERNEL_TET4G1,
+	FE_KERNEL_TET4G4,
+	FE_KERNEL_TET10G4,
+	FE_KERNEL_TET10G8,
+	FE_KERNEL_TET10GL11,
+	FE_KERNEL_HEX20G8,
+	FE_KERNEL_HEX20G27
+};
+
+//-----------------------------------------------------------------------------
+// Kernels for solid elements with a fixed number of nodes (NEN) and integration
+// points (NINT). Since the loop bounds are known at compile time, the compiler can
+// unroll and vectorize the loops over the element nodes. The nodal coordinates are
+// passed in, so they only need to be collected once per element.
+// These functions do the same calculations (in the same order) as the 
+// corresponding functions of FESolidDomain, so they return the same values.
+template <int NEN, int NINT> class FESolidKernel
+{
+public:
+	enum { NODES = NEN, INTPOINTS = NINT };
+
+public:
+	// Calculate the inverse of the Jacobian with respect to the nodal coordinates r
+	// at integration point n. Returns the determinant of the Jacobian (not the inverse!)
+	static double invjac(const FESolidElement& el, const vec3d* r, double Ji[3][3], int n)
+	{
+		const double* Gr = el.Gr(n);
+		const double* Gs = el.Gs(n);
+		const double* Gt = el.Gt(n);
+
+		double J[3][3] = { 0 };
+		for (int i = 0; i < NEN; ++i)
+		{
+			const double& Gri = Gr[i];
+			const double& Gsi = Gs[i];
+			const double& Gti = Gt[i];
+
+			const double& x = r[i].x;
+			const double& y = r[i].y;
+			const double& z = r[i].z;
+
+			J[0][0] += Gri*x; J[0][1] += Gsi*x; J[0][2] += Gti*x;
+			J[1][0] += Gri*y; J[1][1] += Gsi*y; J[1][2] += Gti*y;
+			J[2][0] += Gri*z; J[2][1] += Gsi*z; J[2][2] += Gti*z;
+		}
+
+		// calculate the determinant
+		double det = J[0][0]*(J[1][1]*J[2][2] - J[1][2]*J[2][1])
+				   + J[0][1]*(J[1][2]*J[2][0] - J[2][2]*J[1][0])
+				   + J[0][2]*(J[1][0]*J[2][1] - J[1][1]*J[2][0]);
+
+		// make sure the determinant is positive
+		if (det <= 0) throw NegativeJacobian(el.GetID(), n + 1, det);
+
+		// calculate inverse jacobian
+		double deti = 1.0 / det;
+
+		Ji[0][0] = deti*(J[1][1]*J[2][2] - J[1][2]*J[2][1]);
+		Ji[1][0] = deti*(J[1][2]*J[2][0] - J[1][0]*J[2][2]);
+		Ji[2][0] = deti*(J[1][0]*J[2][1] - J[1][1]*J[2][0]);
+
+		Ji[0][1] = deti*(J[0][2]*J[2][1] - J[0][1]*J[2][2]);
+		Ji[1][1] = deti*(J[0][0]*J[2][2] - J[0][2]*J[2][0]);
+		Ji[2][1] = deti*(J[0][1]*J[2][0] - J[0][0]*J[2][1]);
+
+		Ji[0][2] = deti*(J[0][1]*J[1][2] - J[1][1]*J[0][2]);
+		Ji[1][2] = deti*(J[0][2]*J[1][0] - J[0][0]*J[1][2]);
+		Ji[2][2] = deti*(J[0][0]*J[1][1] - J[0][1]*J[1][0]);
+
+		return det;
+	}
+
+	// Calculate the spatial gradients of the shape functions with respect to the
+	// nodal coordinates r at integration point n. Returns the Jacobian determinant.
+	static double ShapeGradient(const FESolidElement& el, const vec3d* r, int n, vec3d* G)
+	{
+		double Ji[3][3];
+		double detJ = invjac(el, r, Ji, n);
+
+		const double* Gr = el.Gr(n);
+		const double* Gs = el.Gs(n);
+		const double* Gt = el.Gt(n);
+		for (int i = 0; i < NEN; ++i)
+		{
+			// note that we need the transposed of Ji, not Ji itself !
+			G[i].x = Ji[0][0]*Gr[i] + Ji[1][0]*Gs[i] + Ji[2][0]*Gt[i];
+			G[i].y = Ji[0][1]*Gr[i] + Ji[1][1]*Gs[i] + Ji[2][1]*Gt[i];
+			G[i].z = Ji[0][2]*Gr[i] + Ji[1][2]*Gs[i] + Ji[2][2]*Gt[i];
+		}
+
+		return detJ;
+	}
+};
@@ -45,6 +45,7 @@ BEGIN_FECORE_CLASS(FESolver, FECoreBase)
 	ADD_PARAMETER(m_eq_scheme, "equation_scheme");
 	ADD_PARAMETER(m_eq_order , "equation_order" );
 	ADD_PARAMETER(m_bwopt    , "optimize_bw");
+	ADD_PARAMETER(m_assembly_mode, "assembly_mode", 0, "atomic\0colored\0");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
@@ -64,6 +65,7 @@ FESolver::FESolver(FEModel* fem) : FECoreBase(fem)
 
 	m_eq_scheme = EQUATION_SCHEME::STAGGERED;
 	m_eq_order = EQUATION_ORDER::NORMAL_ORDER;
+	m_assembly_mode = ATOMIC_ASSEMBLY;
 }
 
 //-----------------------------------------------------------------------------
@@ -153,12 +155,18 @@ Matrix_Type FESolver::MatrixType() const
 double FESolver::ExtractSolutionNorm(const vector<double>& v, const FEDofList& dofs) const
 {
 	assert(v.size() == m_dofMap.size());
+	// This is done in a single (multithreaded) pass over the vector, since the 
+	// dof list is usually short.
+	const int N = (int)v.size();
+	const int ndofs = dofs.Size();
 	double norm = 0;
-	for (int n = 0; n < dofs.Size(); ++n)
+	#pragma omp parallel for reduction(+:norm)
+	for (int i = 0; i < N; ++i)
 	{
-		for (int i = 0; i < v.size(); ++i)
+		const int dof_i = m_dofMap[i];
+		for (int n = 0; n < ndofs; ++n)
 		{
-			if (m_dofMap[i] == dofs[n]) norm += v[i] * v[i];
+			if (dof_i == dofs[n]) { norm += v[i] * v[i]; break; }
 		}
 	}
 	return norm;
@@ -351,7 +359,7 @@ bool FESolver::InitEquations()
 	{
 		FENode& node = mesh.Node(P[i]);
 		if (node.HasFlags(FENode::EXCLUDE))
-			for (int j = 0; j < (int)node.m_ID.size(); ++j) node.m_ID[j] = -1;
+			for (int j = 0; j < node.dofs(); ++j) node.m_ID[j] = -1;
 	}
 	m_dofMap.clear();
 
@@ -393,7 +401,7 @@ bool FESolver::InitEquations()
 			{
 				FENode& node = mesh.Node(P[i]);
 				if (node.HasFlags(FENode::EXCLUDE) == false) {
-					int dofs = (int)node.m_ID.size();
+					int dofs = node.dofs();
 					for (int j = dofs - 1; j >= 0; --j)
 					{
 						if (node.is_active(j))
@@ -554,7 +562,7 @@ bool FESolver::InitEquations2()
 	{
 		FENode& node = mesh.Node(P[i]);
 		if (node.HasFlags(FENode::EXCLUDE))
-			for (int j = 0; j < (int)node.m_ID.size(); ++j) node.m_ID[j] = -1;
+			for (int j = 0; j < node.dofs(); ++j) node.m_ID[j] = -1;
 	}
 	// then, on all elements
 	for (int i = 0; i < mesh.Domains(); ++i)
@@ -805,8 +813,8 @@ FENodalDofInfo FESolver::GetDOFInfoFromEquation(int ieq)
 	for (int i = 0; i < mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		vector<int>& id = node.m_ID;
-		for (int j = 0; j < id.size(); ++j)
+		int* id = node.m_ID;
+		for (int j = 0; j < node.dofs(); ++j)
 		{
 			if (id[j] == ieq)
 			{
@@ -52,6 +52,17 @@ enum EQUATION_ORDER
 	FEBIO2_ORDER
 };
 
+//-----------------------------------------------------------------------------
+// Element assembly mode
+// ATOMIC : all elements are assembled concurrently, using atomic updates of the global matrix
+// COLORED: elements are assembled one color at a time. Elements of the same color do not
+//          share any nodes, so the global matrix can be updated without synchronization.
+enum ASSEMBLY_MODE
+{
+	ATOMIC_ASSEMBLY,
+	COLORED_ASSEMBLY
+};
+
 //-----------------------------------------------------------------------------
 // Solution variable
 class FESolutionVariable
@@ -125,6 +136,11 @@ public:
 	//! add equations
 	void AddEquations(int neq, int partition = 0);
 
+	//! Return the size of the next time step, given the size dt the analysis wants to take.
+	//! This is called before the time is updated, so solvers that need to limit the time 
+	//! step (e.g. explicit solvers) should do it here instead of in InitStep.
+	virtual double TimeStepSize(double dt) { return dt; }
+
 	//! initialize the step (This is called before SolveStep)
 	virtual bool InitStep(double time);
 
@@ -186,6 +202,7 @@ public: //TODO Move these parameters elsewhere
 	int					m_msymm;		//!< matrix symmetry flag for linear solver allocation
 	int					m_eq_scheme;	//!< equation number scheme (used in InitEquations)
 	int					m_eq_order;		//!< normal or reverse ordering
+	int					m_assembly_mode;	//!< element assembly mode (see ASSEMBLY_MODE)
 	int					m_neq;			//!< number of equations
 	std::vector<int>	m_part;			//!< partitions of linear system
 	std::vector<int>	m_dofMap;		//!< array stores for each equation the corresponding dof index
@@ -31,9 +31,12 @@ SOFTWARE.*/
 #include "FEMesh.h"
 #include "FESolidDomain.h"
 #include "FEElemElemList.h"
+#include "FESurfaceBVH.h"
 #include "DumpStream.h"
 #include "matrix.h"
 #include <FECore/log.h>
+#include <assert.h>
+#include <omp.h>
 
 //-----------------------------------------------------------------------------
 FESurface::FESurface(FEModel* fem) : FEMeshPartition(FE_DOMAIN_SURFACE, fem)
@@ -47,12 +50,42 @@ FESurface::FESurface(FEModel* fem) : FEMeshPartition(FE_DOMAIN_SURFACE, fem)
 //-----------------------------------------------------------------------------
 FESurface::~FESurface()
 {
+	for (size_t i = 0; i < m_bvh.size(); ++i) delete m_bvh[i];
+}
+
+//-----------------------------------------------------------------------------
+// Callers hold on to the tree they get (e.g. the projections of several contact 
+// interfaces on the same surface), so a tree is never rebuilt for another tolerance.
+// Instead, the surface keeps a tree for each tolerance that is requested.
+FESurfaceBVH* FESurface::SearchTree(double tol)
+{
+	assert(omp_in_parallel() == 0);
 
+	FESurfaceBVH* bvh = nullptr;
+	if (tol < 0.0)
+	{
+		if (m_bvh.empty() == false) bvh = m_bvh[0];
+		tol = (bvh ? bvh->Tolerance() : 0.0);
+	}
+	else
+	{
+		for (size_t i = 0; i < m_bvh.size(); ++i)
+			if (m_bvh[i]->Tolerance() == tol) { bvh = m_bvh[i]; break; }
+	}
+
+	if (bvh == nullptr)
+	{
+		bvh = new FESurfaceBVH(this);
+		m_bvh.push_back(bvh);
+	}
+	bvh->Update(tol);
+	return bvh;
 }
 
 //-----------------------------------------------------------------------------
 void FESurface::Create(int nsize, int elemType)
 {
+	for (size_t i = 0; i < m_bvh.size(); ++i) m_bvh[i]->Attach(this);
 	m_el.resize(nsize);
 	for (int i = 0; i < nsize; ++i)
 	{
@@ -40,6 +40,7 @@ class FEMesh;
 class FENodeSet;
 class FEFacetSet;
 class FELinearSystem;
+class FESurfaceBVH;
 
 //-----------------------------------------------------------------------------
 class FECORE_API FESurfaceMaterialPoint : public FEMaterialPoint
@@ -247,6 +248,12 @@ public:
 	//! Get the facet set that created this surface
 	FEFacetSet* GetFacetSet() { return m_surf; }
 
+	//! Get the facet search tree for the tolerance tol, updated to the current configuration.
+	//! A tree is created on first use for each tolerance and refitted on subsequent calls.
+	//! A negative tolerance returns the first tree that was created (with zero tolerance
+	//! if there is none). This updates the trees, so it must not be called in parallel.
+	FESurfaceBVH* SearchTree(double tol = -1.0);
+
 public:
 	// Get nodal reference coordinates 
 	void GetReferenceNodalCoordinates(FESurfaceElement& el, vec3d* r0);
@@ -293,4 +300,10 @@ protected:
     bool                        m_bitfc;    //!< interface status
     double                      m_alpha;    //!< intermediate time fraction
 	bool						m_bshellb;	//!< true if this surface is the bottom of a shell domain
+	vector<FESurfaceBVH*>		m_bvh;		//!< facet search trees, one per tolerance (created on demand)
+
+private:
+	// the search trees are owned by the surface
+	FESurface(const FESurface&);
+	void operator = (const FESurface&);
 };
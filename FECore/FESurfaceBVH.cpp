@@ -0,0 +1,353 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "FESurfaceBVH.h"
+#include "FESurface.h"
+#include "FEMesh.h"
+#include <algorithm>
+using namespace std;
+
+// max number of facets in a leaf
+#define BVH_LEAF_SIZE	4
+
+// max depth of the tree (the median split keeps the depth at log2(N))
+#define BVH_MAX_DEPTH	64
+
+// a refit tree is rebuilt when its boxes have grown by this factor
+#define BVH_REBUILD_FACTOR	2.0
+
+//-----------------------------------------------------------------------------
+FESurfaceBVH::FESurfaceBVH(FESurface* ps)
+{
+	m_ps = ps;
+	m_tol = 0.0;
+	m_area0 = 0.0;
+}
+
+//-----------------------------------------------------------------------------
+// calculate the (inflated) bounding box of a facet
+void FESurfaceBVH::FacetBox(int i, BOX& b) const
+{
+	FEMesh& mesh = *m_ps->GetMesh();
+	FESurfaceElement& el = m_ps->Element(i);
+	int N = el.Nodes();
+	b.r0 = b.r1 = mesh.Node(el.m_node[0]).m_rt;
+	for (int j = 1; j < N; ++j)
+	{
+		const vec3d& r = mesh.Node(el.m_node[j]).m_rt;
+		if (r.x < b.r0.x) b.r0.x = r.x; if (r.x > b.r1.x) b.r1.x = r.x;
+		if (r.y < b.r0.y) b.r0.y = r.y; if (r.y > b.r1.y) b.r1.y = r.y;
+		if (r.z < b.r0.z) b.r0.z = r.z; if (r.z > b.r1.z) b.r1.z = r.z;
+	}
+
+	double d = (b.r1 - b.r0).norm()*(m_tol + 1e-9);
+	b.r0 -= vec3d(d, d, d);
+	b.r1 += vec3d(d, d, d);
+}
+
+//-----------------------------------------------------------------------------
+static void mergeBox(vec3d& a0, vec3d& a1, const vec3d& b0, const vec3d& b1)
+{
+	if (b0.x < a0.x) a0.x = b0.x; if (b1.x > a1.x) a1.x = b1.x;
+	if (b0.y < a0.y) a0.y = b0.y; if (b1.y > a1.y) a1.y = b1.y;
+	if (b0.z < a0.z) a0.z = b0.z; if (b1.z > a1.z) a1.z = b1.z;
+}
+
+//-----------------------------------------------------------------------------
+void FESurfaceBVH::Build(double tol)
+{
+	assert(m_ps);
+	m_tol = tol;
+	m_node.clear();
+	m_facet.clear();
+
+	int NF = m_ps->Elements();
+	if (NF == 0) return;
+
+	// facet centers are used for splitting
+	vector<vec3d> c(NF);
+	m_facet.resize(NF);
+	for (int i = 0; i < NF; ++i)
+	{
+		BOX b;
+		FacetBox(i, b);
+		c[i] = (b.r0 + b.r1)*0.5;
+		m_facet[i] = i;
+	}
+
+	m_node.reserve(2*(NF / BVH_LEAF_SIZE + 1));
+	BuildNode(0, NF, c);
+
+	// set the boxes
+	Refit();
+	m_area0 = TotalArea();
+}
+
+//-----------------------------------------------------------------------------
+// Create the node for facets [first, first+count) and its children. 
+// Returns the index of the new node.
+int FESurfaceBVH::BuildNode(int first, int count, vector<vec3d>& c)
+{
+	int n = (int)m_node.size();
+	m_node.push_back(NODE());
+	m_node[n].right = -1;
+	m_node[n].first = first;
+	m_node[n].count = count;
+	if (count <= BVH_LEAF_SIZE) return n;
+
+	// find the extent of the facet centers
+	vec3d c0 = c[m_facet[first]], c1 = c0;
+	for (int i = first + 1; i < first + count; ++i) mergeBox(c0, c1, c[m_facet[i]], c[m_facet[i]]);
+
+	// split along the largest axis at the median
+	vec3d d = c1 - c0;
+	int axis = (d.x >= d.y ? (d.x >= d.z ? 0 : 2) : (d.y >= d.z ? 1 : 2));
+	int half = count / 2;
+	int* pf = &m_facet[0] + first;
+	nth_element(pf, pf + half, pf + count, [&](int a, int b) {
+		const vec3d& ra = c[a];
+		const vec3d& rb = c[b];
+		if (axis == 0) return ra.x < rb.x;
+		if (axis == 1) return ra.y < rb.y;
+		return ra.z < rb.z;
+	});
+
+	// the left child directly follows this node
+	m_node[n].count = 0;
+	BuildNode(first, half, c);
+	int right = BuildNode(first + half, count - half, c);
+	m_node[n].right = right;
+
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+void FESurfaceBVH::Refit()
+{
+	// children are stored after their parent, so we can update bottom-up
+	// by visiting the nodes in reverse order
+	for (int i = (int)m_node.size() - 1; i >= 0; --i)
+	{
+		NODE& node = m_node[i];
+		if (node.count > 0)
+		{
+			FacetBox(m_facet[node.first], node.box);
+			for (int j = 1; j < node.count; ++j)
+			{
+				BOX b;
+				FacetBox(m_facet[node.first + j], b);
+				mergeBox(node.box.r0, node.box.r1, b.r0, b.r1);
+			}
+		}
+		else
+		{
+			const BOX& bl = m_node[i + 1].box;
+			const BOX& br = m_node[node.right].box;
+			node.box = bl;
+			mergeBox(node.box.r0, node.box.r1, br.r0, br.r1);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+double FESurfaceBVH::TotalArea() const
+{
+	double A = 0.0;
+	for (size_t i = 0; i < m_node.size(); ++i)
+	{
+		vec3d d = m_node[i].box.r1 - m_node[i].box.r0;
+		A += d.x*d.y + d.y*d.z + d.z*d.x;
+	}
+	return A;
+}
+
+//-----------------------------------------------------------------------------
+void FESurfaceBVH::Update(double tol)
+{
+	if (m_node.empty() || (tol != m_tol) || ((int)m_facet.size() != m_ps->Elements()))
+	{
+		Build(tol);
+		return;
+	}
+
+	Refit();
+	if (TotalArea() > BVH_REBUILD_FACTOR*m_area0) Build(tol);
+}
+
+//-----------------------------------------------------------------------------
+// check if the line x = p + t*n intersects the box
+static bool lineIntersectsBox(const vec3d& p, const vec3d& n, const vec3d& r0, const vec3d& r1)
+{
+	double tmin = -1e99, tmax = 1e99;
+	const double P[3] = { p.x, p.y, p.z };
+	const double N[3] = { n.x, n.y, n.z };
+	const double A[3] = { r0.x, r0.y, r0.z };
+	const double B[3] = { r1.x, r1.y, r1.z };
+	for (int k = 0; k < 3; ++k)
+	{
+		if (N[k] == 0.0)
+		{
+			if ((P[k] < A[k]) || (P[k] > B[k])) return false;
+		}
+		else
+		{
+			double t0 = (A[k] - P[k]) / N[k];
+			double t1 = (B[k] - P[k]) / N[k];
+			if (t0 > t1) { double t = t0; t0 = t1; t1 = t; }
+			if (t0 > tmin) tmin = t0;
+			if (t1 < tmax) tmax = t1;
+			if (tmin > tmax) return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FESurfaceBVH::FindRayCandidates(const vec3d& p, const vec3d& n, vector<int>& sel) const
+{
+	sel.clear();
+	if (m_node.empty()) return;
+
+	int stack[BVH_MAX_DEPTH];
+	int ns = 0;
+	stack[ns++] = 0;
+	while (ns > 0)
+	{
+		const NODE& node = m_node[stack[--ns]];
+		if (lineIntersectsBox(p, n, node.box.r0, node.box.r1) == false) continue;
+
+		if (node.count > 0)
+		{
+			for (int j = 0; j < node.count; ++j) sel.push_back(m_facet[node.first + j]);
+		}
+		else
+		{
+			assert(ns + 2 <= BVH_MAX_DEPTH);
+			stack[ns++] = node.right;
+			stack[ns++] = (int)(&node - &m_node[0]) + 1;
+		}
+	}
+
+	// return the facets in the same order as a full scan would visit them
+	sort(sel.begin(), sel.end());
+}
+
+//-----------------------------------------------------------------------------
+// squared distance from a point to a box
+static double boxDistance2(const vec3d& x, const vec3d& r0, const vec3d& r1)
+{
+	double dx = (x.x < r0.x ? r0.x - x.x : (x.x > r1.x ? x.x - r1.x : 0.0));
+	double dy = (x.y < r0.y ? r0.y - x.y : (x.y > r1.y ? x.y - r1.y : 0.0));
+	double dz = (x.z < r0.z ? r0.z - x.z : (x.z > r1.z ? x.z - r1.z : 0.0));
+	return dx*dx + dy*dy + dz*dz;
+}
+
+//-----------------------------------------------------------------------------
+void FESurfaceBVH::FindFacetsInRange(const vec3d& x, double R, vector<int>& sel) const
+{
+	if (m_node.empty()) return;
+
+	double R2 = R*R;
+	int stack[BVH_MAX_DEPTH];
+	int ns = 0;
+	stack[ns++] = 0;
+	while (ns > 0)
+	{
+		int inode = stack[--ns];
+		const NODE& node = m_node[inode];
+		if (boxDistance2(x, node.box.r0, node.box.r1) > R2) continue;
+
+		if (node.count > 0)
+		{
+			for (int j = 0; j < node.count; ++j)
+			{
+				int nf = m_facet[node.first + j];
+				BOX b;
+				FacetBox(nf, b);
+				if (boxDistance2(x, b.r0, b.r1) <= R2) sel.push_back(nf);
+			}
+		}
+		else
+		{
+			assert(ns + 2 <= BVH_MAX_DEPTH);
+			stack[ns++] = node.right;
+			stack[ns++] = inode + 1;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+int FESurfaceBVH::FindClosestNode(const vec3d& x) const
+{
+	if (m_node.empty()) return -1;
+
+	int imin = -1;
+	double d2min = 0.0;
+
+	int stack[BVH_MAX_DEPTH];
+	int ns = 0;
+	stack[ns++] = 0;
+	while (ns > 0)
+	{
+		int inode = stack[--ns];
+		const NODE& node = m_node[inode];
+		if ((imin >= 0) && (boxDistance2(x, node.box.r0, node.box.r1) > d2min)) continue;
+
+		if (node.count > 0)
+		{
+			for (int j = 0; j < node.count; ++j)
+			{
+				FESurfaceElement& el = m_ps->Element(m_facet[node.first + j]);
+				int ne = el.Nodes();
+				for (int k = 0; k < ne; ++k)
+				{
+					int nk = el.m_lnode[k];
+					vec3d r = m_ps->Node(nk).m_rt;
+					double d2 = (r - x)*(r - x);
+					if ((imin < 0) || (d2 < d2min) || ((d2 == d2min) && (nk < imin)))
+					{
+						imin = nk;
+						d2min = d2;
+					}
+				}
+			}
+		}
+		else
+		{
+			// visit the closest child first
+			int l = inode + 1, r = node.right;
+			double dl = boxDistance2(x, m_node[l].box.r0, m_node[l].box.r1);
+			double dr = boxDistance2(x, m_node[r].box.r0, m_node[r].box.r1);
+			assert(ns + 2 <= BVH_MAX_DEPTH);
+			if (dl <= dr) { stack[ns++] = r; stack[ns++] = l; }
+			else { stack[ns++] = l; stack[ns++] = r; }
+		}
+	}
+
+	return imin;
+}
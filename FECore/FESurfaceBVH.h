@@ -0,0 +1,100 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "vec3d.h"
+#include <vector>
+#include "fecore_api.h"
+
+class FESurface;
+
+//-----------------------------------------------------------------------------
+//! Bounding volume hierarchy (axis-aligned boxes) over the facets of a surface.
+//! The tree is built once and can be refitted to the current nodal positions
+//! without changing its topology. It is rebuilt automatically by Update when
+//! the refitted boxes have grown too much. All queries are const and can be
+//! called from multiple threads.
+class FECORE_API FESurfaceBVH
+{
+	struct BOX
+	{
+		vec3d	r0, r1;	// min and max corners
+	};
+
+	struct NODE
+	{
+		BOX		box;
+		int		right;	// index of right child (left child is next node)
+		int		first;	// first facet (leaves only)
+		int		count;	// number of facets (zero for internal nodes)
+	};
+
+public:
+	FESurfaceBVH(FESurface* ps = nullptr);
+
+	//! attach to a surface
+	void Attach(FESurface* ps) { m_ps = ps; m_node.clear(); }
+
+	//! build the hierarchy. Facet boxes are inflated by tol times the facet size.
+	void Build(double tol = 0.0);
+
+	//! update the boxes to the current configuration (keeps the topology)
+	void Refit();
+
+	//! refit the tree, or rebuild it if it is empty, out of date or degraded
+	void Update(double tol);
+
+	//! the tolerance used for inflating the facet boxes
+	double Tolerance() const { return m_tol; }
+
+	//! is the tree built
+	bool IsEmpty() const { return m_node.empty(); }
+
+public:
+	//! find all facets whose boxes are intersected by the line through p with direction n.
+	//! The facet indices are returned in ascending order.
+	void FindRayCandidates(const vec3d& p, const vec3d& n, std::vector<int>& sel) const;
+
+	//! find all facets whose boxes are within distance R of x.
+	//! The facet indices are appended to sel.
+	void FindFacetsInRange(const vec3d& x, double R, std::vector<int>& sel) const;
+
+	//! find the (local) index of the surface node closest to x
+	int FindClosestNode(const vec3d& x) const;
+
+private:
+	void FacetBox(int i, BOX& b) const;
+	int BuildNode(int first, int count, std::vector<vec3d>& c);
+	double TotalArea() const;
+
+private:
+	FESurface*			m_ps;		//!< the surface
+	std::vector<NODE>	m_node;		//!< tree nodes (in depth-first order)
+	std::vector<int>	m_facet;	//!< facet indices, referenced by leaves
+	double				m_tol;		//!< box inflation
+	double				m_area0;	//!< sum of box areas after last build
+};
@@ -55,7 +55,7 @@ JFNKMatrix::JFNKMatrix(FENewtonSolver* pns, SparseMatrix* K) : m_pns(pns), m_K(K
 	for (int i = 0; i < mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		for (int j = 0; j < node.m_ID.size(); ++j)
+		for (int j = 0; j < node.dofs(); ++j)
 		{
 			int id = node.m_ID[j];
 
@@ -110,9 +110,11 @@ bool JFNKMatrix::mult_vector(double* x, double* r)
 {
 	int neq = (int)m_pns->m_ui.size();
 
+	const int nfree = (int)m_freeDofs.size();
 	if (m_policy == ZERO_PRESCRIBED_DOFS)
 	{
-		for (int i = 0; i < m_freeDofs.size(); ++i)
+		#pragma omp parallel for
+		for (int i = 0; i < nfree; ++i)
 		{
 			int id = m_freeDofs[i];
 			m_v[id] = x[id];
@@ -125,7 +127,8 @@ bool JFNKMatrix::mult_vector(double* x, double* r)
 	}
 	else
 	{
-		for (int i = 0; i < m_freeDofs.size(); ++i)
+		#pragma omp parallel for
+		for (int i = 0; i < nfree; ++i)
 		{
 			int id = m_freeDofs[i];
 			m_v[id] = 0.0;
@@ -149,6 +152,7 @@ bool JFNKMatrix::mult_vector(double* x, double* r)
 		eps = 0.0;
 		if (norm_v != 0.0)
 		{
+			#pragma omp parallel for reduction(+:eps)
 			for (int i = 0; i < neq; ++i) eps += fabs(u[i]);
 			eps *= m_eps / (neq*norm_v);
 		}
@@ -157,12 +161,13 @@ bool JFNKMatrix::mult_vector(double* x, double* r)
 	}
 
 	// multiply by eps
-	for (int i = 0; i < neq; ++i) m_v[i] *= eps;
+	m_v *= eps;
 
 	m_pns->Update2(m_v);
 	if (m_pns->Residual(m_R) == false) return false;
 
-	for (int i = 0; i < m_freeDofs.size(); ++i)
+	#pragma omp parallel for
+	for (int i = 0; i < nfree; ++i)
 	{
 		int id = m_freeDofs[i];
 		r[id] = (m_R0[id] - m_R[id]) / eps;
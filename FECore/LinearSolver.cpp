@@ -28,12 +28,15 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "LinearSolver.h"
+#include "vector.h"
+#include "log.h"
 
 REGISTER_SUPER_CLASS(LinearSolver, FELINEARSOLVER_ID);
 
 //-----------------------------------------------------------------------------
 LinearSolver::LinearSolver(FEModel* fem) : FECoreBase(fem)
 {
+	m_pattern = 0;
 	ResetStats();
 }
 
@@ -95,6 +98,8 @@ void LinearSolver::ResetStats()
 {
 	m_stats.backsolves = 0;
 	m_stats.iterations = 0;
+	m_stats.reused = 0;
+	m_stats.refinements = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -104,6 +109,28 @@ void LinearSolver::UpdateStats(int iterations)
 	m_stats.iterations += iterations;
 }
 
+//-----------------------------------------------------------------------------
+bool LinearSolver::SamePattern(const SparseMatrix* A)
+{
+	// a zero fingerprint means that the pattern is not known
+	unsigned long long fp = (A ? A->Fingerprint() : 0);
+	bool bsame = ((fp != 0) && (fp == m_pattern));
+	m_pattern = fp;
+	return bsame;
+}
+
+//-----------------------------------------------------------------------------
+void LinearSolver::AnalysisReused()
+{
+	m_stats.reused++;
+}
+
+//-----------------------------------------------------------------------------
+void LinearSolver::AddRefinements(int n)
+{
+	m_stats.refinements += n;
+}
+
 //-----------------------------------------------------------------------------
 void LinearSolver::Destroy()
 {
@@ -134,6 +161,66 @@ bool LinearSolver::Solve(vector<double>& x, vector<double>& y)
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(MixedPrecisionSolver, LinearSolver)
+	ADD_PARAMETER(m_mixed    , "mixed_precision");
+	ADD_PARAMETER(m_refineTol, "refine_tol");
+	ADD_PARAMETER(m_maxRefine, "max_refine");
+END_FECORE_CLASS();
+
+MixedPrecisionSolver::MixedPrecisionSolver(FEModel* fem) : LinearSolver(fem)
+{
+	m_mixed = false;
+	m_refineTol = 1e-10;
+	m_maxRefine = 10;
+}
+
+//-----------------------------------------------------------------------------
+bool MixedPrecisionSolver::RefineSolution(SparseMatrix* A, double* x, double* b, std::function<bool(double* d, double* r)> solve)
+{
+	// The single precision factor only gives a solution with about 7 correct digits,
+	// so we use iterative refinement with the residual evaluated in double precision.
+	const int n = A->Rows();
+	double normb = l2_norm(b, n);
+	if (normb == 0.0) { UpdateStats(1); return true; }
+
+	m_r.resize(n);
+	m_d.resize(n);
+	double* r = &m_r[0];
+	double* d = &m_d[0];
+
+	int nref = 0;
+	double normr = 0.0, normr_prev = 0.0;
+	bool converged = false;
+	while (true)
+	{
+		// r = b - A*x
+		A->mult_vector(x, r);
+		vaxpby(n, 1.0, b, -1.0, r);
+		normr = l2_norm(r, n);
+
+		if (normr <= m_refineTol*normb) { converged = true; break; }
+
+		// stop if the maximum is reached or refinement stagnates
+		if ((nref >= m_maxRefine) || ((nref > 0) && (normr > 0.5*normr_prev))) break;
+		normr_prev = normr;
+
+		// x = x + inv(A)*r
+		if (solve(d, r) == false) return false;
+		vaxpy(n, 1.0, d, x);
+		nref++;
+	}
+
+	if (converged == false)
+	{
+		feLogWarning("Iterative refinement did not reach the residual target (%lg > %lg)", normr / normb, m_refineTol);
+	}
+
+	AddRefinements(nref);
+	UpdateStats(1 + nref);
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 IterativeLinearSolver::IterativeLinearSolver(FEModel* fem) : LinearSolver(fem) 
 {
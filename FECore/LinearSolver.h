@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include "FECoreBase.h"
 #include "fecore_enum.h"
 #include <vector>
+#include <functional>
 
 class FEModel;
 
@@ -40,6 +41,8 @@ struct FECORE_API LinearSolverStats
 {
 	int		backsolves;		// number of times backsolve was called
 	int		iterations;		// total number of iterations
+	int		reused;			// number of times the symbolic analysis was reused (matrix structure unchanged)
+	int		refinements;	// total number of iterative refinement steps (mixed precision solvers)
 };
 
 //-----------------------------------------------------------------------------
@@ -122,11 +125,49 @@ protected:
 	// Should be called after each backsolve. Will increment backsolves by one and add iterations
 	void UpdateStats(int iterations);
 
+	// Used by direct solvers in PreProcess to see if the sparsity pattern of A is identical to that
+	// of the previous call. If so, the ordering and symbolic analysis can be reused. Note that this
+	// only compares fingerprints. The solver must still check that its symbolic data is valid.
+	bool SamePattern(const SparseMatrix* A);
+
+	// used by derived classes to record that a symbolic analysis was reused
+	void AnalysisReused();
+
+	// used by derived classes to record the number of iterative refinement steps
+	void AddRefinements(int n);
+
 protected:
 	std::vector<int>	m_part;		//!< partitions of linear system.
 
 private:
 	LinearSolverStats	m_stats;	//!< stats on how often linear solver was called.
+	unsigned long long	m_pattern;	//!< fingerprint of the last preprocessed sparsity pattern
+};
+
+//-----------------------------------------------------------------------------
+// base class for direct solvers that can factor the matrix in single precision
+// (mixed_precision) and improve the solution with iterative refinement
+class FECORE_API MixedPrecisionSolver : public LinearSolver
+{
+public:
+	// constructor
+	MixedPrecisionSolver(FEModel* fem);
+
+protected:
+	// Improve the solution x of A*x = b that was found with the single precision factor.
+	// The residual is evaluated in double precision and the correction is found with 
+	// solve(d, r), which must apply the factor. This also updates the stats.
+	bool RefineSolution(SparseMatrix* A, double* x, double* b, std::function<bool(double* d, double* r)> solve);
+
+protected:
+	bool	m_mixed;		//!< use a single precision factor with iterative refinement
+	double	m_refineTol;	//!< relative residual target for iterative refinement
+	int		m_maxRefine;	//!< max number of refinement steps
+
+private:
+	std::vector<double>	m_r, m_d;	//!< work vectors for iterative refinement
+
+	DECLARE_FECORE_CLASS();
 };
 
 //-----------------------------------------------------------------------------
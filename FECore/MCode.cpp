@@ -0,0 +1,292 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "MCode.h"
+#include <math.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+MCode::MCode()
+{
+	m_result = -1;
+}
+
+//-----------------------------------------------------------------------------
+void MCode::Clear()
+{
+	m_code.clear();
+	m_result = -1;
+}
+
+//-----------------------------------------------------------------------------
+bool MCode::Compile(const MItem* pi)
+{
+	Clear();
+	if (pi == nullptr) return false;
+
+	int r = compile(pi);
+	if (r < 0) { Clear(); return false; }
+	m_result = r;
+
+	removeDeadCode();
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Add an instruction, unless an identical instruction already exists (which
+// eliminates common sub-expressions). Returns the register of the result.
+int MCode::add(const Instruction& in)
+{
+	for (int i = 0; i < (int)m_code.size(); ++i)
+	{
+		const Instruction& ci = m_code[i];
+		if ((ci.op == in.op) && (ci.a == in.a) && (ci.b == in.b) && (ci.f1 == in.f1) && (ci.f2 == in.f2) &&
+			(memcmp(&ci.c, &in.c, sizeof(double)) == 0)) return i;
+	}
+	m_code.push_back(in);
+	return (int)m_code.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+// compile an item and return the register of its result (or -1 on failure)
+int MCode::compile(const MItem* pi)
+{
+	Instruction in = { MC_CONST, -1, -1, 0.0, nullptr, nullptr };
+	switch (pi->Type())
+	{
+	case MCONST:
+	case MFRAC :
+	case MNAMED:
+		in.c = mnumber(pi)->value();
+		return add(in);
+	case MVAR:
+		in.op = MC_VAR;
+		in.a = mvar(pi)->index();
+		return add(in);
+	case MSFNC:
+		return compile(msfncnd(pi)->Value());
+	case MNEG:
+	case MF1D:
+		{
+			int a = compile(munary(pi)->Item());
+			if (a < 0) return -1;
+			if (pi->Type() == MNEG) in.op = MC_NEG;
+			else { in.op = MC_F1D; in.f1 = mfnc1d(pi)->funcptr(); }
+
+			// fold constants
+			if (m_code[a].op == MC_CONST)
+			{
+				double x = m_code[a].c;
+				in.c = (in.op == MC_NEG ? -x : in.f1(x));
+				in.op = MC_CONST; in.f1 = nullptr;
+				return add(in);
+			}
+
+			in.a = a;
+			return add(in);
+		}
+		break;
+	case MADD:
+	case MSUB:
+	case MMUL:
+	case MDIV:
+	case MPOW:
+	case MF2D:
+		{
+			int a = compile(mbinary(pi)->LeftItem());
+			if (a < 0) return -1;
+			int b = compile(mbinary(pi)->RightItem());
+			if (b < 0) return -1;
+
+			switch (pi->Type())
+			{
+			case MADD: in.op = MC_ADD; break;
+			case MSUB: in.op = MC_SUB; break;
+			case MMUL: in.op = MC_MUL; break;
+			case MDIV: in.op = MC_DIV; break;
+			case MPOW: in.op = MC_POW; break;
+			case MF2D: in.op = MC_F2D; in.f2 = mfnc2d(pi)->funcptr(); break;
+			default:
+				assert(false);
+			}
+
+			// fold constants
+			if ((m_code[a].op == MC_CONST) && (m_code[b].op == MC_CONST))
+			{
+				double x = m_code[a].c;
+				double y = m_code[b].c;
+				switch (in.op)
+				{
+				case MC_ADD: in.c = x + y; break;
+				case MC_SUB: in.c = x - y; break;
+				case MC_MUL: in.c = x * y; break;
+				case MC_DIV: in.c = x / y; break;
+				case MC_POW: in.c = pow(x, y); break;
+				case MC_F2D: in.c = in.f2(x, y); break;
+				}
+				in.op = MC_CONST; in.f2 = nullptr;
+				return add(in);
+			}
+
+			// the operands of commutative operators are ordered so that 
+			// e.g. x*y and y*x are recognized as the same expression
+			if (((in.op == MC_ADD) || (in.op == MC_MUL)) && (b < a)) { int t = a; a = b; b = t; }
+
+			in.a = a;
+			in.b = b;
+			return add(in);
+		}
+		break;
+	default:
+		// all other items cannot be compiled
+		return -1;
+	}
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Folding constants can leave instructions whose results are no longer used.
+// This removes them and renumbers the registers.
+void MCode::removeDeadCode()
+{
+	int N = (int)m_code.size();
+	std::vector<int> live(N, 0);
+	live[m_result] = 1;
+	for (int i = m_result; i >= 0; --i)
+	{
+		if (live[i] == 0) continue;
+		const Instruction& in = m_code[i];
+		switch (in.op)
+		{
+		case MC_CONST:
+		case MC_VAR:
+			break;
+		case MC_NEG:
+		case MC_F1D:
+			live[in.a] = 1;
+			break;
+		default:
+			live[in.a] = 1;
+			live[in.b] = 1;
+		}
+	}
+
+	std::vector<int> newIndex(N, -1);
+	std::vector<Instruction> code;
+	for (int i = 0; i < N; ++i)
+	{
+		if (live[i] == 0) continue;
+		Instruction in = m_code[i];
+		if ((in.op != MC_CONST) && (in.op != MC_VAR))
+		{
+			in.a = newIndex[in.a];
+			if ((in.op != MC_NEG) && (in.op != MC_F1D)) in.b = newIndex[in.b];
+		}
+		newIndex[i] = (int)code.size();
+		code.push_back(in);
+	}
+	m_result = newIndex[m_result];
+	m_code = code;
+}
+
+//-----------------------------------------------------------------------------
+double MCode::value(const double* var) const
+{
+	const int N = (int)m_code.size();
+
+	// registers (on the stack for all but very large expressions)
+	const int MAX_REGS = 64;
+	double buf[MAX_REGS];
+	std::vector<double> tmp;
+	double* r = buf;
+	if (N > MAX_REGS) { tmp.resize(N); r = &tmp[0]; }
+
+	const Instruction* code = m_code.data();
+	for (int i = 0; i < N; ++i)
+	{
+		const Instruction& in = code[i];
+		switch (in.op)
+		{
+		case MC_CONST: r[i] = in.c; break;
+		case MC_VAR  : r[i] = var[in.a]; break;
+		case MC_NEG  : r[i] = -r[in.a]; break;
+		case MC_ADD  : r[i] = r[in.a] + r[in.b]; break;
+		case MC_SUB  : r[i] = r[in.a] - r[in.b]; break;
+		case MC_MUL  : r[i] = r[in.a] * r[in.b]; break;
+		case MC_DIV  : r[i] = r[in.a] / r[in.b]; break;
+		case MC_POW  : r[i] = pow(r[in.a], r[in.b]); break;
+		case MC_F1D  : r[i] = in.f1(r[in.a]); break;
+		case MC_F2D  : r[i] = in.f2(r[in.a], r[in.b]); break;
+		}
+	}
+
+	return r[m_result];
+}
+
+//-----------------------------------------------------------------------------
+// The points are processed in blocks. For each instruction, the inner loop runs
+// over all points in the block, which amortizes the instruction dispatch and 
+// allows the compiler to vectorize the arithmetic.
+void MCode::value(int n, const double* const* var, double* val) const
+{
+	const int B = 32;
+	const int N = (int)m_code.size();
+	std::vector<double> reg(N*B);
+	double* r = reg.data();
+
+	const Instruction* code = m_code.data();
+	for (int n0 = 0; n0 < n; n0 += B)
+	{
+		const int m = (n - n0 < B ? n - n0 : B);
+		for (int i = 0; i < N; ++i)
+		{
+			const Instruction& in = code[i];
+			double* ri = r + i*B;
+			const double* ra = ((in.op != MC_CONST) && (in.op != MC_VAR) ? r + in.a*B : nullptr);
+			const double* rb = (in.b >= 0 ? r + in.b*B : nullptr);
+			switch (in.op)
+			{
+			case MC_CONST: for (int k = 0; k < m; ++k) ri[k] = in.c; break;
+			case MC_VAR  : { const double* v = var[in.a] + n0; for (int k = 0; k < m; ++k) ri[k] = v[k]; } break;
+			case MC_NEG  : for (int k = 0; k < m; ++k) ri[k] = -ra[k]; break;
+			case MC_ADD  : for (int k = 0; k < m; ++k) ri[k] = ra[k] + rb[k]; break;
+			case MC_SUB  : for (int k = 0; k < m; ++k) ri[k] = ra[k] - rb[k]; break;
+			case MC_MUL  : for (int k = 0; k < m; ++k) ri[k] = ra[k] * rb[k]; break;
+			case MC_DIV  : for (int k = 0; k < m; ++k) ri[k] = ra[k] / rb[k]; break;
+			case MC_POW  : for (int k = 0; k < m; ++k) ri[k] = pow(ra[k], rb[k]); break;
+			case MC_F1D  : for (int k = 0; k < m; ++k) ri[k] = in.f1(ra[k]); break;
+			case MC_F2D  : for (int k = 0; k < m; ++k) ri[k] = in.f2(ra[k], rb[k]); break;
+			}
+		}
+
+		const double* res = r + m_result*B;
+		for (int k = 0; k < m; ++k) val[n0 + k] = res[k];
+	}
+}
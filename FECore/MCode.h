@@ -0,0 +1,87 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "MItem.h"
+#include <vector>
+#include "fecore_api.h"
+
+//-----------------------------------------------------------------------------
+// This class stores a math expression that is compiled to a flat list of 
+// instructions. Each instruction writes its result to its own register, so the
+// expression is evaluated in a single loop, without recursion. When the 
+// expression is compiled, constant sub-expressions are folded and common
+// sub-expressions are only evaluated once.
+// Only scalar expressions can be compiled (numbers, variables, arithmetic 
+// operators and functions of one or two variables).
+class FECORE_API MCode
+{
+public:
+	enum OpCode {
+		MC_CONST, MC_VAR, MC_NEG, MC_ADD, MC_SUB, MC_MUL, MC_DIV, MC_POW, MC_F1D, MC_F2D
+	};
+
+	struct Instruction
+	{
+		int			op;		// op code
+		int			a, b;	// operand registers (a is the variable index for MC_VAR)
+		double		c;		// value of MC_CONST
+		FUNCPTR		f1;		// function of MC_F1D
+		FUNC2PTR	f2;		// function of MC_F2D
+	};
+
+public:
+	MCode();
+
+	// compile an expression. Returns false if the expression cannot be compiled.
+	bool Compile(const MItem* pi);
+
+	// clear the code
+	void Clear();
+
+	// see if the code is valid
+	bool IsValid() const { return (m_result >= 0); }
+
+	// nr of instructions
+	int Instructions() const { return (int)m_code.size(); }
+
+	// evaluate the expression. The var array contains the values of the variables.
+	double value(const double* var) const;
+
+	// Evaluate the expression at n points. var[i] points to the n values
+	// of variable i, and the results are stored in val.
+	void value(int n, const double* const* var, double* val) const;
+
+private:
+	int compile(const MItem* pi);
+	int add(const Instruction& in);
+	void removeDeadCode();
+
+private:
+	std::vector<Instruction>	m_code;
+	int							m_result;	// register that holds the result
+};
@@ -203,7 +203,31 @@ double MSimpleExpression::value(const MItem* pi, const std::vector<double>& var)
 }
 
 //-----------------------------------------------------------------------------
-MSimpleExpression::MSimpleExpression(const MSimpleExpression& mo) : MathObject(mo), m_item(mo.m_item)
+double MSimpleExpression::value_s(const double* var) const
+{
+	if (m_code.IsValid()) return m_code.value(var);
+
+	std::vector<double> v(var, var + m_Var.size());
+	return value(m_item.ItemPtr(), v);
+}
+
+//-----------------------------------------------------------------------------
+void MSimpleExpression::value_s(int n, const double* const* var, double* val) const
+{
+	if (m_code.IsValid()) { m_code.value(n, var, val); return; }
+
+	// the expression could not be compiled, so evaluate one point at a time
+	int nvar = (int)m_Var.size();
+	std::vector<double> v(nvar);
+	for (int i = 0; i < n; ++i)
+	{
+		for (int j = 0; j < nvar; ++j) v[j] = var[j][i];
+		val[i] = value(m_item.ItemPtr(), v);
+	}
+}
+
+//-----------------------------------------------------------------------------
+MSimpleExpression::MSimpleExpression(const MSimpleExpression& mo) : MathObject(mo), m_item(mo.m_item), m_code(mo.m_code)
 {
 	// The copy c'tor of MathObject copied the variables, but any MVarRefs still point to the mo object, not this object's var list.
 	// Calling the following function fixes this
@@ -218,6 +242,7 @@ void MSimpleExpression::operator=(const MSimpleExpression& mo)
 
 	// copy the item
 	m_item = mo.m_item;
+	m_code = mo.m_code;
 
 	// The = operator of MathObject copied the variables, but any MVarRefs still point to the mo object, not this object's var list.
 	// Calling the following function fixes this
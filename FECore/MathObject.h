@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #pragma once
 #include "MItem.h"
+#include "MCode.h"
 #include <vector>
 #include "fecore_api.h"
 
@@ -76,7 +77,7 @@ public:
 	MSimpleExpression(const MSimpleExpression& mo);
 	void operator = (const MSimpleExpression& mo);
 
-	void SetExpression(MITEM& e) { m_item = e; }
+	void SetExpression(MITEM& e) { m_item = e; m_code.Compile(m_item.ItemPtr()); }
 	MITEM& GetExpression() { return m_item; }
 	const MITEM& GetExpression() const { return m_item; }
 
@@ -97,9 +98,18 @@ public:
 	double value_s(const std::vector<double>& var) const
 	{ 
 		assert(var.size() == m_Var.size());
+		if (m_code.IsValid()) return m_code.value(var.data());
 		return value(m_item.ItemPtr(), var); 
 	}
 
+	// Same as above, but the variable values are passed as an array, which
+	// must have (at least) the same size as the variable array.
+	double value_s(const double* var) const;
+
+	// Evaluate the expression at n points. var[i] points to the n values of
+	// variable i (i.e. one array per variable) and the results are stored in val.
+	void value_s(int n, const double* const* var, double* val) const;
+
 	int Items();
 
 protected:
@@ -111,4 +121,5 @@ protected:
 
 protected:
 	MITEM	m_item;
+	MCode	m_code;	//!< compiled expression (for fast evaluation)
 };
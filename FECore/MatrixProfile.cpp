@@ -357,3 +357,29 @@ SparseMatrixProfile SparseMatrixProfile::GetBlockProfile(int nrow0, int ncol0, i
 
 	return bMP;
 }
+
+//-----------------------------------------------------------------------------
+//! Calculates a hash of the sparsity pattern (64-bit FNV-1a of the dimensions
+//! and the condensed row entries of each column).
+unsigned long long SparseMatrixProfile::Fingerprint() const
+{
+	const unsigned long long prime = 1099511628211ULL;
+	unsigned long long h = 14695981039346656037ULL;
+
+	h = (h ^ (unsigned int)m_nrow)*prime;
+	h = (h ^ (unsigned int)m_ncol)*prime;
+	for (int j = 0; j < (int)m_prof.size(); ++j)
+	{
+		const ColumnProfile& cj = m_prof[j];
+		int nr = cj.size();
+		h = (h ^ (unsigned int)nr)*prime;
+		for (int i = 0; i < nr; ++i)
+		{
+			h = (h ^ (unsigned int)cj[i].start)*prime;
+			h = (h ^ (unsigned int)cj[i].end)*prime;
+		}
+	}
+
+	// zero is reserved for "unknown pattern"
+	return (h == 0 ? 1 : h);
+}
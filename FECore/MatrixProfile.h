@@ -126,6 +126,10 @@ public:
 	// Extracts a block profile
 	SparseMatrixProfile GetBlockProfile(int nrow0, int ncol0, int nrow1, int ncol1) const;
 
+	//! Calculates a hash of the sparsity pattern. Two profiles with the same
+	//! fingerprint can be assumed to have identical structure. Never returns zero.
+	unsigned long long Fingerprint() const;
+
 private:
 	int	m_nrow, m_ncol;				//!< dimensions of matrix
 	vector<ColumnProfile>	m_prof;	//!< the actual profile in condensed format
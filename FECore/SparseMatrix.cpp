@@ -35,6 +35,8 @@ SparseMatrix::SparseMatrix()
 {
 	m_nrow = m_ncol = 0;
 	m_nsize = 0;
+	m_batomic = true;
+	m_fingerprint = 0;
 }
 
 SparseMatrix::~SparseMatrix()
@@ -45,6 +47,7 @@ void SparseMatrix::Clear()
 {
 	m_nrow = m_ncol = 0;
 	m_nsize = 0;
+	m_fingerprint = 0;
 }
 
 //! scale matrix
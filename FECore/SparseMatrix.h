@@ -60,6 +60,39 @@ public:
 	//! return number of nonzeros
 	int NonZeroes() const { return m_nsize; }
 
+	//! Set whether assembly needs to use atomic updates. This can be turned off
+	//! when the elements that are assembled concurrently don't share any dofs.
+	void SetAtomicAssembly(bool b) { m_batomic = b; }
+
+	//! see if assembly uses atomic updates
+	bool AtomicAssembly() const { return m_batomic; }
+
+	//! Returns true if the matrix uses symmetric storage (i.e. only half of the matrix is stored)
+	virtual bool isSymmetric() { return false; }
+
+	//! Set the fingerprint of the sparsity pattern (see SparseMatrixProfile::Fingerprint).
+	//! This is reset to zero (i.e. unknown) when the matrix is cleared.
+	void SetFingerprint(unsigned long long n) { m_fingerprint = n; }
+
+	//! the fingerprint of the sparsity pattern (zero if unknown)
+	unsigned long long Fingerprint() const { return m_fingerprint; }
+
+	//! Returns true if the matrix format groups the equations by node (e.g. block formats).
+	//! For these matrices, FEGlobalMatrix passes the equation-to-node map before the profile
+	//! is built, and then builds the profile directly in block space (see CreateBlocks).
+	virtual bool UsesNodalStructure() const { return false; }
+
+	//! set the node of each equation (or -1 if the equation is not a nodal dof)
+	virtual void SetNodalStructure(const std::vector<int>& eqnode) {}
+
+	//! Returns the block of each equation, as defined by the last call to SetNodalStructure.
+	//! Returns false if the matrix does not group equations into blocks.
+	virtual bool EquationBlocks(std::vector<int>& eqblock) const { return false; }
+
+	//! Create the matrix structure from a profile of blocks (i.e. where each row and
+	//! column refers to a block of equations, as returned by EquationBlocks).
+	virtual void CreateBlocks(SparseMatrixProfile& bp) {}
+
 public: // functions to be overwritten in derived classes
 
 	//! set all matrix elements to zero
@@ -74,6 +107,22 @@ public: // functions to be overwritten in derived classes
 	//! assemble a matrix into the sparse matrix
 	virtual void Assemble(const matrix& ke, const std::vector<int>& lmi, const std::vector<int>& lmj) = 0;
 
+	//! Calculate for each entry of an element matrix the offset into the value array of the 
+	//! sparse matrix (or -1 if the entry is not assembled). This can be used to assemble the
+	//! same element repeatedly without searching the sparsity pattern. Returns false if
+	//! the matrix format does not support this.
+	virtual bool ScatterMap(const std::vector<int>& lmi, const std::vector<int>& lmj, std::vector<int>& offsets) { return false; }
+
+	//! assemble a matrix using the offsets calculated with ScatterMap
+	virtual void AssembleScatter(const matrix& ke, const std::vector<int>& offsets) { assert(false); }
+
+	//! assemble a symmetric matrix, of which only the upper triangular part is defined, 
+	//! into a matrix with symmetric storage. The offsets are stored row by row for the 
+	//! upper triangle only (i.e. N*(N+1)/2 values). For entry (i,j), this is the offset of
+	//! (i,j) or (j,i) that ScatterMap calculated. If both are valid (i.e. the two dofs map
+	//! to the same equation), the entry is added twice, which is flagged as -k-2.
+	virtual void AssembleScatterSymmetric(const matrix& ke, const std::vector<int>& offsets) { assert(false); }
+
 	//! check if an entry was allocated
 	virtual bool check(int i, int j) = 0;
 
@@ -111,4 +160,8 @@ protected:
 	// NOTE: These values are set by derived classes
 	int	m_nrow, m_ncol;		//!< dimension of matrix
 	int	m_nsize;			//!< number of nonzeroes (i.e. matrix elements actually allocated)
+	bool	m_batomic;		//!< use atomic updates during assembly
+
+private:
+	unsigned long long	m_fingerprint;	//!< fingerprint of the sparsity pattern
 };
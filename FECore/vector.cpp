@@ -33,10 +33,20 @@ SOFTWARE.*/
 #include "FEDofList.h"
 #include <algorithm>
 
+// Vectors shorter than this are processed serially, since the overhead of
+// starting a parallel region would outweigh the gain.
+#define MIN_PARALLEL_SIZE	8192
+
+// NOTE: All loops use the default static schedule, so that each thread always
+// touches the same part of a vector. Together with the first-touch page placement
+// of most operating systems (see vfill), this keeps the data local on NUMA machines.
+
 double operator*(const vector<double>& a, const vector<double>& b)
 {
+	const int n = (int)a.size();
 	double sum_p = 0, sum_n = 0;
-	for (size_t i = 0; i < a.size(); i++)
+	#pragma omp parallel for reduction(+:sum_p,sum_n) if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; i++)
 	{
 		double ab = a[i] * b[i];
 		if (ab >= 0.0) sum_p += ab; else sum_n += ab;
@@ -46,78 +56,85 @@ double operator*(const vector<double>& a, const vector<double>& b)
 
 vector<double> operator - (vector<double>& a, vector<double>& b)
 {
-	vector<double> c(a);
-	int n = (int) c.size();
-	for (int i=0; i<n; ++i) c[i] -= b[i];
+	vector<double> c(a.size());
+	vsub(c, a, b);
 	return c;
 }
 
 void operator += (vector<double>& a, const vector<double>& b)
 {
 	assert(a.size() == b.size());
-	for (size_t i = 0; i < a.size(); ++i) a[i] += b[i];
+	vaxpy((int)a.size(), 1.0, b.data(), a.data());
 }
 
 void operator -= (vector<double>& a, const vector<double>& b)
 {
 	assert(a.size() == b.size());
-	for (size_t i = 0; i < a.size(); ++i) a[i] -= b[i];
+	vaxpy((int)a.size(), -1.0, b.data(), a.data());
 }
 
 void operator *= (vector<double>& a, double b)
 {
-	for (size_t i=0; i<a.size(); ++i) a[i] *= b;
+	const int n = (int)a.size();
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) a[i] *= b;
 }
 
 void vcopys(vector<double>& a, const vector<double>& b, double s)
 {
 	assert(a.size() == b.size());
-	for (size_t i=0; i<a.size(); ++i) a[i] = b[i]*s;
+	const int n = (int)a.size();
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) a[i] = b[i] * s;
 }
 
 void vadds(vector<double>& a, const vector<double>& b, double s)
 {
 	assert(a.size() == b.size());
-	for (size_t i = 0; i<a.size(); ++i) a[i] += b[i] * s;
+	vaxpy((int)a.size(), s, b.data(), a.data());
 }
 
 void vsubs(vector<double>& a, const vector<double>& b, double s)
 {
 	assert(a.size() == b.size());
-	for (size_t i = 0; i<a.size(); ++i) a[i] -= b[i] * s;
+	vaxpy((int)a.size(), -s, b.data(), a.data());
 }
 
 void vscale(vector<double>& a, const vector<double>& s)
 {
 	assert(a.size() == s.size());
-	for (size_t i = 0; i<a.size(); ++i) a[i] *= s[i];
+	const int n = (int)a.size();
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) a[i] *= s[i];
 }
 
 void vsub(vector<double>& a, const vector<double>& l, const vector<double>& r)
 {
 	assert((a.size()==l.size())&&(a.size()==r.size()));
-	for (size_t i=0; i<a.size(); ++i) a[i] = l[i] - r[i];
+	const int n = (int)a.size();
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) a[i] = l[i] - r[i];
 }
 
 vector<double> operator + (const vector<double>& a, const vector<double>& b)
 {
 	assert(a.size() == b.size());
 	vector<double> s(a);
-	for (size_t i = 0; i < s.size(); ++i) s[i] += b[i];
+	s += b;
 	return s;
 }
 
 vector<double> operator*(const vector<double>& a, double g)
 {
 	vector<double> s(a.size());
-	for (size_t i = 0; i < s.size(); ++i) s[i] = a[i]*g;
+	vcopys(s, a, g);
 	return s;
 }
 
 vector<double> FECORE_API operator - (const vector<double>& a)
 {
 	vector<double> s(a.size());
-	for (size_t i = 0; i < s.size(); ++i) s[i] = -a[i];
+	vcopys(s, a, -1.0);
 	return s;
 }
 
@@ -184,21 +201,54 @@ void scatter(vector<double>& v, FEMesh& mesh, const FEDofList& dofs)
 
 double l2_norm(const vector<double>& v)
 {
-	double s = 0.0;
-	for (auto vi : v) s += vi*vi;
-	return sqrt(s);
+	return sqrt(l2_sqrnorm(v));
 }
 
 double l2_sqrnorm(const vector<double>& v)
+{
+	const int n = (int)v.size();
+	return vdot(n, v.data(), v.data());
+}
+
+double l2_norm(double* x, int n)
+{
+	return sqrt(vdot(n, x, x));
+}
+
+double vdot(int n, const double* a, const double* b)
 {
 	double s = 0.0;
-	for (auto vi : v) s += vi*vi;
+	#pragma omp parallel for reduction(+:s) if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) s += a[i] * b[i];
 	return s;
 }
 
-double l2_norm(double* x, int n)
+void vaxpy(int n, double a, const double* x, double* y)
+{
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) y[i] += a*x[i];
+}
+
+void vaxpby(int n, double a, const double* x, double b, double* y)
+{
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) y[i] = a*x[i] + b*y[i];
+}
+
+double vaxpy_norm2(int n, double a, const double* x, double* y)
 {
 	double s = 0.0;
-	for (int i = 0; i < n; ++i) s += x[i]*x[i];
-	return sqrt(s);
+	#pragma omp parallel for reduction(+:s) if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i)
+	{
+		y[i] += a*x[i];
+		s += y[i] * y[i];
+	}
+	return s;
+}
+
+void vfill(int n, double* x, double v)
+{
+	#pragma omp parallel for if (n >= MIN_PARALLEL_SIZE)
+	for (int i = 0; i < n; ++i) x[i] = v;
 }
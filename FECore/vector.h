@@ -75,4 +75,22 @@ void FECORE_API scatter(vector<double>& v, FEMesh& mesh, const FEDofList& dofs);
 // calculate l2 norm of vector
 double FECORE_API l2_norm(const vector<double>& v);
 double FECORE_API l2_sqrnorm(const vector<double>& v);
-double l2_norm(double* x, int n);
+double FECORE_API l2_norm(double* x, int n);
+
+// Multithreaded kernels for raw arrays. These are the building blocks of the 
+// iterative linear solvers and the vector operations above.
+
+// dot product
+double FECORE_API vdot(int n, const double* a, const double* b);
+
+// y = y + a*x
+void FECORE_API vaxpy(int n, double a, const double* x, double* y);
+
+// y = a*x + b*y
+void FECORE_API vaxpby(int n, double a, const double* x, double b, double* y);
+
+// y = y + a*x, returns the squared l2-norm of the updated y
+double FECORE_API vaxpy_norm2(int n, double a, const double* x, double* y);
+
+// set all values (in parallel, so that the memory pages are placed close to the threads that use them)
+void FECORE_API vfill(int n, double* x, double v);
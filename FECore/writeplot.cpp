@@ -29,6 +29,56 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "writeplot.h"
 #include "FESPRProjection.h"
+#include "FEModelParam.h"
+
+//-------------------------------------------------------------------------------------------------
+void writeNodalProjectedElementValues(FEMeshPartition& dom, FEDataStream& ar, FEParamDouble& var)
+{
+	const FEMaterialPoint* mp[FEElement::MAX_INTPOINTS];
+	double si[FEElement::MAX_INTPOINTS];
+	double sn[FEElement::MAX_NODES];
+
+	int NE = dom.Elements();
+	for (int i = 0; i<NE; ++i)
+	{
+		FEElement& e = dom.ElementRef(i);
+		int ne = e.Nodes();
+		int ni = e.GaussPoints();
+
+		// get the integration point values
+		for (int k = 0; k<ni; ++k) mp[k] = e.GetMaterialPoint(k);
+		var.values(ni, mp, si);
+
+		// project to nodes
+		e.project_to_nodes(si, sn);
+
+		// push data to archive
+		for (int j = 0; j<ne; ++j) ar << sn[j];
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void writeNodalProjectedElementValues(FESurface& dom, FEDataStream& ar, FEParamDouble& var)
+{
+	const FEMaterialPoint* mp[FEElement::MAX_INTPOINTS];
+	double gi[FEElement::MAX_INTPOINTS];
+	double gn[FEElement::MAX_NODES];
+
+	int NE = dom.Elements();
+	for (int i = 0; i < NE; ++i)
+	{
+		FESurfaceElement& e = dom.Element(i);
+		int nint = e.GaussPoints();
+		int neln = e.Nodes();
+
+		for (int j = 0; j < nint; ++j) mp[j] = e.GetMaterialPoint(j);
+		var.values(nint, mp, gi);
+
+		e.FEElement::project_to_nodes(gi, gn);
+
+		for (int j = 0; j < neln; ++j) ar << gn[j];
+	}
+}
 
 //-------------------------------------------------------------------------------------------------
 void writeSPRElementValueMat3dd(FESolidDomain& dom, FEDataStream& ar, std::function<mat3dd(const FEMaterialPoint&)> fnc, int interpolOrder)
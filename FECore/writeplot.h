@@ -35,6 +35,8 @@ SOFTWARE.*/
 #include "fecore_api.h"
 #include <functional>
 
+class FEParamDouble;
+
 //=================================================================================================
 template <class T> void writeNodalValues(FEMesh& mesh, FEDataStream& ar, std::function<T(const FENode& node)> f)
 {
@@ -235,6 +237,11 @@ template <class T> void writeNodalProjectedElementValues(FESurface& dom, FEDataS
 FECORE_API void writeSPRElementValueMat3dd(FESolidDomain& dom, FEDataStream& ar, std::function<mat3dd(const FEMaterialPoint&)> fnc, int interpolOrder = -1);
 FECORE_API void writeSPRElementValueMat3ds(FESolidDomain& dom, FEDataStream& ar, std::function<mat3ds(const FEMaterialPoint&)> fnc, int interpolOrder = -1);
 
+// helper functions for writing projected values of scalar parameters. The parameter is
+// evaluated at all integration points of an element in one call.
+FECORE_API void writeNodalProjectedElementValues(FEMeshPartition& dom, FEDataStream& ar, FEParamDouble& var);
+FECORE_API void writeNodalProjectedElementValues(FESurface& dom, FEDataStream& ar, FEParamDouble& var);
+
 // Helper functions for mapping data
 FECORE_API void ProjectToNodes(FEDomain& dom, vector<double>& nodeVals, function<double(FEMaterialPoint& mp)> f);
 FECORE_API void writeRelativeError(FEDomain& dom, FEDataStream& a, function<double(FEMaterialPoint& mp)> f);
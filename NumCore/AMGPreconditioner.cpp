@@ -0,0 +1,957 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "AMGPreconditioner.h"
+#include "CompactSymmMatrix.h"
+#include "CompactUnSymmMatrix.h"
+#include "BlockCSRMatrix.h"
+#include <FECore/vector.h>
+#include <FECore/FEModel.h>
+#include <FECore/FEMesh.h>
+#include <FECore/log.h>
+#include <math.h>
+
+// max size of the coarsest level for which a dense factorization is used
+#define MAX_DENSE_SIZE	2000
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(AMGPreconditioner, Preconditioner)
+	ADD_PARAMETER(m_theta      , "theta");
+	ADD_PARAMETER(m_maxLevels  , "max_levels");
+	ADD_PARAMETER(m_coarseSize , "coarse_size");
+	ADD_PARAMETER(m_degree     , "smooth_degree");
+	ADD_PARAMETER(m_blockSize  , "block_size");
+	ADD_PARAMETER(m_printLevel , "print_level");
+END_FECORE_CLASS();
+
+//-----------------------------------------------------------------------------
+// Convert a compact or block matrix to a CSR matrix that stores all entries.
+static bool ConvertMatrix(SparseMatrix* K, CSRMatrix& A)
+{
+	BlockCSRMatrix* B = dynamic_cast<BlockCSRMatrix*>(K);
+	if (B)
+	{
+		B->ToCSR(A);
+		return true;
+	}
+
+	CompactMatrix* C = dynamic_cast<CompactMatrix*>(K);
+	if ((C == nullptr) || (C->Pointers() == nullptr)) return false;
+
+	int N = C->Rows();
+	if (C->Columns() != N) return false;
+
+	bool bsymm = C->isSymmetric();
+	bool brow = C->isRowBased();
+	int off = C->Offset();
+	const double* pv = C->Values();
+	const int* pi = C->Indices();
+	const int* pp = C->Pointers();
+
+	// count the entries of each row
+	A.create(N, N);
+	vector<int>& ptr = A.pointers();
+	for (int p = 0; p < N; ++p)
+	{
+		for (int k = pp[p] - off; k < pp[p + 1] - off; ++k)
+		{
+			int q = pi[k] - off;
+			int i = (brow ? p : q);
+			int j = (brow ? q : p);
+			ptr[i + 1]++;
+			if (bsymm && (i != j)) ptr[j + 1]++;
+		}
+	}
+	for (int i = 0; i < N; ++i) ptr[i + 1] += ptr[i];
+
+	// copy the values
+	vector<int>& col = A.indices();
+	vector<double>& val = A.values();
+	col.resize(ptr[N]);
+	val.resize(ptr[N]);
+	vector<int> pos(ptr.begin(), ptr.end() - 1);
+	for (int p = 0; p < N; ++p)
+	{
+		for (int k = pp[p] - off; k < pp[p + 1] - off; ++k)
+		{
+			int q = pi[k] - off;
+			int i = (brow ? p : q);
+			int j = (brow ? q : p);
+			col[pos[i]] = j; val[pos[i]++] = pv[k];
+			if (bsymm && (i != j)) { col[pos[j]] = i; val[pos[j]++] = pv[k]; }
+		}
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// calculate the transpose of a matrix
+static void Transpose(const CSRMatrix& A, CSRMatrix& T)
+{
+	const vector<int>& Ap = A.pointers();
+	const vector<int>& Ac = A.indices();
+	const vector<double>& Av = A.values();
+	const int nnz = A.nonzeroes();
+
+	T.create(A.cols(), A.rows());
+	vector<int>& Tp = T.pointers();
+	vector<int>& Tc = T.indices();
+	vector<double>& Tv = T.values();
+	for (int k = 0; k < nnz; ++k) Tp[Ac[k] + 1]++;
+	for (int i = 0; i < T.rows(); ++i) Tp[i + 1] += Tp[i];
+
+	Tc.resize(nnz);
+	Tv.resize(nnz);
+	vector<int> pos(Tp.begin(), Tp.end() - 1);
+	for (int i = 0; i < A.rows(); ++i)
+	{
+		for (int k = Ap[i]; k < Ap[i + 1]; ++k)
+		{
+			int j = Ac[k];
+			Tc[pos[j]] = i;
+			Tv[pos[j]++] = Av[k];
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Calculates C = S*A*B + E, where S is an (optional) diagonal matrix and E an
+// (optional) matrix with the same dimensions as C. The column indices of each
+// row of C are sorted.
+static void Multiply(const CSRMatrix& A, const CSRMatrix& B, CSRMatrix& C, const double* S = nullptr, const CSRMatrix* E = nullptr)
+{
+	const int nr = A.rows();
+	const int nc = B.cols();
+	const int* Ap = &A.pointers()[0];
+	const int* Bp = &B.pointers()[0];
+	const int* Ep = (E ? &E->pointers()[0] : nullptr);
+	const int* Ac = (A.nonzeroes() ? &A.indices()[0] : nullptr);
+	const int* Bc = (B.nonzeroes() ? &B.indices()[0] : nullptr);
+	const int* Ec = (E && E->nonzeroes() ? &E->indices()[0] : nullptr);
+	const double* Av = (A.nonzeroes() ? &A.values()[0] : nullptr);
+	const double* Bv = (B.nonzeroes() ? &B.values()[0] : nullptr);
+	const double* Ev = (E && E->nonzeroes() ? &E->values()[0] : nullptr);
+
+	C.create(nr, nc);
+	vector<int>& Cp = C.pointers();
+
+	// count the nonzeroes of each row
+	#pragma omp parallel
+	{
+		vector<int> tag(nc, -1);
+		#pragma omp for schedule(dynamic, 256)
+		for (int i = 0; i < nr; ++i)
+		{
+			int n = 0;
+			if (E)
+			{
+				for (int k = Ep[i]; k < Ep[i + 1]; ++k)
+				{
+					int j = Ec[k];
+					if (tag[j] != i) { tag[j] = i; n++; }
+				}
+			}
+			for (int ka = Ap[i]; ka < Ap[i + 1]; ++ka)
+			{
+				int r = Ac[ka];
+				for (int kb = Bp[r]; kb < Bp[r + 1]; ++kb)
+				{
+					int j = Bc[kb];
+					if (tag[j] != i) { tag[j] = i; n++; }
+				}
+			}
+			Cp[i + 1] = n;
+		}
+	}
+	for (int i = 0; i < nr; ++i) Cp[i + 1] += Cp[i];
+	if (Cp[nr] == 0) return;
+
+	// calculate the values
+	C.indices().resize(Cp[nr]);
+	C.values().resize(Cp[nr]);
+	int* Cc = &C.indices()[0];
+	double* Cv = &C.values()[0];
+	#pragma omp parallel
+	{
+		vector<int> tag(nc, -1), pos(nc);
+		#pragma omp for schedule(dynamic, 256)
+		for (int i = 0; i < nr; ++i)
+		{
+			const int n0 = Cp[i];
+			int n = n0;
+			double si = (S ? S[i] : 1.0);
+			for (int ka = Ap[i]; ka < Ap[i + 1]; ++ka)
+			{
+				int r = Ac[ka];
+				double a = si*Av[ka];
+				for (int kb = Bp[r]; kb < Bp[r + 1]; ++kb)
+				{
+					int j = Bc[kb];
+					if (tag[j] != i) { tag[j] = i; pos[j] = n; Cc[n] = j; Cv[n] = 0.0; n++; }
+					Cv[pos[j]] += a*Bv[kb];
+				}
+			}
+			if (E)
+			{
+				for (int k = Ep[i]; k < Ep[i + 1]; ++k)
+				{
+					int j = Ec[k];
+					if (tag[j] != i) { tag[j] = i; pos[j] = n; Cc[n] = j; Cv[n] = 0.0; n++; }
+					Cv[pos[j]] += Ev[k];
+				}
+			}
+
+			// sort the row (insertion sort, since rows are short)
+			for (int k = n0 + 1; k < n; ++k)
+			{
+				int cj = Cc[k];
+				double vj = Cv[k];
+				int l = k - 1;
+				while ((l >= n0) && (Cc[l] > cj)) { Cc[l + 1] = Cc[l]; Cv[l + 1] = Cv[l]; --l; }
+				Cc[l + 1] = cj;
+				Cv[l + 1] = vj;
+			}
+		}
+	}
+}
+
+//=============================================================================
+AMGPreconditioner::AMGPreconditioner(FEModel* fem) : Preconditioner(fem)
+{
+	m_nc = 0;
+
+	m_theta = 0.08;
+	m_maxLevels = 10;
+	m_coarseSize = 500;
+	m_degree = 2;
+	m_blockSize = 3;
+	m_printLevel = 0;
+}
+
+//-----------------------------------------------------------------------------
+AMGPreconditioner::~AMGPreconditioner()
+{
+	Destroy();
+}
+
+//-----------------------------------------------------------------------------
+SparseMatrix* AMGPreconditioner::CreateSparseMatrix(Matrix_Type ntype)
+{
+	SparseMatrix* A = nullptr;
+	if (ntype == REAL_SYMMETRIC) A = new CompactSymmMatrix(0);
+	else A = new CRSSparseMatrix(0);
+	SetSparseMatrix(A);
+	return A;
+}
+
+//-----------------------------------------------------------------------------
+void AMGPreconditioner::Destroy()
+{
+	for (size_t i = 0; i < m_lev.size(); ++i) delete m_lev[i];
+	m_lev.clear();
+	vector<double>().swap(m_C);
+	m_nc = 0;
+}
+
+//-----------------------------------------------------------------------------
+double AMGPreconditioner::OperatorComplexity() const
+{
+	if (m_lev.empty() || (m_lev[0]->A.nonzeroes() == 0)) return 0.0;
+	double nnz = 0.0;
+	for (size_t i = 0; i < m_lev.size(); ++i) nnz += (double)m_lev[i]->A.nonzeroes();
+	return nnz / (double)m_lev[0]->A.nonzeroes();
+}
+
+//-----------------------------------------------------------------------------
+// Build the multigrid hierarchy
+bool AMGPreconditioner::Factor()
+{
+	Destroy();
+
+	SparseMatrix* K = GetSparseMatrix();
+	if (K == nullptr) return false;
+
+	Level* L0 = new Level;
+	m_lev.push_back(L0);
+	if (ConvertMatrix(K, L0->A) == false)
+	{
+		feLogError("The AMG preconditioner does not support this matrix format.");
+		return false;
+	}
+
+	// The near-nullspace of the finest level is given by the rigid body modes 
+	// if we can figure out which equations belong to which nodes. 
+	if (NearNullspace(*L0) == false) BlockNullspace(*L0);
+
+	double theta = m_theta;
+	while (true)
+	{
+		Level& L = *m_lev.back();
+		int N = L.A.rows();
+		L.r.resize(N);
+		L.d.resize(N);
+		L.w.resize(N);
+		L.x.resize(N);
+		L.b.resize(N);
+		EstimateSpectralRadius(L);
+
+		if ((N <= m_coarseSize) || (Levels() >= m_maxLevels)) break;
+
+		vector<int> agg;
+		int nagg = Aggregate(L, theta, agg);
+		if (nagg == 0) break;
+
+		Level* C = new Level;
+		if ((Coarsen(L, *C, agg, nagg) == false) || (C->A.rows() >= N))
+		{
+			// coarsening failed or stalled
+			delete C;
+			L.P.create(0, 0);
+			L.R.create(0, 0);
+			break;
+		}
+		m_lev.push_back(C);
+
+		// the strength threshold is reduced on coarser levels
+		theta *= 0.5;
+	}
+
+	// a dense factorization is used on the coarsest level (if it is small enough)
+	// Otherwise, the smoother is used.
+	const Level& Lc = *m_lev.back();
+	if (Lc.A.rows() <= MAX_DENSE_SIZE) FactorCoarse(Lc);
+
+	if (m_printLevel > 0)
+	{
+		feLog("AMG preconditioner: %d levels, operator complexity = %lg\n", Levels(), OperatorComplexity());
+		for (int i = 0; i < Levels(); ++i)
+		{
+			feLog("\tlevel %d: %d equations, %d nonzeroes\n", i, m_lev[i]->A.rows(), m_lev[i]->A.nonzeroes());
+		}
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Calculates the rigid body modes of the finest level. The equations of the
+// nodal displacements are grouped per node. All other equations (e.g. rigid body
+// or shell rotations) form their own node and share an additional constant vector.
+// Returns false if the equations cannot be mapped to the mesh.
+bool AMGPreconditioner::NearNullspace(Level& L)
+{
+	FEModel* fem = GetFEModel();
+	if (fem == nullptr) return false;
+
+	int dofs[3] = { fem->GetDOFIndex("x"), fem->GetDOFIndex("y"), fem->GetDOFIndex("z") };
+	if ((dofs[0] < 0) || (dofs[1] < 0) || (dofs[2] < 0)) return false;
+
+	const int N = L.A.rows();
+	FEMesh& mesh = fem->GetMesh();
+	const int NN = mesh.Nodes();
+
+	// find the nodes and directions of the equations
+	vector<int> eqnode(N, -1), eqdir(N, -1);
+	vec3d c(0, 0, 0);
+	int nc = 0;
+	for (int i = 0; i < NN; ++i)
+	{
+		FENode& node = mesh.Node(i);
+		bool bactive = false;
+		for (int k = 0; k < 3; ++k)
+		{
+			int n = node.m_ID[dofs[k]];
+			if (n < -1) n = -n - 2;
+			if (n >= 0)
+			{
+				if ((n >= N) || (eqnode[n] != -1)) return false;
+				eqnode[n] = i;
+				eqdir[n] = k;
+				bactive = true;
+			}
+		}
+		if (bactive) { c += node.m_rt; nc++; }
+	}
+	if (nc == 0) return false;
+	c /= (double)nc;
+
+	bool bother = false;
+	for (int n = 0; n < N; ++n) if (eqnode[n] == -1) { bother = true; break; }
+	const int nb = (bother ? 7 : 6);
+
+	// setup the nodes
+	L.nptr.clear();
+	L.neq.clear();
+	L.nptr.push_back(0);
+	for (int i = 0; i < NN; ++i)
+	{
+		FENode& node = mesh.Node(i);
+		int m = 0;
+		for (int k = 0; k < 3; ++k)
+		{
+			int n = node.m_ID[dofs[k]];
+			if (n < -1) n = -n - 2;
+			if (n >= 0) { L.neq.push_back(n); m++; }
+		}
+		if (m > 0) L.nptr.push_back((int)L.neq.size());
+	}
+	for (int n = 0; n < N; ++n)
+	{
+		if (eqnode[n] == -1)
+		{
+			L.neq.push_back(n);
+			L.nptr.push_back((int)L.neq.size());
+		}
+	}
+
+	// translations and rotations (relative to the centroid)
+	L.nb = nb;
+	L.B.assign((size_t)N*nb, 0.0);
+	for (int n = 0; n < N; ++n)
+	{
+		double* b = &L.B[(size_t)n*nb];
+		if (eqnode[n] >= 0)
+		{
+			vec3d r = mesh.Node(eqnode[n]).m_rt - c;
+			switch (eqdir[n])
+			{
+			case 0: b[0] = 1.0; b[4] =  r.z; b[5] = -r.y; break;
+			case 1: b[1] = 1.0; b[3] = -r.z; b[5] =  r.x; break;
+			case 2: b[2] = 1.0; b[3] =  r.y; b[4] = -r.x; break;
+			}
+		}
+		else b[6] = 1.0;
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Group the equations in blocks of m_blockSize and use the constant vectors
+// for each block component as near-nullspace.
+void AMGPreconditioner::BlockNullspace(Level& L)
+{
+	const int N = L.A.rows();
+	const int bs = (m_blockSize > 0 ? m_blockSize : 1);
+
+	L.nptr.clear();
+	L.neq.resize(N);
+	L.nptr.push_back(0);
+	for (int n = 0; n < N; ++n)
+	{
+		L.neq[n] = n;
+		if (((n + 1) % bs == 0) || (n == N - 1)) L.nptr.push_back(n + 1);
+	}
+
+	L.nb = bs;
+	L.B.assign((size_t)N*bs, 0.0);
+	for (int n = 0; n < N; ++n) L.B[(size_t)n*bs + n % bs] = 1.0;
+}
+
+//-----------------------------------------------------------------------------
+// Calculate the inverse diagonal and estimate the largest eigenvalue of Dinv*A
+// with a few power iterations.
+void AMGPreconditioner::EstimateSpectralRadius(Level& L)
+{
+	const CSRMatrix& A = L.A;
+	const vector<int>& Ap = A.pointers();
+	const vector<int>& Ac = A.indices();
+	const vector<double>& Av = A.values();
+	const int N = A.rows();
+
+	L.Dinv.assign(N, 0.0);
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i)
+	{
+		for (int k = Ap[i]; k < Ap[i + 1]; ++k)
+		{
+			if ((Ac[k] == i) && (Av[k] != 0.0)) { L.Dinv[i] = 1.0 / Av[k]; break; }
+		}
+	}
+
+	// start from a pseudo-random vector
+	vector<double>& v = L.r;
+	vector<double>& w = L.w;
+	unsigned int seed = 12345;
+	for (int i = 0; i < N; ++i)
+	{
+		seed = seed * 1103515245u + 12345u;
+		v[i] = 0.5 + (double)((seed >> 16) & 0x7fff) / 32768.0;
+	}
+	double nv = sqrt(vdot(N, &v[0], &v[0]));
+	for (int i = 0; i < N; ++i) v[i] /= nv;
+
+	double lmax = 0.0;
+	for (int iter = 0; iter < 15; ++iter)
+	{
+		A.multv(&v[0], &w[0]);
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) w[i] *= L.Dinv[i];
+
+		double nw = sqrt(vdot(N, &w[0], &w[0]));
+		if (nw == 0.0) break;
+		lmax = nw;
+		for (int i = 0; i < N; ++i) v[i] = w[i] / nw;
+	}
+	L.lmax = (lmax > 0.0 ? lmax : 1.0);
+}
+
+//-----------------------------------------------------------------------------
+// Aggregate the nodes of a level. Nodes are strongly connected if the Frobenius
+// norm of the block that couples them exceeds theta*sqrt(|Aii|*|Ajj|). Nodes without
+// strong connections are not aggregated (agg = -1). Returns the nr of aggregates.
+int AMGPreconditioner::Aggregate(const Level& L, double theta, vector<int>& agg)
+{
+	const CSRMatrix& A = L.A;
+	const vector<int>& Ap = A.pointers();
+	const vector<int>& Ac = A.indices();
+	const vector<double>& Av = A.values();
+	const int N = A.rows();
+	const int NN = (int)L.nptr.size() - 1;
+
+	vector<int> eqnode(N, -1);
+	for (int I = 0; I < NN; ++I)
+		for (int k = L.nptr[I]; k < L.nptr[I + 1]; ++k) eqnode[L.neq[k]] = I;
+
+	// build the node graph
+	vector<int> gptr(NN + 1, 0);
+	#pragma omp parallel
+	{
+		vector<int> tag(NN, -1);
+		#pragma omp for schedule(dynamic, 256)
+		for (int I = 0; I < NN; ++I)
+		{
+			int n = 0;
+			for (int l = L.nptr[I]; l < L.nptr[I + 1]; ++l)
+			{
+				int i = L.neq[l];
+				for (int k = Ap[i]; k < Ap[i + 1]; ++k)
+				{
+					int J = eqnode[Ac[k]];
+					if (tag[J] != I) { tag[J] = I; n++; }
+				}
+			}
+			gptr[I + 1] = n;
+		}
+	}
+	for (int I = 0; I < NN; ++I) gptr[I + 1] += gptr[I];
+
+	vector<int> gadj(gptr[NN]);
+	vector<double> gw(gptr[NN]);
+	#pragma omp parallel
+	{
+		vector<int> tag(NN, -1), pos(NN);
+		#pragma omp for schedule(dynamic, 256)
+		for (int I = 0; I < NN; ++I)
+		{
+			int n = gptr[I];
+			for (int l = L.nptr[I]; l < L.nptr[I + 1]; ++l)
+			{
+				int i = L.neq[l];
+				for (int k = Ap[i]; k < Ap[i + 1]; ++k)
+				{
+					int J = eqnode[Ac[k]];
+					if (tag[J] != I) { tag[J] = I; pos[J] = n; gadj[n] = J; gw[n] = 0.0; n++; }
+					gw[pos[J]] += Av[k] * Av[k];
+				}
+			}
+		}
+	}
+
+	// find the strong connections
+	vector<double> dw(NN, 0.0);
+	for (int I = 0; I < NN; ++I)
+		for (int k = gptr[I]; k < gptr[I + 1]; ++k) if (gadj[k] == I) dw[I] = gw[k];
+
+	vector<char> strong(gptr[NN], 0);
+	vector<int> nstrong(NN, 0);
+	const double t2 = theta*theta;
+	#pragma omp parallel for
+	for (int I = 0; I < NN; ++I)
+	{
+		for (int k = gptr[I]; k < gptr[I + 1]; ++k)
+		{
+			int J = gadj[k];
+			if ((J != I) && (gw[k] > t2*sqrt(dw[I] * dw[J]))) { strong[k] = 1; nstrong[I]++; }
+		}
+	}
+
+	// Pass 1: nodes whose strong neighbors are all free form an aggregate with them.
+	agg.assign(NN, -1);
+	int nagg = 0;
+	for (int I = 0; I < NN; ++I)
+	{
+		if ((agg[I] != -1) || (nstrong[I] == 0)) continue;
+
+		bool bfree = true;
+		for (int k = gptr[I]; k < gptr[I + 1]; ++k)
+		{
+			if (strong[k] && (agg[gadj[k]] != -1)) { bfree = false; break; }
+		}
+		if (bfree == false) continue;
+
+		agg[I] = nagg;
+		for (int k = gptr[I]; k < gptr[I + 1]; ++k) if (strong[k]) agg[gadj[k]] = nagg;
+		nagg++;
+	}
+
+	// Pass 2: add the remaining nodes to the aggregate of their strongest connection
+	vector<int> agg1(agg);
+	for (int I = 0; I < NN; ++I)
+	{
+		if ((agg1[I] != -1) || (nstrong[I] == 0)) continue;
+
+		double wmax = 0.0;
+		for (int k = gptr[I]; k < gptr[I + 1]; ++k)
+		{
+			int J = gadj[k];
+			if (strong[k] && (agg1[J] != -1) && (gw[k] > wmax)) { wmax = gw[k]; agg[I] = agg1[J]; }
+		}
+	}
+
+	// Pass 3: the nodes that are left form aggregates with their free strong neighbors.
+	for (int I = 0; I < NN; ++I)
+	{
+		if ((agg[I] != -1) || (nstrong[I] == 0)) continue;
+
+		agg[I] = nagg;
+		for (int k = gptr[I]; k < gptr[I + 1]; ++k)
+		{
+			if (strong[k] && (agg[gadj[k]] == -1)) agg[gadj[k]] = nagg;
+		}
+		nagg++;
+	}
+
+	return nagg;
+}
+
+//-----------------------------------------------------------------------------
+// Build the prolongation from the coarse level C to level L and the coarse operator.
+// The tentative prolongator is found by a QR factorization of the near-nullspace 
+// vectors restricted to each aggregate, and is smoothed with a damped Jacobi step.
+bool AMGPreconditioner::Coarsen(Level& L, Level& C, const vector<int>& agg, int nagg)
+{
+	const int N = L.A.rows();
+	const int NN = (int)L.nptr.size() - 1;
+	const int nb = L.nb;
+
+	// collect the equations of each aggregate
+	vector<int> aptr(nagg + 1, 0);
+	for (int I = 0; I < NN; ++I)
+		if (agg[I] >= 0) aptr[agg[I] + 1] += L.nptr[I + 1] - L.nptr[I];
+	for (int a = 0; a < nagg; ++a) aptr[a + 1] += aptr[a];
+
+	vector<int> aeq(aptr[nagg]);
+	vector<int> pos(aptr.begin(), aptr.end() - 1);
+	for (int I = 0; I < NN; ++I)
+	{
+		int a = agg[I];
+		if (a >= 0)
+			for (int k = L.nptr[I]; k < L.nptr[I + 1]; ++k) aeq[pos[a]++] = L.neq[k];
+	}
+
+	// QR factorization of the near-nullspace vectors of each aggregate (modified
+	// Gram-Schmidt). Linearly dependent vectors are dropped, so that each aggregate
+	// has ka <= nb coarse equations.
+	vector<double> Q((size_t)aptr[nagg] * nb, 0.0);
+	vector<double> R((size_t)nagg*nb*nb, 0.0);
+	vector<int> ka(nagg, 0);
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (int a = 0; a < nagg; ++a)
+	{
+		const int n0 = aptr[a];
+		const int na = aptr[a + 1] - n0;
+		double* q = &Q[0] + (size_t)n0*nb;
+		double* r = &R[0] + (size_t)a*nb*nb;
+		int k = 0;
+		for (int c = 0; c < nb; ++c)
+		{
+			double nrm0 = 0.0;
+			for (int i = 0; i < na; ++i)
+			{
+				double v = L.B[(size_t)aeq[n0 + i] * nb + c];
+				q[i*nb + k] = v;
+				nrm0 += v*v;
+			}
+			if (nrm0 == 0.0) continue;
+
+			for (int l = 0; l < k; ++l)
+			{
+				double s = 0.0;
+				for (int i = 0; i < na; ++i) s += q[i*nb + l] * q[i*nb + k];
+				r[l*nb + c] = s;
+				for (int i = 0; i < na; ++i) q[i*nb + k] -= s*q[i*nb + l];
+			}
+
+			double nrm = 0.0;
+			for (int i = 0; i < na; ++i) nrm += q[i*nb + k] * q[i*nb + k];
+			if (nrm <= 1e-16*nrm0) continue;
+
+			nrm = sqrt(nrm);
+			for (int i = 0; i < na; ++i) q[i*nb + k] /= nrm;
+			r[k*nb + c] = nrm;
+			k++;
+		}
+		ka[a] = k;
+	}
+
+	// coarse equations
+	vector<int> cptr(nagg + 1, 0);
+	for (int a = 0; a < nagg; ++a) cptr[a + 1] = cptr[a] + ka[a];
+	const int Nc = cptr[nagg];
+	if (Nc == 0) return false;
+
+	// tentative prolongator
+	vector<int> eqagg(N, -1), eqloc(N, 0);
+	for (int a = 0; a < nagg; ++a)
+		for (int i = aptr[a]; i < aptr[a + 1]; ++i) { eqagg[aeq[i]] = a; eqloc[aeq[i]] = i; }
+
+	CSRMatrix T(N, Nc);
+	vector<int>& Tp = T.pointers();
+	vector<int>& Tc = T.indices();
+	vector<double>& Tv = T.values();
+	for (int i = 0; i < N; ++i) Tp[i + 1] = Tp[i] + (eqagg[i] >= 0 ? ka[eqagg[i]] : 0);
+	Tc.resize(Tp[N]);
+	Tv.resize(Tp[N]);
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i)
+	{
+		int a = eqagg[i];
+		if (a < 0) continue;
+		const double* qi = &Q[0] + (size_t)eqloc[i] * nb;
+		for (int k = 0; k < ka[a]; ++k)
+		{
+			Tc[Tp[i] + k] = cptr[a] + k;
+			Tv[Tp[i] + k] = qi[k];
+		}
+	}
+
+	// the coarse nodes are the aggregates, and the coarse near-nullspace is given by R
+	C.nptr = cptr;
+	C.neq.resize(Nc);
+	for (int i = 0; i < Nc; ++i) C.neq[i] = i;
+	C.nb = nb;
+	C.B.assign((size_t)Nc*nb, 0.0);
+	for (int a = 0; a < nagg; ++a)
+	{
+		const double* r = &R[0] + (size_t)a*nb*nb;
+		for (int k = 0; k < ka[a]; ++k)
+			for (int c = 0; c < nb; ++c) C.B[(size_t)(cptr[a] + k)*nb + c] = r[k*nb + c];
+	}
+
+	// smoothed prolongator P = (I - w*Dinv*A)*T, with w = 4/(3*lmax)
+	double w = 4.0 / (3.0*L.lmax);
+	vector<double> S(N);
+	for (int i = 0; i < N; ++i) S[i] = -w*L.Dinv[i];
+	Multiply(L.A, T, L.P, &S[0], &T);
+	Transpose(L.P, L.R);
+
+	// Galerkin coarse operator Ac = R*A*P
+	CSRMatrix AP;
+	Multiply(L.A, L.P, AP);
+	Multiply(L.R, AP, C.A);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Dense LDLt factorization of the coarsest level
+bool AMGPreconditioner::FactorCoarse(const Level& L)
+{
+	const int n = L.A.rows();
+	m_nc = 0;
+	m_C.assign((size_t)n*n, 0.0);
+	double* C = &m_C[0];
+	const vector<int>& Ap = L.A.pointers();
+	const vector<int>& Ac = L.A.indices();
+	const vector<double>& Av = L.A.values();
+	for (int i = 0; i < n; ++i)
+	{
+		for (int k = Ap[i]; k < Ap[i + 1]; ++k)
+		{
+			int j = Ac[k];
+			if (j <= i) C[(size_t)i*n + j] += Av[k];
+		}
+	}
+
+	vector<double> tmp(n);
+	for (int k = 0; k < n; ++k)
+	{
+		double d = C[(size_t)k*n + k];
+		if ((d == 0.0) || (d != d))
+		{
+			vector<double>().swap(m_C);
+			return false;
+		}
+
+		for (int i = k + 1; i < n; ++i)
+		{
+			tmp[i] = C[(size_t)i*n + k];
+			C[(size_t)i*n + k] /= d;
+		}
+
+		#pragma omp parallel for schedule(dynamic, 16) if (n - k > 256)
+		for (int i = k + 1; i < n; ++i)
+		{
+			double lik = C[(size_t)i*n + k];
+			if (lik == 0.0) continue;
+			double* Ci = C + (size_t)i*n;
+			for (int j = k + 1; j <= i; ++j) Ci[j] -= lik*tmp[j];
+		}
+	}
+
+	m_nc = n;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void AMGPreconditioner::SolveCoarse(double* x, const double* b)
+{
+	const int n = m_nc;
+	const double* C = &m_C[0];
+	for (int i = 0; i < n; ++i)
+	{
+		double s = b[i];
+		const double* Ci = C + (size_t)i*n;
+		for (int j = 0; j < i; ++j) s -= Ci[j] * x[j];
+		x[i] = s;
+	}
+	for (int i = 0; i < n; ++i) x[i] /= C[(size_t)i*n + i];
+	for (int i = n - 1; i >= 0; --i)
+	{
+		double xi = x[i];
+		const double* Ci = C + (size_t)i*n;
+		for (int j = 0; j < i; ++j) x[j] -= Ci[j] * xi;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Chebyshev smoother (Jacobi preconditioned). The polynomial targets the upper part
+// [lmax/30, lmax] of the spectrum of Dinv*A. If bzero is true, the initial guess
+// is taken to be zero.
+void AMGPreconditioner::Smooth(Level& L, double* x, const double* b, bool bzero)
+{
+	const int N = L.A.rows();
+	double* r = &L.r[0];
+	double* d = &L.d[0];
+	double* w = &L.w[0];
+	const double* Di = &L.Dinv[0];
+
+	const double lmax = 1.1*L.lmax;
+	const double lmin = lmax / 30.0;
+	const double theta = 0.5*(lmax + lmin);
+	const double delta = 0.5*(lmax - lmin);
+	const double sigma = theta / delta;
+	double rho = 1.0 / sigma;
+
+	// initial residual
+	if (bzero)
+	{
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) { x[i] = 0.0; r[i] = b[i]; }
+	}
+	else
+	{
+		L.A.multv(x, r);
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) r[i] = b[i] - r[i];
+	}
+
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i) d[i] = Di[i] * r[i] / theta;
+
+	for (int k = 0; k < m_degree; ++k)
+	{
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) x[i] += d[i];
+
+		if (k == m_degree - 1) break;
+
+		L.A.multv(d, w);
+		double rho1 = 1.0 / (2.0*sigma - rho);
+		double c1 = rho1*rho;
+		double c2 = 2.0*rho1 / delta;
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i)
+		{
+			r[i] -= w[i];
+			d[i] = c1*d[i] + c2*Di[i] * r[i];
+		}
+		rho = rho1;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void AMGPreconditioner::VCycle(int l, double* x, const double* b)
+{
+	Level& L = *m_lev[l];
+	const int N = L.A.rows();
+
+	// coarsest level
+	if (l == Levels() - 1)
+	{
+		if (m_nc == N) SolveCoarse(x, b);
+		else
+		{
+			Smooth(L, x, b, true);
+			Smooth(L, x, b, false);
+		}
+		return;
+	}
+
+	// pre-smoothing
+	Smooth(L, x, b, true);
+
+	// restrict the residual
+	double* r = &L.r[0];
+	L.A.multv(x, r);
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i) r[i] = b[i] - r[i];
+
+	Level& C = *m_lev[l + 1];
+	L.R.multv(r, &C.b[0]);
+
+	// coarse grid correction
+	VCycle(l + 1, &C.x[0], &C.b[0]);
+	L.P.multv(&C.x[0], r);
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i) x[i] += r[i];
+
+	// post-smoothing
+	Smooth(L, x, b, false);
+}
+
+//-----------------------------------------------------------------------------
+// apply one V-cycle to y
+bool AMGPreconditioner::BackSolve(double* x, double* y)
+{
+	if (m_lev.empty()) return false;
+	VCycle(0, x, y);
+	return true;
+}
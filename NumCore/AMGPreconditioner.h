@@ -0,0 +1,114 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include <FECore/Preconditioner.h>
+#include <FECore/CSRMatrix.h>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! Smoothed aggregation algebraic multigrid preconditioner.
+
+//! This preconditioner does not depend on any third-party library. It can be used
+//! with CompactSymmMatrix and CRSSparseMatrix matrices. The equations are aggregated
+//! per node, and the rigid body modes, which are calculated from the nodal positions, 
+//! are preserved by the coarse spaces. If the equations cannot be mapped to the mesh, 
+//! the equations are grouped in blocks of block_size and only the translations are 
+//! preserved. A V-cycle with Chebyshev smoothing is applied, which is symmetric and 
+//! can therefore be used with the conjugate gradient method.
+class AMGPreconditioner : public Preconditioner
+{
+public:
+	// multigrid level
+	struct Level
+	{
+		CSRMatrix	A;		//!< level operator
+		CSRMatrix	P;		//!< prolongation from the next (coarser) level
+		CSRMatrix	R;		//!< restriction to the next level (transpose of P)
+
+		std::vector<double>	Dinv;	//!< inverse of the diagonal of A
+		double				lmax;	//!< estimate of largest eigenvalue of Dinv*A
+
+		std::vector<int>	nptr;	//!< offset into neq for each node
+		std::vector<int>	neq;	//!< equations of the nodes
+		std::vector<double>	B;		//!< near-nullspace vectors (row major)
+		int					nb;		//!< nr of near-nullspace vectors
+
+		std::vector<double>	r, d, w;	//!< work vectors for smoothing
+		std::vector<double>	x, b;		//!< solution and right-hand side on coarse levels
+
+		Level() : lmax(0.0), nb(0) {}
+	};
+
+public:
+	AMGPreconditioner(FEModel* fem);
+	~AMGPreconditioner();
+
+	// create a sparse matrix
+	SparseMatrix* CreateSparseMatrix(Matrix_Type ntype) override;
+
+	// build the multigrid hierarchy
+	bool Factor() override;
+
+	// apply to vector P x = y
+	bool BackSolve(double* x, double* y) override;
+
+	// release the hierarchy
+	void Destroy() override;
+
+public:
+	// nr of levels
+	int Levels() const { return (int)m_lev.size(); }
+
+	// ratio of the total nonzeroes of all levels to the nonzeroes of the matrix
+	double OperatorComplexity() const;
+
+private:
+	bool NearNullspace(Level& L);
+	void BlockNullspace(Level& L);
+	int Aggregate(const Level& L, double theta, std::vector<int>& agg);
+	bool Coarsen(Level& L, Level& C, const std::vector<int>& agg, int nagg);
+	void EstimateSpectralRadius(Level& L);
+	bool FactorCoarse(const Level& L);
+	void SolveCoarse(double* x, const double* b);
+	void Smooth(Level& L, double* x, const double* b, bool bzero);
+	void VCycle(int l, double* x, const double* b);
+
+private:
+	std::vector<Level*>	m_lev;		//!< multigrid levels (finest first)
+	std::vector<double>	m_C;		//!< dense LDLt factor of the coarsest operator
+	int					m_nc;		//!< size of the dense coarse factor (zero if not used)
+
+	double	m_theta;		//!< strength of connection threshold
+	int		m_maxLevels;	//!< max nr of levels
+	int		m_coarseSize;	//!< stop coarsening when the level has fewer equations
+	int		m_degree;		//!< degree of Chebyshev smoother
+	int		m_blockSize;	//!< equations per node when the mesh is not used
+	int		m_printLevel;	//!< output level
+
+	DECLARE_FECORE_CLASS();
+};
@@ -117,17 +117,12 @@ bool BiCGStabSolver::BackSolve(double* x, double* b)
 	int neq = A.Rows();
 
 	// assume initial guess is zero
-	for (int i = 0; i < neq; ++i) x[i] = 0.0;
+	vfill(neq, x, 0.0);
 
 	// calculate initial norm
 	// r0 = b - A*x0
-	vector<double> r_i(neq); double norm0 = 0.0, normi = 0.0;
-	for (int j = 0; j < neq; ++j)
-	{
-		r_i[j] = b[j];
-		norm0 += r_i[j] * r_i[j];
-	}
-	norm0 = sqrt(norm0);
+	vector<double> r_i(b, b + neq); double normi = 0.0;
+	double norm0 = l2_norm(r_i);
 
 	// if the norm is zero, there is nothing to do
 	if (norm0 == 0.0) return true;
@@ -147,6 +142,7 @@ bool BiCGStabSolver::BackSolve(double* x, double* b)
 
 		double beta = (rho_i / rho_p)*(alpha / w_p);
 
+		#pragma omp parallel for
 		for (int j = 0; j < neq; ++j) p_i[j] = r_i[j] + beta*(p_p[j] - w_p*v_p[j]);
 
 		// apply preconditioner
@@ -160,9 +156,12 @@ bool BiCGStabSolver::BackSolve(double* x, double* b)
 
 		alpha = rho_i / (rt*v_p);
 
-		for (int j = 0; j < neq; ++j) h[j] = x[j] + alpha*y[j];
-
-		for (int j = 0; j < neq; ++j) s[j] = r_i[j] - alpha*v_p[j];
+		#pragma omp parallel for
+		for (int j = 0; j < neq; ++j)
+		{
+			h[j] = x[j] + alpha*y[j];
+			s[j] = r_i[j] - alpha*v_p[j];
+		}
 //		If h is accurate enough then xi = h and quit
 
 		if (m_P)
@@ -181,11 +180,11 @@ bool BiCGStabSolver::BackSolve(double* x, double* b)
 
 		w_p = (q*z) / (q*q);
 
-		for (int j = 0; j < neq; ++j) x[j] = h[j] + w_p*z[j];
-		
 		normi = 0.0;
+		#pragma omp parallel for reduction(+:normi)
 		for (int j = 0; j < neq; ++j)
 		{
+			x[j] = h[j] + w_p*z[j];
 			r_i[j] = s[j] - w_p*t[j];
 			normi += r_i[j] * r_i[j];
 		}
@@ -0,0 +1,582 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "BlockCSRMatrix.h"
+#include <FECore/CSRMatrix.h>
+#include <algorithm>
+#include <assert.h>
+using namespace std;
+
+//-----------------------------------------------------------------------------
+BlockCSRMatrix::BlockCSRMatrix(int blockSize)
+{
+	assert(blockSize > 0);
+	m_bs = (blockSize > 0 ? blockSize : 1);
+	m_nb = 0;
+	m_identity = true;
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::SetNodalStructure(const std::vector<int>& eqnode)
+{
+	BuildBlocks(eqnode);
+}
+
+//-----------------------------------------------------------------------------
+bool BlockCSRMatrix::EquationBlocks(std::vector<int>& eqblock) const
+{
+	const int neq = (int)m_eqpos.size();
+	eqblock.resize(neq);
+	for (int i = 0; i < neq; ++i) eqblock[i] = m_eqpos[i] / m_bs;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+//! Assign a block position to each equation. All the equations of a node are 
+//! placed in consecutive positions, starting a new block for each node. Nodes are
+//! visited in the order of their lowest equation number so that the block ordering
+//! follows the equation numbering (which is usually bandwidth optimized).
+//! Equations with a negative node are not nodal dofs.
+void BlockCSRMatrix::BuildBlocks(const std::vector<int>& eqnode)
+{
+	const int bs = m_bs;
+	const int neq = (int)eqnode.size();
+	m_eqpos.assign(neq, -1);
+	m_poseq.clear();
+	m_poseq.reserve(neq + bs);
+
+	// list the equations of each node
+	int nodes = 0;
+	for (int i = 0; i < neq; ++i) if (eqnode[i] >= nodes) nodes = eqnode[i] + 1;
+	vector<int> ptr(nodes + 1, 0), eqs;
+	for (int i = 0; i < neq; ++i) if (eqnode[i] >= 0) ptr[eqnode[i] + 1]++;
+	for (int i = 0; i < nodes; ++i) ptr[i + 1] += ptr[i];
+	eqs.resize(ptr[nodes]);
+	vector<int> pos(ptr.begin(), ptr.end() - 1);
+	for (int i = 0; i < neq; ++i) if (eqnode[i] >= 0) eqs[pos[eqnode[i]]++] = i;
+
+	// the block that non-nodal equations are added to (-1 if none is open)
+	int freeBlock = -1;
+	for (int i = 0; i < neq; ++i)
+	{
+		if (m_eqpos[i] >= 0) continue;
+
+		int node = eqnode[i];
+		if (node >= 0)
+		{
+			// add all equations of this node in new blocks
+			int n0 = ptr[node], n1 = ptr[node + 1];
+			for (int k = n0; k < n1; k += bs)
+			{
+				for (int l = 0; l < bs; ++l)
+				{
+					int eq = (k + l < n1 ? eqs[k + l] : -1);
+					if (eq >= 0) m_eqpos[eq] = (int)m_poseq.size();
+					m_poseq.push_back(eq);
+				}
+			}
+		}
+		else
+		{
+			if (freeBlock < 0)
+			{
+				freeBlock = (int)m_poseq.size() / bs;
+				m_poseq.resize(m_poseq.size() + bs, -1);
+			}
+			int p = freeBlock*bs;
+			while (m_poseq[p] >= 0) p++;
+			m_poseq[p] = i;
+			m_eqpos[i] = p;
+			if (p == freeBlock*bs + bs - 1) freeBlock = -1;
+		}
+	}
+
+	m_nb = (int)m_poseq.size() / bs;
+	assert(m_nb*bs == (int)m_poseq.size());
+
+	m_identity = ((int)m_poseq.size() == neq);
+	for (int i = 0; m_identity && (i < neq); ++i) m_identity = (m_eqpos[i] == i);
+}
+
+//-----------------------------------------------------------------------------
+//! Create the structure from a scalar profile. If the equations were not grouped
+//! by SetNodalStructure, the equations are grouped in the order of their numbering.
+//! FEGlobalMatrix uses CreateBlocks instead, which avoids building the scalar profile.
+void BlockCSRMatrix::Create(SparseMatrixProfile& mp)
+{
+	const int neq = mp.Rows();
+	assert(mp.Columns() == neq);
+	const int bs = m_bs;
+
+	if ((int)m_eqpos.size() != neq) BuildBlocks(vector<int>(neq, -1));
+	const int nb = m_nb;
+
+	// Collect the block columns of each block row. Since we loop over the block
+	// columns in order, the columns of each block row will be sorted and the marker
+	// array makes sure each block is only added once.
+	vector< vector<int> > rows(nb);
+	vector<int> tag(nb, -1);
+	for (int bj = 0; bj < nb; ++bj)
+	{
+		for (int l = 0; l < bs; ++l)
+		{
+			int j = m_poseq[bj*bs + l];
+			if (j < 0) continue;
+
+			SparseMatrixProfile::ColumnProfile& a = mp.Column(j);
+			for (int n = 0; n < a.size(); ++n)
+			{
+				for (int k = a[n].start; k <= a[n].end; ++k)
+				{
+					int bi = m_eqpos[k] / bs;
+					if (tag[bi] != bj)
+					{
+						tag[bi] = bj;
+						rows[bi].push_back(bj);
+					}
+				}
+			}
+		}
+	}
+
+	BuildStructure(rows);
+}
+
+//-----------------------------------------------------------------------------
+//! Create the structure from a profile of blocks (as built by FEGlobalMatrix from
+//! the block connectivity). SetNodalStructure must have been called first.
+void BlockCSRMatrix::CreateBlocks(SparseMatrixProfile& bp)
+{
+	const int nb = m_nb;
+	assert((bp.Rows() == nb) && (bp.Columns() == nb));
+
+	// Since we loop over the block columns in order, the columns of each block row 
+	// are sorted. The row ranges of a column do not overlap, so there are no duplicates.
+	vector< vector<int> > rows(nb);
+	for (int bj = 0; bj < nb; ++bj)
+	{
+		SparseMatrixProfile::ColumnProfile& a = bp.Column(bj);
+		for (int n = 0; n < a.size(); ++n)
+		{
+			for (int bi = a[n].start; bi <= a[n].end; ++bi) rows[bi].push_back(bj);
+		}
+	}
+
+	BuildStructure(rows);
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::BuildStructure(vector< vector<int> >& rows)
+{
+	const int bs = m_bs;
+	const int nb = m_nb;
+	const int neq = (int)m_eqpos.size();
+
+	// make sure all diagonal blocks are defined
+	for (int bi = 0; bi < nb; ++bi)
+	{
+		vector<int>& r = rows[bi];
+		if (binary_search(r.begin(), r.end(), bi) == false) r.insert(lower_bound(r.begin(), r.end(), bi), bi);
+	}
+
+	// build the compressed structure
+	m_ptr.assign(nb + 1, 0);
+	for (int bi = 0; bi < nb; ++bi) m_ptr[bi + 1] = m_ptr[bi] + (int)rows[bi].size();
+	m_col.resize(m_ptr[nb]);
+	for (int bi = 0; bi < nb; ++bi)
+	{
+		copy(rows[bi].begin(), rows[bi].end(), m_col.begin() + m_ptr[bi]);
+		vector<int>().swap(rows[bi]);
+	}
+	m_val.assign(m_col.size()*bs*bs, 0.0);
+
+	m_nrow = m_ncol = neq;
+	m_nsize = (int)m_val.size();
+
+	if (m_identity == false)
+	{
+		m_x.assign(nb*bs, 0.0);
+		m_y.assign(nb*bs, 0.0);
+	}
+	else { m_x.clear(); m_y.clear(); }
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::Zero()
+{
+	std::fill(m_val.begin(), m_val.end(), 0.0);
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::Clear()
+{
+	m_ptr.clear();
+	m_col.clear();
+	m_val.clear();
+	m_eqpos.clear();
+	m_poseq.clear();
+	m_x.clear();
+	m_y.clear();
+	m_nb = 0;
+	m_identity = true;
+	SparseMatrix::Clear();
+}
+
+//-----------------------------------------------------------------------------
+int BlockCSRMatrix::findBlock(int bi, int bj) const
+{
+	const int* c0 = &m_col[0] + m_ptr[bi];
+	const int* c1 = &m_col[0] + m_ptr[bi + 1];
+	const int* c = lower_bound(c0, c1, bj);
+	return ((c != c1) && (*c == bj) ? (int)(c - &m_col[0]) : -1);
+}
+
+//-----------------------------------------------------------------------------
+int BlockCSRMatrix::offset(int i, int j) const
+{
+	const int bs = m_bs;
+	int pi = m_eqpos[i], pj = m_eqpos[j];
+	int k = findBlock(pi / bs, pj / bs);
+	return (k >= 0 ? (k*bs + pi % bs)*bs + pj % bs : -1);
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::Assemble(const matrix& ke, const std::vector<int>& lm)
+{
+	Assemble(ke, lm, lm);
+}
+
+//-----------------------------------------------------------------------------
+//! The entries of the element matrix are processed per row. Since consecutive 
+//! columns usually fall in the same block, the block is only looked up when the
+//! block column changes.
+void BlockCSRMatrix::Assemble(const matrix& ke, const std::vector<int>& lmi, const std::vector<int>& lmj)
+{
+	const int bs = m_bs;
+	const int N = ke.rows();
+	const int M = ke.columns();
+	for (int i = 0; i < N; ++i)
+	{
+		int I = lmi[i];
+		if (I < 0) continue;
+		int pi = m_eqpos[I];
+		int bi = pi / bs, ri = pi % bs;
+
+		const double* ki = ke[i];
+		int bj0 = -1, k = -1;
+		for (int j = 0; j < M; ++j)
+		{
+			int J = lmj[j];
+			if (J < 0) continue;
+			int pj = m_eqpos[J];
+			int bj = pj / bs;
+			if (bj != bj0) { k = findBlock(bi, bj); bj0 = bj; }
+			if (k < 0) continue;
+
+			double& v = m_val[(k*bs + ri)*bs + pj % bs];
+			if (m_batomic)
+			{
+				#pragma omp atomic
+				v += ki[j];
+			}
+			else v += ki[j];
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool BlockCSRMatrix::ScatterMap(const std::vector<int>& lmi, const std::vector<int>& lmj, std::vector<int>& offsets)
+{
+	const int bs = m_bs;
+	const int N = (int)lmi.size();
+	const int M = (int)lmj.size();
+	offsets.assign(N*M, -1);
+	for (int i = 0; i < N; ++i)
+	{
+		int I = lmi[i];
+		if (I < 0) continue;
+		int pi = m_eqpos[I];
+		int bi = pi / bs, ri = pi % bs;
+
+		int bj0 = -1, k = -1;
+		for (int j = 0; j < M; ++j)
+		{
+			int J = lmj[j];
+			if (J < 0) continue;
+			int pj = m_eqpos[J];
+			int bj = pj / bs;
+			if (bj != bj0) { k = findBlock(bi, bj); bj0 = bj; }
+			if (k >= 0) offsets[i*M + j] = (k*bs + ri)*bs + pj % bs;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::AssembleScatter(const matrix& ke, const std::vector<int>& offsets)
+{
+	const int N = ke.rows();
+	const int M = ke.columns();
+	assert((int)offsets.size() == N*M);
+
+	double* pd = &m_val[0];
+	const int* off = &offsets[0];
+	for (int i = 0; i < N; ++i, off += M)
+	{
+		const double* ki = ke[i];
+		for (int j = 0; j < M; ++j)
+		{
+			int k = off[j];
+			if (k >= 0)
+			{
+				if (m_batomic)
+				{
+					#pragma omp atomic
+					pd[k] += ki[j];
+				}
+				else pd[k] += ki[j];
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool BlockCSRMatrix::check(int i, int j)
+{
+	return (offset(i, j) >= 0);
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::set(int i, int j, double v)
+{
+	int k = offset(i, j);
+	if (k >= 0) m_val[k] = v;
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::add(int i, int j, double v)
+{
+	int k = offset(i, j);
+	assert(k >= 0);
+	if (k >= 0) m_val[k] += v;
+}
+
+//-----------------------------------------------------------------------------
+double BlockCSRMatrix::get(int i, int j)
+{
+	int k = offset(i, j);
+	return (k >= 0 ? m_val[k] : 0.0);
+}
+
+//-----------------------------------------------------------------------------
+double BlockCSRMatrix::diag(int i)
+{
+	return get(i, i);
+}
+
+//-----------------------------------------------------------------------------
+void BlockCSRMatrix::scale(const std::vector<double>& L, const std::vector<double>& R)
+{
+	const int bs = m_bs;
+	#pragma omp parallel for schedule(guided)
+	for (int bi = 0; bi < m_nb; ++bi)
+	{
+		for (int k = m_ptr[bi]; k < m_ptr[bi + 1]; ++k)
+		{
+			int bj = m_col[k];
+			double* a = &m_val[0] + k*bs*bs;
+			for (int r = 0; r < bs; ++r)
+			{
+				int I = m_poseq[bi*bs + r];
+				for (int c = 0; c < bs; ++c)
+				{
+					int J = m_poseq[bj*bs + c];
+					if ((I >= 0) && (J >= 0)) a[r*bs + c] *= L[I] * R[J];
+				}
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! The product is evaluated in block space. If the equations don't map directly
+//! onto the block positions, the vectors are permuted first.
+bool BlockCSRMatrix::mult_vector(double* x, double* r)
+{
+	if (m_nb == 0) return true;
+
+	if (m_identity)
+	{
+		if (m_bs == 3) mult3(x, r); else multN(x, r);
+		return true;
+	}
+
+	const int np = (int)m_poseq.size();
+	double* px = &m_x[0];
+	double* py = &m_y[0];
+	#pragma omp parallel for
+	for (int p = 0; p < np; ++p)
+	{
+		int eq = m_poseq[p];
+		px[p] = (eq >= 0 ? x[eq] : 0.0);
+	}
+
+	if (m_bs == 3) mult3(px, py); else multN(px, py);
+
+	#pragma omp parallel for
+	for (int p = 0; p < np; ++p)
+	{
+		int eq = m_poseq[p];
+		if (eq >= 0) r[eq] = py[p];
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Matrix-vector product for 3x3 blocks. The block is fully unrolled so that the 
+// compiler can keep the row sums in registers and vectorize the block product.
+void BlockCSRMatrix::mult3(const double* x, double* y) const
+{
+	const int nb = m_nb;
+	const int* ptr = &m_ptr[0];
+	const int* col = &m_col[0];
+	const double* val = &m_val[0];
+
+	#pragma omp parallel for schedule(guided)
+	for (int bi = 0; bi < nb; ++bi)
+	{
+		double y0 = 0.0, y1 = 0.0, y2 = 0.0;
+		for (int k = ptr[bi]; k < ptr[bi + 1]; ++k)
+		{
+			const double* a = val + 9 * k;
+			const double* xj = x + 3 * col[k];
+			const double x0 = xj[0], x1 = xj[1], x2 = xj[2];
+			y0 += a[0] * x0 + a[1] * x1 + a[2] * x2;
+			y1 += a[3] * x0 + a[4] * x1 + a[5] * x2;
+			y2 += a[6] * x0 + a[7] * x1 + a[8] * x2;
+		}
+		double* yi = y + 3 * bi;
+		yi[0] = y0;
+		yi[1] = y1;
+		yi[2] = y2;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Matrix-vector product for general block sizes
+void BlockCSRMatrix::multN(const double* x, double* y) const
+{
+	const int nb = m_nb;
+	const int bs = m_bs;
+	const int* ptr = &m_ptr[0];
+	const int* col = &m_col[0];
+	const double* val = &m_val[0];
+
+	#pragma omp parallel for schedule(guided)
+	for (int bi = 0; bi < nb; ++bi)
+	{
+		double* yi = y + bs * bi;
+		for (int r = 0; r < bs; ++r) yi[r] = 0.0;
+		for (int k = ptr[bi]; k < ptr[bi + 1]; ++k)
+		{
+			const double* a = val + bs*bs*k;
+			const double* xj = x + bs*col[k];
+			for (int r = 0; r < bs; ++r, a += bs)
+			{
+				double s = 0.0;
+				for (int c = 0; c < bs; ++c) s += a[c] * xj[c];
+				yi[r] += s;
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Expands the blocks into a scalar CSR matrix with sorted column indices. 
+//! Padding entries are dropped, but explicit zeroes inside the blocks are kept.
+void BlockCSRMatrix::ToCSR(CSRMatrix& A) const
+{
+	const int N = Rows();
+	const int bs = m_bs;
+	A.create(N, N);
+	vector<int>& ptr = A.pointers();
+	vector<int>& ind = A.indices();
+	vector<double>& val = A.values();
+
+	// count the entries of each row
+	for (int bi = 0; bi < m_nb; ++bi)
+	{
+		int ncols = 0;
+		for (int k = m_ptr[bi]; k < m_ptr[bi + 1]; ++k)
+		{
+			int bj = m_col[k];
+			for (int c = 0; c < bs; ++c) if (m_poseq[bj*bs + c] >= 0) ncols++;
+		}
+		for (int r = 0; r < bs; ++r)
+		{
+			int I = m_poseq[bi*bs + r];
+			if (I >= 0) ptr[I + 1] = ncols;
+		}
+	}
+	for (int i = 0; i < N; ++i) ptr[i + 1] += ptr[i];
+	ind.resize(ptr[N]);
+	val.resize(ptr[N]);
+
+	// copy the values
+	#pragma omp parallel for schedule(guided)
+	for (int bi = 0; bi < m_nb; ++bi)
+	{
+		for (int r = 0; r < bs; ++r)
+		{
+			int I = m_poseq[bi*bs + r];
+			if (I < 0) continue;
+
+			int n = ptr[I];
+			for (int k = m_ptr[bi]; k < m_ptr[bi + 1]; ++k)
+			{
+				int bj = m_col[k];
+				const double* a = &m_val[0] + (k*bs + r)*bs;
+				for (int c = 0; c < bs; ++c)
+				{
+					int J = m_poseq[bj*bs + c];
+					if (J >= 0) { ind[n] = J; val[n] = a[c]; n++; }
+				}
+			}
+
+			// the block ordering need not match the equation ordering
+			if (m_identity == false)
+			{
+				vector< pair<int, double> > tmp(ptr[I + 1] - ptr[I]);
+				for (int l = ptr[I]; l < ptr[I + 1]; ++l) tmp[l - ptr[I]] = make_pair(ind[l], val[l]);
+				sort(tmp.begin(), tmp.end());
+				for (int l = ptr[I]; l < ptr[I + 1]; ++l) { ind[l] = tmp[l - ptr[I]].first; val[l] = tmp[l - ptr[I]].second; }
+			}
+		}
+	}
+}
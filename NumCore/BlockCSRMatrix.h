@@ -0,0 +1,149 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+#pragma once
+#include <FECore/SparseMatrix.h>
+#include <vector>
+
+class CSRMatrix;
+
+//=============================================================================
+//! This class stores a general sparse matrix in Block Compressed Row (BSR) format.
+
+//! The equations are grouped into small dense blocks (3x3 by default), one (or more) 
+//! per node, so that only one column index needs to be stored per block instead of 
+//! one per matrix entry. The equations of a node are not required to be numbered 
+//! consecutively, since the matrix maps the equations to block positions internally.
+//! Nodes with fewer dofs than the block size are padded with zeroes. Equations that 
+//! are not associated with a node are grouped in the order in which they appear.
+//! The blocks are stored row-major and both triangles are stored, which allows the
+//! matrix-vector product to be parallelized over the block rows without write conflicts.
+class BlockCSRMatrix : public SparseMatrix
+{
+public:
+	//! constructor
+	BlockCSRMatrix(int blockSize = 3);
+
+	//! Create the matrix structure from the SparseMatrixProfile
+	void Create(SparseMatrixProfile& mp) override;
+
+	//! set all matrix elements to zero
+	void Zero() override;
+
+	//! release memory for storing data
+	void Clear() override;
+
+	//! block formats need the equation-to-node map
+	bool UsesNodalStructure() const override { return true; }
+
+	//! set the node of each equation and group the equations into blocks
+	void SetNodalStructure(const std::vector<int>& eqnode) override;
+
+	//! return the block of each equation
+	bool EquationBlocks(std::vector<int>& eqblock) const override;
+
+	//! Create the matrix structure from a block profile
+	void CreateBlocks(SparseMatrixProfile& bp) override;
+
+	//! Assemble the element matrix into the global matrix
+	void Assemble(const matrix& ke, const std::vector<int>& lm) override;
+
+	//! assemble a matrix into the sparse matrix
+	void Assemble(const matrix& ke, const std::vector<int>& lmi, const std::vector<int>& lmj) override;
+
+	//! calculate the value offsets of an element matrix
+	bool ScatterMap(const std::vector<int>& lmi, const std::vector<int>& lmj, std::vector<int>& offsets) override;
+
+	//! assemble a matrix using the offsets calculated with ScatterMap
+	void AssembleScatter(const matrix& ke, const std::vector<int>& offsets) override;
+
+	//! see if a matrix element is defined
+	bool check(int i, int j) override;
+
+	//! set the matrix item
+	void set(int i, int j, double v) override;
+
+	//! add a value to the matrix item
+	void add(int i, int j, double v) override;
+
+	//! get a matrix item
+	double get(int i, int j) override;
+
+	//! return the diagonal value
+	double diag(int i) override;
+
+	//! scale matrix
+	void scale(const std::vector<double>& L, const std::vector<double>& R) override;
+
+	//! multiply with vector
+	bool mult_vector(double* x, double* r) override;
+
+	//! convert to a scalar CSR matrix (in the original equation numbering)
+	void ToCSR(CSRMatrix& A) const;
+
+public:
+	//! block size
+	int BlockSize() const { return m_bs; }
+
+	//! number of block rows
+	int BlockRows() const { return m_nb; }
+
+	//! number of nonzero blocks
+	int NonZeroBlocks() const { return (int)m_col.size(); }
+
+private:
+	// group the equations into blocks
+	void BuildBlocks(const std::vector<int>& eqnode);
+
+	// build the compressed structure from the (sorted) block columns of each block row
+	void BuildStructure(std::vector< std::vector<int> >& rows);
+
+	// find the block (bi, bj). Returns -1 if the block is not in the matrix
+	int findBlock(int bi, int bj) const;
+
+	// return the offset of entry (i,j) in the value array (or -1)
+	int offset(int i, int j) const;
+
+	// the block-space matrix-vector products
+	void mult3(const double* x, double* y) const;
+	void multN(const double* x, double* y) const;
+
+private:
+	int		m_bs;					//!< block size
+	int		m_nb;					//!< number of block rows (and columns)
+	bool	m_identity;				//!< equation numbers and block positions coincide
+
+	std::vector<int>	m_eqpos;	//!< block position of each equation
+	std::vector<int>	m_poseq;	//!< equation of each block position (-1 for padding)
+
+	std::vector<int>	m_ptr;		//!< start of each block row
+	std::vector<int>	m_col;		//!< block column indices
+	std::vector<double>	m_val;		//!< block values
+
+	std::vector<double>	m_x, m_y;	//!< block-space work vectors
+};
@@ -0,0 +1,232 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "CGSolver.h"
+#include "CompactSymmMatrix.h"
+#include "CompactUnSymmMatrix.h"
+#include "BlockCSRMatrix.h"
+#include <FECore/vector.h>
+#include <FECore/log.h>
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(CGSolver, IterativeLinearSolver)
+	ADD_PARAMETER(m_print_level  , "print_level");
+	ADD_PARAMETER(m_tol          , "tol");
+	ADD_PARAMETER(m_abstol       , "abs_tol");
+	ADD_PARAMETER(m_maxiter      , "max_iter");
+	ADD_PARAMETER(m_fail_max_iter, "fail_max_iters");
+	ADD_PARAMETER(m_blockMatrix  , "block_matrix");
+	ADD_PROPERTY(m_P, "pc_left", FEProperty::Optional);
+END_FECORE_CLASS();
+
+//-----------------------------------------------------------------------------
+CGSolver::CGSolver(FEModel* fem) : IterativeLinearSolver(fem), m_pA(0), m_P(0)
+{
+	m_maxiter = 0;
+	m_tol = 1e-5;
+	m_abstol = 0.0;
+	m_print_level = 0;
+	m_fail_max_iter = true;
+	m_blockMatrix = false;
+}
+
+//-----------------------------------------------------------------------------
+SparseMatrix* CGSolver::CreateSparseMatrix(Matrix_Type ntype)
+{
+	// the block format is used for both symmetric and unsymmetric matrices
+	if (m_blockMatrix)
+	{
+		m_pA = new BlockCSRMatrix(3);
+		if (m_P) m_P->SetSparseMatrix(m_pA);
+		return m_pA;
+	}
+
+	// let the preconditioner decide
+	m_pA = nullptr;
+	if (m_P)
+	{
+		m_P->SetPartitions(m_part);
+		m_pA = m_P->CreateSparseMatrix(ntype);
+	}
+
+	if (m_pA == nullptr)
+	{
+		if (ntype == REAL_SYMMETRIC) m_pA = new CompactSymmMatrix(0);
+		else m_pA = new CRSSparseMatrix(0);
+		if (m_P) m_P->SetSparseMatrix(m_pA);
+	}
+	return m_pA;
+}
+
+//-----------------------------------------------------------------------------
+bool CGSolver::SetSparseMatrix(SparseMatrix* A)
+{
+	m_pA = A;
+	if (m_P) m_P->SetSparseMatrix(A);
+	return (m_pA != 0);
+}
+
+//-----------------------------------------------------------------------------
+void CGSolver::SetLeftPreconditioner(LinearSolver* P)
+{
+	m_P = P;
+}
+
+//-----------------------------------------------------------------------------
+LinearSolver* CGSolver::GetLeftPreconditioner()
+{
+	return m_P;
+}
+
+//-----------------------------------------------------------------------------
+bool CGSolver::HasPreconditioner() const
+{
+	return (m_P != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+bool CGSolver::PreProcess()
+{
+	if (m_pA == nullptr) return false;
+	int N = m_pA->Rows();
+	m_r.resize(N);
+	m_z.resize(N);
+	m_p.resize(N);
+	m_q.resize(N);
+	return LinearSolver::PreProcess();
+}
+
+//-----------------------------------------------------------------------------
+bool CGSolver::Factor()
+{
+	if (m_pA == nullptr) return false;
+	if (m_P)
+	{
+		if (m_P->PreProcess() == false) return false;
+		if (m_P->Factor() == false) return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool CGSolver::BackSolve(double* x, double* b)
+{
+	if (m_pA == nullptr) return false;
+
+	SparseMatrix& A = *m_pA;
+	const int N = A.Rows();
+	if (N == 0) return true;
+	if ((int)m_r.size() != N) PreProcess();
+
+	double* r = &m_r[0];
+	double* z = &m_z[0];
+	double* p = &m_p[0];
+	double* q = &m_q[0];
+
+	// initial guess is zero, so r0 = b
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i) { x[i] = 0.0; r[i] = b[i]; }
+
+	double norm0 = sqrt(vdot(N, r, r));
+	if (norm0 == 0.0)
+	{
+		UpdateStats(0);
+		return true;
+	}
+	double tol = norm0*m_tol + m_abstol;
+
+	// z = P*r
+	if (m_P) m_P->BackSolve(z, r);
+	else
+	{
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) z[i] = r[i];
+	}
+
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i) p[i] = z[i];
+	double rz = vdot(N, r, z);
+
+	const int maxiter = (m_maxiter > 0 ? m_maxiter : N);
+	int iter = 0;
+	double normr = norm0;
+	bool converged = false;
+	while (iter < maxiter)
+	{
+		A.mult_vector(p, q);
+		double pq = vdot(N, p, q);
+		if (pq == 0.0) break;
+		double alpha = rz / pq;
+
+		// update solution and residual
+		double rr = 0.0;
+		#pragma omp parallel for reduction(+:rr)
+		for (int i = 0; i < N; ++i)
+		{
+			x[i] += alpha*p[i];
+			r[i] -= alpha*q[i];
+			rr += r[i] * r[i];
+		}
+		normr = sqrt(rr);
+		iter++;
+
+		if (m_print_level > 1) feLog("%d:%lg, %lg\n", iter, normr, tol);
+
+		if (normr <= tol) { converged = true; break; }
+
+		// apply preconditioner
+		if (m_P) m_P->BackSolve(z, r);
+		else
+		{
+			#pragma omp parallel for
+			for (int i = 0; i < N; ++i) z[i] = r[i];
+		}
+
+		double rz1 = vdot(N, r, z);
+		double beta = rz1 / rz;
+		rz = rz1;
+
+		vaxpby(N, 1.0, z, beta, p);
+	}
+
+	if (m_print_level == 1)
+	{
+		feLog("%d:%lg, %lg\n", iter, normr, norm0);
+	}
+
+	UpdateStats(iter);
+
+	return (m_fail_max_iter ? converged : true);
+}
+
+//-----------------------------------------------------------------------------
+void CGSolver::Destroy()
+{
+	if (m_P) m_P->Destroy();
+	LinearSolver::Destroy();
+}
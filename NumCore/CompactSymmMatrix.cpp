@@ -39,6 +39,9 @@ CompactSymmMatrix::CompactSymmMatrix(int offset) : CompactMatrix(offset)
 //-----------------------------------------------------------------------------
 bool CompactSymmMatrix::mult_vector(double* x, double* r)
 {
+	// use the multithreaded product when possible
+	if (ColumnProduct(x, r, true)) return true;
+
 	// get row count
 	int N = Rows();
 	int M = Columns();
@@ -220,8 +223,12 @@ void CompactSymmMatrix::Assemble(const matrix& ke, const vector<int>& LM)
 			for (; n<l; ++n)
 				if (pi[n] == I)
 				{
-					#pragma omp atomic
-					pm[n] += ke[i][j];
+					if (m_batomic)
+					{
+						#pragma omp atomic
+						pm[n] += ke[i][j];
+					}
+					else pm[n] += ke[i][j];
 					break;
 				}
 		}
@@ -256,8 +263,12 @@ void CompactSymmMatrix::Assemble(const matrix& ke, const vector<int>& LMi, const
 				for (int n = 0; n<l; ++n) 
 					if (pi[n] - m_offset == I)
 					{
-						#pragma omp atomic
-						pv[n] += ke[i][j];
+						if (m_batomic)
+						{
+							#pragma omp atomic
+							pv[n] += ke[i][j];
+						}
+						else pv[n] += ke[i][j];
 						break;
 					}
 			}
@@ -265,6 +276,25 @@ void CompactSymmMatrix::Assemble(const matrix& ke, const vector<int>& LMi, const
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Only the lower-triangular entries are assembled, consistent with Assemble above.
+bool CompactSymmMatrix::ScatterMap(const vector<int>& LMi, const vector<int>& LMj, vector<int>& offsets)
+{
+	const int N = (int)LMi.size();
+	const int M = (int)LMj.size();
+	offsets.assign(N*M, -1);
+	for (int i = 0; i<N; ++i)
+	{
+		int I = LMi[i];
+		for (int j = 0; j<M; ++j)
+		{
+			int J = LMj[j];
+			if ((I >= J) && (J >= 0)) offsets[i*M + j] = find(J, I);
+		}
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 //! add a matrix item
 void CompactSymmMatrix::add(int i, int j, double v)
@@ -288,8 +318,12 @@ void CompactSymmMatrix::add(int i, int j, double v)
 			int m = pi[n];
 			if (m == i)
 			{
-				#pragma omp atomic
-				pd[n] += v;
+				if (m_batomic)
+				{
+					#pragma omp atomic
+					pd[n] += v;
+				}
+				else pd[n] += v;
 				return;
 			}
 			else if (m < i)
@@ -346,8 +380,12 @@ void CompactSymmMatrix::set(int i, int j, double v)
 			{
 				int k = m_ppointers[j] + n;
 				k -= m_offset;
+				if (m_batomic)
+				{
 #pragma omp critical
-				m_pd[k] = v;
+					m_pd[k] = v;
+				}
+				else m_pd[k] = v;
 				return;
 			}
 
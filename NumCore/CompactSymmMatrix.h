@@ -50,6 +50,9 @@ public:
 	//! assemble a matrix into the sparse matrix
 	void Assemble(const matrix& ke, const vector<int>& lmi, const vector<int>& lmj) override;
 
+	//! calculate the value offsets of an element matrix
+	bool ScatterMap(const vector<int>& lmi, const vector<int>& lmj, vector<int>& offsets) override;
+
 	//! add a matrix item
 	void add(int i, int j, double v) override;
 
@@ -233,8 +233,12 @@ void CRSSparseMatrix::Assemble(const matrix& ke, const vector<int>& LM)
 			for (; n<l; ++n)
 				if (pi[n] == J)
 				{
+					if (m_batomic)
+					{
 #pragma omp atomic
-					pm[n] += kij;
+						pm[n] += kij;
+					}
+					else pm[n] += kij;
 					break;
 				}
 		}
@@ -261,6 +265,25 @@ void CRSSparseMatrix::Assemble(const matrix& ke, const vector<int>& LMi, const v
 	}
 }
 
+//-----------------------------------------------------------------------------
+bool CRSSparseMatrix::ScatterMap(const vector<int>& LMi, const vector<int>& LMj, vector<int>& offsets)
+{
+	const int N = (int)LMi.size();
+	const int M = (int)LMj.size();
+	offsets.assign(N*M, -1);
+	for (int i = 0; i<N; ++i)
+	{
+		int I = LMi[i];
+		if (I < 0) continue;
+		for (int j = 0; j<M; ++j)
+		{
+			int J = LMj[j];
+			if (J >= 0) offsets[i*M + j] = find(I, J);
+		}
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 // This algorithm uses a binary search for locating the correct row index
 // This assumes that the indices are ordered!
@@ -280,8 +303,12 @@ void CRSSparseMatrix::add(int i, int j, double v)
 		int m = pi[n];
 		if (m == j)
 		{
+			if (m_batomic)
+			{
 #pragma omp atomic
-			pd[n] += v;
+				pd[n] += v;
+			}
+			else pd[n] += v;
 			return;
 		}
 		else if (m < j)
@@ -308,8 +335,12 @@ void CRSSparseMatrix::set(int i, int j, double v)
 	{
 		if (pi[n] == j + m_offset)
 		{
+			if (m_batomic)
+			{
 #pragma omp critical
-			m_pd[m_ppointers[i] + n - m_offset] = v;
+				m_pd[m_ppointers[i] + n - m_offset] = v;
+			}
+			else m_pd[m_ppointers[i] + n - m_offset] = v;
 			return;
 		}
 	}
@@ -359,38 +390,34 @@ double CRSSparseMatrix::diag(int i)
 //-----------------------------------------------------------------------------
 bool CRSSparseMatrix::mult_vector(double* x, double* r)
 {
-#ifdef MKL_ISS
-
 	// get the matrix size
 	const int N = Rows();
 
+#ifdef MKL_ISS
 	if (Offset() == 1)
 	{
 		const char transa = 'N';
 		mkl_dcsrgemv(&transa, &N, m_pd, m_ppointers, m_pindices, x, r);
+		return true;
 	}
-	else
-	{
-		assert(m_offset == 0);
-		// loop over all rows
+#endif
+
+	// loop over all rows
 	#pragma omp parallel for schedule(guided)
-		for (int i = 0; i < N; ++i)
+	for (int i = 0; i < N; ++i)
+	{
+		const double* pv = m_pd + (m_ppointers[i] - m_offset);
+		const int* pi = m_pindices + (m_ppointers[i] - m_offset);
+		const int n = m_ppointers[i + 1] - m_ppointers[i];
+		double ri = 0.0;
+		for (int j = 0; j < n; j ++)
 		{
-			const double* pv = m_pd + (m_ppointers[i] - m_offset);
-			const int* pi = m_pindices + (m_ppointers[i] - m_offset);
-			const int n = m_ppointers[i + 1] - m_ppointers[i];
-			r[i] = 0.0;
-			for (int j = 0; j < n; j ++)
-			{
-				r[i] += (*pv++) * x[*pi++ - m_offset];
-			}
+			ri += pv[j] * x[pi[j] - m_offset];
 		}
+		r[i] = ri;
 	}
 
 	return true;
-#else
-	return false;
-#endif
 }
 
 //! calculate the abs row sum 
@@ -657,8 +684,12 @@ void CCSSparseMatrix::Assemble(const matrix& ke, const vector<int>& LM)
 			for (; n<l; ++n)
 				if (pi[n] == I)
 				{
+					if (m_batomic)
+					{
 #pragma omp atomic
-					pm[n] += ke[i][j];
+						pm[n] += ke[i][j];
+					}
+					else pm[n] += ke[i][j];
 					break;
 				}
 		}
@@ -685,6 +716,25 @@ void CCSSparseMatrix::Assemble(const matrix& ke, const vector<int>& LMi, const v
 	}
 }
 
+//-----------------------------------------------------------------------------
+bool CCSSparseMatrix::ScatterMap(const vector<int>& LMi, const vector<int>& LMj, vector<int>& offsets)
+{
+	const int N = (int)LMi.size();
+	const int M = (int)LMj.size();
+	offsets.assign(N*M, -1);
+	for (int i = 0; i<N; ++i)
+	{
+		int I = LMi[i];
+		if (I < 0) continue;
+		for (int j = 0; j<M; ++j)
+		{
+			int J = LMj[j];
+			if (J >= 0) offsets[i*M + j] = find(J, I);
+		}
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 // This algorithm uses a binary search for locating the correct row index
 // This assumes that the indices are ordered!
@@ -704,8 +754,12 @@ void CCSSparseMatrix::add(int i, int j, double v)
 		int m = pi[n];
 		if (m == i)
 		{
+			if (m_batomic)
+			{
 #pragma omp atomic
-			pd[n] += v;
+				pd[n] += v;
+			}
+			else pd[n] += v;
 			return;
 		}
 		else if (m < i)
@@ -731,8 +785,12 @@ void CCSSparseMatrix::set(int i, int j, double v)
 	{
 		if (pi[n] == i + m_offset)
 		{
+			if (m_batomic)
+			{
 #pragma omp critical
-			m_pd[m_ppointers[j] + n - m_offset] = v;
+				m_pd[m_ppointers[j] + n - m_offset] = v;
+			}
+			else m_pd[m_ppointers[j] + n - m_offset] = v;
 			return;
 		}
 	}
@@ -782,6 +840,9 @@ double CCSSparseMatrix::diag(int i)
 //-----------------------------------------------------------------------------
 bool CCSSparseMatrix::mult_vector(double* x, double* r)
 {
+	// use the multithreaded product when possible
+	if (ColumnProduct(x, r, false)) return true;
+
 	// get the matrix size
 	const int N = Rows();
 	const int M = Columns();
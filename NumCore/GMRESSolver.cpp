@@ -0,0 +1,292 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "GMRESSolver.h"
+#include "CompactSymmMatrix.h"
+#include "CompactUnSymmMatrix.h"
+#include "BlockCSRMatrix.h"
+#include <FECore/vector.h>
+#include <FECore/log.h>
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(GMRESSolver, IterativeLinearSolver)
+	ADD_PARAMETER(m_print_level  , "print_level");
+	ADD_PARAMETER(m_tol          , "tol");
+	ADD_PARAMETER(m_abstol       , "abs_tol");
+	ADD_PARAMETER(m_maxiter      , "max_iter");
+	ADD_PARAMETER(m_nrestart     , "max_restart");
+	ADD_PARAMETER(m_fail_max_iter, "fail_max_iters");
+	ADD_PARAMETER(m_blockMatrix  , "block_matrix");
+	ADD_PROPERTY(m_P, "pc_right", FEProperty::Optional);
+END_FECORE_CLASS();
+
+//-----------------------------------------------------------------------------
+GMRESSolver::GMRESSolver(FEModel* fem) : IterativeLinearSolver(fem), m_pA(0), m_P(0)
+{
+	m_maxiter = 0;
+	m_nrestart = 50;
+	m_tol = 1e-5;
+	m_abstol = 0.0;
+	m_print_level = 0;
+	m_fail_max_iter = true;
+	m_blockMatrix = false;
+}
+
+//-----------------------------------------------------------------------------
+SparseMatrix* GMRESSolver::CreateSparseMatrix(Matrix_Type ntype)
+{
+	// the block format is used for both symmetric and unsymmetric matrices
+	if (m_blockMatrix)
+	{
+		m_pA = new BlockCSRMatrix(3);
+		if (m_P) m_P->SetSparseMatrix(m_pA);
+		return m_pA;
+	}
+
+	// let the preconditioner decide
+	m_pA = nullptr;
+	if (m_P)
+	{
+		m_P->SetPartitions(m_part);
+		m_pA = m_P->CreateSparseMatrix(ntype);
+	}
+
+	if (m_pA == nullptr)
+	{
+		if (ntype == REAL_SYMMETRIC) m_pA = new CompactSymmMatrix(0);
+		else m_pA = new CRSSparseMatrix(0);
+		if (m_P) m_P->SetSparseMatrix(m_pA);
+	}
+	return m_pA;
+}
+
+//-----------------------------------------------------------------------------
+bool GMRESSolver::SetSparseMatrix(SparseMatrix* A)
+{
+	m_pA = A;
+	if (m_P) m_P->SetSparseMatrix(A);
+	return (m_pA != 0);
+}
+
+//-----------------------------------------------------------------------------
+void GMRESSolver::SetRightPreconditioner(LinearSolver* P)
+{
+	m_P = P;
+}
+
+//-----------------------------------------------------------------------------
+LinearSolver* GMRESSolver::GetRightPreconditioner()
+{
+	return m_P;
+}
+
+//-----------------------------------------------------------------------------
+bool GMRESSolver::HasPreconditioner() const
+{
+	return (m_P != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+bool GMRESSolver::PreProcess()
+{
+	if (m_pA == nullptr) return false;
+	int N = m_pA->Rows();
+	int m = (m_nrestart > 0 ? m_nrestart : 50);
+	if (m > N) m = N;
+	m_V.resize((size_t)(m + 1)*N);
+	m_H.resize((size_t)(m + 1)*m);
+	m_w.resize(N);
+	m_z.resize(N);
+	return LinearSolver::PreProcess();
+}
+
+//-----------------------------------------------------------------------------
+bool GMRESSolver::Factor()
+{
+	if (m_pA == nullptr) return false;
+	if (m_P)
+	{
+		if (m_P->PreProcess() == false) return false;
+		if (m_P->Factor() == false) return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool GMRESSolver::BackSolve(double* x, double* b)
+{
+	if (m_pA == nullptr) return false;
+
+	SparseMatrix& A = *m_pA;
+	const int N = A.Rows();
+	if (N == 0) return true;
+	if ((int)m_w.size() != N) PreProcess();
+
+	const int m = (int)(m_V.size() / N) - 1;
+	const int maxiter = (m_maxiter > 0 ? m_maxiter : N);
+	double* H = &m_H[0];
+	double* w = &m_w[0];
+	double* z = &m_z[0];
+	vector<double> cs(m), sn(m), g(m + 1), y(m);
+
+	// initial guess is zero, so r0 = b
+	double* v0 = &m_V[0];
+	#pragma omp parallel for
+	for (int i = 0; i < N; ++i) { x[i] = 0.0; v0[i] = b[i]; }
+
+	double beta = sqrt(vdot(N, v0, v0));
+	const double norm0 = beta;
+	if (norm0 == 0.0)
+	{
+		UpdateStats(0);
+		return true;
+	}
+	const double tol = norm0*m_tol + m_abstol;
+
+	int iter = 0;
+	double resid = beta;
+	bool converged = false;
+	while (true)
+	{
+		// v0 = r/|r|
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) v0[i] /= beta;
+
+		for (int i = 0; i <= m; ++i) g[i] = 0.0;
+		g[0] = beta;
+
+		// Arnoldi process
+		int k = 0;
+		for (int j = 0; j < m; ++j)
+		{
+			double* vj = &m_V[0] + (size_t)j*N;
+			double* vn = &m_V[0] + (size_t)(j + 1)*N;
+
+			// vn = A*P*vj
+			if (m_P)
+			{
+				m_P->BackSolve(z, vj);
+				A.mult_vector(z, vn);
+			}
+			else A.mult_vector(vj, vn);
+
+			// modified Gram-Schmidt
+			for (int i = 0; i <= j; ++i)
+			{
+				double* vi = &m_V[0] + (size_t)i*N;
+				double h = vdot(N, vn, vi);
+				H[i*m + j] = h;
+				vaxpy(N, -h, vi, vn);
+			}
+			double hn = sqrt(vdot(N, vn, vn));
+			H[(j + 1)*m + j] = hn;
+			if (hn != 0.0)
+			{
+				#pragma omp parallel for
+				for (int i = 0; i < N; ++i) vn[i] /= hn;
+			}
+
+			// apply the previous Givens rotations to the new column
+			for (int i = 0; i < j; ++i)
+			{
+				double hi = H[i*m + j], hi1 = H[(i + 1)*m + j];
+				H[i*m + j] = cs[i] * hi + sn[i] * hi1;
+				H[(i + 1)*m + j] = -sn[i] * hi + cs[i] * hi1;
+			}
+
+			// calculate the new rotation
+			double a = H[j*m + j], c = H[(j + 1)*m + j];
+			double d = sqrt(a*a + c*c);
+			if (d == 0.0) { cs[j] = 1.0; sn[j] = 0.0; }
+			else { cs[j] = a / d; sn[j] = c / d; }
+			H[j*m + j] = cs[j] * a + sn[j] * c;
+			H[(j + 1)*m + j] = 0.0;
+			g[j + 1] = -sn[j] * g[j];
+			g[j] = cs[j] * g[j];
+
+			resid = fabs(g[j + 1]);
+			iter++;
+			k = j + 1;
+
+			if (m_print_level > 1) feLog("%d:%lg, %lg\n", iter, resid, tol);
+
+			if (resid <= tol) { converged = true; break; }
+			if ((iter >= maxiter) || (hn == 0.0)) break;
+		}
+
+		// solve the upper triangular system H*y = g
+		for (int i = k - 1; i >= 0; --i)
+		{
+			double s = g[i];
+			for (int l = i + 1; l < k; ++l) s -= H[i*m + l] * y[l];
+			y[i] = (H[i*m + i] != 0.0 ? s / H[i*m + i] : 0.0);
+		}
+
+		// update solution x += P*V*y
+		const double* V = &m_V[0];
+		#pragma omp parallel for
+		for (int n = 0; n < N; ++n)
+		{
+			double s = 0.0;
+			for (int i = 0; i < k; ++i) s += y[i] * V[(size_t)i*N + n];
+			w[n] = s;
+		}
+		if (m_P)
+		{
+			m_P->BackSolve(z, w);
+			vaxpy(N, 1.0, z, x);
+		}
+		else vaxpy(N, 1.0, w, x);
+
+		if (converged || (iter >= maxiter)) break;
+
+		// restart with the true residual
+		A.mult_vector(x, w);
+		#pragma omp parallel for
+		for (int i = 0; i < N; ++i) v0[i] = b[i] - w[i];
+		beta = sqrt(vdot(N, v0, v0));
+		resid = beta;
+		if (beta <= tol) { converged = true; break; }
+	}
+
+	if (m_print_level == 1)
+	{
+		feLog("%d:%lg, %lg\n", iter, resid, norm0);
+	}
+
+	UpdateStats(iter);
+
+	return (m_fail_max_iter ? converged : true);
+}
+
+//-----------------------------------------------------------------------------
+void GMRESSolver::Destroy()
+{
+	if (m_P) m_P->Destroy();
+	LinearSolver::Destroy();
+}
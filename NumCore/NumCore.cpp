@@ -28,6 +28,10 @@ SOFTWARE.*/
 #include "SkylineSolver.h"
 #include "LUSolver.h"
 #include "PardisoSolver.h"
+#include "SupernodalSolver.h"
+#include "CGSolver.h"
+#include "GMRESSolver.h"
+#include "AMGPreconditioner.h"
 #include "RCICGSolver.h"
 #include "FGMRESSolver.h"
 #include "ILU0_Preconditioner.h"
@@ -52,6 +56,7 @@ void NumCore::InitModule()
 {
 	// register linear solvers
 	REGISTER_FECORE_CLASS(PardisoSolver  , "pardiso");
+	REGISTER_FECORE_CLASS(SupernodalSolver, "supernodal");
 	REGISTER_FECORE_CLASS(SkylineSolver  , "skyline");
 	REGISTER_FECORE_CLASS(LUSolver       , "LU"     );
 	REGISTER_FECORE_CLASS(FGMRESSolver        , "fgmres"   );
@@ -64,11 +69,14 @@ void NumCore::InitModule()
 	REGISTER_FECORE_CLASS(BIPNSolver          , "bipn");
 	REGISTER_FECORE_CLASS(BiCGStabSolver      , "bicgstab");
 	REGISTER_FECORE_CLASS(StrategySolver      , "strategy");
+	REGISTER_FECORE_CLASS(CGSolver            , "pcg");
+	REGISTER_FECORE_CLASS(GMRESSolver         , "gmres");
 
 	// register preconditioners
 	REGISTER_FECORE_CLASS(ILU0_Preconditioner, "ilu0");
 	REGISTER_FECORE_CLASS(ILUT_Preconditioner, "ilut");
 	REGISTER_FECORE_CLASS(IncompleteCholesky , "ichol");
+	REGISTER_FECORE_CLASS(AMGPreconditioner  , "amg");
 
 	// register eigen solvers
 	REGISTER_FECORE_CLASS(FEASTEigenSolver, "feast");
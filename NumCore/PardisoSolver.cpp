@@ -87,18 +87,19 @@ void print_err(int nerror)
 // PardisoSolver
 //////////////////////////////////////////////////////////////
 
-BEGIN_FECORE_CLASS(PardisoSolver, LinearSolver)
-	ADD_PARAMETER(m_print_cn, "print_condition_number");
-	ADD_PARAMETER(m_iparm3  , "precondition");
+BEGIN_FECORE_CLASS(PardisoSolver, MixedPrecisionSolver)
+	ADD_PARAMETER(m_print_cn , "print_condition_number");
+	ADD_PARAMETER(m_iparm3   , "precondition");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
-PardisoSolver::PardisoSolver(FEModel* fem) : LinearSolver(fem), m_pA(0)
+PardisoSolver::PardisoSolver(FEModel* fem) : MixedPrecisionSolver(fem), m_pA(0)
 {
 	m_print_cn = false;
 	m_mtype = -2;
 	m_iparm3 = false;
 	m_isFactored = false;
+	m_isAnalyzed = false;
 
 	/* If both PARDISO AND PARDISODL are defined, print a warning */
 #ifdef PARDISODL
@@ -110,7 +111,7 @@ PardisoSolver::PardisoSolver(FEModel* fem) : LinearSolver(fem), m_pA(0)
 //-----------------------------------------------------------------------------
 PardisoSolver::~PardisoSolver()
 {
-	Destroy();
+	Release();
 #ifdef PARDISO
 	MKL_Free_Buffers();
 #endif
@@ -131,6 +132,8 @@ void PardisoSolver::UseIterativeFactorization(bool b)
 //-----------------------------------------------------------------------------
 SparseMatrix* PardisoSolver::CreateSparseMatrix(Matrix_Type ntype)
 {
+	Release();
+
 	// allocate the correct matrix format depending on matrix symmetry type
 	switch (ntype)
 	{
@@ -148,7 +151,7 @@ SparseMatrix* PardisoSolver::CreateSparseMatrix(Matrix_Type ntype)
 //-----------------------------------------------------------------------------
 bool PardisoSolver::SetSparseMatrix(SparseMatrix* pA)
 {
-	if (m_pA && m_isFactored) Destroy();
+	if (m_pA && (m_isFactored || m_isAnalyzed)) Release();
 	m_pA = dynamic_cast<CompactMatrix*>(pA);
 	m_mtype = -2;
 	if (dynamic_cast<CRSSparseMatrix*>(pA)) m_mtype = 11;
@@ -158,12 +161,29 @@ bool PardisoSolver::SetSparseMatrix(SparseMatrix* pA)
 //-----------------------------------------------------------------------------
 bool PardisoSolver::PreProcess()
 {
+	// If the structure of the matrix did not change, we can keep the reordering and
+	// symbolic factorization of the previous matrix. This is not done for nonsymmetric
+	// matrices since the default scaling and matching depend on the matrix values. 
+	bool bsame = SamePattern(m_pA);
+	if (m_isAnalyzed && bsame && (m_mtype != 11) && (m_n == m_pA->Rows()) && (m_nnz == m_pA->NonZeroes()))
+	{
+		AnalysisReused();
+		return LinearSolver::PreProcess();
+	}
+
+	// release the previous analysis
+	Release();
+
 	m_iparm[0] = 0; /* Use default values for parameters */
 
 	//fprintf(stderr, "In PreProcess\n");
 	assert(m_isFactored == false);
 	pardisoinit(m_pt, &m_mtype, m_iparm);
 
+	// single precision factorization (this must be set before the analysis phase).
+	// Note that in this case all arrays passed to Pardiso must be single precision.
+	m_iparm[27] = (m_mixed ? 1 : 0);
+
 	m_n = m_pA->Rows();
 	m_nnz = m_pA->NonZeroes();
 	m_nrhs = 1;
@@ -188,20 +208,36 @@ bool PardisoSolver::Factor()
 
 // ------------------------------------------------------------------------------
 // Reordering and Symbolic Factorization.  This step also allocates all memory
-// that is necessary for the factorization.
+// that is necessary for the factorization. It only needs to be done once for
+// each matrix structure (except for nonsymmetric matrices, see PreProcess).
 // ------------------------------------------------------------------------------
 
 	int phase = 11;
-
 	int error = 0;
-	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
-		 NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
 
-	if (error)
+	// In mixed precision, Pardiso factors a single precision copy of the matrix.
+	void* a = m_pA->Values();
+	if (m_mixed)
 	{
-		fprintf(stderr, "\nERROR during symbolic factorization: ");
-		print_err(error);
-		exit(2);
+		const double* v = m_pA->Values();
+		m_af.resize(m_nnz);
+		for (int i = 0; i < m_nnz; ++i) m_af[i] = (float) v[i];
+		a = &m_af[0];
+	}
+
+	if ((m_isAnalyzed == false) || (m_mtype == 11))
+	{
+		pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, a, m_pA->Pointers(), m_pA->Indices(),
+			 NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
+
+		if (error)
+		{
+			fprintf(stderr, "\nERROR during symbolic factorization: ");
+			print_err(error);
+			exit(2);
+		}
+
+		m_isAnalyzed = true;
 	}
 
 // ------------------------------------------------------------------------------
@@ -212,7 +248,7 @@ bool PardisoSolver::Factor()
 
 	m_iparm[3] = (m_iparm3 ? 61 : 0);
 	error = 0;
-	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
+	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, a, m_pA->Pointers(), m_pA->Indices(),
 		 NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
 
 	if (error)
@@ -235,18 +271,29 @@ bool PardisoSolver::Factor()
 }
 
 //-----------------------------------------------------------------------------
-bool PardisoSolver::BackSolve(double* x, double* b)
+bool PardisoSolver::SolveFactor(double* x, double* b)
 {
-	// make sure we have work to do
-	if (m_pA->Rows() == 0) return true;
-
 	int phase = 33;
-
-	m_iparm[7] = 1;	/* Maximum number of iterative refinement steps */
-
 	int error = 0;
-	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
-		 NULL, &m_nrhs, m_iparm, &m_msglvl, b, x, &error);
+
+	if (m_mixed == false)
+	{
+		m_iparm[7] = 1;	// max number of iterative refinement steps
+		pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
+			 NULL, &m_nrhs, m_iparm, &m_msglvl, b, x, &error);
+	}
+	else
+	{
+		// Pardiso's own refinement would evaluate the residual in single precision, 
+		// so we turn it off and do the refinement in BackSolve.
+		m_iparm[7] = 0;
+		m_bf.resize(m_n);
+		m_xf.resize(m_n);
+		for (int i = 0; i < m_n; ++i) m_bf[i] = (float) b[i];
+		pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, &m_af[0], m_pA->Pointers(), m_pA->Indices(),
+			 NULL, &m_nrhs, m_iparm, &m_msglvl, &m_bf[0], &m_xf[0], &error);
+		for (int i = 0; i < m_n; ++i) x[i] = (double) m_xf[i];
+	}
 
 	if (error)
 	{
@@ -255,12 +302,26 @@ bool PardisoSolver::BackSolve(double* x, double* b)
 		exit(3);
 	}
 
-	// update stats
-	UpdateStats(1);
-
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+bool PardisoSolver::BackSolve(double* x, double* b)
+{
+	// make sure we have work to do
+	if (m_pA->Rows() == 0) return true;
+
+	SolveFactor(x, b);
+	if (m_mixed == false)
+	{
+		UpdateStats(1);
+		return true;
+	}
+
+	// refine the solution of the single precision factor
+	return RefineSolution(m_pA, x, b, [this](double* d, double* r) { return SolveFactor(d, r); });
+}
+
 //-----------------------------------------------------------------------------
 // This algorithm (naively) estimates the condition number. It is based on the observation that
 // for a linear system of equations A.x = b, the following holds
@@ -306,9 +367,12 @@ double PardisoSolver::condition_number()
 }
 
 //-----------------------------------------------------------------------------
+// This only releases the memory of the numerical factorization. The symbolic 
+// factorization is kept so that it can be reused when the matrix is recreated with 
+// the same structure. Call Release to free all internal memory.
 void PardisoSolver::Destroy()
 {
-	int phase = -1;
+	int phase = 0;
 
 	int error = 0;
 
@@ -318,19 +382,39 @@ void PardisoSolver::Destroy()
 			NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
 	}
 	m_isFactored = false;
+	std::vector<float>().swap(m_af);
+}
+
+//-----------------------------------------------------------------------------
+//! Release all internal memory
+void PardisoSolver::Release()
+{
+	int phase = -1;
+
+	int error = 0;
+
+	if (m_isFactored || m_isAnalyzed)
+	{
+		pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, NULL, NULL, NULL,
+			NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
+	}
+	m_isFactored = false;
+	m_isAnalyzed = false;
 }
 #else 
-BEGIN_FECORE_CLASS(PardisoSolver, LinearSolver)
+BEGIN_FECORE_CLASS(PardisoSolver, MixedPrecisionSolver)
 	ADD_PARAMETER(m_print_cn, "print_condition_number");
 	ADD_PARAMETER(m_iparm3, "precondition");
 END_FECORE_CLASS();
 
-PardisoSolver::PardisoSolver(FEModel* fem) : LinearSolver(fem) {}
+PardisoSolver::PardisoSolver(FEModel* fem) : MixedPrecisionSolver(fem) {}
 PardisoSolver::~PardisoSolver() {}
 bool PardisoSolver::PreProcess() { return false; }
 bool PardisoSolver::Factor() { return false; }
 bool PardisoSolver::BackSolve(double* x, double* y) { return false; }
+bool PardisoSolver::SolveFactor(double* x, double* y) { return false; }
 void PardisoSolver::Destroy() {}
+void PardisoSolver::Release() {}
 SparseMatrix* PardisoSolver::CreateSparseMatrix(Matrix_Type ntype) { return nullptr; }
 bool PardisoSolver::SetSparseMatrix(SparseMatrix* pA) { return false; }
 void PardisoSolver::PrintConditionNumber(bool b) {}
@@ -30,13 +30,14 @@ SOFTWARE.*/
 #include <FECore/LinearSolver.h>
 #include "CompactUnSymmMatrix.h"
 #include "CompactSymmMatrix.h"
+#include <vector>
 
 //! The Pardiso solver is included in the Intel Math Kernel Library (MKL).
 //! It can also be installed as a shared object library from
 //!		http://www.pardiso-project.org
 
 
-class PardisoSolver : public LinearSolver
+class PardisoSolver : public MixedPrecisionSolver
 {
 public:
 	PardisoSolver(FEModel* fem);
@@ -46,6 +47,9 @@ public:
 	bool BackSolve(double* x, double* y) override;
 	void Destroy() override;
 
+	//! release all internal memory (including the symbolic factorization)
+	void Release();
+
 	SparseMatrix* CreateSparseMatrix(Matrix_Type ntype) override;
 	bool SetSparseMatrix(SparseMatrix* pA) override;
 
@@ -55,6 +59,10 @@ public:
 
 	void UseIterativeFactorization(bool b);
 
+protected:
+	// solve with the current factorization (no refinement in mixed precision)
+	bool SolveFactor(double* x, double* b);
+
 protected:
 
 	CompactMatrix*	m_pA;
@@ -67,12 +75,16 @@ protected:
 
 	bool m_iparm3;	// use direct-iterative method
 
+	// single precision copies of the matrix values and the vectors (mixed precision only)
+	std::vector<float>	m_af, m_bf, m_xf;
+
 	// Matrix data
 	int m_n, m_nnz, m_nrhs;
 
 	bool	m_print_cn;	// estimate and print the condition number
 
 	bool	m_isFactored;
+	bool	m_isAnalyzed;	// the reordering and symbolic factorization are done
 
 	void* m_pt[64]; // Internal solver memory pointer
 
@@ -0,0 +1,921 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "SupernodalSolver.h"
+#include <FECore/log.h>
+#include <algorithm>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+using namespace std;
+
+//-----------------------------------------------------------------------------
+// subgraphs with fewer vertices than this are not dissected further
+#define ND_LEAF_SIZE	64
+
+//-----------------------------------------------------------------------------
+// Helper class for calculating a nested dissection ordering of a graph. 
+// The separators are level sets of a breadth-first search from a pseudo-peripheral vertex.
+class NestedDissection
+{
+public:
+	NestedDissection(const vector<int>& xadj, const vector<int>& adj, const vector<int>& w) : m_xadj(xadj), m_adj(adj), m_w(w)
+	{
+		int n = (int)xadj.size() - 1;
+		m_label.assign(n, -1);
+		m_level.assign(n, -1);
+		m_nlabel = 0;
+	}
+
+	void Apply(vector<int>& order)
+	{
+		int n = (int)m_xadj.size() - 1;
+		vector<int> S(n);
+		for (int i = 0; i < n; ++i) S[i] = i;
+		order.clear();
+		order.reserve(n);
+		Dissect(S, order);
+	}
+
+private:
+	// Breadth-first search from v, visiting the vertices labeled 'from' and relabeling them 'to'.
+	// Returns the number of levels.
+	int BFS(int v, int from, int to, vector<int>& queue)
+	{
+		queue.clear();
+		queue.push_back(v);
+		m_level[v] = 0;
+		m_label[v] = to;
+		int nlev = 1;
+		for (size_t q = 0; q < queue.size(); ++q)
+		{
+			int u = queue[q];
+			for (int k = m_xadj[u]; k < m_xadj[u + 1]; ++k)
+			{
+				int t = m_adj[k];
+				if (m_label[t] == from)
+				{
+					m_label[t] = to;
+					m_level[t] = m_level[u] + 1;
+					if (m_level[t] + 1 > nlev) nlev = m_level[t] + 1;
+					queue.push_back(t);
+				}
+			}
+		}
+		return nlev;
+	}
+
+	void Dissect(vector<int>& S, vector<int>& order)
+	{
+		int ns = (int)S.size();
+		if (ns <= ND_LEAF_SIZE)
+		{
+			order.insert(order.end(), S.begin(), S.end());
+			return;
+		}
+
+		// Each BFS uses a new label. Vertices of this subgraph carry the previous label.
+		vector<int> queue;
+		queue.reserve(ns);
+		int label = m_nlabel + 1;
+		for (int i = 0; i < ns; ++i) m_label[S[i]] = label;
+
+		// find a pseudo-peripheral vertex
+		int v = S[0];
+		int nlev = 0;
+		for (int iter = 0; iter < 3; ++iter)
+		{
+			label++;
+			int nl = BFS(v, label - 1, label, queue);
+			int vlast = queue.back();
+			if ((iter > 0) && (nl <= nlev)) { nlev = nl; break; }
+			nlev = nl;
+			if (iter < 2)
+			{
+				// reset the labels for the next search
+				for (int i = 0; i < ns; ++i) m_label[S[i]] = label;
+				v = vlast;
+			}
+		}
+		label++;
+		for (int i = 0; i < ns; ++i) m_label[S[i]] = label;
+		label++;
+		nlev = BFS(v, label - 1, label, queue);
+		m_nlabel = label;
+
+		// disconnected subgraph: order the components separately
+		if ((int)queue.size() < ns)
+		{
+			vector< vector<int> > comp(1, queue);
+			int unvisited = label - 1;
+			for (int i = 0; i < ns; ++i)
+			{
+				int u = S[i];
+				if (m_label[u] == unvisited)
+				{
+					label++;
+					BFS(u, unvisited, label, queue);
+					comp.push_back(queue);
+				}
+			}
+			m_nlabel = label;
+			vector<int>().swap(S);
+			for (size_t c = 0; c < comp.size(); ++c) Dissect(comp[c], order);
+			return;
+		}
+
+		// not enough levels to find a separator
+		if (nlev < 3)
+		{
+			order.insert(order.end(), S.begin(), S.end());
+			return;
+		}
+
+		// calculate level weights
+		vector<double> lw(nlev, 0.0);
+		double wtot = 0.0;
+		for (int i = 0; i < ns; ++i) { lw[m_level[S[i]]] += m_w[S[i]]; wtot += m_w[S[i]]; }
+
+		// find the median level
+		int lmed = 1;
+		double wc = lw[0];
+		while ((lmed < nlev - 2) && (wc + lw[lmed] < 0.5*wtot)) { wc += lw[lmed]; lmed++; }
+
+		// pick the smallest level near the median that keeps the parts balanced
+		int lsep = lmed;
+		wc = 0.0;
+		for (int l = 0; l < nlev; ++l)
+		{
+			if ((l >= 1) && (l <= nlev - 2) && (wc >= 0.3*wtot) && (wc + lw[l] <= 0.7*wtot))
+			{
+				if (lw[l] < lw[lsep]) lsep = l;
+			}
+			wc += lw[l];
+		}
+
+		vector<int> A, B, Sep;
+		for (int i = 0; i < ns; ++i)
+		{
+			int u = S[i];
+			int l = m_level[u];
+			if (l < lsep) A.push_back(u);
+			else if (l > lsep) B.push_back(u);
+			else Sep.push_back(u);
+		}
+		vector<int>().swap(S);
+
+		Dissect(A, order);
+		Dissect(B, order);
+		order.insert(order.end(), Sep.begin(), Sep.end());
+	}
+
+private:
+	const vector<int>&	m_xadj;
+	const vector<int>&	m_adj;
+	const vector<int>&	m_w;
+	vector<int>	m_label;
+	vector<int>	m_level;
+	int			m_nlabel;
+};
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(SupernodalSolver, MixedPrecisionSolver)
+	ADD_PARAMETER(m_print, "print_stats");
+	ADD_PARAMETER(m_pivotTol, FE_RANGE_GREATER_OR_EQUAL(0.0), "pivot_tol");
+	ADD_PARAMETER(m_pivotPerturb, "pivot_perturb");
+END_FECORE_CLASS();
+
+//-----------------------------------------------------------------------------
+SupernodalSolver::SupernodalSolver(FEModel* fem) : MixedPrecisionSolver(fem), m_pA(0)
+{
+	m_n = 0;
+	m_bsymbolic = false;
+	m_print = false;
+	m_pivotTol = 1e-13;
+	m_pivotPerturb = true;
+	m_pivotMin = 0.0;
+	m_nperturbed = 0;
+	m_nnegative = 0;
+}
+
+//-----------------------------------------------------------------------------
+SupernodalSolver::~SupernodalSolver()
+{
+	Destroy();
+}
+
+//-----------------------------------------------------------------------------
+//! Create a sparse matrix
+SparseMatrix* SupernodalSolver::CreateSparseMatrix(Matrix_Type ntype)
+{
+	m_bsymbolic = false;
+	return (m_pA = (ntype == REAL_SYMMETRIC ? new CompactSymmMatrix(0) : 0));
+}
+
+//-----------------------------------------------------------------------------
+bool SupernodalSolver::SetSparseMatrix(SparseMatrix* pA)
+{
+	m_pA = dynamic_cast<CompactSymmMatrix*>(pA);
+	m_bsymbolic = false;
+	return (m_pA != 0);
+}
+
+//-----------------------------------------------------------------------------
+bool SupernodalSolver::PreProcess()
+{
+	if (m_pA == 0) return false;
+
+	// If the structure of the matrix did not change, we can reuse the ordering
+	// and the symbolic factorization. 
+	bool bsame = SamePattern(m_pA);
+	if (m_bsymbolic && bsame && (m_n == m_pA->Rows()))
+	{
+		AnalysisReused();
+		return LinearSolver::PreProcess();
+	}
+
+	m_n = m_pA->Rows();
+	Ordering();
+	if (SymbolicFactorization() == false) return false;
+
+	if (m_print)
+	{
+		feLog("Supernodal solver: %d equations, %d supernodes, %lg nonzeroes in factor\n", m_n, Supernodes(), FactorSize());
+	}
+
+	return LinearSolver::PreProcess();
+}
+
+//-----------------------------------------------------------------------------
+// Calculate a fill-reducing ordering. Equations with identical adjacency (e.g. the 
+// degrees of freedom of a node) are grouped together before the dissection.
+void SupernodalSolver::Ordering()
+{
+	int n = m_n;
+	int off = m_pA->Offset();
+	int* pp = m_pA->Pointers();
+	int* pi = m_pA->Indices();
+
+	// build the adjacency graph (without diagonal)
+	vector<int> xadj(n + 1, 0);
+	for (int j = 0; j < n; ++j)
+	{
+		for (int k = pp[j] - off; k < pp[j + 1] - off; ++k)
+		{
+			int i = pi[k] - off;
+			if (i != j) { xadj[i + 1]++; xadj[j + 1]++; }
+		}
+	}
+	for (int i = 0; i < n; ++i) xadj[i + 1] += xadj[i];
+	vector<int> adj(xadj[n]);
+	vector<int> pos(xadj.begin(), xadj.end() - 1);
+	for (int j = 0; j < n; ++j)
+	{
+		for (int k = pp[j] - off; k < pp[j + 1] - off; ++k)
+		{
+			int i = pi[k] - off;
+			if (i != j) { adj[pos[i]++] = j; adj[pos[j]++] = i; }
+		}
+	}
+	for (int i = 0; i < n; ++i) sort(adj.begin() + xadj[i], adj.begin() + xadj[i + 1]);
+
+	// group consecutive equations with the same closed neighborhood
+	vector<int> group(n, 0);
+	int ng = 0;
+	for (int i = 0; i < n; ++i)
+	{
+		bool bsame = false;
+		if ((i > 0) && (xadj[i + 1] - xadj[i] == xadj[i] - xadj[i - 1]))
+		{
+			// compare adj(i) + {i} with adj(i-1) + {i-1}
+			const int* a = &adj[0] + xadj[i];
+			const int* b = &adj[0] + xadj[i - 1];
+			int na = xadj[i + 1] - xadj[i];
+			bsame = (binary_search(a, a + na, i - 1));
+			int ka = 0, kb = 0;
+			while (bsame && ((ka < na) || (kb < na)))
+			{
+				int va = (ka < na ? a[ka] : n); if (va == i - 1) { ka++; continue; }
+				int vb = (kb < na ? b[kb] : n); if (vb == i) { kb++; continue; }
+				if (va != vb) bsame = false;
+				ka++; kb++;
+			}
+		}
+		if (bsame == false) ng++;
+		group[i] = ng - 1;
+	}
+
+	// build the compressed graph
+	vector<int> gfirst(ng + 1, n), w(ng, 0);
+	for (int i = n - 1; i >= 0; --i) { gfirst[group[i]] = i; w[group[i]]++; }
+	vector<int> gxadj(ng + 1, 0), gadj;
+	gadj.reserve(xadj[n] / (n > 0 ? (n / ng) : 1) + ng);
+	vector<int> tag(ng, -1);
+	for (int g = 0; g < ng; ++g)
+	{
+		int i = gfirst[g];
+		tag[g] = g;
+		for (int k = xadj[i]; k < xadj[i + 1]; ++k)
+		{
+			int h = group[adj[k]];
+			if (tag[h] != g) { tag[h] = g; gadj.push_back(h); }
+		}
+		gxadj[g + 1] = (int)gadj.size();
+	}
+	vector<int>().swap(adj);
+	vector<int>().swap(xadj);
+
+	// nested dissection on the compressed graph
+	vector<int> gorder;
+	NestedDissection nd(gxadj, gadj, w);
+	nd.Apply(gorder);
+
+	// expand the ordering
+	m_perm.resize(n);
+	m_iperm.resize(n);
+	int m = 0;
+	for (int k = 0; k < ng; ++k)
+	{
+		int g = gorder[k];
+		for (int i = gfirst[g]; i < gfirst[g] + w[g]; ++i) m_perm[m++] = i;
+	}
+	assert(m == n);
+	for (int i = 0; i < n; ++i) m_iperm[m_perm[i]] = i;
+}
+
+//-----------------------------------------------------------------------------
+// The symbolic factorization calculates the elimination tree, the supernodes and their
+// row structure, and the maps that are used for assembling the frontal matrices.
+bool SupernodalSolver::SymbolicFactorization()
+{
+	int n = m_n;
+	int off = m_pA->Offset();
+	int* pp = m_pA->Pointers();
+	int* pi = m_pA->Indices();
+
+	vector<int> parent(n), post(n);
+	vector<int> cptr, crow, cval, rptr, rcol;
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		// permuted lower triangular pattern (by column) and its transpose (by row)
+		cptr.assign(n + 1, 0);
+		rptr.assign(n + 1, 0);
+		for (int jo = 0; jo < n; ++jo)
+		{
+			for (int k = pp[jo] - off; k < pp[jo + 1] - off; ++k)
+			{
+				int i = m_iperm[pi[k] - off], j = m_iperm[jo];
+				if (i < j) { int t = i; i = j; j = t; }
+				cptr[j + 1]++;
+				if (i != j) rptr[i + 1]++;
+			}
+		}
+		for (int i = 0; i < n; ++i) { cptr[i + 1] += cptr[i]; rptr[i + 1] += rptr[i]; }
+		crow.resize(cptr[n]); cval.resize(cptr[n]); rcol.resize(rptr[n]);
+		vector<int> cp(cptr.begin(), cptr.end() - 1), rp(rptr.begin(), rptr.end() - 1);
+		for (int jo = 0; jo < n; ++jo)
+		{
+			for (int k = pp[jo] - off; k < pp[jo + 1] - off; ++k)
+			{
+				int i = m_iperm[pi[k] - off], j = m_iperm[jo];
+				if (i < j) { int t = i; i = j; j = t; }
+				crow[cp[j]] = i; cval[cp[j]++] = k;
+				if (i != j) rcol[rp[i]++] = j;
+			}
+		}
+
+		// elimination tree
+		vector<int> anc(n, -1);
+		for (int i = 0; i < n; ++i)
+		{
+			parent[i] = -1;
+			for (int k = rptr[i]; k < rptr[i + 1]; ++k)
+			{
+				int r = rcol[k];
+				while ((anc[r] != -1) && (anc[r] != i)) { int t = anc[r]; anc[r] = i; r = t; }
+				if (anc[r] == -1) { anc[r] = i; parent[r] = i; }
+			}
+		}
+
+		if (pass == 1) break;
+
+		// postorder the tree so that the supernodes are contiguous
+		vector<int> head(n, -1), next(n, -1), stack;
+		for (int j = n - 1; j >= 0; --j)
+		{
+			if (parent[j] != -1) { next[j] = head[parent[j]]; head[parent[j]] = j; }
+		}
+		int k = 0;
+		for (int j = 0; j < n; ++j)
+		{
+			if (parent[j] != -1) continue;
+			stack.push_back(j);
+			while (!stack.empty())
+			{
+				int p = stack.back();
+				int c = head[p];
+				if (c == -1) { stack.pop_back(); post[k++] = p; }
+				else { head[p] = next[c]; stack.push_back(c); }
+			}
+		}
+
+		// apply the postordering
+		vector<int> perm(n);
+		for (int i = 0; i < n; ++i) perm[i] = m_perm[post[i]];
+		m_perm = perm;
+		for (int i = 0; i < n; ++i) m_iperm[m_perm[i]] = i;
+	}
+
+	// column counts of L
+	vector<int> cc(n, 1), mark(n, -1);
+	for (int i = 0; i < n; ++i)
+	{
+		mark[i] = i;
+		for (int k = rptr[i]; k < rptr[i + 1]; ++k)
+		{
+			int r = rcol[k];
+			while (mark[r] != i) { cc[r]++; mark[r] = i; r = parent[r]; }
+		}
+	}
+	vector<int>().swap(rptr);
+	vector<int>().swap(rcol);
+
+	// fundamental supernodes
+	vector<int> nchild(n, 0);
+	for (int j = 0; j < n; ++j) if (parent[j] != -1) nchild[parent[j]]++;
+	m_sfirst.clear();
+	vector<int> snode(n);
+	for (int j = 0; j < n; ++j)
+	{
+		if ((j == 0) || (parent[j - 1] != j) || (cc[j - 1] != cc[j] + 1) || (nchild[j] != 1)) m_sfirst.push_back(j);
+		snode[j] = (int)m_sfirst.size() - 1;
+	}
+	int ns = (int)m_sfirst.size();
+	m_sfirst.push_back(n);
+
+	// supernodal tree
+	vector<int> sparent(ns, -1);
+	for (int s = 0; s < ns; ++s)
+	{
+		int p = parent[m_sfirst[s + 1] - 1];
+		sparent[s] = (p == -1 ? -1 : snode[p]);
+	}
+	m_schildptr.assign(ns + 1, 0);
+	for (int s = 0; s < ns; ++s) if (sparent[s] != -1) m_schildptr[sparent[s] + 1]++;
+	for (int s = 0; s < ns; ++s) m_schildptr[s + 1] += m_schildptr[s];
+	m_schild.resize(m_schildptr[ns]);
+	vector<int> cp(m_schildptr.begin(), m_schildptr.end() - 1);
+	for (int s = 0; s < ns; ++s) if (sparent[s] != -1) m_schild[cp[sparent[s]]++] = s;
+
+	// row structure of the supernodes and the assembly maps
+	m_sptr.assign(ns + 1, 0);
+	for (int s = 0; s < ns; ++s) m_sptr[s + 1] = m_sptr[s] + cc[m_sfirst[s]];
+	m_srow.resize(m_sptr[ns]);
+	m_aptr.assign(ns + 1, 0);
+	m_aval.resize(cptr[n]);
+	m_apos.resize(cptr[n]);
+	m_cptr.assign(ns + 1, 0);
+	m_cmap.clear();
+	mark.assign(n, -1);
+	vector<int> rpos(n, -1);
+	for (int s = 0; s < ns; ++s)
+	{
+		int f = m_sfirst[s], l = m_sfirst[s + 1] - 1;
+		int* rows = &m_srow[0] + m_sptr[s];
+		int m = m_sptr[s + 1] - m_sptr[s];
+		int nr = 0;
+		for (int j = f; j <= l; ++j) { rows[nr++] = j; mark[j] = s; }
+		for (int j = f; j <= l; ++j)
+		{
+			for (int k = cptr[j]; k < cptr[j + 1]; ++k)
+			{
+				int i = crow[k];
+				if (mark[i] != s) { if (nr >= m) return false; mark[i] = s; rows[nr++] = i; }
+			}
+		}
+		for (int k = m_schildptr[s]; k < m_schildptr[s + 1]; ++k)
+		{
+			int c = m_schild[k];
+			int kc = m_sfirst[c + 1] - m_sfirst[c];
+			for (int q = m_sptr[c] + kc; q < m_sptr[c + 1]; ++q)
+			{
+				int i = m_srow[q];
+				if (mark[i] != s) { if (nr >= m) return false; mark[i] = s; rows[nr++] = i; }
+			}
+		}
+		if (nr != m) return false;
+		sort(rows + (l - f + 1), rows + m);
+		for (int q = 0; q < m; ++q) rpos[rows[q]] = q;
+
+		// assembly map of the matrix entries
+		int na = m_aptr[s];
+		for (int j = f; j <= l; ++j)
+		{
+			for (int k = cptr[j]; k < cptr[j + 1]; ++k)
+			{
+				m_aval[na] = cval[k];
+				m_apos[na] = rpos[crow[k]] + (j - f)*m;
+				na++;
+			}
+		}
+		m_aptr[s + 1] = na;
+
+		// location of the children's update rows in this front
+		for (int k = m_schildptr[s]; k < m_schildptr[s + 1]; ++k)
+		{
+			int c = m_schild[k];
+			int kc = m_sfirst[c + 1] - m_sfirst[c];
+			for (int q = m_sptr[c] + kc; q < m_sptr[c + 1]; ++q) m_cmap.push_back(rpos[m_srow[q]]);
+		}
+		m_cptr[s + 1] = (int)m_cmap.size();
+	}
+
+	// group the supernodes by tree level (leaves are level 0)
+	vector<int> lev(ns, 0);
+	int nlev = 0;
+	for (int s = 0; s < ns; ++s)
+	{
+		if (sparent[s] != -1) lev[sparent[s]] = max(lev[sparent[s]], lev[s] + 1);
+		nlev = max(nlev, lev[s] + 1);
+	}
+	m_levptr.assign(nlev + 1, 0);
+	for (int s = 0; s < ns; ++s) m_levptr[lev[s] + 1]++;
+	for (int l = 0; l < nlev; ++l) m_levptr[l + 1] += m_levptr[l];
+	m_sorder.resize(ns);
+	cp.assign(m_levptr.begin(), m_levptr.end() - 1);
+	for (int s = 0; s < ns; ++s) m_sorder[cp[lev[s]]++] = s;
+
+	// storage for the factor
+	m_lptr.assign(ns + 1, 0);
+	for (int s = 0; s < ns; ++s)
+	{
+		size_t k = m_sfirst[s + 1] - m_sfirst[s];
+		size_t m = m_sptr[s + 1] - m_sptr[s];
+		m_lptr[s + 1] = m_lptr[s] + m*k;
+	}
+	vector<double>().swap(m_L);
+	vector<float>().swap(m_Lf);
+	m_tmp.resize(n);
+
+	m_bsymbolic = true;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SupernodalSolver::Factor()
+{
+	if (m_bsymbolic == false) return false;
+
+	int ns = Supernodes();
+	int nlev = (int)m_levptr.size() - 1;
+	vector< vector<double> > upd(ns);
+
+	// allocate the factor (it is released by Destroy)
+	if (m_mixed)
+	{
+		vector<double>().swap(m_L);
+		if (m_Lf.size() != m_lptr[ns]) m_Lf.resize(m_lptr[ns]);
+	}
+	else
+	{
+		vector<float>().swap(m_Lf);
+		if (m_L.size() != m_lptr[ns]) m_L.resize(m_lptr[ns]);
+	}
+
+	int nthreads = 1;
+#ifdef _OPENMP
+	nthreads = omp_get_max_threads();
+#endif
+
+	// the pivot threshold is relative to the largest diagonal entry
+	double dmax = 0.0;
+	for (int i = 0; i < m_n; ++i)
+	{
+		double di = fabs(m_pA->diag(i));
+		if (di > dmax) dmax = di;
+	}
+	m_pivotMin = m_pivotTol*dmax;
+	m_nperturbed = 0;
+	m_nnegative = 0;
+
+	// process the tree level by level. Supernodes on the same level are independent.
+	bool bok = true;
+	for (int l = 0; l < nlev; ++l)
+	{
+		int l0 = m_levptr[l], l1 = m_levptr[l + 1];
+		if (l1 - l0 >= nthreads)
+		{
+			#pragma omp parallel for schedule(dynamic)
+			for (int k = l0; k < l1; ++k)
+			{
+				if (FactorSupernode(m_sorder[k], &upd[0], false) == false) bok = false;
+			}
+		}
+		else
+		{
+			// few (large) supernodes, so we parallelize within the supernode
+			for (int k = l0; k < l1; ++k)
+			{
+				if (FactorSupernode(m_sorder[k], &upd[0], true) == false) bok = false;
+			}
+		}
+		if (bok == false) return false;
+	}
+
+	if (m_nperturbed > 0)
+	{
+		feLogWarning("Supernodal solver: %d small pivots were perturbed (threshold = %lg).", m_nperturbed, m_pivotMin);
+	}
+	if (m_print && (m_nnegative > 0))
+	{
+		feLog("Supernodal solver: %d negative pivots (matrix is indefinite)\n", m_nnegative);
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Check the pivot of column j of supernode s. A pivot whose magnitude is below the 
+// threshold is replaced by the threshold value (with the same sign), or makes the 
+// factorization fail when perturbation is turned off.
+bool SupernodalSolver::CheckPivot(int s, int j, double& d)
+{
+	if (d < 0.0)
+	{
+		#pragma omp atomic
+		m_nnegative++;
+	}
+
+	if (fabs(d) > m_pivotMin) return true;
+
+	int col = m_sfirst[s] + j;
+	int eq = m_perm[col];
+	if (m_pivotPerturb && (m_pivotMin > 0.0))
+	{
+		int n;
+		#pragma omp atomic capture
+		n = m_nperturbed++;
+
+		// only report the first few
+		if (n < 10)
+		{
+			#pragma omp critical (supernodal_log)
+			feLogWarning("Supernodal solver: small pivot %lg in supernode %d, column %d (equation %d) was perturbed.", d, s, col, eq);
+		}
+		d = (d < 0.0 ? -m_pivotMin : m_pivotMin);
+		return true;
+	}
+
+	#pragma omp critical (supernodal_log)
+	feLogError("Supernodal solver: pivot %lg in supernode %d, column %d (equation %d) is below the threshold %lg.", d, s, col, eq, m_pivotMin);
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Assemble and partially factor the frontal matrix of supernode s.
+bool SupernodalSolver::FactorSupernode(int s, vector<double>* upd, bool bpar)
+{
+	const double* A = m_pA->Values();
+	int f = m_sfirst[s];
+	int k = m_sfirst[s + 1] - f;
+	int m = m_sptr[s + 1] - m_sptr[s];
+	int mu = m - k;
+
+	// assemble the frontal matrix (column major, lower triangle)
+	vector<double> F((size_t)m*m, 0.0);
+	double* pF = &F[0];
+	for (int i = m_aptr[s]; i < m_aptr[s + 1]; ++i) pF[m_apos[i]] += A[m_aval[i]];
+
+	// extend-add the update matrices of the children
+	const int* cmap = (m_cmap.empty() ? 0 : &m_cmap[0] + m_cptr[s]);
+	for (int ic = m_schildptr[s]; ic < m_schildptr[s + 1]; ++ic)
+	{
+		int c = m_schild[ic];
+		int mc = (m_sptr[c + 1] - m_sptr[c]) - (m_sfirst[c + 1] - m_sfirst[c]);
+		const double* U = &upd[c][0];
+		for (int q = 0; q < mc; ++q)
+		{
+			double* Fq = pF + (size_t)cmap[q] * m;
+			const double* Uq = U + (size_t)q*mc;
+			for (int p = q; p < mc; ++p) Fq[cmap[p]] += Uq[p];
+		}
+		cmap += mc;
+		vector<double>().swap(upd[c]);
+	}
+
+	// factor the first k columns (left-looking within the panel)
+	vector<double> t(k);
+	for (int j = 0; j < k; ++j)
+	{
+		double* Fj = pF + (size_t)j*m;
+		for (int p = 0; p < j; ++p)
+		{
+			const double* Fp = pF + (size_t)p*m;
+			double a = Fp[j] * Fp[p];
+			if (a == 0.0) continue;
+			for (int i = j; i < m; ++i) Fj[i] -= a*Fp[i];
+		}
+		double d = Fj[j];
+		if (CheckPivot(s, j, d) == false) return false;
+		Fj[j] = d;
+		double di = 1.0 / d;
+		for (int i = j + 1; i < m; ++i) Fj[i] *= di;
+	}
+
+	// store the factor
+	if (m_mixed)
+	{
+		float* L = &m_Lf[0] + m_lptr[s];
+		for (int j = 0; j < k; ++j)
+		{
+			const double* Fj = pF + (size_t)j*m;
+			for (int i = 0; i < m; ++i) L[(size_t)j*m + i] = (float) Fj[i];
+		}
+	}
+	else
+	{
+		double* L = &m_L[0] + m_lptr[s];
+		for (int j = 0; j < k; ++j)
+		{
+			const double* Fj = pF + (size_t)j*m;
+			for (int i = 0; i < m; ++i) L[(size_t)j*m + i] = Fj[i];
+		}
+	}
+
+	if (mu == 0) return true;
+
+	// calculate the update matrix U = F22 - L21*D*L21t
+	// (W = L21*D is stored row-wise so that a block of columns of U can be updated at once)
+	vector<double> W((size_t)mu*k);
+	for (int j = 0; j < k; ++j)
+	{
+		const double* Lj = pF + (size_t)j*m + k;
+		double d = pF[(size_t)j*m + j];
+		for (int i = 0; i < mu; ++i) W[(size_t)i*k + j] = Lj[i] * d;
+	}
+
+	vector<double>& U = upd[s];
+	U.resize((size_t)mu*mu);
+	double* pU = &U[0];
+	const double* pW = &W[0];
+	int nb = (mu + 3) / 4;
+	#pragma omp parallel for schedule(dynamic) if (bpar)
+	for (int ib = 0; ib < nb; ++ib)
+	{
+		int q0 = 4 * ib;
+		int nq = (mu - q0 < 4 ? mu - q0 : 4);
+
+		// copy the columns of F22 (only the lower part is used)
+		for (int q = q0; q < q0 + nq; ++q)
+		{
+			const double* Fq = pF + (size_t)(k + q)*m + k;
+			double* Uq = pU + (size_t)q*mu;
+			for (int p = q0; p < mu; ++p) Uq[p] = Fq[p];
+		}
+
+		double* U0 = pU + (size_t)q0*mu;
+		double* U1 = (nq > 1 ? U0 + mu : 0);
+		double* U2 = (nq > 2 ? U0 + 2*mu : 0);
+		double* U3 = (nq > 3 ? U0 + 3*mu : 0);
+		for (int r = 0; r < k; ++r)
+		{
+			const double* Lr = pF + (size_t)r*m + k;
+			double a0 = pW[(size_t)q0*k + r];
+			if (nq == 4)
+			{
+				double a1 = pW[(size_t)(q0 + 1)*k + r];
+				double a2 = pW[(size_t)(q0 + 2)*k + r];
+				double a3 = pW[(size_t)(q0 + 3)*k + r];
+				for (int p = q0; p < mu; ++p)
+				{
+					double l = Lr[p];
+					U0[p] -= a0*l;
+					U1[p] -= a1*l;
+					U2[p] -= a2*l;
+					U3[p] -= a3*l;
+				}
+			}
+			else
+			{
+				for (int p = q0; p < mu; ++p) U0[p] -= a0*Lr[p];
+				if (U1) { double a1 = pW[(size_t)(q0 + 1)*k + r]; for (int p = q0; p < mu; ++p) U1[p] -= a1*Lr[p]; }
+				if (U2) { double a2 = pW[(size_t)(q0 + 2)*k + r]; for (int p = q0; p < mu; ++p) U2[p] -= a2*Lr[p]; }
+			}
+		}
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SupernodalSolver::BackSolve(double* x, double* b)
+{
+	if (m_bsymbolic == false) return false;
+
+	if (m_mixed == false)
+	{
+		Solve(&m_L[0], x, b);
+		UpdateStats(1);
+		return true;
+	}
+
+	// solve with the single precision factor and refine the solution
+	Solve(&m_Lf[0], x, b);
+	return RefineSolution(m_pA, x, b, [this](double* d, double* r) {
+		Solve(&m_Lf[0], d, r);
+		return true;
+	});
+}
+
+//-----------------------------------------------------------------------------
+// Forward and backward substitution with the factor L (which is either stored
+// in single or double precision). The solution is always calculated in double.
+template <typename T> void SupernodalSolver::Solve(const T* pL, double* x, const double* b)
+{
+	int n = m_n;
+	int ns = Supernodes();
+	double* y = &m_tmp[0];
+	for (int i = 0; i < n; ++i) y[i] = b[m_perm[i]];
+
+	// forward substitution
+	for (int s = 0; s < ns; ++s)
+	{
+		int f = m_sfirst[s], k = m_sfirst[s + 1] - f;
+		int m = m_sptr[s + 1] - m_sptr[s];
+		const int* rows = &m_srow[0] + m_sptr[s];
+		const T* L = pL + m_lptr[s];
+		for (int j = 0; j < k; ++j)
+		{
+			const T* Lj = L + (size_t)j*m;
+			double yj = y[f + j];
+			if (yj == 0.0) continue;
+			for (int i = j + 1; i < k; ++i) y[f + i] -= Lj[i] * yj;
+			for (int i = k; i < m; ++i) y[rows[i]] -= Lj[i] * yj;
+		}
+	}
+
+	// diagonal
+	for (int s = 0; s < ns; ++s)
+	{
+		int f = m_sfirst[s], k = m_sfirst[s + 1] - f;
+		int m = m_sptr[s + 1] - m_sptr[s];
+		const T* L = pL + m_lptr[s];
+		for (int j = 0; j < k; ++j) y[f + j] /= L[(size_t)j*m + j];
+	}
+
+	// backward substitution
+	for (int s = ns - 1; s >= 0; --s)
+	{
+		int f = m_sfirst[s], k = m_sfirst[s + 1] - f;
+		int m = m_sptr[s + 1] - m_sptr[s];
+		const int* rows = &m_srow[0] + m_sptr[s];
+		const T* L = pL + m_lptr[s];
+		for (int j = k - 1; j >= 0; --j)
+		{
+			const T* Lj = L + (size_t)j*m;
+			double sum = 0.0;
+			for (int i = j + 1; i < k; ++i) sum += Lj[i] * y[f + i];
+			for (int i = k; i < m; ++i) sum += Lj[i] * y[rows[i]];
+			y[f + j] -= sum;
+		}
+	}
+
+	for (int i = 0; i < n; ++i) x[m_perm[i]] = y[i];
+}
+
+//-----------------------------------------------------------------------------
+// This only releases the numeric factor. The symbolic factorization is kept so
+// that it can be reused if the matrix is recreated with the same structure.
+void SupernodalSolver::Destroy()
+{
+	vector<double>().swap(m_L);
+	vector<float>().swap(m_Lf);
+	LinearSolver::Destroy();
+}
@@ -0,0 +1,129 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include <FECore/LinearSolver.h>
+#include "CompactSymmMatrix.h"
+
+//-----------------------------------------------------------------------------
+//! Built-in sparse direct solver for symmetric matrices.
+
+//! This solver calculates an LDLt factorization (without pivoting) of a 
+//! CompactSymmMatrix. The equations are reordered with a nested dissection
+//! ordering, and the symbolic analysis (elimination tree, supernodes, and the 
+//! assembly maps) is done in PreProcess, so it is reused for all factorizations
+//! with the same matrix profile (also after the matrix was recreated with an
+//! unchanged structure). The numeric factorization is multifrontal and 
+//! processes independent branches of the supernodal elimination tree in parallel.
+//! In mixed precision mode, the factor is stored in single precision (which halves
+//! the factor memory) and the solution is improved by iterative refinement until 
+//! the relative residual (calculated in double precision) reaches refine_tol.
+//! Since there is no pivoting, pivots that are small compared to the largest 
+//! diagonal entry of the matrix (relative threshold pivot_tol) are either perturbed
+//! to the threshold value (as Pardiso does) or cause the factorization to fail.
+class SupernodalSolver : public MixedPrecisionSolver
+{
+public:
+	//! constructor
+	SupernodalSolver(FEModel* fem);
+
+	//! destructor
+	~SupernodalSolver();
+
+	//! Preprocess (ordering and symbolic factorization)
+	bool PreProcess() override;
+
+	//! Factor matrix (numeric factorization)
+	bool Factor() override;
+
+	//! Backsolve the linear system
+	bool BackSolve(double* x, double* b) override;
+
+	//! Clean up
+	void Destroy() override;
+
+	//! Create a sparse matrix
+	SparseMatrix* CreateSparseMatrix(Matrix_Type ntype) override;
+
+	//! Set the sparse matrix
+	bool SetSparseMatrix(SparseMatrix* pA) override;
+
+public:
+	//! number of nonzeroes in the factor
+	double FactorSize() const { return (double) (m_lptr.empty() ? 0 : m_lptr.back()); }
+
+	//! number of supernodes
+	int Supernodes() const { return (int)m_sfirst.size() - 1; }
+
+private:
+	void Ordering();
+	bool SymbolicFactorization();
+	bool FactorSupernode(int s, std::vector<double>* upd, bool bpar);
+	bool CheckPivot(int s, int j, double& d);
+	template <typename T> void Solve(const T* L, double* x, const double* b);
+
+private:
+	CompactSymmMatrix*	m_pA;	//!< the matrix
+	int					m_n;	//!< nr of equations
+
+	std::vector<int>	m_perm;		//!< new to old equation numbers
+	std::vector<int>	m_iperm;	//!< old to new equation numbers
+
+	// supernodes
+	std::vector<int>	m_sfirst;	//!< first column of each supernode (plus one entry for end)
+	std::vector<int>	m_sptr;		//!< offset into m_srow for each supernode
+	std::vector<int>	m_srow;		//!< row structure of the supernodes
+	std::vector<int>	m_schildptr;//!< offset into m_schild for each supernode
+	std::vector<int>	m_schild;	//!< child supernodes
+	std::vector<int>	m_sorder;	//!< supernodes sorted by tree level
+	std::vector<int>	m_levptr;	//!< offset into m_sorder for each level
+
+	// assembly maps
+	std::vector<int>	m_aptr;		//!< offset into m_aval and m_apos for each supernode
+	std::vector<int>	m_aval;		//!< index into the matrix values
+	std::vector<int>	m_apos;		//!< location in the frontal matrix
+	std::vector<int>	m_cptr;		//!< offset into m_cmap for each supernode
+	std::vector<int>	m_cmap;		//!< location of the update rows in the parent front
+
+	// numeric factor
+	std::vector<size_t>	m_lptr;		//!< offset into m_L for each supernode
+	std::vector<double>	m_L;		//!< the factor (column major blocks per supernode)
+	std::vector<float>	m_Lf;		//!< the factor in single precision (mixed precision mode)
+
+	std::vector<double>	m_tmp;		//!< work vector for backsolve
+
+	bool	m_bsymbolic;	//!< symbolic factorization is valid
+	bool	m_print;		//!< print factorization statistics
+	double	m_pivotTol;		//!< relative pivot threshold
+	bool	m_pivotPerturb;	//!< perturb small pivots (or fail if false)
+
+	double	m_pivotMin;		//!< absolute pivot threshold of the current factorization
+	int		m_nperturbed;	//!< number of perturbed pivots in the current factorization
+	int		m_nnegative;	//!< number of negative pivots in the current factorization
+
+	DECLARE_FECORE_CLASS();
+};